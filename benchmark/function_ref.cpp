@@ -0,0 +1,108 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/reference.hpp>
+
+#include <functional>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace ts = type_safe;
+
+namespace
+{
+    int add_one(int i)
+    {
+        return i + 1;
+    }
+
+    std::vector<int> make_values(std::size_t size)
+    {
+        std::vector<int> result;
+        result.reserve(size);
+        for (auto i = 0u; i != size; ++i)
+            result.push_back(static_cast<int>((i * 7u) % 128u));
+        return result;
+    }
+
+    // the callbacks are passed to a function that isn't a template,
+    // like it would be done across a library boundary
+    template <typename Callback>
+    int transform_sum(const std::vector<int>& values, Callback f)
+    {
+        auto sum = 0;
+        for (auto value : values)
+            sum += f(value);
+        return sum;
+    }
+
+    int sum_function_ptr(const std::vector<int>& values, int (*f)(int))
+    {
+        return transform_sum(values, f);
+    }
+
+    int sum_std_function(const std::vector<int>& values, const std::function<int(int)>& f)
+    {
+        return transform_sum(values, std::ref(f));
+    }
+
+    int sum_function_ref(const std::vector<int>& values, ts::function_ref<int(int)> f)
+    {
+        return transform_sum(values, f);
+    }
+
+    void function_ref_call_function_ptr(benchmark::State& state)
+    {
+        auto values = make_values(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+            benchmark::DoNotOptimize(sum_function_ptr(values, &add_one));
+    }
+    BENCHMARK(function_ref_call_function_ptr)->Arg(1024);
+
+    void function_ref_call_std_function(benchmark::State& state)
+    {
+        auto values = make_values(static_cast<std::size_t>(state.range(0)));
+        auto offset = static_cast<int>(state.range(0));
+        for (auto _ : state)
+            benchmark::DoNotOptimize(sum_std_function(values, [&](int i) { return i + offset; }));
+    }
+    BENCHMARK(function_ref_call_std_function)->Arg(1024);
+
+    void function_ref_call_function_ref(benchmark::State& state)
+    {
+        auto values = make_values(static_cast<std::size_t>(state.range(0)));
+        auto offset = static_cast<int>(state.range(0));
+        for (auto _ : state)
+        {
+            auto f = [&](int i) { return i + offset; };
+            benchmark::DoNotOptimize(sum_function_ref(values, ts::function_ref<int(int)>(f)));
+        }
+    }
+    BENCHMARK(function_ref_call_function_ref)->Arg(1024);
+
+    // creating the callback, std::function may need to allocate for bigger captures
+    void function_ref_create_std_function(benchmark::State& state)
+    {
+        int a = 1, b = 2, c = 3, d = 4;
+        for (auto _ : state)
+        {
+            std::function<int(int)> f([a, b, c, d](int i) { return i + a + b + c + d; });
+            benchmark::DoNotOptimize(f);
+        }
+    }
+    BENCHMARK(function_ref_create_std_function);
+
+    void function_ref_create_function_ref(benchmark::State& state)
+    {
+        int a = 1, b = 2, c = 3, d = 4;
+        for (auto _ : state)
+        {
+            auto lambda = [a, b, c, d](int i) { return i + a + b + c + d; };
+            ts::function_ref<int(int)> f(lambda);
+            benchmark::DoNotOptimize(f);
+        }
+    }
+    BENCHMARK(function_ref_create_function_ref);
+} // namespace
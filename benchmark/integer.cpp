@@ -0,0 +1,95 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/integer.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace ts = type_safe;
+
+namespace
+{
+    template <typename Int>
+    std::vector<Int> make_values(std::size_t size)
+    {
+        std::vector<Int> result;
+        result.reserve(size);
+        for (auto i = 0u; i != size; ++i)
+            result.push_back(Int(static_cast<int>(i % 128u)));
+        return result;
+    }
+
+    template <typename Int>
+    void integer_construct(benchmark::State& state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        for (auto _ : state)
+        {
+            auto values = make_values<Int>(size);
+            benchmark::DoNotOptimize(values.data());
+        }
+    }
+    BENCHMARK_TEMPLATE(integer_construct, int)->Arg(1024);
+    BENCHMARK_TEMPLATE(integer_construct, ts::integer<int>)->Arg(1024);
+
+    template <typename Int>
+    void integer_sum(benchmark::State& state)
+    {
+        auto values = make_values<Int>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            Int sum(0);
+            for (auto& value : values)
+                sum += value;
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+    BENCHMARK_TEMPLATE(integer_sum, int)->Arg(1024);
+    BENCHMARK_TEMPLATE(integer_sum, ts::integer<int>)->Arg(1024);
+    BENCHMARK_TEMPLATE(integer_sum, ts::integer<int, ts::checked_arithmetic>)->Arg(1024);
+
+    template <typename Int>
+    void integer_multiply(benchmark::State& state)
+    {
+        auto values = make_values<Int>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            for (auto& value : values)
+                benchmark::DoNotOptimize(value * value);
+        }
+    }
+    BENCHMARK_TEMPLATE(integer_multiply, int)->Arg(1024);
+    BENCHMARK_TEMPLATE(integer_multiply, ts::integer<int>)->Arg(1024);
+    BENCHMARK_TEMPLATE(integer_multiply, ts::integer<int, ts::checked_arithmetic>)->Arg(1024);
+
+    template <typename Int>
+    void integer_copy(benchmark::State& state)
+    {
+        auto values = make_values<Int>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto copy = values;
+            benchmark::DoNotOptimize(copy.data());
+        }
+    }
+    BENCHMARK_TEMPLATE(integer_copy, int)->Arg(1024);
+    BENCHMARK_TEMPLATE(integer_copy, ts::integer<int>)->Arg(1024);
+
+    template <typename Int>
+    void integer_sort(benchmark::State& state)
+    {
+        auto values = make_values<Int>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto copy = values;
+            std::sort(copy.begin(), copy.end());
+            benchmark::DoNotOptimize(copy.data());
+        }
+    }
+    BENCHMARK_TEMPLATE(integer_sort, int)->Arg(1024);
+    BENCHMARK_TEMPLATE(integer_sort, ts::integer<int>)->Arg(1024);
+} // namespace
@@ -0,0 +1,86 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/optional.hpp>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace ts = type_safe;
+
+namespace
+{
+    // what one would write without type_safe
+    struct raw_optional
+    {
+        int  value;
+        bool has_value;
+
+        raw_optional() : value(0), has_value(false) {}
+
+        raw_optional(int v) : value(v), has_value(true) {}
+    };
+
+    int value_or(const raw_optional& opt, int fallback)
+    {
+        return opt.has_value ? opt.value : fallback;
+    }
+
+    int value_or(const ts::optional<int>& opt, int fallback)
+    {
+        return opt.value_or(fallback);
+    }
+
+    template <typename Optional>
+    std::vector<Optional> make_values(std::size_t size)
+    {
+        std::vector<Optional> result;
+        result.reserve(size);
+        for (auto i = 0u; i != size; ++i)
+            result.push_back(i % 3u == 0u ? Optional() : Optional(static_cast<int>(i)));
+        return result;
+    }
+
+    template <typename Optional>
+    void optional_construct(benchmark::State& state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        for (auto _ : state)
+        {
+            auto values = make_values<Optional>(size);
+            benchmark::DoNotOptimize(values.data());
+        }
+    }
+    BENCHMARK_TEMPLATE(optional_construct, raw_optional)->Arg(1024);
+    BENCHMARK_TEMPLATE(optional_construct, ts::optional<int>)->Arg(1024);
+
+    template <typename Optional>
+    void optional_value_or(benchmark::State& state)
+    {
+        auto values = make_values<Optional>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto sum = 0;
+            for (auto& value : values)
+                sum += value_or(value, 1);
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+    BENCHMARK_TEMPLATE(optional_value_or, raw_optional)->Arg(1024);
+    BENCHMARK_TEMPLATE(optional_value_or, ts::optional<int>)->Arg(1024);
+
+    template <typename Optional>
+    void optional_copy(benchmark::State& state)
+    {
+        auto values = make_values<Optional>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto copy = values;
+            benchmark::DoNotOptimize(copy.data());
+        }
+    }
+    BENCHMARK_TEMPLATE(optional_copy, raw_optional)->Arg(1024);
+    BENCHMARK_TEMPLATE(optional_copy, ts::optional<int>)->Arg(1024);
+} // namespace
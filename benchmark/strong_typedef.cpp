@@ -0,0 +1,61 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/strong_typedef.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace ts = type_safe;
+
+namespace
+{
+    struct meter : ts::strong_typedef<meter, int>,
+                   ts::strong_typedef_op::addition<meter>,
+                   ts::strong_typedef_op::relational_comparison<meter>
+    {
+        using strong_typedef::strong_typedef;
+    };
+
+    template <typename T>
+    std::vector<T> make_values(std::size_t size)
+    {
+        std::vector<T> result;
+        result.reserve(size);
+        for (auto i = 0u; i != size; ++i)
+            result.push_back(T(static_cast<int>((i * 7u) % 128u)));
+        return result;
+    }
+
+    template <typename T>
+    void strong_typedef_sum(benchmark::State& state)
+    {
+        auto values = make_values<T>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            T sum(0);
+            for (auto& value : values)
+                sum += value;
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+    BENCHMARK_TEMPLATE(strong_typedef_sum, int)->Arg(1024);
+    BENCHMARK_TEMPLATE(strong_typedef_sum, meter)->Arg(1024);
+
+    template <typename T>
+    void strong_typedef_sort(benchmark::State& state)
+    {
+        auto values = make_values<T>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto copy = values;
+            std::sort(copy.begin(), copy.end());
+            benchmark::DoNotOptimize(copy.data());
+        }
+    }
+    BENCHMARK_TEMPLATE(strong_typedef_sort, int)->Arg(1024);
+    BENCHMARK_TEMPLATE(strong_typedef_sort, meter)->Arg(1024);
+} // namespace
@@ -0,0 +1,130 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/visitor.hpp>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace ts = type_safe;
+
+namespace
+{
+    // what one would write without type_safe
+    struct raw_variant
+    {
+        enum kind_t
+        {
+            int_kind,
+            double_kind,
+            float_kind,
+        } kind;
+        union
+        {
+            int    i;
+            double d;
+            float  f;
+        };
+
+        raw_variant(int value) : kind(int_kind), i(value) {}
+        raw_variant(double value) : kind(double_kind), d(value) {}
+        raw_variant(float value) : kind(float_kind), f(value) {}
+    };
+
+    using ts_variant = ts::variant<int, double, float>;
+
+    struct visitor
+    {
+        double operator()(int i) const
+        {
+            return i;
+        }
+        double operator()(double d) const
+        {
+            return d;
+        }
+        double operator()(float f) const
+        {
+            return f;
+        }
+    };
+
+    double visit_value(const raw_variant& var)
+    {
+        switch (var.kind)
+        {
+        case raw_variant::int_kind:
+            return visitor{}(var.i);
+        case raw_variant::double_kind:
+            return visitor{}(var.d);
+        case raw_variant::float_kind:
+            return visitor{}(var.f);
+        }
+        return 0.;
+    }
+
+    double visit_value(const ts_variant& var)
+    {
+        return ts::visit(visitor{}, var);
+    }
+
+    template <typename Variant>
+    std::vector<Variant> make_values(std::size_t size)
+    {
+        std::vector<Variant> result;
+        result.reserve(size);
+        for (auto i = 0u; i != size; ++i)
+        {
+            if (i % 3u == 0u)
+                result.push_back(Variant(static_cast<int>(i)));
+            else if (i % 3u == 1u)
+                result.push_back(Variant(static_cast<double>(i)));
+            else
+                result.push_back(Variant(static_cast<float>(i)));
+        }
+        return result;
+    }
+
+    template <typename Variant>
+    void variant_construct(benchmark::State& state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        for (auto _ : state)
+        {
+            auto values = make_values<Variant>(size);
+            benchmark::DoNotOptimize(values.data());
+        }
+    }
+    BENCHMARK_TEMPLATE(variant_construct, raw_variant)->Arg(1024);
+    BENCHMARK_TEMPLATE(variant_construct, ts_variant)->Arg(1024);
+
+    template <typename Variant>
+    void variant_visit(benchmark::State& state)
+    {
+        auto values = make_values<Variant>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto sum = 0.;
+            for (auto& value : values)
+                sum += visit_value(value);
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+    BENCHMARK_TEMPLATE(variant_visit, raw_variant)->Arg(1024);
+    BENCHMARK_TEMPLATE(variant_visit, ts_variant)->Arg(1024);
+
+    template <typename Variant>
+    void variant_copy(benchmark::State& state)
+    {
+        auto values = make_values<Variant>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto copy = values;
+            benchmark::DoNotOptimize(copy.data());
+        }
+    }
+    BENCHMARK_TEMPLATE(variant_copy, raw_variant)->Arg(1024);
+    BENCHMARK_TEMPLATE(variant_copy, ts_variant)->Arg(1024);
+} // namespace
@@ -0,0 +1,37 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_COMPILE_BENCHMARK_HPP_INCLUDED
+#define TYPE_SAFE_COMPILE_BENCHMARK_HPP_INCLUDED
+
+#include <cstddef>
+
+#include <type_safe/detail/index_sequence.hpp>
+
+// the number of types or instantiations a benchmark creates,
+// set by measure.cmake for each run
+#ifndef TYPE_SAFE_COMPILE_BENCHMARK_SIZE
+#define TYPE_SAFE_COMPILE_BENCHMARK_SIZE 8
+#endif
+
+namespace compile_benchmark
+{
+    constexpr std::size_t size = TYPE_SAFE_COMPILE_BENCHMARK_SIZE;
+
+    using indices = type_safe::detail::make_index_sequence<size>;
+
+    // calls Use<I>::run() for all I in [0, size),
+    // so each benchmark only has to write the code for one I
+    template <template <std::size_t> class Use, std::size_t... Is>
+    int run_all(type_safe::detail::index_sequence<Is...>)
+    {
+        int results[] = {0, Use<Is>::run()...};
+        auto sum      = 0;
+        for (auto r : results)
+            sum += r;
+        return sum;
+    }
+} // namespace compile_benchmark
+
+#endif // TYPE_SAFE_COMPILE_BENCHMARK_HPP_INCLUDED
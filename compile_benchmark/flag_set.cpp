@@ -0,0 +1,55 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// `size` flag sets with their operators
+
+#include <type_safe/flag_set.hpp>
+
+#include "benchmark.hpp"
+
+namespace ts = type_safe;
+
+template <std::size_t I>
+struct flags
+{
+    enum class type
+    {
+        a,
+        b,
+        c,
+        d,
+        e,
+        f,
+        _flag_set_size
+    };
+};
+
+template <std::size_t I>
+struct use
+{
+    static int run()
+    {
+        using flag = typename flags<I>::type;
+
+        ts::flag_set<flag> set(flag::a | flag::b);
+        set.set(flag::c);
+        set.reset(flag::a);
+        set.toggle(flag::d);
+        set |= flag::e | flag::f;
+        set &= ~flag::b & ~flag::e;
+        set ^= flag::a;
+
+        auto result = static_cast<int>(set.count());
+        if (set == flag::c || set.any_of(flag::a | flag::d) || (set & flag::f))
+            ++result;
+        for (auto f : set)
+            result += static_cast<int>(f);
+        return result;
+    }
+};
+
+int type_safe_compile_benchmark()
+{
+    return compile_benchmark::run_all<use>(compile_benchmark::indices{});
+}
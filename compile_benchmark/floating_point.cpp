@@ -0,0 +1,47 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// `size` functions using the operators of all floating point types,
+// mixed with each other and the built-in types
+
+#include <type_safe/floating_point.hpp>
+
+#include "benchmark.hpp"
+
+namespace ts = type_safe;
+
+// the I is only needed to instantiate each function anew
+template <typename T, typename U, std::size_t I>
+int use_floating_point()
+{
+    ts::floating_point<T> a(T(1));
+    ts::floating_point<U> b(U(2));
+    a += a;
+    b -= a;
+    a = a * a + T(1) - a / a;
+    b *= U(2);
+    b /= b;
+
+    auto result = 0;
+    if (a < b || T(1) <= a || a > U(2) || b >= a)
+        ++result;
+    return result;
+}
+
+template <std::size_t I>
+struct use
+{
+    static int run()
+    {
+        return use_floating_point<float, float, I>() + use_floating_point<float, double, I>()
+               + use_floating_point<double, double, I>()
+               + use_floating_point<double, long double, I>()
+               + use_floating_point<long double, long double, I>();
+    }
+};
+
+int type_safe_compile_benchmark()
+{
+    return compile_benchmark::run_all<use>(compile_benchmark::indices{});
+}
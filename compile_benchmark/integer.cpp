@@ -0,0 +1,56 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// the operators of `size` integer types with distinct policies,
+// mixed with the built-in types
+
+#include <cstdint>
+
+#include <type_safe/integer.hpp>
+
+#include "benchmark.hpp"
+
+namespace ts = type_safe;
+
+// a distinct policy for each I so every use creates new integer types
+template <std::size_t I>
+class policy : public ts::checked_arithmetic
+{
+};
+
+template <typename T, std::size_t I>
+int use_integer()
+{
+    using integer = ts::integer<T, policy<I>>;
+
+    integer a(T(1));
+    integer b(T(2));
+    a += b;
+    a -= T(1);
+    a = a * b + T(1) - b / b % b;
+    ++a;
+    a++;
+
+    auto result = 0;
+    if (a == b || a != T(0) || a < b || T(1) <= a || a > b || a >= T(2))
+        ++result;
+    return result + static_cast<int>(static_cast<T>(a));
+}
+
+template <std::size_t I>
+struct use
+{
+    static int run()
+    {
+        return use_integer<std::int8_t, I>() + use_integer<std::uint8_t, I>()
+               + use_integer<std::int16_t, I>() + use_integer<std::uint16_t, I>()
+               + use_integer<std::int32_t, I>() + use_integer<std::uint32_t, I>()
+               + use_integer<std::int64_t, I>() + use_integer<std::uint64_t, I>();
+    }
+};
+
+int type_safe_compile_benchmark()
+{
+    return compile_benchmark::run_all<use>(compile_benchmark::indices{});
+}
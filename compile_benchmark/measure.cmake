@@ -0,0 +1,119 @@
+# Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+# This file is subject to the license terms in the LICENSE file
+# found in the top-level directory of this distribution.
+
+# compiles SOURCE once for each size and reports the time and memory it took
+#
+# Clang writes a -ftime-trace file for each run and reports the time of the template instantiations
+# as well as the time and memory of the whole process (-fproc-stat-report),
+# GCC reports the same numbers using -ftime-report.
+#
+# expected variables:
+# COMPILER - the C++ compiler
+# COMPILER_ID - the CMAKE_CXX_COMPILER_ID of the compiler
+# NAME - the name of the benchmark
+# SOURCE - the benchmark source file
+# SIZES - the values of TYPE_SAFE_COMPILE_BENCHMARK_SIZE separated by '|'
+# OUTPUT - directory for the object files, trace files and the NAME.csv with the results
+# INCLUDE_DIRS - include directories separated by '|'
+
+string(REPLACE "|" ";" sizes "${SIZES}")
+string(REPLACE "|" ";" include_dirs "${INCLUDE_DIRS}")
+set(flags -std=c++11 -O0 -c
+          -DTYPE_SAFE_ENABLE_ASSERTIONS=0 -DTYPE_SAFE_ENABLE_PRECONDITION_CHECKS=1
+          -DTYPE_SAFE_ENABLE_WRAPPER=1 -DTYPE_SAFE_ARITHMETIC_UB=1)
+foreach(dir ${include_dirs})
+    list(APPEND flags -I${dir})
+endforeach()
+
+if(COMPILER_ID MATCHES "Clang")
+    list(APPEND flags -ftime-trace -fproc-stat-report)
+elseif(COMPILER_ID STREQUAL "GNU")
+    list(APPEND flags -ftime-report)
+else()
+    message(FATAL_ERROR "compile-time benchmarks require Clang or GCC")
+endif()
+
+# sums the durations of the given "Total ..." events in a -ftime-trace file, in ms
+function(_type_safe_trace_duration file events result)
+    file(READ ${file} trace)
+    set(sum 0)
+    foreach(event ${events})
+        if(trace MATCHES "\"dur\":([0-9]+),\"name\":\"Total ${event}\"")
+            math(EXPR sum "${sum} + ${CMAKE_MATCH_1}")
+        endif()
+    endforeach()
+    math(EXPR sum "${sum} / 1000") # trace is in us
+    set(${result} ${sum} PARENT_SCOPE)
+endfunction()
+
+# converts a time in seconds with a fractional part to ms
+function(_type_safe_seconds_to_ms seconds result)
+    if(seconds MATCHES "^([0-9]+)\\.([0-9]+)$")
+        string(SUBSTRING "${CMAKE_MATCH_2}000" 0 3 fraction)
+        math(EXPR ms "${CMAKE_MATCH_1} * 1000 + 1${fraction} - 1000")
+        set(${result} ${ms} PARENT_SCOPE)
+    else()
+        set(${result} "${seconds}" PARENT_SCOPE)
+    endif()
+endfunction()
+
+# converts a memory amount as printed by GCC to kB
+function(_type_safe_memory_to_kb memory result)
+    if(memory MATCHES "^([0-9]+)([kMG]?)")
+        set(kb ${CMAKE_MATCH_1})
+        if(CMAKE_MATCH_2 STREQUAL "M")
+            math(EXPR kb "${kb} * 1024")
+        elseif(CMAKE_MATCH_2 STREQUAL "G")
+            math(EXPR kb "${kb} * 1024 * 1024")
+        endif()
+        set(${result} ${kb} PARENT_SCOPE)
+    else()
+        set(${result} "${memory}" PARENT_SCOPE)
+    endif()
+endfunction()
+
+set(csv "size,total_ms,instantiation_ms,memory_kb\n")
+message(STATUS "${NAME}:")
+message(STATUS "    size    total [ms]    instantiation [ms]    memory [kB]")
+foreach(size ${sizes})
+    set(object ${OUTPUT}/${NAME}_${size}.o)
+    execute_process(COMMAND ${COMPILER} ${flags} -DTYPE_SAFE_COMPILE_BENCHMARK_SIZE=${size}
+                            ${SOURCE} -o ${object}
+                    RESULT_VARIABLE result
+                    OUTPUT_VARIABLE output
+                    ERROR_VARIABLE error)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "unable to compile ${SOURCE} with size ${size}:\n${error}")
+    endif()
+    set(report "${output}${error}")
+
+    set(total "?")
+    set(instantiation "?")
+    set(memory "?")
+    if(COMPILER_ID MATCHES "Clang")
+        if(report MATCHES "total=([0-9.]+) ms")
+            string(REGEX REPLACE "\\..*" "" total "${CMAKE_MATCH_1}")
+        endif()
+        if(report MATCHES "mem=([0-9]+) Kb")
+            set(memory ${CMAKE_MATCH_1})
+        endif()
+        # trace file is named after the object file
+        _type_safe_trace_duration(${OUTPUT}/${NAME}_${size}.json
+                                  "InstantiateClass;InstantiateFunction" instantiation)
+    else()
+        # columns are usr, sys, wall and memory, with percentages except for the total
+        if(report MATCHES "TOTAL[ \t]*:[ \t]*[0-9.]+[ \t]+[0-9.]+[ \t]+([0-9.]+)[ \t]+([0-9]+ ?[kMG]?)")
+            _type_safe_seconds_to_ms(${CMAKE_MATCH_1} total)
+            _type_safe_memory_to_kb("${CMAKE_MATCH_2}" memory)
+        endif()
+        if(report MATCHES "template instantiation[ \t]*:[ \t]*[0-9.]+[ \t]*\\([ 0-9]+%\\)[ \t]*[0-9.]+[ \t]*\\([ 0-9]+%\\)[ \t]*([0-9.]+)")
+            _type_safe_seconds_to_ms(${CMAKE_MATCH_1} instantiation)
+        endif()
+    endif()
+
+    set(csv "${csv}${size},${total},${instantiation},${memory}\n")
+    message(STATUS "    ${size}\t    ${total}\t\t  ${instantiation}\t\t\t${memory}")
+endforeach()
+
+file(WRITE ${OUTPUT}/${NAME}.csv "${csv}")
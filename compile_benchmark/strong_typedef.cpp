@@ -0,0 +1,65 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// `size` strong typedefs with all the arithmetic and comparison mixins
+
+#include <type_safe/strong_typedef.hpp>
+
+#include "benchmark.hpp"
+
+namespace ts = type_safe;
+
+template <std::size_t I>
+struct integer : ts::strong_typedef<integer<I>, int>,
+                 ts::strong_typedef_op::equality_comparison<integer<I>>,
+                 ts::strong_typedef_op::relational_comparison<integer<I>>,
+                 ts::strong_typedef_op::integer_arithmetic<integer<I>>,
+                 ts::strong_typedef_op::bitmask<integer<I>>,
+                 ts::strong_typedef_op::bitshift<integer<I>, int>,
+                 ts::strong_typedef_op::mixed_addition<integer<I>, int>,
+                 ts::strong_typedef_op::mixed_multiplication<integer<I>, int>
+{
+    using ts::strong_typedef<integer<I>, int>::strong_typedef;
+};
+
+template <std::size_t I>
+struct floating : ts::strong_typedef<floating<I>, double>,
+                  ts::strong_typedef_op::equality_comparison<floating<I>>,
+                  ts::strong_typedef_op::relational_comparison<floating<I>>,
+                  ts::strong_typedef_op::floating_point_arithmetic<floating<I>>
+{
+    using ts::strong_typedef<floating<I>, double>::strong_typedef;
+};
+
+template <std::size_t I>
+struct use
+{
+    static int run()
+    {
+        integer<I> a(static_cast<int>(I));
+        integer<I> b(1);
+
+        a += b * b - b / b;
+        a = (a & b) | (a ^ ~b);
+        a <<= 1;
+        a = a + 2;
+        a *= 3;
+        ++a;
+        b--;
+
+        floating<I> c(1.0);
+        floating<I> d(2.0);
+        c = -c + d * d / d;
+
+        auto result = static_cast<int>(a);
+        if (a == b || a < b || c != d || c >= d)
+            ++result;
+        return result;
+    }
+};
+
+int type_safe_compile_benchmark()
+{
+    return compile_benchmark::run_all<use>(compile_benchmark::indices{});
+}
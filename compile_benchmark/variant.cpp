@@ -0,0 +1,77 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// a single variant with `size` alternatives
+
+#include <type_safe/variant.hpp>
+#include <type_safe/visitor.hpp>
+
+#include "benchmark.hpp"
+
+namespace ts = type_safe;
+
+template <std::size_t I>
+struct alternative
+{
+    int value;
+
+    alternative(int v) : value(v) {}
+};
+
+template <std::size_t I>
+bool operator==(const alternative<I>& a, const alternative<I>& b)
+{
+    return a.value == b.value;
+}
+
+template <std::size_t I>
+bool operator<(const alternative<I>& a, const alternative<I>& b)
+{
+    return a.value < b.value;
+}
+
+template <typename Indices>
+struct make_variant;
+
+template <std::size_t... Is>
+struct make_variant<ts::detail::index_sequence<Is...>>
+{
+    using type = ts::variant<alternative<Is>...>;
+};
+
+using variant = typename make_variant<compile_benchmark::indices>::type;
+
+struct visitor
+{
+    template <std::size_t I>
+    int operator()(const alternative<I>& alt) const
+    {
+        return alt.value + int(I);
+    }
+};
+
+// creates, copies and compares every alternative
+template <std::size_t I>
+struct use
+{
+    static int run()
+    {
+        variant a(alternative<I>{static_cast<int>(I)});
+        variant b(a);
+        b = alternative<I>(0);
+        a.emplace(ts::variant_type<alternative<I>>{}, 1);
+
+        auto result = ts::visit(visitor{}, a);
+        if (a == b || a < b)
+            ++result;
+        if (a.has_value(ts::variant_type<alternative<I>>{}))
+            result += a.value(ts::variant_type<alternative<I>>{}).value;
+        return result;
+    }
+};
+
+int type_safe_compile_benchmark()
+{
+    return compile_benchmark::run_all<use>(compile_benchmark::indices{});
+}
@@ -0,0 +1,192 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_ARENA_HPP_INCLUDED
+#define TYPE_SAFE_ARENA_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#include <type_safe/config.hpp>
+#include <type_safe/detail/assert.hpp>
+
+namespace type_safe
+{
+    /// A monotonic memory arena.
+    ///
+    /// It allocates big blocks of memory from the global `operator new`
+    /// and hands out pieces of them by bumping a pointer.
+    /// Memory is never returned individually,
+    /// instead all blocks are freed at once by `release()` or the destructor.
+    /// This makes allocation almost free and destroying a whole tree of objects
+    /// a couple of `operator delete` calls.
+    ///
+    /// Use [ts::arena_allocator]() to allocate from it with an allocator interface.
+    /// \notes It is not thread-safe.
+    /// \module types
+    class arena
+    {
+    public:
+        /// \effects Creates an arena that does not own any memory yet,
+        /// blocks that are allocated later will have (at least) the given size in bytes.
+        explicit arena(std::size_t block_size = 4096u) noexcept
+        : head_(nullptr), cur_(nullptr), end_(nullptr), block_size_(block_size)
+        {
+        }
+
+        arena(const arena&) = delete;
+        arena& operator=(const arena&) = delete;
+
+        /// \effects Same as `release()`.
+        ~arena() noexcept
+        {
+            release();
+        }
+
+        /// \returns A pointer to `size` bytes of memory aligned to `alignment`.
+        /// \throws Anything thrown by `operator new` if a new block is required.
+        /// \requires `alignment` must be a power of two.
+        void* allocate(std::size_t size, std::size_t alignment)
+        {
+            TYPE_SAFE_PRECONDITION(alignment != 0u && (alignment & (alignment - 1u)) == 0u,
+                                   "alignment not a power of two");
+
+            auto offset = align_offset(cur_, alignment);
+            if (cur_ == nullptr || size + offset > static_cast<std::size_t>(end_ - cur_))
+            {
+                if (size + alignment > block_size_)
+                    // allocation is too big for a new block, so give it one of its own
+                    // and keep on using the current block for the next allocations
+                    return insert_block(size + alignment, alignment);
+
+                auto memory = insert_block(block_size_, 1u);
+                cur_        = static_cast<char*>(memory);
+                end_        = cur_ + block_size_;
+                offset      = align_offset(cur_, alignment);
+            }
+
+            auto result = cur_ + offset;
+            cur_        = result + size;
+            return result;
+        }
+
+        /// \effects Frees all memory owned by the arena.
+        /// \notes This invalidates all memory allocated before,
+        /// but no destructors are called.
+        void release() noexcept
+        {
+            while (head_)
+            {
+                auto next = head_->next;
+                ::operator delete(static_cast<void*>(head_));
+                head_ = next;
+            }
+            cur_ = end_ = nullptr;
+        }
+
+        /// \returns The size of the blocks that will be allocated.
+        std::size_t block_size() const noexcept
+        {
+            return block_size_;
+        }
+
+    private:
+        struct block
+        {
+            block* next;
+        };
+
+        static std::size_t align_offset(const char* ptr, std::size_t alignment) noexcept
+        {
+            auto misaligned = reinterpret_cast<std::uintptr_t>(ptr) & (alignment - 1u);
+            return misaligned == 0u ? 0u : alignment - misaligned;
+        }
+
+        // allocates a block with the given usable size and returns the aligned start
+        void* insert_block(std::size_t size, std::size_t alignment)
+        {
+            auto memory    = static_cast<char*>(::operator new(sizeof(block) + size));
+            head_          = ::new (static_cast<void*>(memory)) block{head_};
+
+            auto data = memory + sizeof(block);
+            return data + align_offset(data, alignment);
+        }
+
+        block*      head_;
+        char*       cur_;
+        char*       end_;
+        std::size_t block_size_;
+    };
+
+    /// An `Allocator` that allocates memory from a [ts::arena]().
+    ///
+    /// `deallocate()` does nothing, the memory is freed when the arena is released.
+    /// Two allocators compare equal if they refer to the same arena.
+    /// \module types
+    template <typename T>
+    class arena_allocator
+    {
+    public:
+        using value_type = T;
+
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap            = std::true_type;
+
+        /// \effects Creates an allocator that allocates from the given arena.
+        explicit arena_allocator(arena& a) noexcept : arena_(&a)
+        {
+        }
+
+        /// \effects Creates an allocator that allocates from the same arena as `other`.
+        template <typename U>
+        arena_allocator(const arena_allocator<U>& other) noexcept : arena_(&other.get_arena())
+        {
+        }
+
+        /// \returns Memory for `n` objects of type `T` allocated from the arena.
+        /// \throws `std::bad_array_new_length` if the size overflows,
+        /// or anything thrown by [ts::arena::allocate]().
+        T* allocate(std::size_t n)
+        {
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+                TYPE_SAFE_THROW(std::bad_array_new_length());
+            return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        /// \effects Does nothing.
+        void deallocate(T*, std::size_t) noexcept
+        {
+        }
+
+        /// \returns A reference to the arena it allocates from.
+        arena& get_arena() const noexcept
+        {
+            return *arena_;
+        }
+
+    private:
+        arena* arena_;
+    };
+
+    /// \returns Whether or not both allocators allocate from the same arena.
+    /// \group arena_allocator_compare
+    template <typename T, typename U>
+    bool operator==(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) noexcept
+    {
+        return &lhs.get_arena() == &rhs.get_arena();
+    }
+
+    /// \group arena_allocator_compare
+    template <typename T, typename U>
+    bool operator!=(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_ARENA_HPP_INCLUDED
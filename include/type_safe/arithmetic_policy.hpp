@@ -5,6 +5,7 @@
 #ifndef TYPE_SAFE_ARITHMETIC_POLICY_HPP_INCLUDED
 #define TYPE_SAFE_ARITHMETIC_POLICY_HPP_INCLUDED
 
+#include <climits>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
@@ -12,6 +13,7 @@
 #include <type_safe/detail/assert.hpp>
 #include <type_safe/detail/force_inline.hpp>
 #include <type_safe/config.hpp>
+#include <type_safe/fwd.hpp>
 
 namespace type_safe
 {
@@ -67,44 +69,91 @@ namespace type_safe
             typename std::conditional<std::is_signed<T>::value, signed_integer_tag,
                                       unsigned_integer_tag>::type;
 
+#if TYPE_SAFE_USE_BUILTIN_OVERFLOW && defined(__clang__)
+        // clang's builtins need an output variable,
+        // so they are only used outside of constant evaluation
+        template <typename T>
+        bool builtin_add_overflow(const T& a, const T& b) noexcept
+        {
+            T result;
+            return __builtin_add_overflow(a, b, &result);
+        }
+
+        template <typename T>
+        bool builtin_sub_overflow(const T& a, const T& b) noexcept
+        {
+            T result;
+            return __builtin_sub_overflow(a, b, &result);
+        }
+
+        template <typename T>
+        bool builtin_mul_overflow(const T& a, const T& b) noexcept
+        {
+            T result;
+            return __builtin_mul_overflow(a, b, &result);
+        }
+
+/// \exclude
+#define TYPE_SAFE_DETAIL_OVERFLOW_CHECK(Op, T, A, B, Fallback)                                     \
+    (__builtin_is_constant_evaluated() ? (Fallback) :                                              \
+                                         type_safe::detail::builtin_##Op##_overflow(A, B))
+#elif TYPE_SAFE_USE_BUILTIN_OVERFLOW
+#define TYPE_SAFE_DETAIL_OVERFLOW_CHECK(Op, T, A, B, Fallback)                                     \
+    __builtin_##Op##_overflow_p(A, B, T(0))
+#else
+#define TYPE_SAFE_DETAIL_OVERFLOW_CHECK(Op, T, A, B, Fallback) (Fallback)
+#endif
+
         template <typename T>
         constexpr bool will_addition_error(signed_integer_tag, const T& a, const T& b)
         {
-            return b > T(0) ? a > std::numeric_limits<T>::max() - b :
-                              a < std::numeric_limits<T>::min() - b;
+            return TYPE_SAFE_DETAIL_OVERFLOW_CHECK(add, T, a, b,
+                                                   b > T(0) ?
+                                                       a > std::numeric_limits<T>::max() - b :
+                                                       a < std::numeric_limits<T>::min() - b);
         }
         template <typename T>
         constexpr bool will_addition_error(unsigned_integer_tag, const T& a, const T& b)
         {
-            return std::numeric_limits<T>::max() - b < a;
+            return TYPE_SAFE_DETAIL_OVERFLOW_CHECK(add, T, a, b,
+                                                   std::numeric_limits<T>::max() - b < a);
         }
 
         template <typename T>
         constexpr bool will_subtraction_error(signed_integer_tag, const T& a, const T& b)
         {
-            return b > T(0) ? a < std::numeric_limits<T>::min() + b :
-                              a > std::numeric_limits<T>::max() + b;
+            return TYPE_SAFE_DETAIL_OVERFLOW_CHECK(sub, T, a, b,
+                                                   b > T(0) ?
+                                                       a < std::numeric_limits<T>::min() + b :
+                                                       a > std::numeric_limits<T>::max() + b);
         }
         template <typename T>
         constexpr bool will_subtraction_error(unsigned_integer_tag, const T& a, const T& b)
         {
-            return a < b;
+            return TYPE_SAFE_DETAIL_OVERFLOW_CHECK(sub, T, a, b, a < b);
         }
 
+        // the fallback needs up to two divisions, the builtins only check a flag
         template <typename T>
         constexpr bool will_multiplication_error(signed_integer_tag, const T& a, const T& b)
         {
-            return a > T(0) ? (b > T(0) ? a > std::numeric_limits<T>::max() / b : // a, b > 0
-                                   b < std::numeric_limits<T>::min() / a) :       // a > 0, b <= 0
-                       (b > T(0) ? a < std::numeric_limits<T>::min() / b :        // a <= 0, b > 0
-                            a != T(0) && b < std::numeric_limits<T>::max() / a);  // a, b <= 0
+            return TYPE_SAFE_DETAIL_OVERFLOW_CHECK(
+                mul, T, a, b,
+                a > T(0) ? (b > T(0) ? a > std::numeric_limits<T>::max() / b : // a, b > 0
+                                b < std::numeric_limits<T>::min() / a) :       // a > 0, b <= 0
+                    (b > T(0) ? a < std::numeric_limits<T>::min() / b :        // a <= 0, b > 0
+                         a != T(0) && b < std::numeric_limits<T>::max() / a)); // a, b <= 0
         }
         template <typename T>
         constexpr bool will_multiplication_error(unsigned_integer_tag, const T& a, const T& b)
         {
-            return b != T(0) && a > std::numeric_limits<T>::max() / b;
+            return TYPE_SAFE_DETAIL_OVERFLOW_CHECK(mul, T, a, b,
+                                                   b != T(0)
+                                                       && a > std::numeric_limits<T>::max() / b);
         }
 
+#undef TYPE_SAFE_DETAIL_OVERFLOW_CHECK
+
         template <typename T>
         constexpr bool will_division_error(signed_integer_tag, const T& a, const T& b)
         {
@@ -126,6 +175,138 @@ namespace type_safe
         {
             return b == T(0);
         }
+
+        //=== wrapping/saturating arithmetic ===//
+        // unsigned type the arithmetic is done in,
+        // at least unsigned int so it isn't promoted to int
+        template <typename T>
+        using wrapping_int =
+            typename std::make_unsigned<typename std::common_type<T, unsigned>::type>::type;
+
+        template <typename T>
+        constexpr wrapping_int<T> to_wrapping(const T& value) noexcept
+        {
+            return static_cast<wrapping_int<T>>(value);
+        }
+
+        // converting values out of range to a signed type is implementation-defined before C++20,
+        // but all supported compilers use the two's complement
+        template <typename T>
+        constexpr T from_wrapping(const wrapping_int<T>& value) noexcept
+        {
+            return static_cast<T>(static_cast<typename std::make_unsigned<T>::type>(value));
+        }
+
+        template <typename T>
+        constexpr bool sign_bit(const wrapping_int<T>& value) noexcept
+        {
+            return ((value >> (sizeof(T) * CHAR_BIT - 1u)) & 1u) != 0u;
+        }
+
+        template <typename T>
+        constexpr T saturation_value(bool negative) noexcept
+        {
+            return negative ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+        }
+
+        template <typename T>
+        constexpr T wrapping_division(signed_integer_tag, const T& a, const T& b) noexcept
+        {
+            // min / -1 is the only overflow
+            return b == T(-1) ? from_wrapping<T>(0u - to_wrapping(a)) : T(a / b);
+        }
+        template <typename T>
+        constexpr T wrapping_division(unsigned_integer_tag, const T& a, const T& b) noexcept
+        {
+            return T(a / b);
+        }
+
+        template <typename T>
+        constexpr T wrapping_modulo(signed_integer_tag, const T& a, const T& b) noexcept
+        {
+            // min % -1 is undefined
+            return b == T(-1) ? T(0) : T(a % b);
+        }
+        template <typename T>
+        constexpr T wrapping_modulo(unsigned_integer_tag, const T& a, const T& b) noexcept
+        {
+            return T(a % b);
+        }
+
+        // signed addition overflows iff both operands have a different sign than the result
+        template <typename T>
+        constexpr T saturating_addition_impl(const wrapping_int<T>& a, const wrapping_int<T>& b,
+                                             const wrapping_int<T>& result) noexcept
+        {
+            return sign_bit<T>((a ^ result) & (b ^ result)) ? saturation_value<T>(sign_bit<T>(a)) :
+                                                               from_wrapping<T>(result);
+        }
+        template <typename T>
+        constexpr T saturating_addition(signed_integer_tag, const T& a, const T& b) noexcept
+        {
+            return saturating_addition_impl<T>(to_wrapping(a), to_wrapping(b),
+                                               to_wrapping(a) + to_wrapping(b));
+        }
+        template <typename T>
+        constexpr T saturating_addition_impl(const T& a, const T& result) noexcept
+        {
+            return result < a ? std::numeric_limits<T>::max() : result;
+        }
+        template <typename T>
+        constexpr T saturating_addition(unsigned_integer_tag, const T& a, const T& b) noexcept
+        {
+            return saturating_addition_impl(a, from_wrapping<T>(to_wrapping(a) + to_wrapping(b)));
+        }
+
+        // signed subtraction overflows iff the operands have different signs
+        // and the result has a different sign than a
+        template <typename T>
+        constexpr T saturating_subtraction_impl(const wrapping_int<T>& a, const wrapping_int<T>& b,
+                                                const wrapping_int<T>& result) noexcept
+        {
+            return sign_bit<T>((a ^ b) & (a ^ result)) ? saturation_value<T>(sign_bit<T>(a)) :
+                                                          from_wrapping<T>(result);
+        }
+        template <typename T>
+        constexpr T saturating_subtraction(signed_integer_tag, const T& a, const T& b) noexcept
+        {
+            return saturating_subtraction_impl<T>(to_wrapping(a), to_wrapping(b),
+                                                  to_wrapping(a) - to_wrapping(b));
+        }
+        template <typename T>
+        constexpr T saturating_subtraction(unsigned_integer_tag, const T& a, const T& b) noexcept
+        {
+            return a < b ? T(0) : T(a - b);
+        }
+
+        template <typename T>
+        constexpr T saturating_multiplication(signed_integer_tag, const T& a, const T& b) noexcept
+        {
+            return will_multiplication_error(signed_integer_tag{}, a, b) ?
+                       saturation_value<T>((a < T(0)) != (b < T(0))) :
+                       from_wrapping<T>(to_wrapping(a) * to_wrapping(b));
+        }
+        template <typename T>
+        constexpr T saturating_multiplication(unsigned_integer_tag, const T& a, const T& b) noexcept
+        {
+            return will_multiplication_error(unsigned_integer_tag{}, a, b) ?
+                       std::numeric_limits<T>::max() :
+                       from_wrapping<T>(to_wrapping(a) * to_wrapping(b));
+        }
+
+        template <typename T>
+        constexpr T saturating_division(signed_integer_tag, const T& a, const T& b) noexcept
+        {
+            // min / -1 is the only overflow
+            return b == T(-1) && a == std::numeric_limits<T>::min() ?
+                       std::numeric_limits<T>::max() :
+                       T(a / b);
+        }
+        template <typename T>
+        constexpr T saturating_division(unsigned_integer_tag, const T& a, const T& b) noexcept
+        {
+            return T(a / b);
+        }
     } // namespace detail
 
     /// An `ArithmeticPolicy` where under/overflow is always undefined behavior,
@@ -137,9 +318,9 @@ namespace type_safe
         template <typename T>
         TYPE_SAFE_FORCE_INLINE static constexpr T do_addition(const T& a, const T& b) noexcept
         {
-            return detail::will_addition_error(detail::arithmetic_tag_for<T>{}, a, b) ?
-                       (DEBUG_UNREACHABLE(detail::precondition_error_handler{},
-                                          "addition will result in overflow"),
+            return (TYPE_SAFE_PRECONDITION_SAMPLE()
+                    && detail::will_addition_error(detail::arithmetic_tag_for<T>{}, a, b)) ?
+                       (TYPE_SAFE_PRECONDITION_UNREACHABLE("addition will result in overflow"),
                         a) :
                        T(a + b);
         }
@@ -147,9 +328,9 @@ namespace type_safe
         template <typename T>
         TYPE_SAFE_FORCE_INLINE static constexpr T do_subtraction(const T& a, const T& b) noexcept
         {
-            return detail::will_subtraction_error(detail::arithmetic_tag_for<T>{}, a, b) ?
-                       (DEBUG_UNREACHABLE(detail::precondition_error_handler{},
-                                          "subtraction will result in underflow"),
+            return (TYPE_SAFE_PRECONDITION_SAMPLE()
+                    && detail::will_subtraction_error(detail::arithmetic_tag_for<T>{}, a, b)) ?
+                       (TYPE_SAFE_PRECONDITION_UNREACHABLE("subtraction will result in underflow"),
                         a) :
                        T(a - b);
         }
@@ -157,9 +338,10 @@ namespace type_safe
         template <typename T>
         TYPE_SAFE_FORCE_INLINE static constexpr T do_multiplication(const T& a, const T& b) noexcept
         {
-            return detail::will_multiplication_error(detail::arithmetic_tag_for<T>{}, a, b) ?
-                       (DEBUG_UNREACHABLE(detail::precondition_error_handler{},
-                                          "multiplication will result in overflow"),
+            return (TYPE_SAFE_PRECONDITION_SAMPLE()
+                    && detail::will_multiplication_error(detail::arithmetic_tag_for<T>{}, a, b)) ?
+                       (TYPE_SAFE_PRECONDITION_UNREACHABLE(
+                            "multiplication will result in overflow"),
                         a) :
                        T(a * b);
         }
@@ -167,9 +349,9 @@ namespace type_safe
         template <typename T>
         TYPE_SAFE_FORCE_INLINE static constexpr T do_division(const T& a, const T& b) noexcept
         {
-            return detail::will_division_error(detail::arithmetic_tag_for<T>{}, a, b) ?
-                       (DEBUG_UNREACHABLE(detail::precondition_error_handler{},
-                                          "division by zero/overflow"),
+            return (TYPE_SAFE_PRECONDITION_SAMPLE()
+                    && detail::will_division_error(detail::arithmetic_tag_for<T>{}, a, b)) ?
+                       (TYPE_SAFE_PRECONDITION_UNREACHABLE("division by zero/overflow"),
                         a) :
                        T(a / b);
         }
@@ -177,8 +359,9 @@ namespace type_safe
         template <typename T>
         TYPE_SAFE_FORCE_INLINE static constexpr T do_modulo(const T& a, const T& b) noexcept
         {
-            return detail::will_modulo_error(detail::arithmetic_tag_for<T>{}, a, b) ?
-                       (DEBUG_UNREACHABLE(detail::precondition_error_handler{}, "modulo by zero"),
+            return (TYPE_SAFE_PRECONDITION_SAMPLE()
+                    && detail::will_modulo_error(detail::arithmetic_tag_for<T>{}, a, b)) ?
+                       (TYPE_SAFE_PRECONDITION_UNREACHABLE("modulo by zero"),
                         a) :
                        T(a % b);
         }
@@ -197,7 +380,7 @@ namespace type_safe
             error(const char* msg) : std::range_error(msg)
             {
 #if !TYPE_SAFE_USE_EXCEPTIONS
-                DEBUG_UNREACHABLE(detail::precondition_error_handler{}, msg);
+                TYPE_SAFE_PRECONDITION_UNREACHABLE(msg);
 #endif
             }
         };
@@ -207,7 +390,7 @@ namespace type_safe
         {
             return detail::will_addition_error(detail::arithmetic_tag_for<T>{}, a, b) ?
                    TYPE_SAFE_THROW(error("addition will result in overflow")),
-                   a : a + b;
+                   a : static_cast<T>(a + b);
         }
 
         template <typename T>
@@ -215,7 +398,7 @@ namespace type_safe
         {
             return detail::will_subtraction_error(detail::arithmetic_tag_for<T>{}, a, b) ?
                    TYPE_SAFE_THROW(error("subtraction will result in underflow")),
-                   a : a - b;
+                   a : static_cast<T>(a - b);
         }
 
         template <typename T>
@@ -223,7 +406,7 @@ namespace type_safe
         {
             return detail::will_multiplication_error(detail::arithmetic_tag_for<T>{}, a, b) ?
                    TYPE_SAFE_THROW(error("multiplication will result in overflow")),
-                   a : a * b;
+                   a : static_cast<T>(a * b);
         }
 
         template <typename T>
@@ -231,7 +414,7 @@ namespace type_safe
         {
             return detail::will_division_error(detail::arithmetic_tag_for<T>{}, a, b) ?
                    TYPE_SAFE_THROW(error("division by zero/overflow")),
-                   a : a / b;
+                   a : static_cast<T>(a / b);
         }
 
         template <typename T>
@@ -239,21 +422,105 @@ namespace type_safe
         {
             return detail::will_modulo_error(detail::arithmetic_tag_for<T>{}, a, b) ?
                    TYPE_SAFE_THROW(error("modulo by zero")),
-                   a : a % b;
+                   a : static_cast<T>(a % b);
         }
     };
 
-#if TYPE_SAFE_ARITHMETIC_UB
-    /// The default `ArithmeticPolicy`.
+    /// An `ArithmeticPolicy` where under/overflow wraps around.
     ///
-    /// It depends on the [TYPE_SAFE_ARITHMETIC_UB]() macro,
-    /// and is either [ts::undefined_behavior_arithmetic]() or [ts::default_arithmetic]().
-    /// \exclude target
+    /// Unlike [ts::default_arithmetic]() this is also true for signed integers,
+    /// the result is the mathematical result modulo `2^N`, where `N` is the number of bits.
+    /// Division and modulo by zero is undefined behavior,
+    /// albeit checked when assertions are enabled.
+    /// \notes The operations are done in the corresponding unsigned type,
+    /// so they are branch-free and can be vectorized.
     /// \module types
-    using arithmetic_policy_default = undefined_behavior_arithmetic;
-#else
-    using arithmetic_policy_default = default_arithmetic;
-#endif
+    class wrapping_arithmetic
+    {
+    public:
+        template <typename T>
+        TYPE_SAFE_FORCE_INLINE static constexpr T do_addition(const T& a, const T& b) noexcept
+        {
+            return detail::from_wrapping<T>(detail::to_wrapping(a) + detail::to_wrapping(b));
+        }
+
+        template <typename T>
+        TYPE_SAFE_FORCE_INLINE static constexpr T do_subtraction(const T& a, const T& b) noexcept
+        {
+            return detail::from_wrapping<T>(detail::to_wrapping(a) - detail::to_wrapping(b));
+        }
+
+        template <typename T>
+        TYPE_SAFE_FORCE_INLINE static constexpr T do_multiplication(const T& a, const T& b) noexcept
+        {
+            return detail::from_wrapping<T>(detail::to_wrapping(a) * detail::to_wrapping(b));
+        }
+
+        template <typename T>
+        TYPE_SAFE_FORCE_INLINE static constexpr T do_division(const T& a, const T& b) noexcept
+        {
+            return b == T(0) ?
+                       (TYPE_SAFE_PRECONDITION_UNREACHABLE("division by zero"),
+                        a) :
+                       detail::wrapping_division(detail::arithmetic_tag_for<T>{}, a, b);
+        }
+
+        template <typename T>
+        TYPE_SAFE_FORCE_INLINE static constexpr T do_modulo(const T& a, const T& b) noexcept
+        {
+            return b == T(0) ?
+                       (TYPE_SAFE_PRECONDITION_UNREACHABLE("modulo by zero"),
+                        a) :
+                       detail::wrapping_modulo(detail::arithmetic_tag_for<T>{}, a, b);
+        }
+    };
+
+    /// An `ArithmeticPolicy` where under/overflow saturates.
+    ///
+    /// If the result is greater than the maximum value, it will be the maximum value,
+    /// if it is less than the minimum value, it will be the minimum value.
+    /// Division and modulo by zero is undefined behavior,
+    /// albeit checked when assertions are enabled.
+    /// \notes Addition and subtraction are implemented without branches,
+    /// so they can be vectorized.
+    /// \module types
+    class saturating_arithmetic
+    {
+    public:
+        template <typename T>
+        TYPE_SAFE_FORCE_INLINE static constexpr T do_addition(const T& a, const T& b) noexcept
+        {
+            return detail::saturating_addition(detail::arithmetic_tag_for<T>{}, a, b);
+        }
+
+        template <typename T>
+        TYPE_SAFE_FORCE_INLINE static constexpr T do_subtraction(const T& a, const T& b) noexcept
+        {
+            return detail::saturating_subtraction(detail::arithmetic_tag_for<T>{}, a, b);
+        }
+
+        template <typename T>
+        TYPE_SAFE_FORCE_INLINE static constexpr T do_multiplication(const T& a, const T& b) noexcept
+        {
+            return detail::saturating_multiplication(detail::arithmetic_tag_for<T>{}, a, b);
+        }
+
+        template <typename T>
+        TYPE_SAFE_FORCE_INLINE static constexpr T do_division(const T& a, const T& b) noexcept
+        {
+            return b == T(0) ?
+                       (TYPE_SAFE_PRECONDITION_UNREACHABLE("division by zero"),
+                        a) :
+                       detail::saturating_division(detail::arithmetic_tag_for<T>{}, a, b);
+        }
+
+        template <typename T>
+        TYPE_SAFE_FORCE_INLINE static constexpr T do_modulo(const T& a, const T& b) noexcept
+        {
+            // the result of modulo is always in range
+            return wrapping_arithmetic::do_modulo(a, b);
+        }
+    };
 } // namespace type_safe
 
 #endif // TYPE_SAFE_ARITHMETIC_POLICY_HPP_INCLUDED
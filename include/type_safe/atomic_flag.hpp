@@ -0,0 +1,222 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_ATOMIC_FLAG_HPP_INCLUDED
+#define TYPE_SAFE_ATOMIC_FLAG_HPP_INCLUDED
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+
+#if defined(__cpp_lib_atomic_wait)
+// use std::atomic::wait()
+#elif defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <thread>
+#endif
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/boolean.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        // 32bit, so it can be used as a futex
+        using atomic_flag_state = std::uint32_t;
+
+#if defined(__cpp_lib_atomic_wait)
+        inline void atomic_flag_wait(const std::atomic<atomic_flag_state>& state,
+                                     atomic_flag_state old, std::memory_order order) noexcept
+        {
+            state.wait(old, order);
+        }
+
+        inline void atomic_flag_notify(std::atomic<atomic_flag_state>& state, bool all) noexcept
+        {
+            if (all)
+                state.notify_all();
+            else
+                state.notify_one();
+        }
+#elif defined(__linux__)
+        static_assert(sizeof(std::atomic<atomic_flag_state>) == sizeof(atomic_flag_state),
+                      "atomic not usable as futex");
+
+        inline long atomic_flag_futex(const std::atomic<atomic_flag_state>& state, int op,
+                                      atomic_flag_state value) noexcept
+        {
+            return syscall(SYS_futex, static_cast<const void*>(&state), op, value, nullptr,
+                           nullptr, 0);
+        }
+
+        inline void atomic_flag_wait(const std::atomic<atomic_flag_state>& state,
+                                     atomic_flag_state old, std::memory_order order) noexcept
+        {
+            // the kernel compares the value again, so a notification can't be missed,
+            // but it can wake up spuriously
+            while (state.load(order) == old)
+                atomic_flag_futex(state, FUTEX_WAIT_PRIVATE, old);
+        }
+
+        inline void atomic_flag_notify(std::atomic<atomic_flag_state>& state, bool all) noexcept
+        {
+            atomic_flag_futex(state, FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1);
+        }
+#else
+        inline void atomic_flag_wait(const std::atomic<atomic_flag_state>& state,
+                                     atomic_flag_state old, std::memory_order order) noexcept
+        {
+            while (state.load(order) == old)
+                std::this_thread::yield();
+        }
+
+        inline void atomic_flag_notify(std::atomic<atomic_flag_state>&, bool) noexcept
+        {
+        }
+#endif
+    } // namespace detail
+
+    /// A [ts::flag]() that can be modified concurrently.
+    ///
+    /// It has the same interface as [ts::flag](),
+    /// where `try_set()` and `try_reset()` are a single compare-exchange,
+    /// so exactly one of the threads that race to change the state will observe the change.
+    /// Each operation takes an optional [std::memory_order]() with the same meaning
+    /// as in the corresponding operation of [std::atomic]().
+    ///
+    /// It also provides `wait()` and `notify_one()`/`notify_all()` like C++20's [std::atomic]():
+    /// they use the standard library if available,
+    /// a futex on Linux and fall back to polling otherwise.
+    ///
+    /// Example:
+    /// ```cpp
+    /// type_safe::atomic_flag done(false);
+    ///
+    /// // worker thread
+    /// done.set(std::memory_order_release);
+    /// done.notify_all();
+    ///
+    /// // main thread
+    /// done.wait(false, std::memory_order_acquire);
+    /// ```
+    /// \module types
+    class atomic_flag
+    {
+    public:
+        atomic_flag() = delete;
+
+        /// \effects Gives the flag the intial state.
+        /// \notes This function does not participate in overload resolution if `T` is not a boolean type.
+        /// \param 1
+        /// \exclude
+        template <typename T, typename = detail::enable_boolean<T>>
+        constexpr atomic_flag(T initial_state) noexcept
+        : state_(static_cast<bool>(initial_state) ? 1u : 0u)
+        {
+        }
+
+        atomic_flag(const atomic_flag&) = delete;
+        atomic_flag& operator=(const atomic_flag&) = delete;
+
+        /// \returns Whether or not the operations are lock-free.
+        bool is_lock_free() const noexcept
+        {
+            return state_.is_lock_free();
+        }
+
+        //=== load ===//
+        /// \returns The current state.
+        bool load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            return state_.load(order) != 0u;
+        }
+
+        //=== modifiers ===//
+        /// \effects Flips the state of the flag.
+        /// \returns The old value.
+        bool toggle(std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return state_.fetch_xor(1u, order) != 0u;
+        }
+
+        /// \effects Sets its state to the new one.
+        /// \requires The new state must be different than the old one.
+        /// \param 1
+        /// \exclude
+        template <typename T, typename = detail::enable_boolean<T>>
+        void change(T new_state, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            auto value = static_cast<bool>(new_state);
+            auto old   = state_.exchange(value ? 1u : 0u, order) != 0u;
+            TYPE_SAFE_PRECONDITION(old != value, "flag already in that state");
+            (void)old;
+        }
+
+        /// \effects Sets its state to `true`.
+        void set(std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            state_.store(1u, order);
+        }
+
+        /// \effects Sets its state to `true`.
+        /// \returns `true` if the previous state was `false`, `false` otherwise,
+        /// i.e. whether or not the state was changed by this call.
+        bool try_set(std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            detail::atomic_flag_state expected = 0u;
+            return state_.compare_exchange_strong(expected, 1u, order);
+        }
+
+        /// \effects Sets its state to `false`.
+        void reset(std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            state_.store(0u, order);
+        }
+
+        /// \effects Sets its state to `false`.
+        /// \returns `true` if the previous state was `true`, `false` otherwise,
+        /// i.e. whether or not the state was changed by this call.
+        bool try_reset(std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            detail::atomic_flag_state expected = 1u;
+            return state_.compare_exchange_strong(expected, 0u, order);
+        }
+
+        //=== waiting ===//
+        /// \effects Blocks until the state is different from `old`,
+        /// i.e. until it has been changed and a notification function has been called.
+        /// Returns immediately if the state is already different.
+        /// \requires `order` must not be `std::memory_order_release` or `std::memory_order_acq_rel`.
+        /// \param 1
+        /// \exclude
+        template <typename T, typename = detail::enable_boolean<T>>
+        void wait(T old, std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            detail::atomic_flag_wait(state_, static_cast<bool>(old) ? 1u : 0u, order);
+        }
+
+        /// \effects Unblocks one/all threads that are blocked in `wait()`.
+        /// \group notify
+        void notify_one() noexcept
+        {
+            detail::atomic_flag_notify(state_, false);
+        }
+
+        /// \group notify
+        void notify_all() noexcept
+        {
+            detail::atomic_flag_notify(state_, true);
+        }
+
+    private:
+        std::atomic<detail::atomic_flag_state> state_;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_ATOMIC_FLAG_HPP_INCLUDED
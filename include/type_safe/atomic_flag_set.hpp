@@ -0,0 +1,234 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_ATOMIC_FLAG_SET_HPP_INCLUDED
+#define TYPE_SAFE_ATOMIC_FLAG_SET_HPP_INCLUDED
+
+#include <atomic>
+
+#include <type_safe/flag_set.hpp>
+
+namespace type_safe
+{
+    /// A [ts::flag_set]() that can be modified concurrently.
+    ///
+    /// It stores the bits in a [std::atomic]() of the integer type a [ts::flag_set]() would use,
+    /// so all operations are lock-free if atomics of that type are.
+    /// Each operation takes an optional [std::memory_order]() with the same meaning
+    /// as in the corresponding operation of [std::atomic]().
+    /// The `fetch_XXX()` operations return the set as it was immediately before the modification.
+    ///
+    /// \requires `Enum` must be a flag,
+    /// i.e. valid with the [ts::flag_set_traits]().
+    template <typename Enum>
+    class atomic_flag_set
+    {
+        static_assert(std::is_enum<Enum>::value, "not an enum");
+        static_assert(flag_set_traits<Enum>::value, "invalid enum for flag_set");
+
+        using impl     = detail::flag_set_impl<Enum>;
+        using int_type = typename impl::int_type;
+        static_assert(std::is_integral<int_type>::value, "atomic_flag_set supports up to 64 flags");
+
+    public:
+        //=== constructors ===//
+        /// \effects Creates a set where all flags are set to `0`.
+        /// \group ctor_null
+        atomic_flag_set() noexcept : bits_(impl::none_set().to_int())
+        {
+        }
+
+        /// \group ctor_null
+        atomic_flag_set(noflag_t) noexcept : atomic_flag_set()
+        {
+        }
+
+        /// \effects Creates a set with the same flags as the given set.
+        atomic_flag_set(const flag_set<Enum>& set) noexcept : bits_(to_int(set))
+        {
+        }
+
+        /// \effects Creates a set where all bits are set to `0` except the given ones.
+        /// \notes This constructor only participates in overload resolution
+        /// if the argument is a flag combination.
+        template <typename FlagCombo, typename = detail::enable_flag_combo<FlagCombo, Enum>>
+        atomic_flag_set(const FlagCombo& combo) noexcept : bits_(impl(combo).to_int())
+        {
+        }
+
+        atomic_flag_set(const atomic_flag_set&) = delete;
+        atomic_flag_set& operator=(const atomic_flag_set&) = delete;
+
+        /// \returns Whether or not the operations are lock-free.
+        bool is_lock_free() const noexcept
+        {
+            return bits_.is_lock_free();
+        }
+
+        //=== load/store ===//
+        /// \returns A copy of the current flags.
+        flag_set<Enum> load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            return from_int(bits_.load(order));
+        }
+
+        /// \effects Replaces the current flags with the given ones.
+        void store(const flag_set<Enum>& set,
+                   std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            bits_.store(to_int(set), order);
+        }
+
+        /// \effects Replaces the current flags with the given ones.
+        /// \returns The previous flags.
+        flag_set<Enum> exchange(const flag_set<Enum>& set,
+                                std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return from_int(bits_.exchange(to_int(set), order));
+        }
+
+        /// \effects Replaces the current flags with `desired` if they are equal to `expected`,
+        /// otherwise sets `expected` to the current flags.
+        /// \returns Whether or not the flags were replaced.
+        /// \notes The weak version may fail spuriously.
+        /// \group compare_exchange
+        bool compare_exchange_weak(flag_set<Enum>& expected, const flag_set<Enum>& desired,
+                                   std::memory_order success, std::memory_order failure) noexcept
+        {
+            auto bits   = to_int(expected);
+            auto result = bits_.compare_exchange_weak(bits, to_int(desired), success, failure);
+            expected    = from_int(bits);
+            return result;
+        }
+
+        /// \group compare_exchange
+        bool compare_exchange_weak(flag_set<Enum>& expected, const flag_set<Enum>& desired,
+                                   std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            auto bits   = to_int(expected);
+            auto result = bits_.compare_exchange_weak(bits, to_int(desired), order);
+            expected    = from_int(bits);
+            return result;
+        }
+
+        /// \group compare_exchange
+        bool compare_exchange_strong(flag_set<Enum>& expected, const flag_set<Enum>& desired,
+                                     std::memory_order success, std::memory_order failure) noexcept
+        {
+            auto bits   = to_int(expected);
+            auto result = bits_.compare_exchange_strong(bits, to_int(desired), success, failure);
+            expected    = from_int(bits);
+            return result;
+        }
+
+        /// \group compare_exchange
+        bool compare_exchange_strong(flag_set<Enum>& expected, const flag_set<Enum>& desired,
+                                     std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            auto bits   = to_int(expected);
+            auto result = bits_.compare_exchange_strong(bits, to_int(desired), order);
+            expected    = from_int(bits);
+            return result;
+        }
+
+        //=== flag operation ===//
+        /// \effects Sets the specified flag to `1`.
+        void set(const Enum& flag, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            bits_.fetch_or(impl(flag).to_int(), order);
+        }
+
+        /// \effects Sets the specified flag to `0`.
+        void reset(const Enum& flag, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            bits_.fetch_and(impl(flag).toggle_all().to_int(), order);
+        }
+
+        /// \effects Toggles the specified flag.
+        void toggle(const Enum& flag, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            bits_.fetch_xor(impl(flag).to_int(), order);
+        }
+
+        /// \effects Sets the specified flag to `1`.
+        /// \returns Whether or not the flag was set before.
+        bool test_and_set(const Enum& flag,
+                          std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return fetch_set(flag, order).is_set(flag);
+        }
+
+        /// \effects Sets the specified flag to `0`.
+        /// \returns Whether or not the flag was set before.
+        bool test_and_reset(const Enum& flag,
+                            std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return fetch_reset(flag, order).is_set(flag);
+        }
+
+        /// \returns Whether or not the specified flag is set.
+        bool is_set(const Enum& flag, std::memory_order order = std::memory_order_seq_cst) const
+            noexcept
+        {
+            return load(order).is_set(flag);
+        }
+
+        //=== combination operation ===//
+        /// \effects Sets all flags that are set in the given flag combination.
+        /// \returns The previous flags.
+        /// \notes This function does not participate in overload resolution,
+        /// unless the argument is a flag combination.
+        template <typename FlagCombo, typename = detail::enable_flag_combo<FlagCombo, Enum>>
+        flag_set<Enum> fetch_set(const FlagCombo& combo,
+                                 std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return from_int(bits_.fetch_or(impl(combo).to_int(), order));
+        }
+
+        /// \effects Clears all flags that are set in the given flag combination.
+        /// \returns The previous flags.
+        /// \notes This function does not participate in overload resolution,
+        /// unless the argument is a flag combination.
+        template <typename FlagCombo, typename = detail::enable_flag_combo<FlagCombo, Enum>>
+        flag_set<Enum> fetch_reset(const FlagCombo& combo,
+                                   std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return from_int(bits_.fetch_and(impl(combo).toggle_all().to_int(), order));
+        }
+
+        /// \effects Toggles all flags that are set in the given flag combination.
+        /// \returns The previous flags.
+        /// \notes This function does not participate in overload resolution,
+        /// unless the argument is a flag combination.
+        template <typename FlagCombo, typename = detail::enable_flag_combo<FlagCombo, Enum>>
+        flag_set<Enum> fetch_toggle(const FlagCombo& combo,
+                                    std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return from_int(bits_.fetch_xor(impl(combo).to_int(), order));
+        }
+
+        /// \effects Clears all flags that aren't set in the given flag mask.
+        /// \returns The previous flags.
+        flag_set<Enum> fetch_mask(const flag_mask<Enum>& mask,
+                                  std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return from_int(bits_.fetch_and(impl(mask).to_int(), order));
+        }
+
+    private:
+        static int_type to_int(const flag_set<Enum>& set) noexcept
+        {
+            return set.template to_int<int_type>();
+        }
+
+        static flag_set<Enum> from_int(int_type bits) noexcept
+        {
+            return flag_set<Enum>(flag_combo<Enum>(impl::from_int(bits)));
+        }
+
+        std::atomic<int_type> bits_;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_ATOMIC_FLAG_SET_HPP_INCLUDED
@@ -0,0 +1,444 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_BATCH_ARITHMETIC_HPP_INCLUDED
+#define TYPE_SAFE_BATCH_ARITHMETIC_HPP_INCLUDED
+
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/arithmetic_policy.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/reference.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        //=== policy classification ===//
+        // unchecked: no error possible, plain loop
+        // checked: error detection is branchless per block, the policy is only called on error
+        // scalar: unknown policy, always call it
+        struct batch_unchecked_tag
+        {
+        };
+        struct batch_checked_tag
+        {
+        };
+        struct batch_scalar_tag
+        {
+        };
+
+        template <class Policy>
+        struct batch_policy_tag
+        {
+            using type = batch_scalar_tag;
+        };
+
+        template <>
+        struct batch_policy_tag<default_arithmetic>
+        {
+            using type = batch_unchecked_tag;
+        };
+
+        template <>
+        struct batch_policy_tag<undefined_behavior_arithmetic>
+        {
+            using type = batch_checked_tag;
+        };
+
+        template <>
+        struct batch_policy_tag<checked_arithmetic>
+        {
+            using type = batch_checked_tag;
+        };
+
+        // number of elements checked at once before results are written
+        // small enough to stay in cache, big enough for vectorization
+        constexpr std::size_t batch_block_size = 256u;
+
+        // integer type that can hold the sum of a block without overflow, or void
+        template <typename T>
+        using batch_wide_int = typename std::conditional<
+            (sizeof(T) > sizeof(std::int_least32_t)), void,
+            typename std::conditional<std::is_signed<T>::value, std::int_least64_t,
+                                      std::uint_least64_t>::type>::type;
+
+        //=== branchless overflow checks ===//
+        template <typename T>
+        constexpr bool sign_bit_set(T value) noexcept
+        {
+            return ((value >> (sizeof(T) * CHAR_BIT - 1u)) & 1u) != 0u;
+        }
+
+        struct batch_addition
+        {
+            template <typename T>
+            static bool will_error(signed_integer_tag, T a, T b) noexcept
+            {
+                using unsigned_t = typename std::make_unsigned<T>::type;
+                auto ua          = static_cast<unsigned_t>(a);
+                auto ub          = static_cast<unsigned_t>(b);
+                auto result      = static_cast<unsigned_t>(ua + ub);
+                // overflow iff both operands have a different sign than the result
+                return sign_bit_set(static_cast<unsigned_t>((ua ^ result) & (ub ^ result)));
+            }
+
+            template <typename T>
+            static bool will_error(unsigned_integer_tag, T a, T b) noexcept
+            {
+                return static_cast<T>(a + b) < a;
+            }
+
+            template <typename T>
+            static T apply(T a, T b) noexcept
+            {
+                return static_cast<T>(a + b);
+            }
+
+            template <class Policy, typename T>
+            static T apply_policy(T a, T b)
+            {
+                return Policy::template do_addition(a, b);
+            }
+        };
+
+        struct batch_subtraction
+        {
+            template <typename T>
+            static bool will_error(signed_integer_tag, T a, T b) noexcept
+            {
+                using unsigned_t = typename std::make_unsigned<T>::type;
+                auto ua          = static_cast<unsigned_t>(a);
+                auto ub          = static_cast<unsigned_t>(b);
+                auto result      = static_cast<unsigned_t>(ua - ub);
+                // overflow iff operands have different signs and the result the sign of b
+                return sign_bit_set(static_cast<unsigned_t>((ua ^ ub) & (ua ^ result)));
+            }
+
+            template <typename T>
+            static bool will_error(unsigned_integer_tag, T a, T b) noexcept
+            {
+                return a < b;
+            }
+
+            template <typename T>
+            static T apply(T a, T b) noexcept
+            {
+                return static_cast<T>(a - b);
+            }
+
+            template <class Policy, typename T>
+            static T apply_policy(T a, T b)
+            {
+                return Policy::template do_subtraction(a, b);
+            }
+        };
+
+        struct batch_multiplication
+        {
+            template <typename Tag, typename T>
+            static bool will_error_wide(Tag, T a, T b, std::true_type) noexcept
+            {
+                using wide_t = batch_wide_int<T>;
+                auto result  = static_cast<wide_t>(a) * static_cast<wide_t>(b);
+                return result < static_cast<wide_t>(std::numeric_limits<T>::min())
+                       || result > static_cast<wide_t>(std::numeric_limits<T>::max());
+            }
+
+            template <typename Tag, typename T>
+            static bool will_error_wide(Tag tag, T a, T b, std::false_type) noexcept
+            {
+                return will_multiplication_error(tag, a, b);
+            }
+
+            template <typename Tag, typename T>
+            static bool will_error(Tag tag, T a, T b) noexcept
+            {
+                return will_error_wide(tag, a, b,
+                                       std::integral_constant<bool, !std::is_void<
+                                                                        batch_wide_int<T>>::value>{});
+            }
+
+            template <typename T>
+            static T apply(T a, T b) noexcept
+            {
+                return static_cast<T>(a * b);
+            }
+
+            template <class Policy, typename T>
+            static T apply_policy(T a, T b)
+            {
+                return Policy::template do_multiplication(a, b);
+            }
+        };
+
+        //=== element-wise kernels ===//
+        template <class Op, typename T, class Policy>
+        void batch_transform(batch_unchecked_tag, integer<T, Policy>* result,
+                             const integer<T, Policy>* a, const integer<T, Policy>* b,
+                             std::size_t size)
+        {
+            for (std::size_t i = 0u; i != size; ++i)
+                result[i] = integer<T, Policy>(Op::apply(a[i].get(), b[i].get()));
+        }
+
+        template <class Op, typename T, class Policy>
+        void batch_transform(batch_scalar_tag, integer<T, Policy>* result,
+                             const integer<T, Policy>* a, const integer<T, Policy>* b,
+                             std::size_t size)
+        {
+            for (std::size_t i = 0u; i != size; ++i)
+                result[i] =
+                    integer<T, Policy>(Op::template apply_policy<Policy>(a[i].get(), b[i].get()));
+        }
+
+        template <class Op, typename T, class Policy>
+        void batch_transform(batch_checked_tag, integer<T, Policy>* result,
+                             const integer<T, Policy>* a, const integer<T, Policy>* b,
+                             std::size_t size)
+        {
+            for (std::size_t begin = 0u; begin < size; begin += batch_block_size)
+            {
+                auto block_size = size - begin < batch_block_size ? size - begin : batch_block_size;
+
+                // check the entire block first, so result may alias the input
+                auto error = false;
+                for (std::size_t i = begin; i != begin + block_size; ++i)
+                    error |= Op::will_error(arithmetic_tag_for<T>{}, a[i].get(), b[i].get());
+
+                if (error)
+                    // let the policy report the first error
+                    batch_transform<Op>(batch_scalar_tag{}, result + begin, a + begin, b + begin,
+                                        block_size);
+                else
+                    batch_transform<Op>(batch_unchecked_tag{}, result + begin, a + begin,
+                                        b + begin, block_size);
+            }
+        }
+
+        template <class Op, typename T, class Policy>
+        void batch_transform(const array_ref<integer<T, Policy>>&       result,
+                             const array_ref<const integer<T, Policy>>& a,
+                             const array_ref<const integer<T, Policy>>& b)
+        {
+            TYPE_SAFE_PRECONDITION(result.size() == a.size() && a.size() == b.size(),
+                                   "mismatched sizes");
+            batch_transform<Op>(typename batch_policy_tag<Policy>::type{}, result.data(),
+                                a.data(), b.data(), static_cast<std::size_t>(a.size()));
+        }
+
+        template <typename T, class Policy>
+        array_ref<const integer<T, Policy>> make_const_array_ref(
+            const array_ref<integer<T, Policy>>& ref) noexcept
+        {
+            return ref.size() == 0u ?
+                       array_ref<const integer<T, Policy>>(nullptr) :
+                       array_ref<const integer<T, Policy>>(ref.data(), ref.size());
+        }
+
+        template <typename T, class Policy>
+        const array_ref<const integer<T, Policy>>& make_const_array_ref(
+            const array_ref<const integer<T, Policy>>& ref) noexcept
+        {
+            return ref;
+        }
+
+        //=== reduction kernels ===//
+        template <typename T, class Policy>
+        T batch_sum(batch_unchecked_tag, T total, const integer<T, Policy>* values,
+                    std::size_t size)
+        {
+            for (std::size_t i = 0u; i != size; ++i)
+                total = static_cast<T>(total + values[i].get());
+            return total;
+        }
+
+        template <typename T, class Policy>
+        T batch_sum(batch_scalar_tag, T total, const integer<T, Policy>* values, std::size_t size)
+        {
+            for (std::size_t i = 0u; i != size; ++i)
+                total = Policy::template do_addition(total, values[i].get());
+            return total;
+        }
+
+        // sums the block into total if none of the partial sums can overflow,
+        // otherwise returns false without changing total
+        // all partial sums lie in [total + negative, total + positive],
+        // so if that range fits, none of them overflow
+        template <typename T, class Policy>
+        bool batch_try_sum_block(signed_integer_tag, T& total, const integer<T, Policy>* values,
+                                 std::size_t size) noexcept
+        {
+            using wide_t = batch_wide_int<T>;
+
+            wide_t positive = 0, negative = 0;
+            for (std::size_t i = 0u; i != size; ++i)
+            {
+                auto value = static_cast<wide_t>(values[i].get());
+                positive += value > 0 ? value : 0;
+                negative += value < 0 ? value : 0;
+            }
+
+            if (total + positive > static_cast<wide_t>(std::numeric_limits<T>::max())
+                || total + negative < static_cast<wide_t>(std::numeric_limits<T>::min()))
+                return false;
+            total = static_cast<T>(total + positive + negative);
+            return true;
+        }
+
+        template <typename T, class Policy>
+        bool batch_try_sum_block(unsigned_integer_tag, T& total, const integer<T, Policy>* values,
+                                 std::size_t size) noexcept
+        {
+            using wide_t = batch_wide_int<T>;
+
+            wide_t sum = total;
+            for (std::size_t i = 0u; i != size; ++i)
+                sum += values[i].get();
+
+            if (sum > static_cast<wide_t>(std::numeric_limits<T>::max()))
+                return false;
+            total = static_cast<T>(sum);
+            return true;
+        }
+
+        // no wider type, every partial sum has to be checked anyway
+        template <typename Tag, typename T, class Policy>
+        T batch_sum_block(Tag, std::false_type, T total, const integer<T, Policy>* values,
+                          std::size_t size)
+        {
+            return batch_sum(batch_scalar_tag{}, total, values, size);
+        }
+
+        template <typename Tag, typename T, class Policy>
+        T batch_sum_block(Tag tag, std::true_type, T total, const integer<T, Policy>* values,
+                          std::size_t size)
+        {
+            if (!batch_try_sum_block(tag, total, values, size))
+                // let the policy report the first error
+                return batch_sum(batch_scalar_tag{}, total, values, size);
+            return total;
+        }
+
+        template <typename T, class Policy>
+        T batch_sum(batch_checked_tag, T total, const integer<T, Policy>* values,
+                    std::size_t size)
+        {
+            using has_wide = std::integral_constant<bool, !std::is_void<batch_wide_int<T>>::value>;
+
+            for (std::size_t begin = 0u; begin < size; begin += batch_block_size)
+            {
+                auto block_size = size - begin < batch_block_size ? size - begin : batch_block_size;
+                total = batch_sum_block(arithmetic_tag_for<T>{}, has_wide{}, total, values + begin,
+                                        block_size);
+            }
+            return total;
+        }
+    } // namespace detail
+
+    /// \effects Sets `result[i]` to `a[i] + b[i]` (1)/`a[i] - b[i]` (2)/`a[i] * b[i]` (3)
+    /// for each index using the `Policy` of the integer.
+    ///
+    /// It has the same semantics as the equivalent loop,
+    /// but for [ts::checked_arithmetic]() and [ts::undefined_behavior_arithmetic]()
+    /// the overflow detection is done branchless on blocks of elements,
+    /// which allows the compiler to vectorize it.
+    /// Only if a block contains an error, it is processed element by element,
+    /// so the policy reports the error of the first offending element like the loop would,
+    /// it does not get the index.
+    /// [ts::default_arithmetic]() does no checks at all,
+    /// any other policy is called for each element;
+    /// [ts::wrapping_arithmetic]() and [ts::saturating_arithmetic]() are branch-free,
+    /// so that loop can be vectorized as well.
+    /// \requires All arrays must have the same size.
+    /// `result` may be the same array as `a` or `b`, but must not partially overlap them.
+    /// \notes If the policy reports an error by throwing,
+    /// all elements before the offending index have been written,
+    /// the ones after that have unspecified values.
+    /// \notes These functions do not participate in overload resolution,
+    /// unless the element types of `a` and `b` are possibly `const` `integer<T, Policy>`.
+    /// \group batch_transform
+    /// \module types
+    /// \param 4
+    /// \exclude
+    template <typename T, class Policy, typename A, typename B,
+              typename = typename std::enable_if<
+                  std::is_same<typename std::remove_const<A>::type, integer<T, Policy>>::value
+                  && std::is_same<typename std::remove_const<B>::type,
+                                  integer<T, Policy>>::value>::type>
+    void batch_add(const array_ref<integer<T, Policy>>& result, const array_ref<A>& a,
+                   const array_ref<B>& b)
+    {
+        detail::batch_transform<detail::batch_addition>(result, detail::make_const_array_ref(a),
+                                                        detail::make_const_array_ref(b));
+    }
+
+    /// \group batch_transform
+    /// \param 4
+    /// \exclude
+    template <typename T, class Policy, typename A, typename B,
+              typename = typename std::enable_if<
+                  std::is_same<typename std::remove_const<A>::type, integer<T, Policy>>::value
+                  && std::is_same<typename std::remove_const<B>::type,
+                                  integer<T, Policy>>::value>::type>
+    void batch_sub(const array_ref<integer<T, Policy>>& result, const array_ref<A>& a,
+                   const array_ref<B>& b)
+    {
+        detail::batch_transform<detail::batch_subtraction>(result, detail::make_const_array_ref(a),
+                                                           detail::make_const_array_ref(b));
+    }
+
+    /// \group batch_transform
+    /// \param 4
+    /// \exclude
+    template <typename T, class Policy, typename A, typename B,
+              typename = typename std::enable_if<
+                  std::is_same<typename std::remove_const<A>::type, integer<T, Policy>>::value
+                  && std::is_same<typename std::remove_const<B>::type,
+                                  integer<T, Policy>>::value>::type>
+    void batch_mul(const array_ref<integer<T, Policy>>& result, const array_ref<A>& a,
+                   const array_ref<B>& b)
+    {
+        detail::batch_transform<detail::batch_multiplication>(result,
+                                                              detail::make_const_array_ref(a),
+                                                              detail::make_const_array_ref(b));
+    }
+
+    /// \returns The sum of `init` and all elements of the array, added from left to right.
+    ///
+    /// It has the same semantics as the equivalent loop,
+    /// but for [ts::checked_arithmetic]() and [ts::undefined_behavior_arithmetic]()
+    /// the check is done once for each block of elements,
+    /// by summing the positive and negative elements separately in a wider type.
+    /// Only if a partial sum in the block could overflow, it is processed element by element,
+    /// so the policy reports the error of the first addition that overflows like the loop would,
+    /// it does not get the index.
+    /// \notes For 64 bit integers there is no wider type,
+    /// so each partial sum is checked individually.
+    /// \group batch_sum
+    /// \module types
+    template <typename T, class Policy>
+    integer<T, Policy> batch_sum(const array_ref<const integer<T, Policy>>& values,
+                                 const integer<T, Policy>&                  init = T(0))
+    {
+        return integer<T, Policy>(
+            detail::batch_sum(typename detail::batch_policy_tag<Policy>::type{}, init.get(),
+                              values.data(), static_cast<std::size_t>(values.size())));
+    }
+
+    /// \group batch_sum
+    template <typename T, class Policy>
+    integer<T, Policy> batch_sum(const array_ref<integer<T, Policy>>& values,
+                                 const integer<T, Policy>&            init = T(0))
+    {
+        return batch_sum(detail::make_const_array_ref(values), init);
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_BATCH_ARITHMETIC_HPP_INCLUDED
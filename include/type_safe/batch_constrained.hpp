@@ -0,0 +1,316 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_BATCH_CONSTRAINED_HPP_INCLUDED
+#define TYPE_SAFE_BATCH_CONSTRAINED_HPP_INCLUDED
+
+#include <cstddef>
+#include <type_traits>
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/uncaught_exceptions.hpp>
+#include <type_safe/bounded_type.hpp>
+#include <type_safe/config.hpp>
+#include <type_safe/constrained_type.hpp>
+#include <type_safe/reference.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        //=== validation kernels ===//
+        // no early exit, so the loop can be vectorized
+        template <typename T, class Predicate>
+        bool batch_all_valid(std::false_type, const T* values, std::size_t size,
+                             const Predicate& p)
+        {
+            auto result = true;
+            for (std::size_t i = 0u; i != size; ++i)
+                result &= static_cast<bool>(p(values[i]));
+            return result;
+        }
+
+        // an integer is in the interval iff the minimum and maximum are,
+        // computing them is a single vectorized pass
+        template <typename T, class Predicate>
+        bool batch_all_valid(std::true_type, const T* values, std::size_t size,
+                             const Predicate& p)
+        {
+            if (size == 0u)
+                return true;
+
+            auto min = values[0], max = values[0];
+            for (std::size_t i = 1u; i != size; ++i)
+            {
+                min = values[i] < min ? values[i] : min;
+                max = values[i] > max ? values[i] : max;
+            }
+            return p(min) && p(max);
+        }
+
+        template <typename T, class Predicate>
+        struct is_batch_interval : std::false_type
+        {
+        };
+
+        template <typename T, typename U, bool LowerInclusive, bool UpperInclusive,
+                  typename LowerBound, typename UpperBound>
+        struct is_batch_interval<T, constraints::bounded<U, LowerInclusive, UpperInclusive,
+                                                         LowerBound, UpperBound>>
+            : std::is_integral<T>
+        {
+        };
+
+        template <typename T, typename U, typename Bound>
+        struct is_batch_interval<T, constraints::less<U, Bound>> : std::is_integral<T>
+        {
+        };
+
+        template <typename T, typename U, typename Bound>
+        struct is_batch_interval<T, constraints::less_equal<U, Bound>> : std::is_integral<T>
+        {
+        };
+
+        template <typename T, typename U, typename Bound>
+        struct is_batch_interval<T, constraints::greater<U, Bound>> : std::is_integral<T>
+        {
+        };
+
+        template <typename T, typename U, typename Bound>
+        struct is_batch_interval<T, constraints::greater_equal<U, Bound>> : std::is_integral<T>
+        {
+        };
+
+        //=== verification ===//
+        template <typename T, class Predicate>
+        void batch_verify(assertion_verifier, T* values, std::size_t size, const Predicate& p)
+        {
+            TYPE_SAFE_PRECONDITION(batch_all_valid(is_batch_interval<T, Predicate>{}, values, size,
+                                                   p),
+                                   "value does not fulfill constraint");
+        }
+
+        template <typename T, class Predicate>
+        void batch_verify(throwing_verifier, T* values, std::size_t size, const Predicate& p)
+        {
+            if (!batch_all_valid(is_batch_interval<T, Predicate>{}, values, size, p))
+                TYPE_SAFE_THROW(constrain_error{});
+        }
+
+        template <typename T, typename U, typename LowerBound, typename UpperBound>
+        void batch_verify(clamping_verifier, T* values, std::size_t size,
+                          const constraints::closed_interval<U, LowerBound, UpperBound>& interval)
+        {
+            const T lower = static_cast<T>(interval.get_lower_bound());
+            const T upper = static_cast<T>(interval.get_upper_bound());
+            for (std::size_t i = 0u; i != size; ++i)
+            {
+                auto value = values[i] < lower ? lower : values[i];
+                values[i]  = value > upper ? upper : value;
+            }
+        }
+
+        template <typename T, class Predicate>
+        void batch_verify(clamping_verifier, T* values, std::size_t size, const Predicate& p)
+        {
+            for (std::size_t i = 0u; i != size; ++i)
+                clamping_verifier::verify(values[i], p);
+        }
+
+        template <class Verifier, typename T, class Predicate>
+        void batch_verify(Verifier, T* values, std::size_t size, const Predicate& p)
+        {
+            for (std::size_t i = 0u; i != size; ++i)
+                Verifier::verify(values[i], p);
+        }
+    } // namespace detail
+
+    /// \returns `true` if all values fulfill the predicate, `false` otherwise.
+    /// \notes For integers and the constraints of [ts::bounded_type]()
+    /// it computes minimum and maximum in a single pass that can be vectorized
+    /// and only checks those.
+    template <typename T, class Predicate>
+    bool all_valid(const array_ref<T>& values, const Predicate& p)
+    {
+        return detail::batch_all_valid(detail::is_batch_interval<T, Predicate>{}, values.data(),
+                                       static_cast<std::size_t>(values.size()), p);
+    }
+
+    /// Changes all values so that they are in the given [ts::constraints::closed_interval]().
+    /// \effects Same as calling `clamp(interval, val)` for each value,
+    /// but the loop is branchless and can be vectorized.
+    template <typename T, typename U, typename LowerBound, typename UpperBound>
+    void clamp_all(const array_ref<T>& values,
+                   const constraints::closed_interval<U, LowerBound, UpperBound>& interval)
+    {
+        detail::batch_verify(clamping_verifier{}, values.data(),
+                             static_cast<std::size_t>(values.size()), interval);
+    }
+
+    /// Views an array of values as an array of [ts::constrained_type]().
+    /// \effects Verifies all values using the `Verifier`,
+    /// then returns a reference to the same memory as array of `constrained_type<T, Constraint, Verifier>`.
+    /// For [ts::assertion_verifier]() and [ts::throwing_verifier]() the values are checked in one pass,
+    /// see [ts::all_valid](),
+    /// for [ts::clamping_verifier]() they are clamped in place, see [ts::clamp_all]().
+    /// Other verifiers are called for each value.
+    /// \returns The view of the values, no copies are made.
+    /// \throws Anything thrown by the `Verifier`.
+    /// \requires The `Constraint` must be an empty class, i.e. use only static bounds,
+    /// so that a `constrained_type` has the same layout as `T`.
+    /// The values must not be modified through the original array while the view is used.
+    template <class Verifier = assertion_verifier, typename T, class Constraint>
+    array_ref<constrained_type<T, Constraint, Verifier>> constrain_all(const array_ref<T>& values,
+                                                                      const Constraint& constraint)
+    {
+        using result_type = constrained_type<T, Constraint, Verifier>;
+        static_assert(std::is_empty<Constraint>::value, "constraint must not store any state");
+        static_assert(std::is_standard_layout<result_type>::value
+                          && sizeof(result_type) == sizeof(T)
+                          && alignof(result_type) == alignof(T),
+                      "constrained_type must have the same layout as the value");
+
+        detail::batch_verify(Verifier{}, values.data(), static_cast<std::size_t>(values.size()),
+                             constraint);
+        if (values.size() == 0u)
+            return nullptr;
+        return array_ref<result_type>(reinterpret_cast<result_type*>(values.data()),
+                                      values.size());
+    }
+
+    /// \effects Same as `constrain_all<Verifier>(values, Constraint())`.
+    template <class Constraint, class Verifier = assertion_verifier, typename T>
+    array_ref<constrained_type<T, Constraint, Verifier>> constrain_all(const array_ref<T>& values)
+    {
+        return constrain_all<Verifier>(values, Constraint());
+    }
+
+    /// A proxy to modify all values of an array of [ts::constrained_type]() at once.
+    ///
+    /// It gives access to the underlying values as `array_ref<T>`
+    /// and verifies all of them once in `commit()` or its destructor,
+    /// like [ts::constrain_all]().
+    /// \notes It is returned by [ts::modify_all]().
+    /// \notes If the destructor runs due to an exception, it does not verify the values,
+    /// so they might not fulfill the constraint afterwards.
+    /// Call `commit()` explicitly to report a violation without relying on the destructor.
+    template <typename T, typename Constraint, class Verifier>
+    class constrained_array_modifier
+    {
+    public:
+        using value_type = typename constrained_type<T, Constraint, Verifier>::value_type;
+
+        /// \effects Move constructs it.
+        /// `other` will not verify any values afterwards.
+        constrained_array_modifier(constrained_array_modifier&& other) noexcept
+        : values_(other.values_),
+          size_(other.size_),
+          uncaught_(other.uncaught_),
+          active_(other.active_)
+        {
+            other.active_ = false;
+        }
+
+        /// \effects Verifies all values, if it isn't in the moved-from state
+        /// and it is not destroyed due to an exception.
+        /// \throws Anything thrown by the `Verifier`.
+        ~constrained_array_modifier() noexcept(false)
+        {
+            if (active_ && detail::uncaught_exceptions() <= uncaught_)
+                commit();
+        }
+
+        /// \effects Move assigns it.
+        /// If it isn't in the moved-from state, it verifies its current values first, like `commit()`.
+        /// `other` will not verify any values afterwards.
+        /// \throws Anything thrown by the `Verifier`,
+        /// then `other` is unchanged.
+        constrained_array_modifier& operator=(constrained_array_modifier&& other)
+        {
+            if (this != &other)
+            {
+                if (active_)
+                    commit();
+
+                values_       = other.values_;
+                size_         = other.size_;
+                uncaught_     = other.uncaught_;
+                active_       = other.active_;
+                other.active_ = false;
+            }
+            return *this;
+        }
+
+        /// \effects Verifies all values and puts it into the moved-from state,
+        /// so the destructor will not verify them again.
+        /// \throws Anything thrown by the `Verifier`.
+        /// \requires It must not be in the moved-from state.
+        void commit()
+        {
+            TYPE_SAFE_PRECONDITION(active_, "values have been moved from");
+            active_ = false;
+            detail::batch_verify(Verifier{}, values_, size_, Constraint());
+        }
+
+        /// \returns A reference to the stored values.
+        /// \requires It must not be in the moved-from state.
+        array_ref<value_type> operator*() const noexcept
+        {
+            return get();
+        }
+
+        /// \returns A reference to the stored values.
+        /// \requires It must not be in the moved-from state.
+        array_ref<value_type> get() const noexcept
+        {
+            TYPE_SAFE_PRECONDITION(active_, "values have been moved from");
+            return size_ == 0u ? array_ref<value_type>(nullptr) :
+                                 array_ref<value_type>(values_, size_);
+        }
+
+    private:
+        constrained_array_modifier(value_type* values, std::size_t size) noexcept
+        : values_(values), size_(size), uncaught_(detail::uncaught_exceptions()), active_(true)
+        {
+        }
+
+        value_type* values_;
+        std::size_t size_;
+        int         uncaught_;
+        bool        active_;
+
+        template <typename T2, typename Constraint2, class Verifier2>
+        friend constrained_array_modifier<T2, Constraint2, Verifier2> modify_all(
+            const array_ref<constrained_type<T2, Constraint2, Verifier2>>& values) noexcept;
+    };
+
+    /// \returns A [ts::constrained_array_modifier]() to modify all values of the array,
+    /// they are verified once all modifications are done, i.e. on `commit()` or destruction.
+    /// For [ts::assertion_verifier]() and [ts::throwing_verifier]() they are checked in one pass,
+    /// see [ts::all_valid](),
+    /// for [ts::clamping_verifier]() they are clamped in place, see [ts::clamp_all]().
+    /// Other verifiers are called for each value.
+    /// \requires The `Constraint` must be an empty class, i.e. use only static bounds,
+    /// so that a `constrained_type` has the same layout as `T`.
+    /// \notes Until the modifier is committed or destroyed, the values might not fulfill the constraint,
+    /// so they must not be accessed through the array.
+    template <typename T, typename Constraint, class Verifier>
+    constrained_array_modifier<T, Constraint, Verifier> modify_all(
+        const array_ref<constrained_type<T, Constraint, Verifier>>& values) noexcept
+    {
+        using constrained = constrained_type<T, Constraint, Verifier>;
+        static_assert(!std::is_const<T>::value, "cannot modify const values");
+        static_assert(std::is_empty<Constraint>::value, "constraint must not store any state");
+        static_assert(std::is_standard_layout<constrained>::value
+                          && sizeof(constrained) == sizeof(T) && alignof(constrained) == alignof(T),
+                      "constrained_type must have the same layout as the value");
+
+        auto data = reinterpret_cast<T*>(values.data());
+        return constrained_array_modifier<T, Constraint, Verifier>(data, static_cast<std::size_t>(
+                                                                             values.size()));
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_BATCH_CONSTRAINED_HPP_INCLUDED
@@ -0,0 +1,126 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_BATCH_VISIT_HPP_INCLUDED
+#define TYPE_SAFE_BATCH_VISIT_HPP_INCLUDED
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/index_sequence.hpp>
+#include <type_safe/reference.hpp>
+#include <type_safe/variant.hpp>
+#include <type_safe/visitor.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        template <bool AllowIncomplete, typename Visitor, class Variant>
+        class visit_all_impl
+        {
+            using id_count = variant_id_count<Variant>;
+
+            // all variants of the group have the same type id, so it is known at compile-time
+            template <std::size_t Id>
+            static int visit_group(Visitor& visitor, Variant* variants, const std::size_t* first,
+                                   const std::size_t* last)
+            {
+                for (; first != last; ++first)
+                    visit_variant_impl<AllowIncomplete, Visitor&>::call(
+                        visitor, variant_unpack<Variant&>::template get<Id>(variants[*first]));
+                return 0;
+            }
+
+            template <std::size_t... Ids>
+            static void visit_groups(index_sequence<Ids...>, Visitor& visitor, Variant* variants,
+                                     const std::size_t* indices, const std::size_t* offsets)
+            {
+                int dummy[] = {visit_group<Ids>(visitor, variants, indices + offsets[Ids],
+                                                indices + offsets[Ids + 1u])...};
+                (void)dummy;
+            }
+
+        public:
+            static void call(Visitor& visitor, Variant* variants, std::size_t size,
+                             std::size_t* indices)
+            {
+                // stable counting sort of the indices by type id,
+                // the indices of type id i are in [offsets[i], offsets[i + 1])
+                std::size_t offsets[id_count::value + 1u] = {};
+                for (auto i = std::size_t(0u); i != size; ++i)
+                    ++offsets[get_type_id_value(variants[i]) + 1u];
+                for (auto id = std::size_t(0u); id != id_count::value; ++id)
+                    offsets[id + 1u] += offsets[id];
+
+                std::size_t cursors[id_count::value];
+                for (auto id = std::size_t(0u); id != id_count::value; ++id)
+                    cursors[id] = offsets[id];
+                for (auto i = std::size_t(0u); i != size; ++i)
+                    indices[cursors[get_type_id_value(variants[i])]++] = i;
+
+                visit_groups(make_index_sequence<id_count::value>{}, visitor, variants, indices,
+                             offsets);
+            }
+        };
+
+        template <class Visitor, class Variant>
+        void visit_all(Visitor& visitor, Variant* variants, std::size_t size,
+                       std::size_t* indices)
+        {
+            visit_all_impl<visitor_allow_incomplete<Visitor>::value, Visitor, Variant>::call(
+                visitor, variants, size, indices);
+        }
+    } // namespace detail
+
+    /// Visits all [ts::basic_variant]()s of an array, grouped by their active type.
+    /// \effects Calls the `operator()` of `visitor` for each variant of `variants`,
+    /// passing it the currently stored value, like [ts::visit]().
+    /// But first it is called for all empty variants, then for all variants with the first type,
+    /// and so on, the variants with the same type are visited in the order of the array.
+    /// The order is determined by a counting sort of the indices into `buffer`,
+    /// so the type isn't dispatched for each variant,
+    /// avoiding the branch mispredictions if the types alternate.
+    /// If a type is not overloaded,
+    /// the program is ill-formed, unless `Visitor` provides a member named `incomplete_visitor`,
+    /// like with [ts::visit]().
+    /// \requires `buffer.size()` must be at least `variants.size()`.
+    /// The `visitor` must not change the types of the variants.
+    /// \notes This function does not participate in overload resolution,
+    /// unless `Variant` is a possibly `const` [ts::basic_variant]().
+    /// \group visit_all
+    /// \module variant
+    /// \param 3
+    /// \exclude
+    template <typename Variant, class Visitor,
+              typename = typename std::enable_if<detail::is_variant<Variant>::value>::type>
+    void visit_all(const array_ref<Variant>& variants, const array_ref<std::size_t>& buffer,
+                   Visitor&& visitor)
+    {
+        auto size = static_cast<std::size_t>(variants.size());
+        TYPE_SAFE_PRECONDITION(static_cast<std::size_t>(buffer.size()) >= size,
+                               "buffer too small");
+        detail::visit_all(visitor, variants.data(), size, buffer.data());
+    }
+
+    /// \effects Same as the other overload,
+    /// but it allocates the buffer itself.
+    /// \group visit_all
+    /// \param 2
+    /// \exclude
+    template <typename Variant, class Visitor,
+              typename = typename std::enable_if<detail::is_variant<Variant>::value>::type>
+    void visit_all(const array_ref<Variant>& variants, Visitor&& visitor)
+    {
+        auto size = static_cast<std::size_t>(variants.size());
+        std::unique_ptr<std::size_t[]> buffer(new std::size_t[size]);
+        detail::visit_all(visitor, variants.data(), size, buffer.get());
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_BATCH_VISIT_HPP_INCLUDED
@@ -0,0 +1,472 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_BOOLEAN_ARRAY_HPP_INCLUDED
+#define TYPE_SAFE_BOOLEAN_ARRAY_HPP_INCLUDED
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <type_safe/boolean.hpp>
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/bitmap.hpp>
+#include <type_safe/index.hpp>
+
+namespace type_safe
+{
+    /// A proxy reference to a single [ts::boolean]() stored as a bit
+    /// in a [ts::boolean_array]() or [ts::boolean_vector]().
+    ///
+    /// It behaves like a `boolean&`:
+    /// it implicitly converts to [ts::boolean]() and assigning to it changes the bit.
+    /// \module types
+    class boolean_reference
+    {
+    public:
+        boolean_reference(const boolean_reference&) = default;
+
+        /// \effects Sets the bit to the given `value`.
+        /// \notes This function does not participate in overload resolution if `T` is not a boolean type.
+        /// \param 1
+        /// \exclude
+        template <typename T, typename = detail::enable_boolean<T>>
+        const boolean_reference& operator=(T value) const noexcept
+        {
+            detail::bitmap_assign(words_, index_, static_cast<bool>(value));
+            return *this;
+        }
+
+        /// \effects Sets the bit to the value of the bit `other` refers to.
+        const boolean_reference& operator=(const boolean_reference& other) const noexcept
+        {
+            return *this = static_cast<boolean>(other);
+        }
+
+        /// \returns The value of the bit.
+        /// \group conversion
+        operator boolean() const noexcept
+        {
+            return detail::bitmap_test(words_, index_);
+        }
+
+        /// \group conversion
+        explicit operator bool() const noexcept
+        {
+            return detail::bitmap_test(words_, index_);
+        }
+
+        /// \returns The same as `!static_cast<bool>(*this)`.
+        boolean operator!() const noexcept
+        {
+            return !detail::bitmap_test(words_, index_);
+        }
+
+        /// \effects Inverts the bit.
+        void flip() const noexcept
+        {
+            *this = !*this;
+        }
+
+    private:
+        boolean_reference(detail::bitmap_word* words, std::size_t index) noexcept
+        : words_(words), index_(index)
+        {
+        }
+
+        detail::bitmap_word* words_;
+        std::size_t          index_;
+
+        template <std::size_t N>
+        friend class boolean_array;
+        friend class boolean_vector;
+    };
+
+    /// A fixed-size array of `N` [ts::boolean]() objects that stores a single bit per element.
+    ///
+    /// Unlike a [std::bitset]() it uses the [ts::boolean]() interface
+    /// and its indices are [ts::index_t]().
+    /// The reductions `all()`, `any()` and `count()` as well as the bitwise operations
+    /// process a whole word of 64 elements at a time.
+    /// \module types
+    template <std::size_t N>
+    class boolean_array
+    {
+    public:
+        using value_type      = boolean;
+        using reference       = boolean_reference;
+        using const_reference = boolean;
+
+        //=== constructors ===//
+        /// \effects Creates an array where all elements are `false`.
+        boolean_array() noexcept : words_()
+        {
+        }
+
+        /// \effects Creates an array where all elements have the given `value`.
+        explicit boolean_array(boolean value) noexcept : words_()
+        {
+            fill(value);
+        }
+
+        //=== size ===//
+        /// \returns The number of elements, i.e. `N`.
+        static constexpr size_t size() noexcept
+        {
+            return N;
+        }
+
+        //=== access ===//
+        /// \returns A [ts::boolean_reference]() to (1)/the value of (2) the `i`th element.
+        /// \requires `i < N`.
+        /// \group index
+        boolean_reference operator[](index_t i) noexcept
+        {
+            return boolean_reference(words_.data(), checked_index(i));
+        }
+
+        /// \group index
+        boolean operator[](index_t i) const noexcept
+        {
+            return detail::bitmap_test(words_.data(), checked_index(i));
+        }
+
+        //=== reductions ===//
+        /// \returns Whether or not all elements are `true`.
+        /// \notes It returns `true` if `N == 0`.
+        boolean all() const noexcept
+        {
+            return detail::bitmap_all(words_.data(), N);
+        }
+
+        /// \returns Whether or not at least one element is `true`.
+        boolean any() const noexcept
+        {
+            return detail::bitmap_any(words_.data(), words_.size());
+        }
+
+        /// \returns Whether or not all elements are `false`.
+        boolean none() const noexcept
+        {
+            return !any();
+        }
+
+        /// \returns The number of elements that are `true`.
+        size_t count() const noexcept
+        {
+            return detail::bitmap_count(words_.data(), words_.size());
+        }
+
+        //=== modifiers ===//
+        /// \effects Sets all elements to the given `value`.
+        void fill(boolean value) noexcept
+        {
+            detail::bitmap_fill(words_.data(), N, static_cast<bool>(value));
+        }
+
+        /// \effects Inverts all elements.
+        void flip() noexcept
+        {
+            detail::bitmap_flip(words_.data(), N);
+        }
+
+        /// \effects Combines each element with the corresponding element of `other`
+        /// using logical and/or/xor.
+        /// \group compound_op
+        boolean_array& operator&=(const boolean_array& other) noexcept
+        {
+            detail::bitmap_and(words_.data(), other.words_.data(), words_.size());
+            return *this;
+        }
+
+        /// \group compound_op
+        boolean_array& operator|=(const boolean_array& other) noexcept
+        {
+            detail::bitmap_or(words_.data(), other.words_.data(), words_.size());
+            return *this;
+        }
+
+        /// \group compound_op
+        boolean_array& operator^=(const boolean_array& other) noexcept
+        {
+            detail::bitmap_xor(words_.data(), other.words_.data(), words_.size());
+            return *this;
+        }
+
+        /// \returns A copy of the array where all elements are inverted.
+        boolean_array operator~() const noexcept
+        {
+            auto result = *this;
+            result.flip();
+            return result;
+        }
+
+        /// \returns The elementwise logical and/or/xor of both arrays.
+        /// \group binary_op
+        friend boolean_array operator&(boolean_array a, const boolean_array& b) noexcept
+        {
+            return a &= b;
+        }
+
+        /// \group binary_op
+        friend boolean_array operator|(boolean_array a, const boolean_array& b) noexcept
+        {
+            return a |= b;
+        }
+
+        /// \group binary_op
+        friend boolean_array operator^(boolean_array a, const boolean_array& b) noexcept
+        {
+            return a ^= b;
+        }
+
+        /// \returns Whether or not all elements are equal/not equal.
+        /// \group comparison
+        friend bool operator==(const boolean_array& a, const boolean_array& b) noexcept
+        {
+            return detail::bitmap_equal(a.words_.data(), b.words_.data(), a.words_.size());
+        }
+
+        /// \group comparison
+        friend bool operator!=(const boolean_array& a, const boolean_array& b) noexcept
+        {
+            return !(a == b);
+        }
+
+    private:
+        static std::size_t checked_index(index_t i) noexcept
+        {
+            auto index = static_cast<std::size_t>(get(i));
+            TYPE_SAFE_PRECONDITION(index < N, "out of bounds access");
+            return index;
+        }
+
+        std::array<detail::bitmap_word, detail::bitmap_word_count(N)> words_;
+    };
+
+    /// A dynamically sized array of [ts::boolean]() objects that stores a single bit per element.
+    ///
+    /// It is the dynamically sized equivalent of [ts::boolean_array](),
+    /// i.e. a [std::vector]() of [ts::boolean]() with the memory footprint of `std::vector<bool>`.
+    /// \notes The bitwise operations require that both vectors have the same size.
+    /// \module types
+    class boolean_vector
+    {
+    public:
+        using value_type      = boolean;
+        using reference       = boolean_reference;
+        using const_reference = boolean;
+
+        //=== constructors ===//
+        /// \effects Creates an empty container.
+        boolean_vector() noexcept : size_(0u)
+        {
+        }
+
+        /// \effects Creates a container with the given number of elements,
+        /// which all have the given `value`.
+        explicit boolean_vector(size_t size, boolean value = false)
+        : words_(detail::bitmap_word_count(static_cast<std::size_t>(size))),
+          size_(static_cast<std::size_t>(size))
+        {
+            fill(value);
+        }
+
+        //=== size ===//
+        /// \returns The number of elements.
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// \returns Whether or not the container has no elements.
+        bool empty() const noexcept
+        {
+            return size_ == 0u;
+        }
+
+        /// \effects Reserves memory for the given number of elements.
+        void reserve(size_t capacity)
+        {
+            words_.reserve(detail::bitmap_word_count(static_cast<std::size_t>(capacity)));
+        }
+
+        /// \effects Changes the number of elements to the given size,
+        /// removing elements at the end or adding elements with the given `value`.
+        void resize(size_t new_size, boolean value = false)
+        {
+            auto size = static_cast<std::size_t>(new_size);
+            words_.resize(detail::bitmap_word_count(size), 0u);
+            for (auto i = size_; i < size; ++i)
+                detail::bitmap_assign(words_.data(), i, static_cast<bool>(value));
+            // clear the bits of removed elements
+            if (!words_.empty())
+                words_.back() &= detail::bitmap_tail_mask(size);
+            size_ = size;
+        }
+
+        /// \effects Removes all elements.
+        void clear() noexcept
+        {
+            words_.clear();
+            size_ = 0u;
+        }
+
+        //=== access ===//
+        /// \returns A [ts::boolean_reference]() to (1)/the value of (2) the `i`th element.
+        /// \requires `i < size()`.
+        /// \group index
+        boolean_reference operator[](index_t i) noexcept
+        {
+            return boolean_reference(words_.data(), checked_index(i));
+        }
+
+        /// \group index
+        boolean operator[](index_t i) const noexcept
+        {
+            return detail::bitmap_test(words_.data(), checked_index(i));
+        }
+
+        //=== reductions ===//
+        /// \returns Whether or not all elements are `true`.
+        /// \notes It returns `true` if the container is empty.
+        boolean all() const noexcept
+        {
+            return detail::bitmap_all(words_.data(), size_);
+        }
+
+        /// \returns Whether or not at least one element is `true`.
+        boolean any() const noexcept
+        {
+            return detail::bitmap_any(words_.data(), words_.size());
+        }
+
+        /// \returns Whether or not all elements are `false`.
+        boolean none() const noexcept
+        {
+            return !any();
+        }
+
+        /// \returns The number of elements that are `true`.
+        size_t count() const noexcept
+        {
+            return detail::bitmap_count(words_.data(), words_.size());
+        }
+
+        //=== modifiers ===//
+        /// \effects Adds a new element with the given `value` at the end.
+        void push_back(boolean value)
+        {
+            if (size_ % detail::bitmap_word_bits == 0u)
+                words_.push_back(0u);
+            detail::bitmap_assign(words_.data(), size_, static_cast<bool>(value));
+            ++size_;
+        }
+
+        /// \effects Removes the last element.
+        /// \requires The container must not be empty.
+        void pop_back() noexcept
+        {
+            TYPE_SAFE_PRECONDITION(!empty(), "container is empty");
+            resize(size_ - 1u);
+        }
+
+        /// \effects Sets all elements to the given `value`.
+        void fill(boolean value) noexcept
+        {
+            detail::bitmap_fill(words_.data(), size_, static_cast<bool>(value));
+        }
+
+        /// \effects Inverts all elements.
+        void flip() noexcept
+        {
+            detail::bitmap_flip(words_.data(), size_);
+        }
+
+        /// \effects Combines each element with the corresponding element of `other`
+        /// using logical and/or/xor.
+        /// \requires `size() == other.size()`.
+        /// \group compound_op
+        boolean_vector& operator&=(const boolean_vector& other) noexcept
+        {
+            detail::bitmap_and(words_.data(), checked_words(other), words_.size());
+            return *this;
+        }
+
+        /// \group compound_op
+        boolean_vector& operator|=(const boolean_vector& other) noexcept
+        {
+            detail::bitmap_or(words_.data(), checked_words(other), words_.size());
+            return *this;
+        }
+
+        /// \group compound_op
+        boolean_vector& operator^=(const boolean_vector& other) noexcept
+        {
+            detail::bitmap_xor(words_.data(), checked_words(other), words_.size());
+            return *this;
+        }
+
+        /// \returns A copy of the container where all elements are inverted.
+        boolean_vector operator~() const
+        {
+            auto result = *this;
+            result.flip();
+            return result;
+        }
+
+        /// \returns The elementwise logical and/or/xor of both containers.
+        /// \requires `a.size() == b.size()`.
+        /// \group binary_op
+        friend boolean_vector operator&(boolean_vector a, const boolean_vector& b) noexcept
+        {
+            return std::move(a &= b);
+        }
+
+        /// \group binary_op
+        friend boolean_vector operator|(boolean_vector a, const boolean_vector& b) noexcept
+        {
+            return std::move(a |= b);
+        }
+
+        /// \group binary_op
+        friend boolean_vector operator^(boolean_vector a, const boolean_vector& b) noexcept
+        {
+            return std::move(a ^= b);
+        }
+
+        /// \returns Whether or not both containers have the same size and all elements are equal/not equal.
+        /// \group comparison
+        friend bool operator==(const boolean_vector& a, const boolean_vector& b) noexcept
+        {
+            return a.size_ == b.size_
+                   && detail::bitmap_equal(a.words_.data(), b.words_.data(), a.words_.size());
+        }
+
+        /// \group comparison
+        friend bool operator!=(const boolean_vector& a, const boolean_vector& b) noexcept
+        {
+            return !(a == b);
+        }
+
+    private:
+        std::size_t checked_index(index_t i) const noexcept
+        {
+            auto index = static_cast<std::size_t>(get(i));
+            TYPE_SAFE_PRECONDITION(index < size_, "out of bounds access");
+            return index;
+        }
+
+        const detail::bitmap_word* checked_words(const boolean_vector& other) const noexcept
+        {
+            TYPE_SAFE_PRECONDITION(size_ == other.size_, "containers must have the same size");
+            return other.words_.data();
+        }
+
+        std::vector<detail::bitmap_word> words_;
+        std::size_t                      size_;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_BOOLEAN_ARRAY_HPP_INCLUDED
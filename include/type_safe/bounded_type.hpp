@@ -5,6 +5,7 @@
 #ifndef TYPE_SAFE_BOUNDED_TYPE_HPP_INCLUDED
 #define TYPE_SAFE_BOUNDED_TYPE_HPP_INCLUDED
 
+#include <cstdint>
 #include <limits>
 #include <type_traits>
 
@@ -166,13 +167,81 @@ namespace type_safe
             template <bool Inclusive, typename T, typename Bound>
             using lower_bound_t = typename std::conditional<Inclusive, greater_equal<T, Bound>,
                                                             greater<T, Bound>>::type;
+
+            // compares integers of different signedness correctly
+            template <typename A, typename B>
+            constexpr bool integer_less(std::true_type, std::true_type, A a, B b) noexcept
+            {
+                return static_cast<long long>(a) < static_cast<long long>(b);
+            }
+
+            template <typename A, typename B>
+            constexpr bool integer_less(std::false_type, std::false_type, A a, B b) noexcept
+            {
+                return static_cast<unsigned long long>(a) < static_cast<unsigned long long>(b);
+            }
+
+            template <typename A, typename B>
+            constexpr bool integer_less(std::true_type, std::false_type, A a, B b) noexcept
+            {
+                return a < A(0)
+                       || static_cast<unsigned long long>(a) < static_cast<unsigned long long>(b);
+            }
+
+            template <typename A, typename B>
+            constexpr bool integer_less(std::false_type, std::true_type, A a, B b) noexcept
+            {
+                return !(b < B(0))
+                       && static_cast<unsigned long long>(a) < static_cast<unsigned long long>(b);
+            }
+
+            template <typename A, typename B>
+            constexpr bool integer_less(A a, B b) noexcept
+            {
+                return integer_less(std::is_signed<A>{}, std::is_signed<B>{}, a, b);
+            }
+
+            template <bool Inclusive, typename A, typename B>
+            constexpr bool integer_before(A a, B b) noexcept
+            {
+                return Inclusive ? !integer_less(b, a) : integer_less(a, b);
+            }
+
+            template <typename Bound>
+            struct is_integer_bound
+                : std::is_integral<typename std::decay<decltype(Bound::value)>::type>
+            {
+            };
+
+            template <>
+            struct is_integer_bound<dynamic_bound> : std::false_type
+            {
+            };
+
+            // no value, so the constant can't be verified at compile-time
+            template <bool Checkable, class Constant, bool LowerInclusive, bool UpperInclusive,
+                      typename LowerBound, typename UpperBound>
+            struct bounded_constant_check
+            {
+            };
+
+            template <class Constant, bool LowerInclusive, bool UpperInclusive,
+                      typename LowerBound, typename UpperBound>
+            struct bounded_constant_check<true, Constant, LowerInclusive, UpperInclusive,
+                                          LowerBound, UpperBound>
+                : std::integral_constant<bool, integer_before<LowerInclusive>(LowerBound::value,
+                                                                              Constant::value)
+                                                   && integer_before<UpperInclusive>(
+                                                          Constant::value, UpperBound::value)>
+            {
+            };
         } // namespace detail
 
         /// Tag objects to specify bounds for [ts::constraints::bounded]().
         /// \group open_closed Open/Closed Tags
-        constexpr bool open = false;
+        TYPE_SAFE_INLINE_VARIABLE constexpr bool open = false;
         /// \group open_closed
-        constexpr bool closed = true;
+        TYPE_SAFE_INLINE_VARIABLE constexpr bool closed = true;
 
         /// A `Constraint` for the [ts::constrained_type]().
         ///
@@ -243,6 +312,22 @@ namespace type_safe
             {
             }
 
+            /// Checks a compile-time constant.
+            ///
+            /// It has a `value` of `true` if the `Constant` is within the bounds,
+            /// `false` otherwise.
+            /// If at least one bound is dynamic, it has no `value`,
+            /// as the `Constant` can't be checked at compile-time.
+            /// \requires `Constant` must be a [std::integral_constant]().
+            template <class Constant>
+            struct is_valid_constant
+                : detail::bounded_constant_check<detail::is_integer_bound<LowerBound>::value
+                                                     && detail::is_integer_bound<UpperBound>::value,
+                                                 Constant, LowerInclusive, UpperInclusive,
+                                                 LowerBound, UpperBound>
+            {
+            };
+
             /// Does the bounds check.
             template <typename U>
             bool operator()(const U& u) const
@@ -378,9 +463,8 @@ namespace type_safe
         namespace lit_detail
         {
             template <typename T, T Value>
-            struct integer_bound
+            struct integer_bound : std::integral_constant<T, Value>
             {
-                static constexpr auto value = Value;
             };
 
             template <typename T, T Value>
@@ -415,6 +499,77 @@ namespace type_safe
         {
             return {};
         }
+
+        /// Creates a compile-time constant of a fixed-width integer type.
+        ///
+        /// It is a [std::integral_constant]() like the result of `_bound`,
+        /// but it has the given type and it is checked that the value fits.
+        /// A [ts::bounded_type]() with static bounds that is constructed from such a constant
+        /// checks it at compile-time, so there's no run-time overhead,
+        /// e.g. `ts::bounded_type<std::int32_t, true, true, decltype(0_bound), decltype(100_bound)>(42_ci32)`.
+        /// \group constant_lit
+        template <char... Digits>
+        constexpr auto operator"" _ci8()
+            -> lit_detail::integer_bound<std::int8_t, detail::parse_signed<std::int8_t, Digits...>()>
+        {
+            return {};
+        }
+
+        /// \group constant_lit
+        template <char... Digits>
+        constexpr auto operator"" _ci16()
+            -> lit_detail::integer_bound<std::int16_t, detail::parse_signed<std::int16_t, Digits...>()>
+        {
+            return {};
+        }
+
+        /// \group constant_lit
+        template <char... Digits>
+        constexpr auto operator"" _ci32()
+            -> lit_detail::integer_bound<std::int32_t, detail::parse_signed<std::int32_t, Digits...>()>
+        {
+            return {};
+        }
+
+        /// \group constant_lit
+        template <char... Digits>
+        constexpr auto operator"" _ci64()
+            -> lit_detail::integer_bound<std::int64_t, detail::parse_signed<std::int64_t, Digits...>()>
+        {
+            return {};
+        }
+
+        /// \group constant_lit
+        template <char... Digits>
+        constexpr auto operator"" _cu8()
+            -> lit_detail::integer_bound<std::uint8_t, detail::parse_unsigned<std::uint8_t, Digits...>()>
+        {
+            return {};
+        }
+
+        /// \group constant_lit
+        template <char... Digits>
+        constexpr auto operator"" _cu16()
+            -> lit_detail::integer_bound<std::uint16_t, detail::parse_unsigned<std::uint16_t, Digits...>()>
+        {
+            return {};
+        }
+
+        /// \group constant_lit
+        template <char... Digits>
+        constexpr auto operator"" _cu32()
+            -> lit_detail::integer_bound<std::uint32_t, detail::parse_unsigned<std::uint32_t, Digits...>()>
+        {
+            return {};
+        }
+
+        /// \group constant_lit
+        template <char... Digits>
+        constexpr auto operator"" _cu64()
+            -> lit_detail::integer_bound<std::uint64_t, detail::parse_unsigned<std::uint64_t, Digits...>()>
+        {
+            return {};
+        }
     } // namespace literals
 
     /// Creates a [ts::bounded_type]() to a specified [ts::constraints::closed_interval]().
@@ -0,0 +1,395 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_BOXED_HPP_INCLUDED
+#define TYPE_SAFE_BOXED_HPP_INCLUDED
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <type_safe/config.hpp>
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/relocation.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        // empty base optimization for the allocator
+        template <class Allocator>
+        struct boxed_storage : Allocator
+        {
+            using pointer = typename std::allocator_traits<Allocator>::pointer;
+
+            pointer ptr;
+
+            explicit boxed_storage(const Allocator& alloc) noexcept
+            : Allocator(alloc), ptr(nullptr)
+            {
+            }
+
+            explicit boxed_storage(Allocator&& alloc) noexcept
+            : Allocator(std::move(alloc)), ptr(nullptr)
+            {
+            }
+
+            Allocator& get_allocator() noexcept
+            {
+                return *this;
+            }
+
+            const Allocator& get_allocator() const noexcept
+            {
+                return *this;
+            }
+        };
+    } // namespace detail
+
+    /// A heap (or arena) allocated value with value semantics.
+    ///
+    /// It stores a pointer to a `T` allocated by the `Allocator`,
+    /// copying it copies the value, comparing it compares the values.
+    /// Unlike `T` itself it can be declared with an incomplete type,
+    /// so it can be used to create recursive [ts::basic_variant]() types:
+    /// ```cpp
+    /// struct json;
+    /// using json_array = ts::boxed<std::vector<json>>;
+    /// struct json : ts::variant<ts::nullvar_t, double, std::string, json_array>
+    /// { ... };
+    /// ```
+    /// [ts::visit]() unwraps it transparently, i.e. the visitor is called with `T` and not the `boxed`.
+    /// The member functions of the variant, like `has_value()` and `value()`, do not:
+    /// they have to be called with `variant_type<boxed<T>>` and return the `boxed`.
+    ///
+    /// With a [ts::arena_allocator]() allocation is just a pointer bump,
+    /// and a whole tree can be freed at once by releasing the arena.
+    /// \requires `Allocator::value_type` must be `T`.
+    /// \notes A moved-from `boxed` does not store a value,
+    /// it may only be destroyed or assigned to.
+    /// \module types
+    template <typename T, class Allocator = std::allocator<T>>
+    class boxed
+    {
+        using traits = std::allocator_traits<Allocator>;
+
+    public:
+        using value_type     = T;
+        using allocator_type = Allocator;
+
+        //=== constructors/destructor/assignment ===//
+        /// \effects Creates it by copying (1)/moving (2) the value into newly allocated memory
+        /// from a default constructed `Allocator`.
+        /// \throws Anything thrown by the allocation or the copy/move constructor of `T`.
+        /// \group ctor_value
+        boxed(const T& value) : boxed(std::allocator_arg, Allocator(), value)
+        {
+        }
+
+        /// \group ctor_value
+        boxed(T&& value) : boxed(std::allocator_arg, Allocator(), std::move(value))
+        {
+        }
+
+        /// \effects Creates it by allocating memory using the given allocator
+        /// and constructing the value by forwarding the arguments.
+        /// \throws Anything thrown by the allocation or the constructor of `T`.
+        template <typename... Args>
+        boxed(std::allocator_arg_t, const Allocator& alloc, Args&&... args) : storage_(alloc)
+        {
+            create(std::forward<Args>(args)...);
+        }
+
+        /// \effects Copies the value of `other` into new memory,
+        /// allocated by `std::allocator_traits<Allocator>::select_on_container_copy_construction()`.
+        /// \throws Anything thrown by the allocation or the copy constructor of `T`.
+        boxed(const boxed& other)
+        : storage_(traits::select_on_container_copy_construction(other.get_allocator()))
+        {
+            create(other.value());
+        }
+
+        /// \effects Takes ownership of the value of `other`, no allocation is done.
+        boxed(boxed&& other) noexcept : storage_(std::move(other.storage_.get_allocator()))
+        {
+            storage_.ptr       = other.storage_.ptr;
+            other.storage_.ptr = nullptr;
+        }
+
+        /// \effects Destroys the value and deallocates its memory.
+        ~boxed() noexcept
+        {
+            destroy();
+        }
+
+        /// \effects Copy assigns the value of `other`,
+        /// if `*this` has been moved from, it copies it into new memory instead.
+        /// If the allocator propagates on copy assignment and the allocators don't compare equal,
+        /// it copies the value into memory allocated by the allocator of `other` instead,
+        /// then destroys the current value and takes over the allocator.
+        /// \throws Anything thrown by the allocation, the copy assignment operator
+        /// or the copy constructor of `T`.
+        boxed& operator=(const boxed& other)
+        {
+            copy_assign(typename traits::propagate_on_container_copy_assignment{}, other);
+            return *this;
+        }
+
+        /// \effects Takes ownership of the value of `other` after destroying the current one,
+        /// if the allocators propagate or compare equal.
+        /// Otherwise it move assigns the value.
+        /// \throws Nothing if the allocator propagates on move assignment,
+        /// otherwise anything thrown by the move assignment operator or the move constructor of `T`.
+        boxed& operator=(boxed&& other) noexcept(
+            traits::propagate_on_container_move_assignment::value)
+        {
+            move_assign(typename traits::propagate_on_container_move_assignment{}, other);
+            return *this;
+        }
+
+        /// \effects Exchanges the ownership of the values.
+        /// \requires The allocators must propagate on swap or compare equal.
+        friend void swap(boxed& a, boxed& b) noexcept
+        {
+            TYPE_SAFE_PRECONDITION(traits::propagate_on_container_swap::value
+                                       || a.get_allocator() == b.get_allocator(),
+                                   "cannot swap boxed");
+            swap_allocator(typename traits::propagate_on_container_swap{}, a, b);
+            std::swap(a.storage_.ptr, b.storage_.ptr);
+        }
+
+        //=== access ===//
+        /// \returns A reference to the stored value.
+        /// \requires `*this` must not have been moved from.
+        /// \group value
+        T& value() TYPE_SAFE_LVALUE_REF noexcept
+        {
+            TYPE_SAFE_PRECONDITION(storage_.ptr != nullptr, "boxed moved from");
+            return *storage_.ptr;
+        }
+
+        /// \group value
+        const T& value() const TYPE_SAFE_LVALUE_REF noexcept
+        {
+            TYPE_SAFE_PRECONDITION(storage_.ptr != nullptr, "boxed moved from");
+            return *storage_.ptr;
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group value
+        T&& value() && noexcept
+        {
+            return std::move(value());
+        }
+
+        /// \group value
+        const T&& value() const && noexcept
+        {
+            return std::move(value());
+        }
+#endif
+
+        /// \returns The same as `value()`.
+        /// \group deref
+        T& operator*() TYPE_SAFE_LVALUE_REF noexcept
+        {
+            return value();
+        }
+
+        /// \group deref
+        const T& operator*() const TYPE_SAFE_LVALUE_REF noexcept
+        {
+            return value();
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group deref
+        T&& operator*() && noexcept
+        {
+            return std::move(value());
+        }
+
+        /// \group deref
+        const T&& operator*() const && noexcept
+        {
+            return std::move(value());
+        }
+#endif
+
+        /// \returns A pointer to the stored value.
+        /// \requires `*this` must not have been moved from.
+        /// \group arrow
+        T* operator->() noexcept
+        {
+            return &value();
+        }
+
+        /// \group arrow
+        const T* operator->() const noexcept
+        {
+            return &value();
+        }
+
+        /// \returns A copy of the allocator.
+        allocator_type get_allocator() const noexcept
+        {
+            return storage_.get_allocator();
+        }
+
+    private:
+        template <typename... Args>
+        void create(Args&&... args)
+        {
+            DEBUG_ASSERT(storage_.ptr == nullptr, detail::assert_handler{});
+            auto& alloc = storage_.get_allocator();
+            auto  ptr   = traits::allocate(alloc, 1u);
+            TYPE_SAFE_TRY
+            {
+                traits::construct(alloc, std::addressof(*ptr), std::forward<Args>(args)...);
+            }
+            TYPE_SAFE_CATCH_ALL
+            {
+                traits::deallocate(alloc, ptr, 1u);
+                TYPE_SAFE_RETHROW;
+            }
+            storage_.ptr = ptr;
+        }
+
+        void destroy() noexcept
+        {
+            if (storage_.ptr)
+            {
+                auto& alloc = storage_.get_allocator();
+                traits::destroy(alloc, std::addressof(*storage_.ptr));
+                traits::deallocate(alloc, storage_.ptr, 1u);
+                storage_.ptr = nullptr;
+            }
+        }
+
+        void copy_assign(std::true_type, const boxed& other)
+        {
+            if (get_allocator() == other.get_allocator())
+            {
+                storage_.get_allocator() = other.storage_.get_allocator();
+                copy_assign(std::false_type{}, other);
+            }
+            else
+            {
+                // the memory must come from the new allocator
+                boxed copy(std::allocator_arg, other.get_allocator(), other.value());
+                move_assign(std::true_type{}, copy);
+            }
+        }
+
+        void copy_assign(std::false_type, const boxed& other)
+        {
+            if (storage_.ptr)
+                value() = other.value();
+            else
+                create(other.value());
+        }
+
+        void move_assign(std::true_type, boxed& other) noexcept
+        {
+            destroy();
+            storage_.get_allocator() = std::move(other.storage_.get_allocator());
+            storage_.ptr             = other.storage_.ptr;
+            other.storage_.ptr       = nullptr;
+        }
+
+        void move_assign(std::false_type, boxed& other)
+        {
+            if (get_allocator() == other.get_allocator())
+            {
+                destroy();
+                storage_.ptr       = other.storage_.ptr;
+                other.storage_.ptr = nullptr;
+            }
+            else if (storage_.ptr)
+                value() = std::move(other.value());
+            else
+                create(std::move(other.value()));
+        }
+
+        static void swap_allocator(std::true_type, boxed& a, boxed& b) noexcept
+        {
+            using std::swap;
+            swap(a.storage_.get_allocator(), b.storage_.get_allocator());
+        }
+
+        static void swap_allocator(std::false_type, boxed&, boxed&) noexcept
+        {
+        }
+
+        detail::boxed_storage<Allocator> storage_;
+
+        static_assert(std::is_same<typename Allocator::value_type, T>::value,
+                      "allocator has wrong value_type");
+    };
+
+    /// \exclude
+    template <typename T, class Allocator>
+    struct is_trivially_relocatable<boxed<T, Allocator>>
+    : std::integral_constant<
+          bool, is_trivially_relocatable<Allocator>::value
+                    && is_trivially_relocatable<
+                           typename std::allocator_traits<Allocator>::pointer>::value>
+    {
+    };
+
+    /// \returns A [ts::boxed]() containing a `T` constructed by forwarding the arguments,
+    /// allocated using the given allocator.
+    /// \throws Anything thrown by the allocation or the constructor of `T`.
+    template <typename T, class Allocator, typename... Args>
+    boxed<T, Allocator> allocate_boxed(const Allocator& alloc, Args&&... args)
+    {
+        return boxed<T, Allocator>(std::allocator_arg, alloc, std::forward<Args>(args)...);
+    }
+
+    /// \returns The result of the comparison of the stored values.
+    /// \group boxed_compare Comparison operators
+    template <typename T, class Allocator>
+    bool operator==(const boxed<T, Allocator>& lhs, const boxed<T, Allocator>& rhs)
+    {
+        return lhs.value() == rhs.value();
+    }
+
+    /// \group boxed_compare
+    template <typename T, class Allocator>
+    bool operator!=(const boxed<T, Allocator>& lhs, const boxed<T, Allocator>& rhs)
+    {
+        return lhs.value() != rhs.value();
+    }
+
+    /// \group boxed_compare
+    template <typename T, class Allocator>
+    bool operator<(const boxed<T, Allocator>& lhs, const boxed<T, Allocator>& rhs)
+    {
+        return lhs.value() < rhs.value();
+    }
+
+    /// \group boxed_compare
+    template <typename T, class Allocator>
+    bool operator<=(const boxed<T, Allocator>& lhs, const boxed<T, Allocator>& rhs)
+    {
+        return lhs.value() <= rhs.value();
+    }
+
+    /// \group boxed_compare
+    template <typename T, class Allocator>
+    bool operator>(const boxed<T, Allocator>& lhs, const boxed<T, Allocator>& rhs)
+    {
+        return lhs.value() > rhs.value();
+    }
+
+    /// \group boxed_compare
+    template <typename T, class Allocator>
+    bool operator>=(const boxed<T, Allocator>& lhs, const boxed<T, Allocator>& rhs)
+    {
+        return lhs.value() >= rhs.value();
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_BOXED_HPP_INCLUDED
@@ -5,10 +5,13 @@
 #ifndef TYPE_SAFE_COMPACT_OPTIONAL_HPP_INCLUDED
 #define TYPE_SAFE_COMPACT_OPTIONAL_HPP_INCLUDED
 
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <type_traits>
 
 #include <type_safe/optional.hpp>
+#include <type_safe/reference.hpp>
 
 namespace type_safe
 {
@@ -78,8 +81,7 @@ namespace type_safe
             typename std::enable_if<std::is_constructible<value_type, Args&&...>::value>::type
         {
             storage_ = static_cast<storage_type>(value_type(std::forward<Args>(args)...));
-            DEBUG_ASSERT(has_value(), detail::precondition_error_handler{},
-                         "create_value() called creating an invalid value");
+            TYPE_SAFE_PRECONDITION(has_value(), "create_value() called creating an invalid value");
         }
 
         /// \effects Copy assigns the `storage_type`.
@@ -192,6 +194,15 @@ namespace type_safe
 
     private:
         storage_type storage_;
+
+        friend detail::compact_optional_access;
+    };
+
+    /// \exclude
+    template <class CompactPolicy>
+    struct is_trivially_relocatable<compact_optional_storage<CompactPolicy>>
+    : is_trivially_relocatable<typename CompactPolicy::storage_type>
+    {
     };
 
     /// An alias for [ts::basic_optional]() using [ts::compact_optional_storage]() with the given `CompactPolicy`.
@@ -247,7 +258,10 @@ namespace type_safe
 
     /// A `CompactPolicy` for [ts::compact_optional_storage]() for floating point types.
     ///
-    /// `NaN` will be used to mark an empty optional.
+    /// The quiet `NaN` of `std::numeric_limits` is stored to mark an empty optional.
+    /// The check is a floating point comparison,
+    /// so an optional storing any other `NaN` is empty as well;
+    /// use [ts::compact_nan_payload_policy]() if `NaN`s are valid values.
     /// \module optional
     template <typename FloatingPoint>
     class compact_floating_point_policy
@@ -270,6 +284,101 @@ namespace type_safe
         }
     };
 
+    /// \exclude
+    namespace detail
+    {
+        template <typename FloatingPoint>
+        struct nan_payload;
+
+        // signaling NaNs with a payload no arithmetic operation produces
+        template <>
+        struct nan_payload<float>
+        {
+            using bits_type = std::uint32_t;
+            static constexpr bits_type value = 0x7FA5A5A5u;
+        };
+
+        template <>
+        struct nan_payload<double>
+        {
+            using bits_type = std::uint64_t;
+            static constexpr bits_type value = 0x7FF5A5A5A5A5A5A5u;
+        };
+
+        template <typename FloatingPoint>
+        typename nan_payload<FloatingPoint>::bits_type float_bits(FloatingPoint value) noexcept
+        {
+            typename nan_payload<FloatingPoint>::bits_type result;
+            std::memcpy(&result, &value, sizeof(result));
+            return result;
+        }
+    } // namespace detail
+
+    /// A `CompactPolicy` for [ts::compact_optional_storage]() for floating point types.
+    ///
+    /// Only a single bit pattern, a signaling `NaN` with a specific payload,
+    /// marks an empty optional.
+    /// Unlike [ts::compact_floating_point_policy]() all other `NaN`s, including the quiet `NaN`,
+    /// are engaged values,
+    /// as the check is a comparison of the bit pattern instead of a floating point comparison.
+    /// \requires `FloatingPoint` must be `float` or `double` in the IEEE 754 format.
+    /// \notes The reserved value is a signaling `NaN` no arithmetic operation produces,
+    /// but it must not be quieted when copied,
+    /// as it happens on platforms passing floating point values via the x87 stack.
+    /// \module optional
+    template <typename FloatingPoint>
+    class compact_nan_payload_policy
+    {
+        static_assert(std::numeric_limits<FloatingPoint>::is_iec559,
+                      "must be an IEEE 754 floating point");
+        static_assert(sizeof(FloatingPoint)
+                          == sizeof(typename detail::nan_payload<FloatingPoint>::bits_type),
+                      "unexpected floating point size");
+
+    public:
+        using value_type   = FloatingPoint;
+        using storage_type = FloatingPoint;
+
+        static storage_type invalid_value() noexcept
+        {
+            storage_type result;
+            auto         bits = detail::nan_payload<FloatingPoint>::value;
+            std::memcpy(&result, &bits, sizeof(result));
+            return result;
+        }
+
+        static bool is_invalid(const storage_type& storage) noexcept
+        {
+            return detail::float_bits(storage) == detail::nan_payload<FloatingPoint>::value;
+        }
+    };
+
+    /// A `CompactPolicy` for [ts::compact_optional_storage]() for pointer types.
+    ///
+    /// An address that is not aligned for `T` will be used to mark an empty optional,
+    /// so unlike [ts::optional_ref]() the null pointer is a valid value.
+    /// \requires The alignment of `T` must be greater than one.
+    /// \module optional
+    template <typename T>
+    class compact_pointer_policy
+    {
+        static_assert(alignof(T) > 1u, "no misaligned address available");
+
+    public:
+        using value_type   = T*;
+        using storage_type = T*;
+
+        static storage_type invalid_value() noexcept
+        {
+            return reinterpret_cast<storage_type>(std::uintptr_t(1u));
+        }
+
+        static bool is_invalid(const storage_type& storage) noexcept
+        {
+            return reinterpret_cast<std::uintptr_t>(storage) == 1u;
+        }
+    };
+
     /// \exclude
     namespace compact_enum_detail
     {
@@ -347,6 +456,166 @@ namespace type_safe
             return static_cast<bool>(detail::is_empty(0, storage));
         }
     };
+
+    /// \exclude
+    namespace detail
+    {
+        struct compact_optional_access
+        {
+            template <class CompactPolicy>
+            static typename CompactPolicy::storage_type* data(
+                const array_ref<compact_optional<CompactPolicy>>& range) noexcept
+            {
+                static_assert(sizeof(compact_optional<CompactPolicy>)
+                                  == sizeof(typename CompactPolicy::storage_type),
+                              "compact_optional must not have overhead");
+                return range.size() == 0u ? nullptr :
+                                            &range.data()->get_storage().storage_;
+            }
+
+            template <class CompactPolicy>
+            static const typename CompactPolicy::storage_type* data(
+                const array_ref<const compact_optional<CompactPolicy>>& range) noexcept
+            {
+                static_assert(sizeof(compact_optional<CompactPolicy>)
+                                  == sizeof(typename CompactPolicy::storage_type),
+                              "compact_optional must not have overhead");
+                return range.size() == 0u ? nullptr :
+                                            &range.data()->get_storage().storage_;
+            }
+        };
+
+        // the range algorithms work on the stored values directly,
+        // so they require a policy where those are the actual values
+        template <class CompactPolicy>
+        using enable_compact_range = typename std::enable_if<
+            std::is_same<typename CompactPolicy::value_type,
+                         typename CompactPolicy::storage_type>::value>::type;
+
+        template <class CompactPolicy>
+        std::size_t count_present(const typename CompactPolicy::storage_type* values,
+                                  std::size_t size) noexcept
+        {
+            std::size_t result = 0u;
+            for (std::size_t i = 0u; i != size; ++i)
+                result += CompactPolicy::is_invalid(values[i]) ? 0u : 1u;
+            return result;
+        }
+
+        // floating point operations might trap, so the compiler must not speculate them:
+        // apply f to the invalid value of every empty optional as well and discard the result,
+        // f gets a copy so it can't change the invalid value
+        template <class CompactPolicy, typename Func>
+        void transform_present(std::true_type, typename CompactPolicy::storage_type* values,
+                               std::size_t size, Func& f)
+        {
+            using storage_type = typename CompactPolicy::storage_type;
+            for (std::size_t i = 0u; i != size; ++i)
+            {
+                auto value  = values[i];
+                auto result = static_cast<storage_type>(f(value));
+                values[i]   = CompactPolicy::is_invalid(values[i]) ? values[i] : result;
+            }
+        }
+
+        // f might not be defined for the invalid value, so only call it for the others
+        template <class CompactPolicy, typename Func>
+        void transform_present(std::false_type, typename CompactPolicy::storage_type* values,
+                               std::size_t size, Func& f)
+        {
+            using storage_type = typename CompactPolicy::storage_type;
+            for (std::size_t i = 0u; i != size; ++i)
+                values[i] = CompactPolicy::is_invalid(values[i]) ?
+                                values[i] :
+                                static_cast<storage_type>(f(values[i]));
+        }
+    } // namespace detail
+
+    /// \effects Sets every empty optional of the range to `value` converted to the `value_type`,
+    /// leaving the others unchanged.
+    ///
+    /// It has the same semantics as the equivalent loop,
+    /// but compares the stored values against the invalid value directly,
+    /// without branches, which allows the compiler to vectorize it.
+    /// \requires `value` converted to `value_type` must not be the invalid value.
+    /// \notes This function does not participate in overload resolution,
+    /// unless the `value_type` of the `CompactPolicy` is the `storage_type`.
+    /// \module optional
+    /// \param 2
+    /// \exclude
+    template <class CompactPolicy, typename U,
+              typename = detail::enable_compact_range<CompactPolicy>>
+    void fill_missing(const array_ref<compact_optional<CompactPolicy>>& range, const U& value)
+    {
+        using storage_type = typename CompactPolicy::storage_type;
+
+        auto fill = static_cast<storage_type>(value);
+        TYPE_SAFE_PRECONDITION(!CompactPolicy::is_invalid(fill),
+                               "fill_missing() called with an invalid value");
+
+        auto values = detail::compact_optional_access::data(range);
+        auto size   = static_cast<std::size_t>(range.size());
+        for (std::size_t i = 0u; i != size; ++i)
+            values[i] = CompactPolicy::is_invalid(values[i]) ? fill : values[i];
+    }
+
+    /// \returns The number of optionals in the range that have a value.
+    ///
+    /// It has the same semantics as the equivalent loop,
+    /// but compares the stored values against the invalid value directly,
+    /// without branches, which allows the compiler to vectorize it.
+    /// \notes These functions do not participate in overload resolution,
+    /// unless the `value_type` of the `CompactPolicy` is the `storage_type`.
+    /// \group count_present
+    /// \module optional
+    /// \param 1
+    /// \exclude
+    template <class CompactPolicy, typename = detail::enable_compact_range<CompactPolicy>>
+    size_t count_present(const array_ref<const compact_optional<CompactPolicy>>& range) noexcept
+    {
+        return detail::count_present<CompactPolicy>(detail::compact_optional_access::data(range),
+                                                    static_cast<std::size_t>(range.size()));
+    }
+
+    /// \group count_present
+    /// \param 1
+    /// \exclude
+    template <class CompactPolicy, typename = detail::enable_compact_range<CompactPolicy>>
+    size_t count_present(const array_ref<compact_optional<CompactPolicy>>& range) noexcept
+    {
+        return detail::count_present<CompactPolicy>(detail::compact_optional_access::data(range),
+                                                    static_cast<std::size_t>(range.size()));
+    }
+
+    /// \effects Replaces the value of every optional of the range that has a value
+    /// with `f(value)` converted to the `value_type`, leaving the empty ones unchanged.
+    ///
+    /// It has the same semantics as the equivalent loop,
+    /// but `f` is applied to the stored values directly
+    /// and the result selected without branches,
+    /// so the compiler can vectorize it if `f` is simple enough to be inlined.
+    /// \requires `f` must be invocable with `value_type&` and return something convertible to it.
+    /// For floating point values, `f` must be pure, i.e. not have any side effects:
+    /// it is invoked for every element,
+    /// with a copy of the policy's invalid value for the empty optionals,
+    /// and the result is discarded for those,
+    /// as the result can't be selected branchless otherwise.
+    /// \notes If `f` returns the invalid value, the optional will be empty afterwards.
+    /// \notes This function does not participate in overload resolution,
+    /// unless the `value_type` of the `CompactPolicy` is the `storage_type`.
+    /// \module optional
+    /// \param 2
+    /// \exclude
+    template <class CompactPolicy, typename Func,
+              typename = detail::enable_compact_range<CompactPolicy>>
+    void transform_present(const array_ref<compact_optional<CompactPolicy>>& range, Func&& f)
+    {
+        auto values = detail::compact_optional_access::data(range);
+        auto size   = static_cast<std::size_t>(range.size());
+        detail::transform_present<CompactPolicy>(std::is_floating_point<
+                                                     typename CompactPolicy::storage_type>{},
+                                                 values, size, f);
+    }
 } // namespace type_safe
 
 #endif // TYPE_SAFE_COMPACT_OPTIONAL_HPP_INCLUDED
@@ -0,0 +1,439 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_COMPACT_VARIANT_HPP_INCLUDED
+#define TYPE_SAFE_COMPACT_VARIANT_HPP_INCLUDED
+
+#include <cstdint>
+#include <type_traits>
+
+#include <type_safe/reference.hpp>
+#include <type_safe/visitor.hpp>
+
+namespace type_safe
+{
+    /// Traits for pointer-like types that can be stored in a [ts::compact_variant]().
+    ///
+    /// The stored pointers are converted to integers and the type of the variant is stored in the low bits,
+    /// which are always zero because of the alignment.
+    /// Specializations must provide the following `static` members:
+    /// * `alignment` - a `constexpr` power of two all pointers are aligned to
+    /// * `std::uintptr_t to_int(const T&) noexcept` - converts the object to an integer
+    /// * `T from_int(std::uintptr_t) noexcept` - converts the integer back to an object
+    ///
+    /// It is specialized for pointers and [ts::object_ref]().
+    /// \module variant
+    template <typename T>
+    struct compact_variant_pointer_traits;
+
+    /// \exclude
+    template <typename T>
+    struct compact_variant_pointer_traits<T*>
+    {
+        static constexpr std::size_t alignment = alignof(T);
+
+        static std::uintptr_t to_int(T* ptr) noexcept
+        {
+            return reinterpret_cast<std::uintptr_t>(ptr);
+        }
+
+        static T* from_int(std::uintptr_t i) noexcept
+        {
+            return reinterpret_cast<T*>(i);
+        }
+    };
+
+    /// \exclude
+    template <typename T, bool XValue>
+    struct compact_variant_pointer_traits<object_ref<T, XValue>>
+    {
+        static constexpr std::size_t alignment = alignof(T);
+
+        static std::uintptr_t to_int(const object_ref<T, XValue>& ref) noexcept
+        {
+            return reinterpret_cast<std::uintptr_t>(ref.operator->());
+        }
+
+        static object_ref<T, XValue> from_int(std::uintptr_t i) noexcept
+        {
+            return object_ref<T, XValue>(*reinterpret_cast<T*>(i));
+        }
+    };
+
+    /// \exclude
+    namespace detail
+    {
+        template <std::size_t... Alignments>
+        struct min_alignment;
+
+        template <std::size_t Alignment>
+        struct min_alignment<Alignment> : std::integral_constant<std::size_t, Alignment>
+        {
+        };
+
+        template <std::size_t Head, std::size_t... Tail>
+        struct min_alignment<Head, Tail...>
+        : std::integral_constant<std::size_t, (Head < min_alignment<Tail...>::value ?
+                                                   Head :
+                                                   min_alignment<Tail...>::value)>
+        {
+        };
+    } // namespace detail
+
+    /// A `CompactVariantPolicy` for [ts::basic_compact_variant]() storing pointer-like types.
+    ///
+    /// The objects are stored as a single [std::uintptr_t]() using the [ts::compact_variant_pointer_traits]().
+    /// The type is stored in the low bits which are unused because of alignment,
+    /// the empty state is the integer `0`.
+    /// \requires All types must have a specialization of the traits
+    /// and the minimal alignment must be greater than the number of types.
+    /// \module variant
+    template <bool AllowEmpty, typename... Types>
+    class pointer_compact_variant_policy
+    {
+        static constexpr std::size_t alignment =
+            detail::min_alignment<compact_variant_pointer_traits<Types>::alignment...>::value;
+        static_assert(alignment > sizeof...(Types), "not enough unused bits to store the type");
+
+        static constexpr std::uintptr_t type_mask = alignment - 1u;
+
+    public:
+        using allow_empty  = std::integral_constant<bool, AllowEmpty>;
+        using storage_type = std::uintptr_t;
+
+        static constexpr storage_type invalid_value() noexcept
+        {
+            return 0u;
+        }
+
+        static constexpr std::size_t get_type(storage_type storage) noexcept
+        {
+            return static_cast<std::size_t>(storage & type_mask);
+        }
+
+        template <typename T>
+        static storage_type store(std::size_t type, const T& obj) noexcept
+        {
+            auto value = compact_variant_pointer_traits<T>::to_int(obj);
+            TYPE_SAFE_PRECONDITION((value & type_mask) == 0u, "pointer not properly aligned");
+            return value | type;
+        }
+
+        template <typename T>
+        static T load(variant_type<T>, storage_type storage) noexcept
+        {
+            return compact_variant_pointer_traits<T>::from_int(storage & ~type_mask);
+        }
+    };
+
+    /// A variant storing at most one of the given types without a separate tag.
+    ///
+    /// Unlike [ts::basic_variant]() it does not store a [ts::tagged_union]().
+    /// Instead the active type is encoded in-band in unused bit patterns of the stored objects,
+    /// so the variant is as big as its `storage_type`.
+    /// How this is done is controlled by the `CompactVariantPolicy`.
+    /// It must provide the following `static` members and typedefs:
+    /// * `allow_empty` - either [std::true_type]() or [std::false_type]()
+    /// * `storage_type` - the actual type that is being stored
+    /// * `storage_type invalid_value()` - returns the value that marks the variant as empty
+    /// * `std::size_t get_type(const storage_type&)` - returns `0` if empty or `i` if it stores the `i`th type
+    /// * `storage_type store(std::size_t i, const T& obj)` - encodes `obj`, which is the `i`th type
+    /// * `T load(variant_type<T>, const storage_type&)` - decodes the stored object of type `T`
+    ///
+    /// All of those are assumed to be `noexcept` and cheap,
+    /// so changing the value can never leave the variant without a value.
+    /// As the objects are not stored directly,
+    /// `value()` returns a copy and not a reference.
+    /// \module variant
+    template <class CompactVariantPolicy, typename HeadT, typename... TailT>
+    class basic_compact_variant
+    {
+        using storage_type = typename CompactVariantPolicy::storage_type;
+
+    public:
+        using types   = variant_types<HeadT, TailT...>;
+        using type_id = typename tagged_union<HeadT, TailT...>::type_id;
+
+        using allow_empty = typename CompactVariantPolicy::allow_empty;
+
+        static constexpr type_id invalid_type = type_id();
+
+        //=== constructors/assignment ===//
+        /// \effects Initializes the variant to the empty state.
+        /// \notes This constructor only participates in overload resolution,
+        /// if the policy allows an empty variant.
+        /// \group default
+        /// \param Dummy
+        /// \exclude
+        /// \param 1
+        /// \exclude
+        template <typename Dummy = void,
+                  typename = typename std::enable_if<CompactVariantPolicy::allow_empty::value,
+                                                     Dummy>::type>
+        basic_compact_variant() noexcept : storage_(CompactVariantPolicy::invalid_value())
+        {
+        }
+
+        /// \group default
+        /// \param Dummy
+        /// \exclude
+        /// \param 1
+        /// \exclude
+        template <typename Dummy = void,
+                  typename = typename std::enable_if<CompactVariantPolicy::allow_empty::value,
+                                                     Dummy>::type>
+        basic_compact_variant(nullvar_t) noexcept : basic_compact_variant()
+        {
+        }
+
+        /// \effects Creates a temporary object of type `T` by forwarding `args` and stores it.
+        /// \throws Anything thrown by `T`s constructor.
+        /// \notes This constructor only participates in overload resolution,
+        /// if `T` is a valid type for this variant and constructible from the arguments.
+        /// \param 2
+        /// \exclude
+        template <typename T, typename... Args,
+                  typename = detail::enable_variant_type<tagged_union<HeadT, TailT...>, T,
+                                                         Args&&...>>
+        explicit basic_compact_variant(variant_type<T> type, Args&&... args)
+        : storage_(store(type, T(std::forward<Args>(args)...)))
+        {
+        }
+
+        /// \effects Same as the `variant_type` overload, but deduces the type.
+        /// \notes This constructor only participates in overload resolution,
+        /// if `T` is a valid type for this variant.
+        /// \param 1
+        /// \exclude
+        template <typename T, typename = detail::enable_variant_type<tagged_union<HeadT, TailT...>,
+                                                                     T, T&&>>
+        basic_compact_variant(T&& obj)
+        : basic_compact_variant(variant_type<typename std::decay<T>::type>{}, std::forward<T>(obj))
+        {
+        }
+
+        /// \effects Same as `reset()`.
+        /// \notes This function only participates in overload resolution,
+        /// if the policy allows an empty variant.
+        /// \param Dummy
+        /// \exclude
+        /// \param 1
+        /// \exclude
+        template <typename Dummy = void,
+                  typename = typename std::enable_if<CompactVariantPolicy::allow_empty::value,
+                                                     Dummy>::type>
+        basic_compact_variant& operator=(nullvar_t) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        /// \effects Same as `emplace(variant_type<T>{}, std::forward<T>(obj))`.
+        /// \notes This function only participates in overload resolution,
+        /// if `T` is a valid type for this variant.
+        /// \param 1
+        /// \exclude
+        template <typename T, typename = detail::enable_variant_type<tagged_union<HeadT, TailT...>,
+                                                                     T, T&&>>
+        basic_compact_variant& operator=(T&& obj)
+        {
+            emplace(variant_type<typename std::decay<T>::type>{}, std::forward<T>(obj));
+            return *this;
+        }
+
+        //=== modifiers ===//
+        /// \effects Puts the variant in the empty state.
+        /// \notes This function only participates in overload resolution,
+        /// if the policy allows an empty variant.
+        /// \param Dummy
+        /// \exclude
+        /// \param 1
+        /// \exclude
+        template <typename Dummy = void,
+                  typename = typename std::enable_if<CompactVariantPolicy::allow_empty::value,
+                                                     Dummy>::type>
+        void reset() noexcept
+        {
+            storage_ = CompactVariantPolicy::invalid_value();
+        }
+
+        /// \effects Creates a temporary object of type `T` by forwarding `args` and stores it,
+        /// replacing the old value.
+        /// \throws Anything thrown by `T`s constructor,
+        /// in which case the variant is unchanged.
+        /// \notes This function only participates in overload resolution,
+        /// if `T` is a valid type for this variant and constructible from the arguments.
+        /// \param 2
+        /// \exclude
+        template <typename T, typename... Args,
+                  typename = detail::enable_variant_type<tagged_union<HeadT, TailT...>, T,
+                                                         Args&&...>>
+        void emplace(variant_type<T> type, Args&&... args)
+        {
+            storage_ = store(type, T(std::forward<Args>(args)...));
+        }
+
+        //=== observers ===//
+        /// \returns The type id representing the type of the value currently stored in the variant.
+        /// \notes If it does not have a value stored, returns [*invalid_type]().
+        type_id type() const noexcept
+        {
+            const type_id ids[] = {invalid_type, type_id(variant_type<HeadT>{}),
+                                   type_id(variant_type<TailT>{})...};
+            return ids[CompactVariantPolicy::get_type(storage_)];
+        }
+
+        /// \returns `true` if the variant currently contains a value,
+        /// `false` otherwise.
+        /// \group has_value
+        bool has_value() const noexcept
+        {
+            return CompactVariantPolicy::get_type(storage_) != 0u;
+        }
+
+        /// \group has_value
+        explicit operator bool() const noexcept
+        {
+            return has_value();
+        }
+
+        /// \group has_value
+        bool has_value(variant_type<nullvar_t>) const noexcept
+        {
+            return !has_value();
+        }
+
+        /// \returns `true` if the variant currently stores an object of type `T`,
+        /// `false` otherwise.
+        /// \notes `T` must not necessarily be a type that can be stored in the variant.
+        template <typename T>
+        bool has_value(variant_type<T> type) const noexcept
+        {
+            return this->type() == type_id(type);
+        }
+
+        /// \returns A copy of [ts::nullvar]().
+        /// \requires The variant must be empty.
+        nullvar_t value(variant_type<nullvar_t>) const noexcept
+        {
+            TYPE_SAFE_PRECONDITION(!has_value(), "variant not empty");
+            return nullvar;
+        }
+
+        /// \returns A copy of the stored object of the given type.
+        /// \requires The variant must currently store an object of the given type,
+        /// i.e. `has_value(type)` must return `true`.
+        /// \param 1
+        /// \exclude
+        template <typename T,
+                  typename = typename std::enable_if<type_id::template is_valid<T>()>::type>
+        T value(variant_type<T> type) const noexcept
+        {
+            TYPE_SAFE_PRECONDITION(has_value(type), "wrong type");
+            return CompactVariantPolicy::load(type, storage_);
+        }
+
+        /// \returns A [ts::optional]() containing a copy of the stored object of the given type.
+        /// If it stores a different type, returns [ts::nullopt]().
+        /// \param 1
+        /// \exclude
+        template <typename T,
+                  typename = typename std::enable_if<type_id::template is_valid<T>()>::type>
+        optional<T> optional_value(variant_type<T> type) const noexcept
+        {
+            return has_value(type) ? optional<T>(value(type)) : optional<T>(nullopt);
+        }
+
+        /// \returns If the variant currently stores an object of type `T`,
+        /// returns a copy of that.
+        /// Otherwise returns `other` converted to `T`.
+        /// \notes `T` must not necessarily be a type that can be stored in the variant.
+        /// \param 2
+        /// \exclude
+        template <typename T, typename U>
+        T value_or(variant_type<T> type, U&& other,
+                   typename std::enable_if<std::is_convertible<U&&, T>::value, int>::type = 0) const
+        {
+            return has_value(type) ? value(type) : static_cast<T>(std::forward<U>(other));
+        }
+
+    private:
+        template <typename T>
+        static storage_type store(variant_type<T>, const T& obj) noexcept
+        {
+            return CompactVariantPolicy::store(detail::get_type_index<T, HeadT, TailT...>::value,
+                                               obj);
+        }
+
+        storage_type storage_;
+
+        template <class Policy, typename Head, typename... Types>
+        friend bool operator==(const basic_compact_variant<Policy, Head, Types...>& lhs,
+                               const basic_compact_variant<Policy, Head, Types...>& rhs) noexcept;
+    };
+
+    /// \exclude
+    template <class CompactVariantPolicy, typename Head, typename... Types>
+    constexpr typename basic_compact_variant<CompactVariantPolicy, Head, Types...>::type_id
+        basic_compact_variant<CompactVariantPolicy, Head, Types...>::invalid_type;
+
+    /// \returns `true` if both variants are empty or store the same object,
+    /// `false` otherwise.
+    /// \notes As the encoding of the policy is unique,
+    /// it only compares the underlying storage.
+    /// \group compact_variant_comp
+    /// \module variant
+    template <class CompactVariantPolicy, typename Head, typename... Types>
+    bool operator==(const basic_compact_variant<CompactVariantPolicy, Head, Types...>& lhs,
+                    const basic_compact_variant<CompactVariantPolicy, Head, Types...>& rhs) noexcept
+    {
+        return lhs.storage_ == rhs.storage_;
+    }
+
+    /// \group compact_variant_comp
+    template <class CompactVariantPolicy, typename Head, typename... Types>
+    bool operator!=(const basic_compact_variant<CompactVariantPolicy, Head, Types...>& lhs,
+                    const basic_compact_variant<CompactVariantPolicy, Head, Types...>& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /// \exclude
+    namespace detail
+    {
+        template <class CompactVariantPolicy, typename Head, typename... Types>
+        struct is_variant_impl<basic_compact_variant<CompactVariantPolicy, Head, Types...>>
+        : std::true_type
+        {
+        };
+
+        template <typename Head, typename... Types>
+        struct select_compact_variant
+        {
+            using type =
+                basic_compact_variant<pointer_compact_variant_policy<false, Head, Types...>, Head,
+                                      Types...>;
+        };
+
+        template <typename Head, typename... Types>
+        struct select_compact_variant<nullvar_t, Head, Types...>
+        {
+            using type =
+                basic_compact_variant<pointer_compact_variant_policy<true, Head, Types...>, Head,
+                                      Types...>;
+        };
+    } // namespace detail
+
+    /// A [ts::basic_compact_variant]() using the [ts::pointer_compact_variant_policy]().
+    ///
+    /// It is a variant of pointer-like types, like [ts::object_ref](),
+    /// with the size of a single pointer.
+    /// If the first type is [ts::nullvar_t]() it allows the empty state,
+    /// otherwise it is never empty.
+    /// \module variant
+    template <typename Head, typename... Types>
+    using compact_variant = typename detail::select_compact_variant<Head, Types...>::type;
+} // namespace type_safe
+
+#endif // TYPE_SAFE_COMPACT_VARIANT_HPP_INCLUDED
@@ -22,6 +22,29 @@
 #define TYPE_SAFE_ENABLE_PRECONDITION_CHECKS 1
 #endif
 
+#ifndef TYPE_SAFE_PRECONDITION_TELEMETRY
+/// Controls whether precondition violations are counted instead of handled.
+///
+/// If enabled, all preconditions are checked regardless of [TYPE_SAFE_ENABLE_PRECONDITION_CHECKS](),
+/// a violation increments a counter for the call site and execution continues.
+/// The counters can be queried with [ts::violation_stats]().
+///
+/// It is disabled by default.
+#define TYPE_SAFE_PRECONDITION_TELEMETRY 0
+#endif
+
+#ifndef TYPE_SAFE_PRECONDITION_SAMPLING
+/// Controls whether the precondition checks on hot paths are only done for some invocations.
+///
+/// If enabled, checks of [ts::at()](), [ts::assertion_verifier](), [ts::undefined_behavior_arithmetic]()
+/// and the type checks of [ts::tagged_union]() only run for one in N invocations per thread,
+/// N can be changed at runtime with [ts::set_precondition_sample_rate]().
+/// All other preconditions are still checked according to [TYPE_SAFE_ENABLE_PRECONDITION_CHECKS]().
+///
+/// It is disabled by default.
+#define TYPE_SAFE_PRECONDITION_SAMPLING 0
+#endif
+
 #ifndef TYPE_SAFE_ENABLE_WRAPPER
 /// Controls whether the typedefs in [types.hpp]() use the type safe wrapper types.
 ///
@@ -98,6 +121,108 @@
 #define TYPE_SAFE_CONSTEXPR14
 #endif
 
+#ifndef TYPE_SAFE_USE_INLINE_VARIABLES
+
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606
+/// \exclude
+#define TYPE_SAFE_USE_INLINE_VARIABLES 1
+#else
+/// \exclude
+#define TYPE_SAFE_USE_INLINE_VARIABLES 0
+#endif
+
+#endif
+
+#if TYPE_SAFE_USE_INLINE_VARIABLES
+// gives the constants external linkage, which is required to export them from a module
+/// \exclude
+#define TYPE_SAFE_INLINE_VARIABLE inline
+#else
+/// \exclude
+#define TYPE_SAFE_INLINE_VARIABLE
+#endif
+
+#ifndef TYPE_SAFE_USE_BUILTIN_OVERFLOW
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 7
+// GCC's __builtin_*_overflow_p() are usable in constant expressions
+/// \exclude
+#define TYPE_SAFE_USE_BUILTIN_OVERFLOW 1
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_mul_overflow) && __has_builtin(__builtin_is_constant_evaluated)
+/// \exclude
+#define TYPE_SAFE_USE_BUILTIN_OVERFLOW 1
+#else
+/// \exclude
+#define TYPE_SAFE_USE_BUILTIN_OVERFLOW 0
+#endif
+#else
+/// \exclude
+#define TYPE_SAFE_USE_BUILTIN_OVERFLOW 0
+#endif
+
+#endif
+
+#ifndef TYPE_SAFE_USE_IS_CONSTANT_EVALUATED
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9
+/// \exclude
+#define TYPE_SAFE_USE_IS_CONSTANT_EVALUATED 1
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+/// \exclude
+#define TYPE_SAFE_USE_IS_CONSTANT_EVALUATED 1
+#else
+/// \exclude
+#define TYPE_SAFE_USE_IS_CONSTANT_EVALUATED 0
+#endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+/// \exclude
+#define TYPE_SAFE_USE_IS_CONSTANT_EVALUATED 1
+#else
+/// \exclude
+#define TYPE_SAFE_USE_IS_CONSTANT_EVALUATED 0
+#endif
+
+#endif
+
+#ifndef TYPE_SAFE_USE_FROM_CHARS
+
+// std::from_chars() and std::to_chars() of <charconv>
+#if defined(__has_include)
+#if __has_include(<charconv>)                                                                     \
+    && (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+/// \exclude
+#define TYPE_SAFE_USE_FROM_CHARS 1
+#else
+/// \exclude
+#define TYPE_SAFE_USE_FROM_CHARS 0
+#endif
+#else
+/// \exclude
+#define TYPE_SAFE_USE_FROM_CHARS 0
+#endif
+
+#endif
+
+#ifndef TYPE_SAFE_USE_COROUTINES
+
+// C++20 coroutines with <coroutine>
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && defined(__has_include)
+#if __has_include(<coroutine>)
+/// \exclude
+#define TYPE_SAFE_USE_COROUTINES 1
+#else
+/// \exclude
+#define TYPE_SAFE_USE_COROUTINES 0
+#endif
+#else
+/// \exclude
+#define TYPE_SAFE_USE_COROUTINES 0
+#endif
+
+#endif
+
 #ifndef TYPE_SAFE_USE_EXCEPTIONS
 
 #if __cpp_exceptions
@@ -154,6 +279,12 @@ namespace type_safe
 
 #endif
 
+#ifndef TYPE_SAFE_CACHE_LINE_SIZE
+// assumed size of a cache line, used to avoid false sharing
+/// \exclude
+#define TYPE_SAFE_CACHE_LINE_SIZE 64
+#endif
+
 /// \entity type_safe
 /// \unique_name ts
 
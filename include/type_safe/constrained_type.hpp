@@ -13,6 +13,7 @@
 #include <type_safe/detail/assert.hpp>
 #include <type_safe/detail/is_nothrow_swappable.hpp>
 #include <type_safe/config.hpp>
+#include <type_safe/relocation.hpp>
 
 namespace type_safe
 {
@@ -27,8 +28,7 @@ namespace type_safe
         template <typename Value, typename Predicate>
         static void verify(const Value& val, const Predicate& p)
         {
-            DEBUG_ASSERT(p(val), detail::precondition_error_handler{},
-                         "value does not fulfill constraint");
+            TYPE_SAFE_SAMPLED_PRECONDITION(p(val), "value does not fulfill constraint");
         }
     };
 
@@ -74,6 +74,27 @@ namespace type_safe
         struct is_valid : decltype(verify_static_constrained<Constraint, T>(0))
         {
         };
+
+        template <class Constraint, class Constant>
+        auto verify_constant_constrained(int)
+            -> decltype(Constraint::template is_valid_constant<Constant>::value, std::true_type{});
+
+        template <class Constraint, class Constant>
+        auto verify_constant_constrained(char) -> std::false_type;
+
+        template <class Constraint, class Constant>
+        struct has_constant_check : decltype(verify_constant_constrained<Constraint, Constant>(0))
+        {
+        };
+
+        // only for the verifiers that just check the value, the others might modify it
+        template <class Verifier, class Constraint, class Constant>
+        struct is_verifiable_constant
+            : std::integral_constant<bool, (std::is_same<Verifier, assertion_verifier>::value
+                                            || std::is_same<Verifier, throwing_verifier>::value)
+                                               && has_constant_check<Constraint, Constant>::value>
+        {
+        };
     } // namespace detail
 
     template <typename T, class Constraint, class Verifier>
@@ -84,6 +105,9 @@ namespace type_safe
     /// The `Constraint` is checked by the `Verifier`.
     /// The `Constraint` can also provide a nested template `is_valid<T>` to statically check types.
     /// Those will be checked regardless of the `Verifier`.
+    /// Likewise, it can provide a nested template `is_valid_constant<Constant>`
+    /// to check a [std::integral_constant]() at compile-time,
+    /// then constructing it from the constant doesn't invoke a checking `Verifier` at all.
     ///
     /// If `T` is `const`, the `modify()` function will not be available,
     /// you can only modify the type by assigning a completely new value to it.
@@ -120,6 +144,30 @@ namespace type_safe
             verify();
         }
 
+        /// \effects Creates it giving it the compile-time constant `Value` and a `predicate`.
+        /// The constant is verified with a `static_assert()`,
+        /// so there is no run-time check and the `Verifier` is not invoked.
+        /// \notes This constructor only participates in overload resolution,
+        /// if the `Constraint` provides a nested template `is_valid_constant<Constant>`
+        /// that can check the constant
+        /// and the `Verifier` is [ts::assertion_verifier]() or [ts::throwing_verifier](),
+        /// otherwise the constant is converted to `value_type` and verified as usual.
+        /// \param 2
+        /// \exclude
+        template <typename U, U Value,
+                  typename = typename std::enable_if<
+                      detail::is_verifiable_constant<Verifier, constraint_predicate,
+                                                     std::integral_constant<U, Value>>::value>::type>
+        explicit constrained_type(std::integral_constant<U, Value>,
+                                  constraint_predicate predicate = {}) noexcept(
+            std::is_nothrow_constructible<value_type, U>::value)
+        : Constraint(std::move(predicate)), value_(Value)
+        {
+            static_assert(constraint_predicate::template is_valid_constant<
+                              std::integral_constant<U, Value>>::value,
+                          "constant does not fulfill constraint");
+        }
+
         /// \exclude
         template <typename U,
                   typename = typename std::enable_if<!detail::is_valid<constraint_predicate,
@@ -260,6 +308,14 @@ namespace type_safe
         friend constrained_modifier<T, Constraint, Verifier>;
     };
 
+    /// \exclude
+    template <typename T, class Constraint, class Verifier>
+    struct is_trivially_relocatable<constrained_type<T, Constraint, Verifier>>
+    : std::integral_constant<bool, is_trivially_relocatable<typename std::remove_cv<T>::type>::value
+                                       && is_trivially_relocatable<Constraint>::value>
+    {
+    };
+
     /// Specialization of [ts::constrained_type]() for references.
     ///
     /// It models a reference to a value that always fulfills the given constraint.
@@ -337,6 +393,13 @@ namespace type_safe
         friend constrained_modifier<T&, Constraint, Verifier>;
     };
 
+    /// \exclude
+    template <typename T, class Constraint, class Verifier>
+    struct is_trivially_relocatable<constrained_type<T&, Constraint, Verifier>>
+    : is_trivially_relocatable<Constraint>
+    {
+    };
+
     /// Alias for [ts::constrained_type<T&>](standardese://ts::constrained_type_ref/).
     template <typename T, class Constraint, class Verifier = assertion_verifier>
     using constrained_ref = constrained_type<T&, Constraint, Verifier>;
@@ -393,7 +456,7 @@ namespace type_safe
         /// \requires It must not be in the moved-from state.
         value_type& get() noexcept
         {
-            DEBUG_ASSERT(value_, detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(value_, "value has been moved from");
             return value_->get_non_const();
         }
 
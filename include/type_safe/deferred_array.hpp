@@ -0,0 +1,324 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_DEFERRED_ARRAY_HPP_INCLUDED
+#define TYPE_SAFE_DEFERRED_ARRAY_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/bitmap.hpp>
+#include <type_safe/index.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        template <typename T>
+        using deferred_storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+        template <typename T>
+        T* deferred_value(deferred_storage<T>* storage, std::size_t i) noexcept
+        {
+            return static_cast<T*>(static_cast<void*>(&storage[i]));
+        }
+
+        template <typename T>
+        const T* deferred_value(const deferred_storage<T>* storage, std::size_t i) noexcept
+        {
+            return static_cast<const T*>(static_cast<const void*>(&storage[i]));
+        }
+
+        // nothing to do, clearing the bitmap is enough
+        template <typename T>
+        void deferred_destroy_all(std::true_type, deferred_storage<T>*, const bitmap_word*,
+                                  std::size_t) noexcept
+        {
+        }
+
+        // only visits the set bits, so sparse arrays are cheap
+        template <typename T>
+        void deferred_destroy_all(std::false_type, deferred_storage<T>* storage,
+                                  const bitmap_word* words, std::size_t word_count) noexcept
+        {
+            bitmap_for_each(words, word_count, [&](std::size_t i) {
+                deferred_value<T>(storage, i)->~T();
+            });
+        }
+
+        template <typename T>
+        void deferred_destroy_all(deferred_storage<T>* storage, bitmap_word* words,
+                                  std::size_t word_count) noexcept
+        {
+            deferred_destroy_all<T>(std::is_trivially_destructible<T>{}, storage, words,
+                                    word_count);
+            std::fill(words, words + word_count, bitmap_word(0u));
+        }
+    } // namespace detail
+
+    /// A fixed-size array of `N` objects of type `T` that are constructed on demand.
+    ///
+    /// It is like an array of [ts::deferred_construction](),
+    /// but whether or not an element is initialized is stored in a separate bitmap,
+    /// so each element only needs a single bit of extra storage.
+    /// Unlike [ts::deferred_construction]() elements can be destroyed again,
+    /// either individually or all at once using `reset()`.
+    /// Resetting only touches the initialized elements and is a single pass over the bitmap,
+    /// if `T` is trivially destructible, it doesn't touch the elements at all.
+    /// \notes It can neither be copied nor moved,
+    /// as it is meant as scratch storage that is reused.
+    template <typename T, std::size_t N>
+    class deferred_array
+    {
+    public:
+        using value_type = T;
+
+        //=== constructors/destructor ===//
+        /// \effects Creates an array where all elements are un-initialized.
+        deferred_array() noexcept : bits_()
+        {
+        }
+
+        deferred_array(const deferred_array&) = delete;
+
+        /// \effects Destroys all initialized elements.
+        ~deferred_array() noexcept
+        {
+            reset();
+        }
+
+        deferred_array& operator=(const deferred_array&) = delete;
+
+        //=== size ===//
+        /// \returns The number of elements, i.e. `N`.
+        static constexpr size_t size() noexcept
+        {
+            return N;
+        }
+
+        /// \returns The number of elements that are initialized.
+        size_t count() const noexcept
+        {
+            return detail::bitmap_count(bits_.data(), bits_.size());
+        }
+
+        //=== modifiers ===//
+        /// \effects Initializes the `i`th element with the `value_type` constructed from `args`.
+        /// \returns A reference to the new value.
+        /// \requires `i < N` and `has_value(i) == false`.
+        /// \throws Anything thrown by the chosen constructor of `value_type`,
+        /// the element stays un-initialized then.
+        template <typename... Args>
+        T& emplace(index_t i, Args&&... args)
+        {
+            auto index = checked_index(i);
+            TYPE_SAFE_PRECONDITION(!detail::bitmap_test(bits_.data(), index),
+                                   "element already initialized");
+            auto ptr = ::new (static_cast<void*>(&storage_[index])) T(std::forward<Args>(args)...);
+            detail::bitmap_set(bits_.data(), index);
+            return *ptr;
+        }
+
+        /// \effects Destroys the `i`th element and sets it to the un-initialized state.
+        /// \requires `i < N` and `has_value(i) == true`.
+        void destroy(index_t i) noexcept
+        {
+            auto index = checked_index(i);
+            TYPE_SAFE_PRECONDITION(detail::bitmap_test(bits_.data(), index),
+                                   "element not initialized");
+            detail::deferred_value<T>(storage_.data(), index)->~T();
+            detail::bitmap_reset(bits_.data(), index);
+        }
+
+        /// \effects Destroys all initialized elements and sets them to the un-initialized state.
+        void reset() noexcept
+        {
+            detail::deferred_destroy_all<T>(storage_.data(), bits_.data(), bits_.size());
+        }
+
+        //=== access ===//
+        /// \returns Whether or not the `i`th element is initialized.
+        /// \requires `i < N`.
+        bool has_value(index_t i) const noexcept
+        {
+            return detail::bitmap_test(bits_.data(), checked_index(i));
+        }
+
+        /// \returns A (`const`) reference to the `i`th element.
+        /// \requires `i < N` and `has_value(i) == true`.
+        /// \group value
+        T& value(index_t i) noexcept
+        {
+            return *detail::deferred_value<T>(storage_.data(), checked_value_index(i));
+        }
+
+        /// \group value
+        const T& value(index_t i) const noexcept
+        {
+            return *detail::deferred_value<T>(storage_.data(), checked_value_index(i));
+        }
+
+    private:
+        static std::size_t checked_index(index_t i) noexcept
+        {
+            auto index = static_cast<std::size_t>(get(i));
+            TYPE_SAFE_PRECONDITION(index < N, "out of bounds access");
+            return index;
+        }
+
+        std::size_t checked_value_index(index_t i) const noexcept
+        {
+            auto index = checked_index(i);
+            TYPE_SAFE_PRECONDITION(detail::bitmap_test(bits_.data(), index),
+                                   "element not initialized");
+            return index;
+        }
+
+        std::array<detail::deferred_storage<T>, N>                     storage_;
+        std::array<detail::bitmap_word, detail::bitmap_word_count(N)> bits_;
+    };
+
+    /// A dynamically sized array of objects of type `T` that are constructed on demand.
+    ///
+    /// It is the dynamically sized equivalent of [ts::deferred_array](),
+    /// the number of elements is fixed on construction.
+    /// \notes It can be moved but not copied,
+    /// moving transfers the memory and leaves the other array with zero elements.
+    template <typename T>
+    class deferred_vector
+    {
+    public:
+        using value_type = T;
+
+        //=== constructors/destructor ===//
+        /// \effects Creates an array without any elements.
+        deferred_vector() noexcept : size_(0u)
+        {
+        }
+
+        /// \effects Creates an array with the given number of un-initialized elements.
+        /// \throws Allocation failure.
+        explicit deferred_vector(size_t size)
+        : storage_(new detail::deferred_storage<T>[static_cast<std::size_t>(size)]),
+          bits_(new detail::bitmap_word[detail::bitmap_word_count(
+              static_cast<std::size_t>(size))]()),
+          size_(static_cast<std::size_t>(size))
+        {
+        }
+
+        /// \effects Takes ownership of the elements of `other`,
+        /// `other` won't have any elements afterwards.
+        deferred_vector(deferred_vector&& other) noexcept
+        : storage_(std::move(other.storage_)), bits_(std::move(other.bits_)), size_(other.size_)
+        {
+            other.size_ = 0u;
+        }
+
+        /// \effects Destroys all initialized elements.
+        ~deferred_vector() noexcept
+        {
+            reset();
+        }
+
+        deferred_vector& operator=(deferred_vector&&) = delete;
+
+        //=== size ===//
+        /// \returns The number of elements.
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// \returns The number of elements that are initialized.
+        size_t count() const noexcept
+        {
+            return detail::bitmap_count(bits_.get(), detail::bitmap_word_count(size_));
+        }
+
+        //=== modifiers ===//
+        /// \effects Initializes the `i`th element with the `value_type` constructed from `args`.
+        /// \returns A reference to the new value.
+        /// \requires `i < size()` and `has_value(i) == false`.
+        /// \throws Anything thrown by the chosen constructor of `value_type`,
+        /// the element stays un-initialized then.
+        template <typename... Args>
+        T& emplace(index_t i, Args&&... args)
+        {
+            auto index = checked_index(i);
+            TYPE_SAFE_PRECONDITION(!detail::bitmap_test(bits_.get(), index),
+                                   "element already initialized");
+            auto ptr = ::new (static_cast<void*>(&storage_[index])) T(std::forward<Args>(args)...);
+            detail::bitmap_set(bits_.get(), index);
+            return *ptr;
+        }
+
+        /// \effects Destroys the `i`th element and sets it to the un-initialized state.
+        /// \requires `i < size()` and `has_value(i) == true`.
+        void destroy(index_t i) noexcept
+        {
+            auto index = checked_index(i);
+            TYPE_SAFE_PRECONDITION(detail::bitmap_test(bits_.get(), index),
+                                   "element not initialized");
+            detail::deferred_value<T>(storage_.get(), index)->~T();
+            detail::bitmap_reset(bits_.get(), index);
+        }
+
+        /// \effects Destroys all initialized elements and sets them to the un-initialized state.
+        void reset() noexcept
+        {
+            detail::deferred_destroy_all<T>(storage_.get(), bits_.get(),
+                                            detail::bitmap_word_count(size_));
+        }
+
+        //=== access ===//
+        /// \returns Whether or not the `i`th element is initialized.
+        /// \requires `i < size()`.
+        bool has_value(index_t i) const noexcept
+        {
+            return detail::bitmap_test(bits_.get(), checked_index(i));
+        }
+
+        /// \returns A (`const`) reference to the `i`th element.
+        /// \requires `i < size()` and `has_value(i) == true`.
+        /// \group value
+        T& value(index_t i) noexcept
+        {
+            return *detail::deferred_value<T>(storage_.get(), checked_value_index(i));
+        }
+
+        /// \group value
+        const T& value(index_t i) const noexcept
+        {
+            return *detail::deferred_value<T>(storage_.get(), checked_value_index(i));
+        }
+
+    private:
+        std::size_t checked_index(index_t i) const noexcept
+        {
+            auto index = static_cast<std::size_t>(get(i));
+            TYPE_SAFE_PRECONDITION(index < size_, "out of bounds access");
+            return index;
+        }
+
+        std::size_t checked_value_index(index_t i) const noexcept
+        {
+            auto index = checked_index(i);
+            TYPE_SAFE_PRECONDITION(detail::bitmap_test(bits_.get(), index),
+                                   "element not initialized");
+            return index;
+        }
+
+        std::unique_ptr<detail::deferred_storage<T>[]> storage_;
+        std::unique_ptr<detail::bitmap_word[]>         bits_;
+        std::size_t                                    size_;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_DEFERRED_ARRAY_HPP_INCLUDED
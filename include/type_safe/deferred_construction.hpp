@@ -105,7 +105,7 @@ namespace type_safe
         template <typename... Args>
         void emplace(Args&&... args)
         {
-            DEBUG_ASSERT(!has_value(), detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(!has_value(), "already initialized");
             ::new (as_void()) value_type(std::forward<Args>(args)...);
             initialized_ = true;
         }
@@ -130,14 +130,14 @@ namespace type_safe
         /// \group value
         value_type& value() TYPE_SAFE_LVALUE_REF noexcept
         {
-            DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(has_value(), "not initialized");
             return *static_cast<value_type*>(as_void());
         }
 
         /// \group value
         const value_type& value() const TYPE_SAFE_LVALUE_REF noexcept
         {
-            DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(has_value(), "not initialized");
             return *static_cast<const value_type*>(as_void());
         }
 
@@ -145,14 +145,14 @@ namespace type_safe
         /// \group value
         value_type&& value() && noexcept
         {
-            DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(has_value(), "not initialized");
             return std::move(*static_cast<value_type*>(as_void()));
         }
 
         /// \group value
         const value_type&& value() const && noexcept
         {
-            DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(has_value(), "not initialized");
             return std::move(*static_cast<const value_type*>(as_void()));
         }
 #endif
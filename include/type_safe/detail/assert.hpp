@@ -9,6 +9,15 @@
 
 #include <type_safe/config.hpp>
 
+#if TYPE_SAFE_PRECONDITION_TELEMETRY
+#include <type_safe/violation_stats.hpp>
+#endif
+
+#if TYPE_SAFE_PRECONDITION_SAMPLING                                                                \
+    && (TYPE_SAFE_ENABLE_PRECONDITION_CHECKS || TYPE_SAFE_PRECONDITION_TELEMETRY)
+#include <type_safe/precondition_sampling.hpp>
+#endif
+
 namespace type_safe
 {
     namespace detail
@@ -35,4 +44,45 @@ namespace type_safe
     } // namespace detail
 } // namespace type_safe
 
+#if TYPE_SAFE_PRECONDITION_TELEMETRY
+// debug_assert aborts after the handler returns, so the check is done by hand
+/// \exclude
+#define TYPE_SAFE_PRECONDITION(Expr, Msg)                                                          \
+    (static_cast<bool>(Expr) ? void()                                                              \
+                             : ::type_safe::detail::on_precondition_violation(                     \
+                                   DEBUG_ASSERT_CUR_SOURCE_LOCATION, #Expr, Msg))
+/// \exclude
+#define TYPE_SAFE_PRECONDITION_UNREACHABLE(Msg)                                                    \
+    ::type_safe::detail::on_precondition_violation(DEBUG_ASSERT_CUR_SOURCE_LOCATION, "", Msg)
+#else
+/// \exclude
+#define TYPE_SAFE_PRECONDITION(Expr, Msg)                                                          \
+    DEBUG_ASSERT(Expr, ::type_safe::detail::precondition_error_handler{}, Msg)
+/// \exclude
+#define TYPE_SAFE_PRECONDITION_UNREACHABLE(Msg)                                                    \
+    DEBUG_UNREACHABLE(::type_safe::detail::precondition_error_handler{}, Msg)
+#endif
+
+// the precondition checks in hot paths, only done for some invocations with sampling
+#if TYPE_SAFE_PRECONDITION_SAMPLING                                                                \
+    && (TYPE_SAFE_ENABLE_PRECONDITION_CHECKS || TYPE_SAFE_PRECONDITION_TELEMETRY)
+#if TYPE_SAFE_USE_IS_CONSTANT_EVALUATED
+// checks during constant evaluation are free, so they are always done
+/// \exclude
+#define TYPE_SAFE_PRECONDITION_SAMPLE()                                                            \
+    (__builtin_is_constant_evaluated() || ::type_safe::detail::precondition_sampled())
+#else
+/// \exclude
+#define TYPE_SAFE_PRECONDITION_SAMPLE() ::type_safe::detail::precondition_sampled()
+#endif
+/// \exclude
+#define TYPE_SAFE_SAMPLED_PRECONDITION(Expr, Msg)                                                  \
+    (TYPE_SAFE_PRECONDITION_SAMPLE() ? TYPE_SAFE_PRECONDITION(Expr, Msg) : void())
+#else
+/// \exclude
+#define TYPE_SAFE_PRECONDITION_SAMPLE() true
+/// \exclude
+#define TYPE_SAFE_SAMPLED_PRECONDITION(Expr, Msg) TYPE_SAFE_PRECONDITION(Expr, Msg)
+#endif
+
 #endif // TYPE_SAFE_DETAIL_ASSERT_HPP_INCLUDED`
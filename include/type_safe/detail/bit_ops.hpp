@@ -0,0 +1,42 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_DETAIL_BIT_OPS_HPP_INCLUDED
+#define TYPE_SAFE_DETAIL_BIT_OPS_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+namespace type_safe
+{
+    namespace detail
+    {
+        // number of set bits
+        inline std::size_t popcount(std::uint_least64_t word) noexcept
+        {
+#if defined(__POPCNT__)
+            return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+            // branchless, so loops over multiple words can be vectorized
+            word = word - ((word >> 1u) & 0x5555555555555555u);
+            word = (word & 0x3333333333333333u) + ((word >> 2u) & 0x3333333333333333u);
+            word = (word + (word >> 4u)) & 0x0F0F0F0F0F0F0F0Fu;
+            return static_cast<std::size_t>(((word * 0x0101010101010101u) & 0xFFFFFFFFFFFFFFFFu)
+                                            >> 56u);
+#endif
+        }
+
+        // index of the lowest set bit, word must not be zero
+        inline std::size_t count_trailing_zeros(std::uint_least64_t word) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+            return popcount((word & (~word + 1u)) - 1u);
+#endif
+        }
+    }
+} // namespace type_safe::detail
+
+#endif // TYPE_SAFE_DETAIL_BIT_OPS_HPP_INCLUDED
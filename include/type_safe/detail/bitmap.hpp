@@ -0,0 +1,147 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_DETAIL_BITMAP_HPP_INCLUDED
+#define TYPE_SAFE_DETAIL_BITMAP_HPP_INCLUDED
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+#include <type_safe/detail/bit_ops.hpp>
+
+namespace type_safe
+{
+    namespace detail
+    {
+        // presence bitmap, bit i is set if element i is present
+        using bitmap_word = std::uint_least64_t;
+
+        constexpr std::size_t bitmap_word_bits = sizeof(bitmap_word) * CHAR_BIT;
+
+        constexpr std::size_t bitmap_word_count(std::size_t size) noexcept
+        {
+            return (size + bitmap_word_bits - 1u) / bitmap_word_bits;
+        }
+
+        inline bool bitmap_test(const bitmap_word* words, std::size_t i) noexcept
+        {
+            return ((words[i / bitmap_word_bits] >> (i % bitmap_word_bits)) & 1u) != 0u;
+        }
+
+        inline void bitmap_set(bitmap_word* words, std::size_t i) noexcept
+        {
+            words[i / bitmap_word_bits] |= bitmap_word(1u) << (i % bitmap_word_bits);
+        }
+
+        inline void bitmap_reset(bitmap_word* words, std::size_t i) noexcept
+        {
+            words[i / bitmap_word_bits] &= ~(bitmap_word(1u) << (i % bitmap_word_bits));
+        }
+
+        // the bits of the last word that are used for the given size,
+        // the remaining bits are always kept zero
+        constexpr bitmap_word bitmap_tail_mask(std::size_t size) noexcept
+        {
+            return size % bitmap_word_bits == 0u ?
+                       ~bitmap_word(0u) :
+                       bitmap_word((bitmap_word(1u) << (size % bitmap_word_bits)) - 1u);
+        }
+
+        inline void bitmap_assign(bitmap_word* words, std::size_t i, bool value) noexcept
+        {
+            auto& word = words[i / bitmap_word_bits];
+            auto  mask = bitmap_word(bitmap_word(1u) << (i % bitmap_word_bits));
+            word       = (word & ~mask) | (bitmap_word(0u - bitmap_word(value)) & mask);
+        }
+
+        inline void bitmap_fill(bitmap_word* words, std::size_t size, bool value) noexcept
+        {
+            auto word_count = bitmap_word_count(size);
+            for (std::size_t i = 0u; i != word_count; ++i)
+                words[i] = bitmap_word(0u - bitmap_word(value));
+            if (word_count != 0u)
+                words[word_count - 1u] &= bitmap_tail_mask(size);
+        }
+
+        inline void bitmap_flip(bitmap_word* words, std::size_t size) noexcept
+        {
+            auto word_count = bitmap_word_count(size);
+            for (std::size_t i = 0u; i != word_count; ++i)
+                words[i] = ~words[i];
+            if (word_count != 0u)
+                words[word_count - 1u] &= bitmap_tail_mask(size);
+        }
+
+        // the reductions accumulate without early exit, so they can be vectorized
+        inline bool bitmap_any(const bitmap_word* words, std::size_t word_count) noexcept
+        {
+            bitmap_word result = 0u;
+            for (std::size_t i = 0u; i != word_count; ++i)
+                result |= words[i];
+            return result != 0u;
+        }
+
+        inline bool bitmap_all(const bitmap_word* words, std::size_t size) noexcept
+        {
+            auto word_count = bitmap_word_count(size);
+            if (word_count == 0u)
+                return true;
+
+            auto result = ~bitmap_word(0u);
+            for (std::size_t i = 0u; i != word_count - 1u; ++i)
+                result &= words[i];
+            return result == ~bitmap_word(0u) && words[word_count - 1u] == bitmap_tail_mask(size);
+        }
+
+        inline bool bitmap_equal(const bitmap_word* a, const bitmap_word* b,
+                                 std::size_t word_count) noexcept
+        {
+            bitmap_word result = 0u;
+            for (std::size_t i = 0u; i != word_count; ++i)
+                result |= a[i] ^ b[i];
+            return result == 0u;
+        }
+
+        inline void bitmap_and(bitmap_word* dest, const bitmap_word* src,
+                               std::size_t word_count) noexcept
+        {
+            for (std::size_t i = 0u; i != word_count; ++i)
+                dest[i] &= src[i];
+        }
+
+        inline void bitmap_or(bitmap_word* dest, const bitmap_word* src,
+                              std::size_t word_count) noexcept
+        {
+            for (std::size_t i = 0u; i != word_count; ++i)
+                dest[i] |= src[i];
+        }
+
+        inline void bitmap_xor(bitmap_word* dest, const bitmap_word* src,
+                               std::size_t word_count) noexcept
+        {
+            for (std::size_t i = 0u; i != word_count; ++i)
+                dest[i] ^= src[i];
+        }
+
+        inline std::size_t bitmap_count(const bitmap_word* words, std::size_t word_count) noexcept
+        {
+            std::size_t result = 0u;
+            for (std::size_t i = 0u; i != word_count; ++i)
+                result += popcount(words[i]);
+            return result;
+        }
+
+        // calls f(i) for each set bit i, in order
+        template <typename Func>
+        void bitmap_for_each(const bitmap_word* words, std::size_t word_count, Func&& f)
+        {
+            for (std::size_t i = 0u; i != word_count; ++i)
+                for (auto word = words[i]; word != 0u; word &= word - 1u)
+                    f(i * bitmap_word_bits + count_trailing_zeros(word));
+        }
+    }
+} // namespace type_safe::detail
+
+#endif // TYPE_SAFE_DETAIL_BITMAP_HPP_INCLUDED
@@ -5,6 +5,7 @@
 #ifndef TYPE_SAFE_DETAIL_CONSTANT_PARSER_HPP_INCLUDED
 #define TYPE_SAFE_DETAIL_CONSTANT_PARSER_HPP_INCLUDED
 
+#include <limits>
 #include <type_traits>
 
 namespace type_safe
@@ -188,6 +189,30 @@ namespace type_safe
         {
             return parse_base<T, Digits...>::parse();
         }
+
+        template <typename T, typename U, U Value>
+        constexpr T validate_value()
+        {
+            static_assert(sizeof(T) <= sizeof(U)
+                              && std::is_signed<U>::value == std::is_signed<T>::value,
+                          "mismatched types");
+            static_assert(U(std::numeric_limits<T>::min()) <= Value
+                              && Value <= U(std::numeric_limits<T>::max()),
+                          "integer literal overflow");
+            return static_cast<T>(Value);
+        }
+
+        template <typename T, char... Digits>
+        constexpr T parse_signed()
+        {
+            return validate_value<T, long long, parse<long long, Digits...>()>();
+        }
+
+        template <typename T, char... Digits>
+        constexpr T parse_unsigned()
+        {
+            return validate_value<T, unsigned long long, parse<unsigned long long, Digits...>()>();
+        }
     }
 } // namespace type_safe::detail
 
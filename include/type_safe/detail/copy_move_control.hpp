@@ -9,11 +9,13 @@ namespace type_safe
 {
     namespace detail
     {
-        template <bool AllowCopy>
+        // a class that contains another class using the controls must use a different Tag,
+        // otherwise the empty base classes of the same type can't share an address
+        template <bool AllowCopy, class Tag = void>
         struct copy_control;
 
-        template <>
-        struct copy_control<true>
+        template <class Tag>
+        struct copy_control<true, Tag>
         {
             copy_control() noexcept = default;
 
@@ -24,8 +26,8 @@ namespace type_safe
             copy_control& operator=(copy_control&&) noexcept = default;
         };
 
-        template <>
-        struct copy_control<false>
+        template <class Tag>
+        struct copy_control<false, Tag>
         {
             copy_control() noexcept = default;
 
@@ -36,11 +38,11 @@ namespace type_safe
             copy_control& operator=(copy_control&&) noexcept = default;
         };
 
-        template <bool AllowCopy>
+        template <bool AllowCopy, class Tag = void>
         struct move_control;
 
-        template <>
-        struct move_control<true>
+        template <class Tag>
+        struct move_control<true, Tag>
         {
             move_control() noexcept = default;
 
@@ -51,8 +53,8 @@ namespace type_safe
             move_control& operator=(move_control&&) noexcept = default;
         };
 
-        template <>
-        struct move_control<false>
+        template <class Tag>
+        struct move_control<false, Tag>
         {
             move_control() noexcept = default;
 
@@ -0,0 +1,54 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_DETAIL_INDEX_SEQUENCE_HPP_INCLUDED
+#define TYPE_SAFE_DETAIL_INDEX_SEQUENCE_HPP_INCLUDED
+
+#include <cstddef>
+
+namespace type_safe
+{
+    namespace detail
+    {
+        // std::index_sequence is C++14
+        template <std::size_t... Is>
+        struct index_sequence
+        {
+        };
+
+        template <class A, class B>
+        struct concat_index_sequence;
+
+        template <std::size_t... As, std::size_t... Bs>
+        struct concat_index_sequence<index_sequence<As...>, index_sequence<Bs...>>
+        {
+            using type = index_sequence<As..., (sizeof...(As) + Bs)...>;
+        };
+
+        // logarithmic instantiation depth
+        template <std::size_t N>
+        struct make_index_sequence_impl
+        : concat_index_sequence<typename make_index_sequence_impl<N / 2>::type,
+                                typename make_index_sequence_impl<N - N / 2>::type>
+        {
+        };
+
+        template <>
+        struct make_index_sequence_impl<0u>
+        {
+            using type = index_sequence<>;
+        };
+
+        template <>
+        struct make_index_sequence_impl<1u>
+        {
+            using type = index_sequence<0u>;
+        };
+
+        template <std::size_t N>
+        using make_index_sequence = typename make_index_sequence_impl<N>::type;
+    }
+} // namespace type_safe::detail
+
+#endif // TYPE_SAFE_DETAIL_INDEX_SEQUENCE_HPP_INCLUDED
@@ -0,0 +1,63 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_DETAIL_TYPE_LIST_HPP_INCLUDED
+#define TYPE_SAFE_DETAIL_TYPE_LIST_HPP_INCLUDED
+
+#include <cstddef>
+#include <type_traits>
+
+#include <type_safe/detail/index_sequence.hpp>
+
+namespace type_safe
+{
+    namespace detail
+    {
+        template <std::size_t I, typename T>
+        struct indexed_type
+        {
+            using type = T;
+        };
+
+        template <class Indices, typename... Types>
+        struct indexed_types_impl;
+
+        template <std::size_t... Is, typename... Types>
+        struct indexed_types_impl<index_sequence<Is...>, Types...> : indexed_type<Is, Types>...
+        {
+        };
+
+        // derives from indexed_type<I, T> for each type,
+        // so a lookup is a single overload resolution against the bases,
+        // instead of one instantiation per type
+        template <typename... Types>
+        using indexed_types = indexed_types_impl<make_index_sequence<sizeof...(Types)>, Types...>;
+
+        template <typename... Types>
+        using indexed_types_ptr = const indexed_types<Types...>*;
+
+        //=== get_type_index ===//
+        // deduction fails if T isn't a base or appears more than once
+        template <typename T, std::size_t I>
+        std::integral_constant<std::size_t, I + 1u> get_type_index_impl(const indexed_type<I, T>*);
+
+        template <typename T>
+        std::integral_constant<std::size_t, 0u> get_type_index_impl(const void*);
+
+        // index of T in Types plus one, or zero if it isn't a unique type of Types
+        template <typename T, typename... Types>
+        using get_type_index = decltype(get_type_index_impl<T>(
+            indexed_types_ptr<typename std::decay<Types>::type...>(nullptr)));
+
+        //=== type_at ===//
+        template <std::size_t I, typename T>
+        indexed_type<I, T> type_at_impl(const indexed_type<I, T>*);
+
+        // type_at<I, Types...>::type is the Ith type
+        template <std::size_t I, typename... Types>
+        using type_at = decltype(type_at_impl<I>(indexed_types_ptr<Types...>(nullptr)));
+    }
+} // namespace type_safe::detail
+
+#endif // TYPE_SAFE_DETAIL_TYPE_LIST_HPP_INCLUDED
@@ -0,0 +1,32 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_DETAIL_UNCAUGHT_EXCEPTIONS_HPP_INCLUDED
+#define TYPE_SAFE_DETAIL_UNCAUGHT_EXCEPTIONS_HPP_INCLUDED
+
+#include <exception>
+
+#include <type_safe/config.hpp>
+
+namespace type_safe
+{
+    namespace detail
+    {
+        // the number of exceptions currently in flight,
+        // compare it with the number at construction to know whether a destructor runs due to one
+        // without std::uncaught_exceptions() it can only be 0 or 1
+        inline int uncaught_exceptions() noexcept
+        {
+#if !TYPE_SAFE_USE_EXCEPTIONS
+            return 0;
+#elif defined(__cpp_lib_uncaught_exceptions) && __cpp_lib_uncaught_exceptions >= 201411
+            return std::uncaught_exceptions();
+#else
+            return std::uncaught_exception() ? 1 : 0;
+#endif
+        }
+    } // namespace detail
+} // namespace type_safe
+
+#endif // TYPE_SAFE_DETAIL_UNCAUGHT_EXCEPTIONS_HPP_INCLUDED
@@ -200,95 +200,51 @@ namespace type_safe
             template <typename... Args>
             static void map(Union& res, const Union& u, Functor&& f, Args&&... args)
             {
-                DEBUG_ASSERT(!res.has_value(), precondition_error_handler{});
+                TYPE_SAFE_PRECONDITION(!res.has_value(), "result not empty");
                 with(u, visitor{}, res, std::forward<Functor>(f), std::forward<Args>(args)...);
             }
 
             template <typename... Args>
             static void map(Union& res, Union&& u, Functor&& f, Args&&... args)
             {
-                DEBUG_ASSERT(!res.has_value(), precondition_error_handler{});
+                TYPE_SAFE_PRECONDITION(!res.has_value(), "result not empty");
                 with(std::move(u), visitor{}, res, std::forward<Functor>(f),
                      std::forward<Args>(args)...);
             }
         };
 
-        //=== compare_variant ===//
-        template <class Variant>
-        struct compare_variant
-        {
-            struct equal_visitor
-            {
-                bool result = false;
-
-                template <typename T>
-                void operator()(const T& value, const Variant& other)
-                {
-                    result = (value == other);
-                }
-            };
-
-            struct less_visitor
-            {
-                bool result = false;
-
-                template <typename T>
-                void operator()(const T& value, const Variant& other)
-                {
-                    result = (value < other);
-                }
-            };
-
-            static bool compare_equal(const Variant& a, const Variant& b)
-            {
-                if (!a.has_value())
-                    // to be equal, b must not have value as well
-                    return !b.has_value();
-
-                equal_visitor v;
-                with(a, v, b);
-                return v.result;
-            }
-
-            static bool compare_less(const Variant& a, const Variant& b)
-            {
-                if (!a.has_value())
-                    // for a to be less than b,
-                    // b must have a value
-                    return b.has_value();
-
-                less_visitor v;
-                with(a, v, b);
-                return v.result;
-            }
-        };
-
         //=== variant_storage ===//
         template <class VariantPolicy, typename... Types>
-        class variant_storage
+        class non_trivial_variant_storage
         {
             using traits = detail::traits<Types...>;
 
         public:
-            variant_storage() noexcept = default;
+            non_trivial_variant_storage() noexcept = default;
+
+            template <typename T, typename... Args>
+            explicit non_trivial_variant_storage(union_type<T> type, Args&&... args)
+            : storage_(type, std::forward<Args>(args)...)
+            {
+            }
 
-            variant_storage(const variant_storage& other)
+            non_trivial_variant_storage(const non_trivial_variant_storage& other)
             {
                 copy(storage_, other.storage_);
             }
 
-            variant_storage(variant_storage&& other) noexcept(
+            non_trivial_variant_storage(non_trivial_variant_storage&& other) noexcept(
                 traits::nothrow_move_constructible::value)
             {
                 move(storage_, std::move(other.storage_));
             }
 
-            ~variant_storage() noexcept
+            ~non_trivial_variant_storage() noexcept
             {
                 destroy(storage_);
             }
 
-            variant_storage& operator=(const variant_storage& other)
+            non_trivial_variant_storage& operator=(const non_trivial_variant_storage& other)
             {
                 if (storage_.has_value() && other.storage_.has_value())
                     copy_assign_union_value<VariantPolicy,
@@ -302,7 +258,7 @@ namespace type_safe
                 return *this;
             }
 
-            variant_storage& operator=(variant_storage&& other) noexcept(
+            non_trivial_variant_storage& operator=(non_trivial_variant_storage&& other) noexcept(
                 traits::nothrow_move_assignable::value)
             {
                 if (storage_.has_value() && other.storage_.has_value())
@@ -332,6 +288,40 @@ namespace type_safe
             tagged_union<Types...> storage_;
         };
 
+        // all types are trivially copyable, so is the union:
+        // copy, move and destruction are trivial and the variant can be memcpy'ied
+        template <typename... Types>
+        class trivial_variant_storage
+        {
+        public:
+            trivial_variant_storage() noexcept = default;
+
+            template <typename T, typename... Args>
+            explicit constexpr trivial_variant_storage(union_type<T> type, Args&&... args)
+            : storage_(type, std::forward<Args>(args)...)
+            {
+            }
+
+            TYPE_SAFE_CONSTEXPR14 tagged_union<Types...>& get_union() noexcept
+            {
+                return storage_;
+            }
+
+            constexpr const tagged_union<Types...>& get_union() const noexcept
+            {
+                return storage_;
+            }
+
+        private:
+            tagged_union<Types...> storage_;
+        };
+
+        template <class VariantPolicy, typename... Types>
+        using variant_storage =
+            typename std::conditional<union_trivial<Types...>::value,
+                                      trivial_variant_storage<Types...>,
+                                      non_trivial_variant_storage<VariantPolicy, Types...>>::type;
+
         struct storage_access
         {
             template <class Variant>
@@ -347,11 +337,16 @@ namespace type_safe
             }
         };
 
+        // the variant contains a tagged_union, which uses the controls as well
+        struct variant_control_tag;
+
         template <typename... Types>
-        using variant_copy = copy_control<traits<Types...>::copy_constructible::value>;
+        using variant_copy =
+            copy_control<traits<Types...>::copy_constructible::value, variant_control_tag>;
 
         template <typename... Types>
-        using variant_move = move_control<traits<Types...>::move_constructible::value>;
+        using variant_move =
+            move_control<traits<Types...>::move_constructible::value, variant_control_tag>;
 
         template <class Union, typename T, typename... Args>
         using enable_variant_type_impl =
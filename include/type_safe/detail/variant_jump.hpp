@@ -0,0 +1,135 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_DETAIL_VARIANT_JUMP_HPP_INCLUDED
+#define TYPE_SAFE_DETAIL_VARIANT_JUMP_HPP_INCLUDED
+
+#include <cstddef>
+#include <utility>
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/index_sequence.hpp>
+
+namespace type_safe
+{
+    namespace detail
+    {
+        // jumps to the function of the dispatcher that handles the given index
+        template <class Indices>
+        struct variant_jump;
+
+        // not a local static, so it can be used in constant expressions
+        template <class Dispatcher, class Indices>
+        struct variant_jump_table;
+
+        template <class Dispatcher, std::size_t... Is>
+        struct variant_jump_table<Dispatcher, index_sequence<Is...>>
+        {
+            static constexpr typename Dispatcher::function table[] = {
+                &Dispatcher::template call<Is>...};
+        };
+
+        template <class Dispatcher, std::size_t... Is>
+        constexpr typename Dispatcher::function
+            variant_jump_table<Dispatcher, index_sequence<Is...>>::table[];
+
+        template <std::size_t... Is>
+        struct variant_jump<index_sequence<Is...>>
+        {
+            template <class Dispatcher, typename... Args>
+            static TYPE_SAFE_CONSTEXPR14 typename Dispatcher::result call(std::size_t index,
+                                                                          Args&&... args)
+            {
+                if (index >= sizeof...(Is))
+                    DEBUG_UNREACHABLE(assert_handler{}, "invalid type id");
+                return variant_jump_table<Dispatcher, index_sequence<Is...>>::table[index](
+                    std::forward<Args>(args)...);
+            }
+        };
+
+        // for few indices a switch is better,
+        // it is lowered to a jump table or a small compare chain and allows inlining
+        template <>
+        struct variant_jump<index_sequence<0u, 1u>>
+        {
+            template <class Dispatcher, typename... Args>
+            static TYPE_SAFE_CONSTEXPR14 typename Dispatcher::result call(std::size_t index,
+                                                                          Args&&... args)
+            {
+                switch (index)
+                {
+                case 1u:
+                    return Dispatcher::template call<1u>(std::forward<Args>(args)...);
+                default:
+                    return Dispatcher::template call<0u>(std::forward<Args>(args)...);
+                }
+            }
+        };
+
+        template <>
+        struct variant_jump<index_sequence<0u, 1u, 2u>>
+        {
+            template <class Dispatcher, typename... Args>
+            static TYPE_SAFE_CONSTEXPR14 typename Dispatcher::result call(std::size_t index,
+                                                                          Args&&... args)
+            {
+                switch (index)
+                {
+                case 1u:
+                    return Dispatcher::template call<1u>(std::forward<Args>(args)...);
+                case 2u:
+                    return Dispatcher::template call<2u>(std::forward<Args>(args)...);
+                default:
+                    return Dispatcher::template call<0u>(std::forward<Args>(args)...);
+                }
+            }
+        };
+
+        template <>
+        struct variant_jump<index_sequence<0u, 1u, 2u, 3u>>
+        {
+            template <class Dispatcher, typename... Args>
+            static TYPE_SAFE_CONSTEXPR14 typename Dispatcher::result call(std::size_t index,
+                                                                          Args&&... args)
+            {
+                switch (index)
+                {
+                case 1u:
+                    return Dispatcher::template call<1u>(std::forward<Args>(args)...);
+                case 2u:
+                    return Dispatcher::template call<2u>(std::forward<Args>(args)...);
+                case 3u:
+                    return Dispatcher::template call<3u>(std::forward<Args>(args)...);
+                default:
+                    return Dispatcher::template call<0u>(std::forward<Args>(args)...);
+                }
+            }
+        };
+
+        template <>
+        struct variant_jump<index_sequence<0u, 1u, 2u, 3u, 4u>>
+        {
+            template <class Dispatcher, typename... Args>
+            static TYPE_SAFE_CONSTEXPR14 typename Dispatcher::result call(std::size_t index,
+                                                                          Args&&... args)
+            {
+                switch (index)
+                {
+                case 1u:
+                    return Dispatcher::template call<1u>(std::forward<Args>(args)...);
+                case 2u:
+                    return Dispatcher::template call<2u>(std::forward<Args>(args)...);
+                case 3u:
+                    return Dispatcher::template call<3u>(std::forward<Args>(args)...);
+                case 4u:
+                    return Dispatcher::template call<4u>(std::forward<Args>(args)...);
+                default:
+                    return Dispatcher::template call<0u>(std::forward<Args>(args)...);
+                }
+            }
+        };
+    }
+} // namespace type_safe::detail
+
+#endif // TYPE_SAFE_DETAIL_VARIANT_JUMP_HPP_INCLUDED
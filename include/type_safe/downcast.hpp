@@ -9,6 +9,7 @@
 
 #include <type_safe/detail/assert.hpp>
 #include <type_safe/config.hpp>
+#include <type_safe/optional_ref.hpp>
 
 namespace type_safe
 {
@@ -20,8 +21,102 @@ namespace type_safe
     {
     };
 
+    /// A range of class ids for [ts::checked_downcast]().
+    ///
+    /// Each class in a hierarchy gets an id, a value of an integer or enumeration type `Id`,
+    /// so that the ids of all classes derived from a class are in a contiguous range,
+    /// e.g. by enumerating the classes in a depth-first traversal of the hierarchy.
+    /// A class then declares `using class_ids = ts::class_id_range<Id, First, Last>;`,
+    /// where `First` is its own id and `Last` the id of its last derived class,
+    /// and the base class of the hierarchy provides a member function `class_id()`
+    /// returning the id of the dynamic type.
+    /// Then checking whether or not an object is of a class or one of its derived classes
+    /// is a simple range check.
+    /// It is used by [ts::can_downcast]() and [ts::checked_downcast](),
+    /// as well as the debug check of [ts::downcast]().
+    /// \notes Every class that is a target of a downcast must declare its own `class_ids`,
+    /// it mustn't be inherited.
+    template <typename Id, Id First, Id Last = First>
+    struct class_id_range
+    {
+        using id_type = Id;
+
+        static constexpr id_type first = First;
+        static constexpr id_type last  = Last;
+
+        /// \returns Whether or not `id` is in the range `[First, Last]`.
+        static constexpr bool contains(const id_type& id) noexcept
+        {
+            return !(id < First) && !(Last < id);
+        }
+    };
+
+    template <typename Id, Id First, Id Last>
+    constexpr Id class_id_range<Id, First, Last>::first;
+
+    template <typename Id, Id First, Id Last>
+    constexpr Id class_id_range<Id, First, Last>::last;
+
     namespace detail
     {
+        template <typename T>
+        auto has_class_ids_impl(int) -> decltype(typename T::class_ids{}, std::true_type{});
+
+        template <typename T>
+        auto has_class_ids_impl(char) -> std::false_type;
+
+        template <typename T>
+        struct has_class_ids : decltype(has_class_ids_impl<T>(0))
+        {
+        };
+
+        // an inherited class_ids would make the check always succeed
+        template <typename Derived, typename Base, bool = has_class_ids<Base>::value>
+        struct has_own_class_ids
+            : std::integral_constant<bool, !std::is_same<typename Derived::class_ids,
+                                                         typename Base::class_ids>::value>
+        {
+        };
+
+        template <typename Derived, typename Base>
+        struct has_own_class_ids<Derived, Base, false> : std::true_type
+        {
+        };
+
+        template <typename Derived, typename Base>
+        bool is_derived_object(std::true_type, const Base& obj) noexcept
+        {
+            static_assert(has_own_class_ids<Derived, Base>::value,
+                          "derived class must declare its own class_ids");
+            return Derived::class_ids::contains(obj.class_id());
+        }
+
+        template <typename Derived, typename Base>
+        bool is_derived_object(std::false_type, const Base& obj) noexcept
+        {
+#if TYPE_SAFE_USE_RTTI
+            static_assert(std::is_polymorphic<Base>::value,
+                          "checked downcast requires class_ids or a polymorphic type");
+            return dynamic_cast<const Derived*>(&obj) != nullptr;
+#else
+            static_assert(has_class_ids<Derived>::value,
+                          "checked downcast without RTTI requires class_ids");
+            return (void)obj, false;
+#endif
+        }
+
+        template <typename T>
+        bool can_downcast(derived_type<T>, const T&) noexcept
+        {
+            return true;
+        }
+
+        template <typename Derived, typename Base>
+        bool can_downcast(derived_type<Derived>, const Base& obj) noexcept
+        {
+            return is_derived_object<Derived>(has_class_ids<Derived>{}, obj);
+        }
+
         // same type
         template <typename T>
         bool is_safe_downcast(derived_type<T>, const T&)
@@ -29,22 +124,36 @@ namespace type_safe
             return true;
         }
 
+        // class id range, so we can check even without RTTI
+        template <typename Derived, typename Base>
+        auto is_safe_downcast(derived_type<Derived>, const Base& obj) ->
+            typename std::enable_if<has_class_ids<Derived>::value, bool>::type
+        {
+            static_assert(has_own_class_ids<Derived, Base>::value,
+                          "derived class must declare its own class_ids");
+            return Derived::class_ids::contains(obj.class_id());
+        }
+
         // polymorphic type, so we can check
         template <typename Derived, typename Base>
         auto is_safe_downcast(derived_type<Derived>, const Base& obj) ->
-            typename std::enable_if<std::is_polymorphic<Base>::value, bool>::type
+            typename std::enable_if<!has_class_ids<Derived>::value
+                                        && std::is_polymorphic<Base>::value,
+                                    bool>::type
         {
 #if TYPE_SAFE_USE_RTTI
             return dynamic_cast<const Derived*>(&obj) != nullptr;
 #else
-            return true;
+            return (void)obj, true;
 #endif
         }
 
         // non-polymorphic type, no check possible
         template <typename Derived, typename Base>
         auto is_safe_downcast(derived_type<Derived>, const Base&) ->
-            typename std::enable_if<!std::is_polymorphic<Base>::value, bool>::type
+            typename std::enable_if<!has_class_ids<Derived>::value
+                                        && !std::is_polymorphic<Base>::value,
+                                    bool>::type
         {
             return true;
         }
@@ -55,8 +164,8 @@ namespace type_safe
             using derived_t = typename std::decay<Derived>::type;
             static_assert(std::is_base_of<Base, derived_t>::value,
                           "can only downcast from base to derived class");
-            DEBUG_ASSERT(detail::is_safe_downcast(derived_type<derived_t>{}, obj),
-                         detail::precondition_error_handler{}, "not a safe downcast");
+            TYPE_SAFE_PRECONDITION(detail::is_safe_downcast(derived_type<derived_t>{}, obj),
+                                   "not a safe downcast");
         }
     } // namespace detail
 
@@ -91,6 +200,52 @@ namespace type_safe
         detail::validate_downcast<Derived>(obj);
         return static_cast<const Derived&>(obj);
     }
+
+    /// \returns Whether or not the dynamic type of `obj` is `Derived` or a class derived from it,
+    /// i.e. whether or not it can be downcast to `Derived`.
+    /// \requires `Base` must be a base class of `Derived`.
+    /// \notes If `Derived` has a [ts::class_id_range]() as `class_ids` member,
+    /// it is a range check of `obj.class_id()`, otherwise it uses `dynamic_cast`,
+    /// which requires RTTI and a polymorphic `Base`.
+    template <typename Derived, typename Base>
+    bool can_downcast(const Base& obj) noexcept
+    {
+        using derived_t = typename std::decay<Derived>::type;
+        static_assert(std::is_base_of<Base, derived_t>::value,
+                      "can only downcast from base to derived class");
+        return detail::can_downcast(derived_type<derived_t>{}, obj);
+    }
+
+    /// Casts an object of base class type to the derived class type, if possible.
+    /// \returns A [ts::optional_ref]() to the object converted to `Derived` with matching qualifiers,
+    /// if `can_downcast<Derived>(obj)` is `true`, a null reference otherwise.
+    /// \requires `Base` must be a base class of `Derived`.
+    /// \notes Unlike [ts::downcast]() this always checks, even in release builds,
+    /// but with a [ts::class_id_range]() that is still cheap.
+    /// \group checked_downcast
+    template <typename Derived, typename Base>
+    optional_ref<Derived> checked_downcast(derived_type<Derived>, Base& obj) noexcept
+    {
+        return can_downcast<Derived>(obj) ? optional_ref<Derived>(static_cast<Derived&>(obj)) :
+                                            nullopt;
+    }
+
+    /// \group checked_downcast
+    template <typename Derived, typename Base>
+    optional_ref<const Derived> checked_downcast(derived_type<Derived>, const Base& obj) noexcept
+    {
+        return can_downcast<Derived>(obj) ?
+                   optional_ref<const Derived>(static_cast<const Derived&>(obj)) :
+                   nullopt;
+    }
+
+    /// \group checked_downcast
+    template <typename Derived, typename Base>
+    auto checked_downcast(Base& obj) noexcept
+        -> decltype(checked_downcast(derived_type<Derived>{}, obj))
+    {
+        return checked_downcast(derived_type<Derived>{}, obj);
+    }
 } // namespace type_safe
 
 #endif // TYPE_SAFE_DOWNCAST_HPP_INCLUDED
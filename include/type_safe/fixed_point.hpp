@@ -0,0 +1,469 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_FIXED_POINT_HPP_INCLUDED
+#define TYPE_SAFE_FIXED_POINT_HPP_INCLUDED
+
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/arithmetic_policy.hpp>
+#include <type_safe/floating_point.hpp>
+#include <type_safe/integer.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef __int128 fixed_point_int128;
+        __extension__ typedef unsigned __int128 fixed_point_uint128;
+#else
+        using fixed_point_int128  = void;
+        using fixed_point_uint128 = void;
+#endif
+
+        // integer type that can hold the product of two values, or void
+        template <typename T>
+        struct fixed_point_wide
+        {
+            using type = typename std::conditional<
+                (sizeof(T) <= sizeof(std::int_least32_t)),
+                typename std::conditional<std::is_signed<T>::value, std::int_least64_t,
+                                          std::uint_least64_t>::type,
+                typename std::conditional<
+                    (sizeof(T) == sizeof(std::int_least64_t)),
+                    typename std::conditional<std::is_signed<T>::value, fixed_point_int128,
+                                              fixed_point_uint128>::type,
+                    void>::type>::type;
+        };
+
+        template <typename T>
+        using fixed_point_wide_t = typename fixed_point_wide<T>::type;
+
+        template <typename Rep, typename Wide>
+        constexpr bool fixed_point_fits(const Wide& value) noexcept
+        {
+            return !(value < static_cast<Wide>(std::numeric_limits<Rep>::min()))
+                   && !(static_cast<Wide>(std::numeric_limits<Rep>::max()) < value);
+        }
+
+        //=== multiplication ===//
+        // if the result doesn't fit, the product of the raw values doesn't either,
+        // so the policy can decide what to do
+        template <class Policy, typename Rep, typename Wide>
+        constexpr Rep fixed_point_narrow_product(const Wide& result, const Rep& a, const Rep& b)
+        {
+            return fixed_point_fits<Rep>(result) ? static_cast<Rep>(result) :
+                                                   Policy::template do_multiplication(a, b);
+        }
+
+        template <class Policy, std::uintmax_t Scale, typename Rep>
+        constexpr Rep fixed_point_multiply(std::false_type, const Rep& a, const Rep& b)
+        {
+            using wide = fixed_point_wide_t<Rep>;
+            return fixed_point_narrow_product<Policy>(static_cast<wide>(a) * static_cast<wide>(b)
+                                                          / static_cast<wide>(Scale),
+                                                      a, b);
+        }
+
+        // no wider type available, so the product must fit
+        template <class Policy, std::uintmax_t Scale, typename Rep>
+        constexpr Rep fixed_point_multiply(std::true_type, const Rep& a, const Rep& b)
+        {
+            return static_cast<Rep>(Policy::template do_multiplication(a, b)
+                                    / static_cast<Rep>(Scale));
+        }
+
+        template <class Policy, std::uintmax_t Scale, typename Rep>
+        constexpr Rep fixed_point_multiply(const Rep& a, const Rep& b)
+        {
+            return fixed_point_multiply<Policy, Scale>(std::is_void<fixed_point_wide_t<Rep>>{}, a,
+                                                       b);
+        }
+
+        //=== division ===//
+        // if the result doesn't fit, either the scaled dividend doesn't fit,
+        // or it is the division of the minimum by -1
+        template <class Policy, std::uintmax_t Scale, typename Rep, typename Wide>
+        constexpr Rep fixed_point_narrow_quotient(const Wide& result, const Wide& dividend,
+                                                  const Rep& a, const Rep& b)
+        {
+            return fixed_point_fits<Rep>(result) ?
+                       static_cast<Rep>(result) :
+                       fixed_point_fits<Rep>(dividend) ?
+                       Policy::template do_division(static_cast<Rep>(dividend), b) :
+                       Policy::template do_multiplication(a, static_cast<Rep>(Scale));
+        }
+
+        template <class Policy, std::uintmax_t Scale, typename Rep>
+        constexpr Rep fixed_point_divide(std::false_type, const Rep& a, const Rep& b)
+        {
+            using wide = fixed_point_wide_t<Rep>;
+            return b == Rep(0) ? Policy::template do_division(a, b) :
+                                 fixed_point_narrow_quotient<Policy, Scale>(
+                                     static_cast<wide>(a) * static_cast<wide>(Scale)
+                                         / static_cast<wide>(b),
+                                     static_cast<wide>(a) * static_cast<wide>(Scale), a, b);
+        }
+
+        // no wider type available, so the scaled dividend must fit
+        template <class Policy, std::uintmax_t Scale, typename Rep>
+        constexpr Rep fixed_point_divide(std::true_type, const Rep& a, const Rep& b)
+        {
+            return Policy::template do_division(Policy::template do_multiplication(
+                                                    a, static_cast<Rep>(Scale)),
+                                                b);
+        }
+
+        template <class Policy, std::uintmax_t Scale, typename Rep>
+        constexpr Rep fixed_point_divide(const Rep& a, const Rep& b)
+        {
+            return fixed_point_divide<Policy, Scale>(std::is_void<fixed_point_wide_t<Rep>>{}, a,
+                                                     b);
+        }
+
+        //=== rescaling ===//
+        // multiplies by Ratio, the ratio is reduced at compile-time,
+        // so one of the operations is usually by one and optimized away
+        template <class Policy, class Ratio, typename Rep>
+        constexpr Rep fixed_point_rescale(const Rep& raw)
+        {
+            return Ratio::num == 1 ?
+                       static_cast<Rep>(raw / static_cast<Rep>(Ratio::den)) :
+                       static_cast<Rep>(
+                           Policy::template do_multiplication(raw, static_cast<Rep>(Ratio::num))
+                           / static_cast<Rep>(Ratio::den));
+        }
+
+        //=== floating point conversion ===//
+        // 2^(N-1) for signed and 2^N for unsigned integers, exactly representable
+        template <typename Rep, typename FloatT>
+        constexpr FloatT fixed_point_float_limit() noexcept
+        {
+            return static_cast<FloatT>(std::numeric_limits<Rep>::max() / 2 + 1) * FloatT(2);
+        }
+
+        template <typename Rep, typename FloatT>
+        constexpr Rep fixed_point_from_rounded(const FloatT& rounded)
+        {
+            return rounded >= static_cast<FloatT>(std::numeric_limits<Rep>::min())
+                           && rounded < fixed_point_float_limit<Rep, FloatT>() ?
+                       static_cast<Rep>(rounded) :
+                       (TYPE_SAFE_PRECONDITION_UNREACHABLE(
+                            "value not representable as fixed point"),
+                        Rep(0));
+        }
+
+        // rounds to nearest, ties away from zero
+        template <typename Rep, typename FloatT>
+        constexpr Rep fixed_point_from_float(const FloatT& scaled)
+        {
+            return fixed_point_from_rounded<Rep>(scaled < FloatT(0) ? scaled - FloatT(0.5) :
+                                                                      scaled + FloatT(0.5));
+        }
+
+        constexpr std::uintmax_t fixed_point_pow10(unsigned exponent) noexcept
+        {
+            return exponent == 0u ? 1u : 10u * fixed_point_pow10(exponent - 1u);
+        }
+    } // namespace detail
+
+    /// A fixed point number.
+    ///
+    /// It stores an integer of type `Rep`, the *raw value*,
+    /// and represents the number `raw / Scale`,
+    /// so it can represent multiples of `1 / Scale` exactly.
+    /// All arithmetic operations are done using integer arithmetic on the raw values,
+    /// and the `Policy` is used to handle overflow like in [ts::integer]().
+    /// Multiplication and division are computed with a type twice the size of `Rep`,
+    /// i.e. a 128bit integer for 64bit integers where available,
+    /// and then divide/multiply by the compile-time constant `Scale`,
+    /// so the intermediate result cannot overflow.
+    /// The result is truncated towards zero.
+    /// If it doesn't fit, the result is whatever the `Policy` returns
+    /// for the multiplication of the raw values, i.e. it throws/asserts/saturates as well.
+    /// \requires `Rep` must be an integer type and `Scale` must be positive and representable in `Rep`.
+    /// \notes Use [ts::decimal_fixed_point]() or [ts::binary_fixed_point]()
+    /// to specify the number of fractional digits instead.
+    /// \module types
+    template <typename Rep, std::uintmax_t Scale, class Policy = arithmetic_policy_default>
+    class fixed_point
+    {
+        static_assert(detail::is_integer<Rep>::value, "must be a real integer type");
+        static_assert(Scale > 0u && Scale <= std::uintmax_t(std::numeric_limits<Rep>::max()),
+                      "invalid scale");
+
+    public:
+        using rep          = Rep;
+        using policy       = Policy;
+        using integer_type = integer<Rep, Policy>;
+
+        /// \returns The scale, i.e. the number of units per whole number.
+        static constexpr Rep scale() noexcept
+        {
+            return static_cast<Rep>(Scale);
+        }
+
+        /// \returns A fixed point number with the given raw value,
+        /// i.e. the number `raw / Scale`.
+        static constexpr fixed_point from_raw(const integer_type& raw) noexcept
+        {
+            return fixed_point(raw, raw_tag{});
+        }
+
+        //=== constructors ===//
+        /// \effects Initializes it to zero.
+        constexpr fixed_point() noexcept : raw_(0)
+        {
+        }
+
+        /// \effects Initializes it to the given whole number.
+        explicit constexpr fixed_point(const integer_type& value)
+        : raw_(Policy::template do_multiplication(static_cast<Rep>(value), scale()))
+        {
+        }
+
+        /// \effects Initializes it to the floating point value rounded to the nearest multiple of `1 / Scale`.
+        /// \requires The value must be representable.
+        /// \group float
+        /// \param 1
+        /// \exclude
+        template <typename FloatT,
+                  typename = typename std::enable_if<std::is_floating_point<FloatT>::value>::type>
+        explicit constexpr fixed_point(const FloatT& value)
+        : raw_(detail::fixed_point_from_float<Rep>(value * static_cast<FloatT>(Scale)))
+        {
+        }
+
+        /// \group float
+        template <typename FloatT>
+        explicit constexpr fixed_point(const floating_point<FloatT>& value)
+        : fixed_point(static_cast<FloatT>(value))
+        {
+        }
+
+        /// \effects Initializes it from a fixed point number with a different scale,
+        /// truncating the value if it cannot be represented exactly.
+        /// \notes The conversion factor is computed at compile-time.
+        template <std::uintmax_t OtherScale>
+        explicit constexpr fixed_point(const fixed_point<Rep, OtherScale, Policy>& other)
+        : raw_(detail::fixed_point_rescale<Policy,
+                                           std::ratio<static_cast<std::intmax_t>(Scale),
+                                                      static_cast<std::intmax_t>(OtherScale)>>(
+              static_cast<Rep>(other.raw())))
+        {
+        }
+
+        //=== access ===//
+        /// \returns The raw value.
+        constexpr integer_type raw() const noexcept
+        {
+            return raw_;
+        }
+
+        /// \returns The value rounded towards zero to a whole number.
+        constexpr integer_type whole() const noexcept
+        {
+            return static_cast<Rep>(raw_ / scale());
+        }
+
+        /// \returns The value converted to a (built-in) floating point.
+        /// \group float_conv
+        /// \param 1
+        /// \exclude
+        template <typename FloatT,
+                  typename = typename std::enable_if<std::is_floating_point<FloatT>::value>::type>
+        explicit constexpr operator FloatT() const noexcept
+        {
+            return static_cast<FloatT>(raw_) / static_cast<FloatT>(Scale);
+        }
+
+        /// \group float_conv
+        template <typename FloatT>
+        constexpr floating_point<FloatT> to_floating_point() const noexcept
+        {
+            return floating_point<FloatT>(static_cast<FloatT>(*this));
+        }
+
+        //=== arithmetic ===//
+        /// \returns The value unchanged.
+        constexpr fixed_point operator+() const noexcept
+        {
+            return *this;
+        }
+
+        /// \returns The negated value.
+        /// \requires `Rep` must not be unsigned.
+        constexpr fixed_point operator-() const
+        {
+            static_assert(std::is_signed<Rep>::value,
+                          "cannot call unary minus on unsigned fixed point");
+            return from_raw(Policy::template do_subtraction(Rep(0), raw_));
+        }
+
+        /// \effects Same as `*this = *this Op other`.
+        /// \group compound_assign Compound assignment
+        fixed_point& operator+=(const fixed_point& other)
+        {
+            raw_ = Policy::template do_addition(raw_, other.raw_);
+            return *this;
+        }
+
+        /// \group compound_assign
+        fixed_point& operator-=(const fixed_point& other)
+        {
+            raw_ = Policy::template do_subtraction(raw_, other.raw_);
+            return *this;
+        }
+
+        /// \group compound_assign
+        fixed_point& operator*=(const fixed_point& other)
+        {
+            raw_ = detail::fixed_point_multiply<Policy, Scale>(raw_, other.raw_);
+            return *this;
+        }
+
+        /// \group compound_assign
+        fixed_point& operator*=(const integer_type& other)
+        {
+            raw_ = Policy::template do_multiplication(raw_, static_cast<Rep>(other));
+            return *this;
+        }
+
+        /// \group compound_assign
+        fixed_point& operator/=(const fixed_point& other)
+        {
+            raw_ = detail::fixed_point_divide<Policy, Scale>(raw_, other.raw_);
+            return *this;
+        }
+
+        /// \group compound_assign
+        fixed_point& operator/=(const integer_type& other)
+        {
+            raw_ = Policy::template do_division(raw_, static_cast<Rep>(other));
+            return *this;
+        }
+
+        //=== mixed arithmetic ===//
+        /// \returns The fixed point number multiplied/divided by the integer.
+        /// \notes This does not need to rescale the result.
+        /// \group mixed_arithmetic Mixed arithmetic operators
+        friend constexpr fixed_point operator*(const fixed_point& a, const integer_type& b)
+        {
+            return from_raw(Policy::template do_multiplication(a.raw_, static_cast<Rep>(b)));
+        }
+
+        /// \group mixed_arithmetic
+        friend constexpr fixed_point operator*(const integer_type& a, const fixed_point& b)
+        {
+            return b * a;
+        }
+
+        /// \group mixed_arithmetic
+        friend constexpr fixed_point operator/(const fixed_point& a, const integer_type& b)
+        {
+            return from_raw(Policy::template do_division(a.raw_, static_cast<Rep>(b)));
+        }
+
+    private:
+        struct raw_tag
+        {
+        };
+
+        constexpr fixed_point(const integer_type& raw, raw_tag) noexcept
+        : raw_(static_cast<Rep>(raw))
+        {
+        }
+
+        Rep raw_;
+    };
+
+    /// A [ts::fixed_point]() with the given number of decimal digits after the decimal point.
+    /// \module types
+    template <typename Rep, unsigned Digits, class Policy = arithmetic_policy_default>
+    using decimal_fixed_point = fixed_point<Rep, detail::fixed_point_pow10(Digits), Policy>;
+
+    /// A [ts::fixed_point]() with the given number of binary digits after the binary point.
+    /// \module types
+    template <typename Rep, unsigned FractionBits, class Policy = arithmetic_policy_default>
+    using binary_fixed_point = fixed_point<Rep, (std::uintmax_t(1) << FractionBits), Policy>;
+
+    //=== arithmetic ===//
+    /// \returns The result of the arithmetic operation on the fixed point numbers.
+    /// \notes Multiplication and division use a wider type for the intermediate result,
+    /// see [ts::fixed_point]().
+    /// \group fixed_arithmetic Arithmetic operators
+    /// \module types
+    template <typename Rep, std::uintmax_t Scale, class Policy>
+    constexpr fixed_point<Rep, Scale, Policy> operator+(const fixed_point<Rep, Scale, Policy>& a,
+                                                        const fixed_point<Rep, Scale, Policy>& b)
+    {
+        return fixed_point<Rep, Scale, Policy>::from_raw(
+            Policy::template do_addition(static_cast<Rep>(a.raw()), static_cast<Rep>(b.raw())));
+    }
+
+    /// \group fixed_arithmetic
+    template <typename Rep, std::uintmax_t Scale, class Policy>
+    constexpr fixed_point<Rep, Scale, Policy> operator-(const fixed_point<Rep, Scale, Policy>& a,
+                                                        const fixed_point<Rep, Scale, Policy>& b)
+    {
+        return fixed_point<Rep, Scale, Policy>::from_raw(
+            Policy::template do_subtraction(static_cast<Rep>(a.raw()), static_cast<Rep>(b.raw())));
+    }
+
+    /// \group fixed_arithmetic
+    template <typename Rep, std::uintmax_t Scale, class Policy>
+    constexpr fixed_point<Rep, Scale, Policy> operator*(const fixed_point<Rep, Scale, Policy>& a,
+                                                        const fixed_point<Rep, Scale, Policy>& b)
+    {
+        return fixed_point<Rep, Scale, Policy>::from_raw(
+            detail::fixed_point_multiply<Policy, Scale>(static_cast<Rep>(a.raw()),
+                                                        static_cast<Rep>(b.raw())));
+    }
+
+    /// \group fixed_arithmetic
+    template <typename Rep, std::uintmax_t Scale, class Policy>
+    constexpr fixed_point<Rep, Scale, Policy> operator/(const fixed_point<Rep, Scale, Policy>& a,
+                                                        const fixed_point<Rep, Scale, Policy>& b)
+    {
+        return fixed_point<Rep, Scale, Policy>::from_raw(
+            detail::fixed_point_divide<Policy, Scale>(static_cast<Rep>(a.raw()),
+                                                      static_cast<Rep>(b.raw())));
+    }
+
+//=== comparison ===//
+/// \exclude
+#define TYPE_SAFE_DETAIL_MAKE_OP(Op)                                                               \
+    /** \group fixed_comp */                                                                       \
+    template <typename Rep, std::uintmax_t Scale, class Policy>                                    \
+    constexpr bool operator Op(const fixed_point<Rep, Scale, Policy>& a,                           \
+                               const fixed_point<Rep, Scale, Policy>& b) noexcept                  \
+    {                                                                                              \
+        return a.raw() Op b.raw();                                                                 \
+    }
+
+    /// \returns The result of the comparison of the raw values.
+    /// \group fixed_comp Comparison operators
+    /// \module types
+    template <typename Rep, std::uintmax_t Scale, class Policy>
+    constexpr bool operator==(const fixed_point<Rep, Scale, Policy>& a,
+                              const fixed_point<Rep, Scale, Policy>& b) noexcept
+    {
+        return a.raw() == b.raw();
+    }
+    TYPE_SAFE_DETAIL_MAKE_OP(!=)
+    TYPE_SAFE_DETAIL_MAKE_OP(<)
+    TYPE_SAFE_DETAIL_MAKE_OP(<=)
+    TYPE_SAFE_DETAIL_MAKE_OP(>)
+    TYPE_SAFE_DETAIL_MAKE_OP(>=)
+
+#undef TYPE_SAFE_DETAIL_MAKE_OP
+} // namespace type_safe
+
+#endif // TYPE_SAFE_FIXED_POINT_HPP_INCLUDED
@@ -81,7 +81,7 @@ namespace type_safe
         template <typename T, typename = detail::enable_boolean<T>>
         void change(T new_state) noexcept
         {
-            DEBUG_ASSERT(state_ != new_state, detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(state_ != new_state, "flag already in that state");
             state_ = new_state;
         }
 
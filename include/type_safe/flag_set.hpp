@@ -7,9 +7,13 @@
 
 #include <cstdint>
 #include <climits>
+#include <iterator>
 #include <type_traits>
 
+#include <type_safe/detail/bit_ops.hpp>
+#include <type_safe/detail/index_sequence.hpp>
 #include <type_safe/flag.hpp>
+#include <type_safe/optional.hpp>
 #include <type_safe/types.hpp>
 
 namespace type_safe
@@ -74,16 +78,260 @@ namespace type_safe
     };
 
     /// Tag object of type [ts::noflag_t]().
-    constexpr noflag_t noflag;
+    TYPE_SAFE_INLINE_VARIABLE constexpr noflag_t noflag;
 
     /// \exclude
     namespace detail
     {
+        using flag_set_word = std::uint_least64_t;
+
+        constexpr std::size_t flag_set_word_bits = sizeof(flag_set_word) * CHAR_BIT;
+
+        // fixed number of words with the same interface as the integers
+        // the operations are expanded over all words, so the compiler can vectorize them
+        template <std::size_t N>
+        class flag_set_words
+        {
+            using indices = make_index_sequence<N>;
+
+        public:
+            constexpr flag_set_words() noexcept : words_{}
+            {
+            }
+
+            static constexpr flag_set_words single(std::size_t i) noexcept
+            {
+                return single_impl(indices{}, i);
+            }
+
+            static constexpr flag_set_words low_bits(std::size_t n) noexcept
+            {
+                return low_bits_impl(indices{}, n);
+            }
+
+            constexpr bool any() const noexcept
+            {
+                return any_impl(0u);
+            }
+
+            std::size_t count() const noexcept
+            {
+                std::size_t result = 0u;
+                for (auto word : words_)
+                    result += popcount(word);
+                return result;
+            }
+
+            // index of the first set bit at position from or later, N * word bits if there is none
+            std::size_t find_next(std::size_t from) const noexcept
+            {
+                for (auto i = from / flag_set_word_bits; i < N; ++i)
+                {
+                    auto word = words_[i];
+                    if (i == from / flag_set_word_bits)
+                        word &= ~flag_set_word(0u) << (from % flag_set_word_bits);
+                    if (word != 0u)
+                        return i * flag_set_word_bits + count_trailing_zeros(word);
+                }
+                return N * flag_set_word_bits;
+            }
+
+            friend constexpr flag_set_words operator|(const flag_set_words& a,
+                                                      const flag_set_words& b) noexcept
+            {
+                return or_impl(indices{}, a, b);
+            }
+
+            friend constexpr flag_set_words operator&(const flag_set_words& a,
+                                                      const flag_set_words& b) noexcept
+            {
+                return and_impl(indices{}, a, b);
+            }
+
+            friend constexpr flag_set_words operator^(const flag_set_words& a,
+                                                      const flag_set_words& b) noexcept
+            {
+                return xor_impl(indices{}, a, b);
+            }
+
+            friend constexpr flag_set_words operator~(const flag_set_words& a) noexcept
+            {
+                return not_impl(indices{}, a);
+            }
+
+            friend constexpr bool operator==(const flag_set_words& a,
+                                             const flag_set_words& b) noexcept
+            {
+                return a.equal_impl(b, 0u);
+            }
+
+            friend constexpr bool operator!=(const flag_set_words& a,
+                                             const flag_set_words& b) noexcept
+            {
+                return !(a == b);
+            }
+
+        private:
+            template <typename... Words>
+            explicit constexpr flag_set_words(std::true_type, Words... words) noexcept
+            : words_{words...}
+            {
+            }
+
+            template <std::size_t... Is>
+            static constexpr flag_set_words single_impl(index_sequence<Is...>,
+                                                        std::size_t i) noexcept
+            {
+                return flag_set_words(std::true_type{},
+                                      flag_set_word(Is == i / flag_set_word_bits ?
+                                                        flag_set_word(1u)
+                                                            << (i % flag_set_word_bits) :
+                                                        0u)...);
+            }
+
+            static constexpr flag_set_word low_bits_word(std::size_t index, std::size_t n) noexcept
+            {
+                return (index + 1u) * flag_set_word_bits <= n ?
+                           ~flag_set_word(0u) :
+                           index * flag_set_word_bits >= n ?
+                           flag_set_word(0u) :
+                           flag_set_word((flag_set_word(1u) << (n - index * flag_set_word_bits))
+                                         - 1u);
+            }
+
+            template <std::size_t... Is>
+            static constexpr flag_set_words low_bits_impl(index_sequence<Is...>,
+                                                          std::size_t n) noexcept
+            {
+                return flag_set_words(std::true_type{}, low_bits_word(Is, n)...);
+            }
+
+            template <std::size_t... Is>
+            static constexpr flag_set_words or_impl(index_sequence<Is...>, const flag_set_words& a,
+                                                    const flag_set_words& b) noexcept
+            {
+                return flag_set_words(std::true_type{},
+                                      flag_set_word(a.words_[Is] | b.words_[Is])...);
+            }
+
+            template <std::size_t... Is>
+            static constexpr flag_set_words and_impl(index_sequence<Is...>,
+                                                     const flag_set_words& a,
+                                                     const flag_set_words& b) noexcept
+            {
+                return flag_set_words(std::true_type{},
+                                      flag_set_word(a.words_[Is] & b.words_[Is])...);
+            }
+
+            template <std::size_t... Is>
+            static constexpr flag_set_words xor_impl(index_sequence<Is...>,
+                                                     const flag_set_words& a,
+                                                     const flag_set_words& b) noexcept
+            {
+                return flag_set_words(std::true_type{},
+                                      flag_set_word(a.words_[Is] ^ b.words_[Is])...);
+            }
+
+            template <std::size_t... Is>
+            static constexpr flag_set_words not_impl(index_sequence<Is...>,
+                                                     const flag_set_words& a) noexcept
+            {
+                return flag_set_words(std::true_type{}, flag_set_word(~a.words_[Is])...);
+            }
+
+            constexpr bool any_impl(std::size_t i) const noexcept
+            {
+                return i != N && (words_[i] != 0u || any_impl(i + 1u));
+            }
+
+            constexpr bool equal_impl(const flag_set_words& other, std::size_t i) const noexcept
+            {
+                return i == N || (words_[i] == other.words_[i] && equal_impl(other, i + 1u));
+            }
+
+            flag_set_word words_[N];
+        };
+
+        // common interface for the integers and flag_set_words
+        template <typename Int>
+        struct flag_set_bits
+        {
+            static constexpr std::size_t width = sizeof(Int) * CHAR_BIT;
+
+            static constexpr Int none() noexcept
+            {
+                return Int(0u);
+            }
+
+            static constexpr Int single(std::size_t i) noexcept
+            {
+                return Int(Int(1u) << i);
+            }
+
+            static constexpr Int low_bits(std::size_t n) noexcept
+            {
+                return n == width ? Int(~Int(0u)) : Int((Int(1u) << n) - Int(1u));
+            }
+
+            static constexpr bool any(Int bits) noexcept
+            {
+                return bits != Int(0u);
+            }
+
+            static std::size_t count(Int bits) noexcept
+            {
+                return popcount(bits);
+            }
+
+            static std::size_t find_next(Int bits, std::size_t from) noexcept
+            {
+                if (from >= width)
+                    return width;
+                auto word = flag_set_word(bits) >> from;
+                return word == 0u ? width : from + count_trailing_zeros(word);
+            }
+        };
+
+        template <std::size_t N>
+        struct flag_set_bits<flag_set_words<N>>
+        {
+            using words = flag_set_words<N>;
+
+            static constexpr words none() noexcept
+            {
+                return words();
+            }
+
+            static constexpr words single(std::size_t i) noexcept
+            {
+                return words::single(i);
+            }
+
+            static constexpr words low_bits(std::size_t n) noexcept
+            {
+                return words::low_bits(n);
+            }
+
+            static constexpr bool any(const words& bits) noexcept
+            {
+                return bits.any();
+            }
+
+            static std::size_t count(const words& bits) noexcept
+            {
+                return bits.count();
+            }
+
+            static std::size_t find_next(const words& bits, std::size_t from) noexcept
+            {
+                return bits.find_next(from);
+            }
+        };
+
         template <std::size_t Size, typename = void>
         struct select_flag_set_int
         {
-            static_assert(Size != 0u,
-                          "number of bits not supported, complain loud enough so I'll do it");
+            static_assert(Size != 0u, "flag_set must not be empty");
         };
 
 /// \exclude
@@ -97,7 +345,13 @@ namespace type_safe
         TYPE_SAFE_DETAIL_SELECT(0u, 8u, std::uint_least8_t)
         TYPE_SAFE_DETAIL_SELECT(8u, 16u, std::uint_least16_t)
         TYPE_SAFE_DETAIL_SELECT(16u, 32u, std::uint_least32_t)
-        TYPE_SAFE_DETAIL_SELECT(32u, sizeof(std::uint_least64_t) * CHAR_BIT, std::uint_least64_t)
+        TYPE_SAFE_DETAIL_SELECT(32u, flag_set_word_bits, std::uint_least64_t)
+
+        template <std::size_t Size>
+        struct select_flag_set_int<Size, typename std::enable_if<(Size > flag_set_word_bits)>::type>
+        {
+            using type = flag_set_words<(Size + flag_set_word_bits - 1u) / flag_set_word_bits>;
+        };
 
 #undef TYPE_SAFE_DETAIL_SELECT
 
@@ -107,14 +361,19 @@ namespace type_safe
         public:
             using traits   = flag_set_traits<Enum>;
             using int_type = typename select_flag_set_int<traits::size()>::type;
+            using bits     = flag_set_bits<int_type>;
 
             static constexpr flag_set_impl all_set()
             {
-                return flag_set_impl(int_type((int_type(1) << traits::size()) - int_type(1)));
+                return flag_set_impl(bits::low_bits(traits::size()));
             }
             static constexpr flag_set_impl none_set()
             {
-                return flag_set_impl(int_type(0));
+                return flag_set_impl(bits::none());
+            }
+            static constexpr flag_set_impl from_int(int_type bits)
+            {
+                return flag_set_impl(bits);
             }
 
             explicit constexpr flag_set_impl(const Enum& e) : bits_(mask(e))
@@ -151,7 +410,24 @@ namespace type_safe
 
             constexpr bool is_set(const Enum& e) const
             {
-                return (bits_ & mask(e)) != int_type(0u);
+                return bits::any(bits_ & mask(e));
+            }
+
+            constexpr bool any() const
+            {
+                return bits::any(bits_);
+            }
+
+            std::size_t count() const noexcept
+            {
+                return bits::count(bits_);
+            }
+
+            // index of the first flag at position from or later, traits::size() if there is none
+            std::size_t find_next(std::size_t from) const noexcept
+            {
+                auto result = bits::find_next(bits_, from);
+                return result < traits::size() ? result : traits::size();
             }
 
             constexpr flag_set_impl bitwise_or(const flag_set_impl& other) const
@@ -172,7 +448,7 @@ namespace type_safe
         private:
             static constexpr int_type mask(const Enum& e)
             {
-                return int_type(int_type(1u) << static_cast<std::size_t>(e));
+                return bits::single(static_cast<std::size_t>(e));
             }
 
             template <typename T, typename = typename std::enable_if<std::is_integral<T>::value
@@ -407,6 +683,77 @@ namespace type_safe
         return flag_mask<Enum>(combo);
     }
 
+    /// A [std::forward_iterator]() over the flags that are set in a [ts::flag_set]().
+    ///
+    /// Its `value_type` is the `Enum`.
+    /// It iterates over a copy of the set,
+    /// so it is not affected by modifications of the original set.
+    template <typename Enum>
+    class flag_set_iterator
+    {
+    public:
+        using value_type        = Enum;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Enum*;
+        using reference         = Enum;
+        using iterator_category = std::forward_iterator_tag;
+
+        /// \effects Creates an iterator that is past the end of an empty set.
+        flag_set_iterator() noexcept
+        : flags_(detail::flag_set_impl<Enum>::none_set()), index_(flag_set_traits<Enum>::size())
+        {
+        }
+
+        /// \returns The current flag.
+        /// \requires The iterator must not be past the end.
+        Enum operator*() const noexcept
+        {
+            return static_cast<Enum>(index_);
+        }
+
+        /// \effects Advances to the next flag that is set.
+        /// \group increment
+        flag_set_iterator& operator++() noexcept
+        {
+            index_ = flags_.find_next(index_ + 1u);
+            return *this;
+        }
+
+        /// \group increment
+        flag_set_iterator operator++(int) noexcept
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /// \returns Whether or not both iterators point to the same flag.
+        /// \notes Only iterators of the same set can be compared.
+        /// \group compare
+        friend bool operator==(const flag_set_iterator& a, const flag_set_iterator& b) noexcept
+        {
+            return a.index_ == b.index_;
+        }
+
+        /// \group compare
+        friend bool operator!=(const flag_set_iterator& a, const flag_set_iterator& b) noexcept
+        {
+            return !(a == b);
+        }
+
+    private:
+        flag_set_iterator(const detail::flag_set_impl<Enum>& flags, std::size_t index) noexcept
+        : flags_(flags), index_(index)
+        {
+        }
+
+        detail::flag_set_impl<Enum> flags_;
+        std::size_t                 index_;
+
+        template <typename>
+        friend class flag_set;
+    };
+
     /// A set of flags where each one can either be `0` or `1`.
     ///
     /// Each enumeration member represents the index of one bit.
@@ -416,6 +763,9 @@ namespace type_safe
     /// which can be set, cleared or toggled.
     /// It can be interpreted as either a flag combination or flag mask, however.
     ///
+    /// The flags are stored in the smallest unsigned integer type with enough bits,
+    /// or in an array of 64 bit integers if there are more than 64 flags.
+    ///
     /// \requires `Enum` must be a flag,
     /// i.e. valid with the [ts::flag_set_traits]().
     template <typename Enum>
@@ -551,7 +901,7 @@ namespace type_safe
         /// \returns Whether any flag is set.
         constexpr bool any() const noexcept
         {
-            return flags_.to_int() != flags_.none_set().to_int();
+            return flags_.any();
         }
 
         /// \returns Whether all flags are set.
@@ -566,6 +916,68 @@ namespace type_safe
             return !any();
         }
 
+        /// \returns Whether any (1)/all (2)/none (3) of the flags in the given combination are set.
+        /// \notes These functions do not participate in overload resolution,
+        /// unless the argument is a flag combination.
+        /// \group any_of
+        template <typename FlagCombo, typename = detail::enable_flag_combo<FlagCombo, Enum>>
+        constexpr bool any_of(const FlagCombo& combo) const noexcept
+        {
+            return flags_.bitwise_and(detail::flag_set_impl<Enum>(combo)).any();
+        }
+
+        /// \group any_of
+        template <typename FlagCombo, typename = detail::enable_flag_combo<FlagCombo, Enum>>
+        constexpr bool all_of(const FlagCombo& combo) const noexcept
+        {
+            return flags_.bitwise_and(detail::flag_set_impl<Enum>(combo)).to_int()
+                   == detail::flag_set_impl<Enum>(combo).to_int();
+        }
+
+        /// \group any_of
+        template <typename FlagCombo, typename = detail::enable_flag_combo<FlagCombo, Enum>>
+        constexpr bool none_of(const FlagCombo& combo) const noexcept
+        {
+            return !any_of(combo);
+        }
+
+        /// \returns The number of flags that are set.
+        std::size_t count() const noexcept
+        {
+            return flags_.count();
+        }
+
+        /// \returns The first flag that is set,
+        /// or an empty optional if no flag is set.
+        optional<Enum> find_first() const noexcept
+        {
+            return flags_.any() ? optional<Enum>(static_cast<Enum>(flags_.find_next(0u))) :
+                                  optional<Enum>(nullopt);
+        }
+
+        /// \returns A [ts::flag_set_iterator]() to the first set flag (1)/one past the last flag (2).
+        /// \notes Iterating over a set visits only the flags that are set,
+        /// in the order of their enumerators.
+        /// \group iterator
+        flag_set_iterator<Enum> begin() const noexcept
+        {
+            return flag_set_iterator<Enum>(flags_, flags_.find_next(0u));
+        }
+
+        /// \group iterator
+        flag_set_iterator<Enum> end() const noexcept
+        {
+            return flag_set_iterator<Enum>(flags_, flag_set_traits<Enum>::size());
+        }
+
+        /// \returns `*this`, to write `for (Enum flag : set.set_flags())`.
+        /// \notes The set itself is a range of the flags that are set,
+        /// this function just makes the intent explicit.
+        const flag_set& set_flags() const noexcept
+        {
+            return *this;
+        }
+
         /// \returns An integer where each bit has the value of the corresponding flag.
         /// \requires `T` must be an unsigned integer type with enough bits.
         template <typename T>
@@ -782,7 +1194,7 @@ namespace type_safe
               typename = detail::enable_flag_combo<FlagCombo, Enum>>
     constexpr bool operator&(const flag_set<Enum>& a, const FlagCombo& b)
     {
-        return static_cast<bool>(combo(a).bitwise_and(flag_combo<Enum>(b)).to_int());
+        return a.any_of(b);
     }
     /// \group bitwise_and_check
     /// \param 2
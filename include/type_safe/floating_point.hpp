@@ -5,7 +5,12 @@
 #ifndef TYPE_SAFE_FLOATING_POINT_HPP_INCLUDED
 #define TYPE_SAFE_FLOATING_POINT_HPP_INCLUDED
 
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <iosfwd>
+#include <limits>
 #include <type_traits>
 
 #include <type_safe/detail/force_inline.hpp>
@@ -420,6 +425,188 @@ namespace type_safe
 
 #undef TYPE_SAFE_DETAIL_MAKE_OP
 
+    //=== approximate comparison ===//
+    /// \exclude
+    namespace detail
+    {
+        template <std::size_t Size>
+        struct floating_point_bits_for;
+
+        template <>
+        struct floating_point_bits_for<4u>
+        {
+            using type = std::uint32_t;
+        };
+
+        template <>
+        struct floating_point_bits_for<8u>
+        {
+            using type = std::uint64_t;
+        };
+
+        template <typename FloatT>
+        using floating_point_bits = typename std::enable_if<
+            std::numeric_limits<FloatT>::is_iec559,
+            typename floating_point_bits_for<sizeof(FloatT)>::type>::type;
+
+        // maps the sign-magnitude representation to an unsigned integer
+        // with the same ordering as the floats, +0 and -0 map to the same value
+        template <typename FloatT>
+        TYPE_SAFE_FORCE_INLINE floating_point_bits<FloatT> ordered_bits(FloatT f) noexcept
+        {
+            using bits_t = floating_point_bits<FloatT>;
+
+            bits_t bits;
+            std::memcpy(&bits, &f, sizeof(bits));
+
+            const auto sign_bit = bits_t(bits_t(1u) << (sizeof(bits_t) * CHAR_BIT - 1u));
+            const auto magnitude = bits_t(bits & ~sign_bit);
+            const auto negative =
+                bits_t(bits_t(0u) - bits_t(bits >> (sizeof(bits_t) * CHAR_BIT - 1u)));
+            // negates the magnitude if the sign is set, without branch
+            return bits_t(sign_bit + bits_t(bits_t(magnitude ^ negative) - negative));
+        }
+
+        template <typename FloatT>
+        TYPE_SAFE_FORCE_INLINE floating_point_bits<FloatT> ulp_distance(FloatT a, FloatT b) noexcept
+        {
+            using bits_t = floating_point_bits<FloatT>;
+
+            const auto ordered_a = ordered_bits(a);
+            const auto ordered_b = ordered_bits(b);
+            const auto distance  = ordered_a > ordered_b ? bits_t(ordered_a - ordered_b) :
+                                                          bits_t(ordered_b - ordered_a);
+            // all bits set if either one is NaN
+            const auto nan_mask = bits_t(bits_t(0u) - bits_t(a != a || b != b));
+            return bits_t(distance | nan_mask);
+        }
+
+#if defined(FP_FAST_FMAF)
+        TYPE_SAFE_FORCE_INLINE float mul_add(float a, float b, float c) noexcept
+        {
+            return std::fma(a, b, c);
+        }
+#else
+        TYPE_SAFE_FORCE_INLINE float mul_add(float a, float b, float c) noexcept
+        {
+            return a * b + c;
+        }
+#endif
+
+#if defined(FP_FAST_FMA)
+        TYPE_SAFE_FORCE_INLINE double mul_add(double a, double b, double c) noexcept
+        {
+            return std::fma(a, b, c);
+        }
+#else
+        TYPE_SAFE_FORCE_INLINE double mul_add(double a, double b, double c) noexcept
+        {
+            return a * b + c;
+        }
+#endif
+
+#if defined(FP_FAST_FMAL)
+        TYPE_SAFE_FORCE_INLINE long double mul_add(long double a, long double b,
+                                                   long double c) noexcept
+        {
+            return std::fma(a, b, c);
+        }
+#else
+        TYPE_SAFE_FORCE_INLINE long double mul_add(long double a, long double b,
+                                                   long double c) noexcept
+        {
+            return a * b + c;
+        }
+#endif
+    } // namespace detail
+
+    /// \returns The number of representable values between `a` and `b`,
+    /// i.e. `0` if they are equal and `1` if they are adjacent floating points.
+    /// If either of them is NaN, it returns the maximal value of the integer type.
+    /// \notes It is computed using integer arithmetic on the bit representations without branches,
+    /// so it can be used in vectorized loops.
+    /// \notes This function does not participate in overload resolution
+    /// unless `FloatT` is an IEEE 754 single or double precision type.
+    /// \module types
+    template <typename FloatT>
+    TYPE_SAFE_FORCE_INLINE detail::floating_point_bits<FloatT> ulp_distance(
+        const floating_point<FloatT>& a, const floating_point<FloatT>& b) noexcept
+    {
+        return detail::ulp_distance(a.get(), b.get());
+    }
+
+    /// \returns `true` if there are at most `max_ulps` representable values between `a` and `b`,
+    /// `false` otherwise or if either of them is NaN.
+    /// \notes This is the recommended replacement for the missing equality operator,
+    /// as it scales with the magnitude of the values.
+    /// It does not work well for values near zero,
+    /// use `almost_equal_abs()` for those.
+    /// \notes This function does not participate in overload resolution
+    /// unless `FloatT` is an IEEE 754 single or double precision type.
+    /// \module types
+    template <typename FloatT>
+    TYPE_SAFE_FORCE_INLINE bool almost_equal_ulps(
+        const floating_point<FloatT>& a, const floating_point<FloatT>& b,
+        detail::floating_point_bits<FloatT> max_ulps = 4u) noexcept
+    {
+        // NaN already gives the maximal distance, but that is a valid max_ulps as well
+        return (a.get() == a.get()) & (b.get() == b.get())
+               & (detail::ulp_distance(a.get(), b.get()) <= max_ulps);
+    }
+
+    /// \returns `true` if the absolute difference between `a` and `b` is at most `tolerance`,
+    /// `false` otherwise or if either of them is NaN.
+    /// \module types
+    template <typename FloatT>
+    TYPE_SAFE_FORCE_INLINE bool almost_equal_abs(const floating_point<FloatT>& a,
+                                                 const floating_point<FloatT>& b,
+                                                 const floating_point<FloatT>& tolerance) noexcept
+    {
+        return std::fabs(a.get() - b.get()) <= tolerance.get();
+    }
+
+    /// \returns `true` if the absolute difference between `a` and `b` is at most `tolerance`
+    /// times the bigger of their absolute values,
+    /// `false` otherwise or if either of them is NaN.
+    /// \module types
+    template <typename FloatT>
+    TYPE_SAFE_FORCE_INLINE bool almost_equal_rel(const floating_point<FloatT>& a,
+                                                 const floating_point<FloatT>& b,
+                                                 const floating_point<FloatT>& tolerance) noexcept
+    {
+        const auto abs_a = std::fabs(a.get());
+        const auto abs_b = std::fabs(b.get());
+        return std::fabs(a.get() - b.get()) <= tolerance.get() * (abs_a < abs_b ? abs_b : abs_a);
+    }
+
+    //=== fused operations ===//
+    /// \returns `a * b + c` computed as if to infinite precision and rounded only once.
+    /// \notes This always computes the fused result using [std::fma](),
+    /// which is a single instruction if the target supports it,
+    /// but a slow software emulation otherwise.
+    /// Use `mul_add()` if the rounding doesn't matter.
+    /// \module types
+    template <typename FloatT>
+    TYPE_SAFE_FORCE_INLINE floating_point<FloatT> fma(const floating_point<FloatT>& a,
+                                                      const floating_point<FloatT>& b,
+                                                      const floating_point<FloatT>& c) noexcept
+    {
+        return floating_point<FloatT>(std::fma(a.get(), b.get(), c.get()));
+    }
+
+    /// \returns `a * b + c`.
+    /// \notes It uses a fused multiply-add if the target has a fast one, i.e. `FP_FAST_FMA` is defined,
+    /// and separate operations otherwise,
+    /// so the result can differ in the last bit depending on the target.
+    /// \module types
+    template <typename FloatT>
+    TYPE_SAFE_FORCE_INLINE floating_point<FloatT> mul_add(const floating_point<FloatT>& a,
+                                                          const floating_point<FloatT>& b,
+                                                          const floating_point<FloatT>& c) noexcept
+    {
+        return floating_point<FloatT>(detail::mul_add(a.get(), b.get(), c.get()));
+    }
+
     //=== input/output ===/
     /// \effects Reads a float from the [std::istream]() and assigns it to the given [ts::floating_point]().
     /// \module types
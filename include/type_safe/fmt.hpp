@@ -0,0 +1,177 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_FMT_HPP_INCLUDED
+#define TYPE_SAFE_FMT_HPP_INCLUDED
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <type_safe/format.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        template <typename OutputIt>
+        OutputIt copy_fmt_chars(const char* str, std::size_t size, OutputIt out)
+        {
+            return std::copy(str, str + size, out);
+        }
+
+        template <typename OutputIt>
+        struct variant_fmt_visitor
+        {
+            OutputIt out;
+
+            OutputIt operator()(nullvar_t) const
+            {
+                return copy_fmt_chars("nullvar", 7u, out);
+            }
+
+            template <typename T>
+            OutputIt operator()(const T& value) const
+            {
+                return fmt::format_to(out, "{}", value);
+            }
+        };
+    } // namespace detail
+} // namespace type_safe
+
+// the formatters require {fmt} 8 or newer
+namespace fmt
+{
+    /// Formats a [ts::integer]() like the integer type it wraps,
+    /// including all format specifiers of that type.
+    /// \module types
+    template <typename IntegerT, class Policy, typename Char>
+    struct formatter<type_safe::integer<IntegerT, Policy>, Char> : formatter<IntegerT, Char>
+    {
+        template <typename FormatContext>
+        auto format(const type_safe::integer<IntegerT, Policy>& value, FormatContext& ctx) const
+            -> decltype(ctx.out())
+        {
+            return formatter<IntegerT, Char>::format(static_cast<IntegerT>(value), ctx);
+        }
+    };
+
+    /// Formats a [ts::floating_point]() like the floating point type it wraps,
+    /// including all format specifiers of that type.
+    /// \module types
+    template <typename FloatT, typename Char>
+    struct formatter<type_safe::floating_point<FloatT>, Char> : formatter<FloatT, Char>
+    {
+        template <typename FormatContext>
+        auto format(const type_safe::floating_point<FloatT>& value, FormatContext& ctx) const
+            -> decltype(ctx.out())
+        {
+            return formatter<FloatT, Char>::format(static_cast<FloatT>(value), ctx);
+        }
+    };
+
+    /// Formats a [ts::boolean]() like a `bool`,
+    /// including all format specifiers of `bool`.
+    /// \module types
+    template <typename Char>
+    struct formatter<type_safe::boolean, Char> : formatter<bool, Char>
+    {
+        template <typename FormatContext>
+        auto format(const type_safe::boolean& value, FormatContext& ctx) const
+            -> decltype(ctx.out())
+        {
+            return formatter<bool, Char>::format(static_cast<bool>(value), ctx);
+        }
+    };
+
+    /// Formats a [ts::strong_typedef]() like its underlying type,
+    /// including all format specifiers of that type.
+    /// \module types
+    template <typename StrongTypedef, typename Char>
+    struct formatter<StrongTypedef, Char,
+                     decltype(void(type_safe::detail::underlying_type(
+                         std::declval<StrongTypedef>())))>
+    : formatter<type_safe::underlying_type<StrongTypedef>, Char>
+    {
+        using underlying = type_safe::underlying_type<StrongTypedef>;
+
+        template <typename FormatContext>
+        auto format(const StrongTypedef& value, FormatContext& ctx) const -> decltype(ctx.out())
+        {
+            return formatter<underlying, Char>::format(static_cast<const underlying&>(value), ctx);
+        }
+    };
+
+    /// Formats a [ts::basic_optional]() like its value, or as `nullopt` if it doesn't have one.
+    /// The format specifiers are the ones of the value type, they are ignored for `nullopt`.
+    /// \module optional
+    template <class StoragePolicy, typename Char>
+    struct formatter<type_safe::basic_optional<StoragePolicy>, Char>
+    : formatter<typename std::decay<
+                    typename type_safe::basic_optional<StoragePolicy>::value_type>::type,
+                Char>
+    {
+        using value_type = typename std::decay<
+            typename type_safe::basic_optional<StoragePolicy>::value_type>::type;
+
+        template <typename FormatContext>
+        auto format(const type_safe::basic_optional<StoragePolicy>& opt, FormatContext& ctx) const
+            -> decltype(ctx.out())
+        {
+            if (opt.has_value())
+                return formatter<value_type, Char>::format(opt.value(), ctx);
+            return type_safe::detail::copy_fmt_chars("nullopt", 7u, ctx.out());
+        }
+    };
+
+    /// Formats a [ts::basic_variant]() like its currently active value,
+    /// or as `nullvar` if it is empty.
+    /// It does not accept any format specifiers, as they depend on the active type.
+    /// \module variant
+    template <class VariantPolicy, typename Head, typename... Types>
+    struct formatter<type_safe::basic_variant<VariantPolicy, Head, Types...>, char>
+    {
+        template <typename ParseContext>
+        FMT_CONSTEXPR auto parse(ParseContext& ctx) -> decltype(ctx.begin())
+        {
+            return ctx.begin();
+        }
+
+        template <typename FormatContext>
+        auto format(const type_safe::basic_variant<VariantPolicy, Head, Types...>& variant,
+                    FormatContext& ctx) const -> decltype(ctx.out())
+        {
+            using visitor = type_safe::detail::variant_fmt_visitor<decltype(ctx.out())>;
+            return type_safe::visit(visitor{ctx.out()}, variant);
+        }
+    };
+
+    /// Formats a [ts::flag_set]() like [ts::to_chars](),
+    /// i.e. as one `0` or `1` for each flag, starting with the last flag.
+    /// It does not accept any format specifiers.
+    /// \module types
+    template <typename Enum, typename Char>
+    struct formatter<type_safe::flag_set<Enum>, Char>
+    {
+        template <typename ParseContext>
+        FMT_CONSTEXPR auto parse(ParseContext& ctx) -> decltype(ctx.begin())
+        {
+            return ctx.begin();
+        }
+
+        template <typename FormatContext>
+        auto format(const type_safe::flag_set<Enum>& set, FormatContext& ctx) const
+            -> decltype(ctx.out())
+        {
+            char buffer[type_safe::flag_set_traits<Enum>::size()];
+            auto end = type_safe::to_chars(buffer, buffer + sizeof(buffer), set);
+            return type_safe::detail::copy_fmt_chars(buffer, std::size_t(end - buffer), ctx.out());
+        }
+    };
+} // namespace fmt
+
+#endif // TYPE_SAFE_FMT_HPP_INCLUDED
@@ -0,0 +1,255 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_FORMAT_HPP_INCLUDED
+#define TYPE_SAFE_FORMAT_HPP_INCLUDED
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include <type_safe/config.hpp>
+
+#if TYPE_SAFE_USE_FROM_CHARS
+#include <charconv>
+#include <system_error>
+#endif
+
+#include <type_safe/boolean.hpp>
+#include <type_safe/flag_set.hpp>
+#include <type_safe/floating_point.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/optional.hpp>
+#include <type_safe/strong_typedef.hpp>
+#include <type_safe/variant.hpp>
+#include <type_safe/visitor.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        template <typename T, typename = void>
+        struct chars_formatter;
+
+        inline char* write_chars(char* first, char* last, const char* str) noexcept
+        {
+            for (; *str; ++str, ++first)
+            {
+                if (first == last)
+                    return nullptr;
+                *first = *str;
+            }
+            return first;
+        }
+
+        template <typename T>
+        using enable_format_integer = typename std::enable_if<
+            std::is_integral<T>::value && !std::is_same<T, bool>::value>::type;
+
+#if TYPE_SAFE_USE_FROM_CHARS
+        template <typename T>
+        struct chars_formatter<T, enable_format_integer<T>>
+        {
+            static char* format(char* first, char* last, T value) noexcept
+            {
+                auto result = std::to_chars(first, last, value);
+                return result.ec == std::errc() ? result.ptr : nullptr;
+            }
+        };
+#else
+        // same output as std::to_chars(): an optional minus sign followed by decimal digits
+        template <typename T>
+        struct chars_formatter<T, enable_format_integer<T>>
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+
+            static bool is_negative(T value, std::true_type) noexcept
+            {
+                return value < T(0);
+            }
+
+            static bool is_negative(T, std::false_type) noexcept
+            {
+                return false;
+            }
+
+            static char* format(char* first, char* last, T value) noexcept
+            {
+                auto negative  = is_negative(value, std::is_signed<T>{});
+                auto magnitude = negative ? static_cast<unsigned_type>(0u - unsigned_type(value)) :
+                                            static_cast<unsigned_type>(value);
+
+                // the digits are generated in reverse order
+                char buffer[std::numeric_limits<unsigned_type>::digits10 + 2];
+                auto cur = buffer;
+                do
+                {
+                    *cur++    = static_cast<char>('0' + magnitude % 10u);
+                    magnitude = static_cast<unsigned_type>(magnitude / 10u);
+                } while (magnitude != 0u);
+                if (negative)
+                    *cur++ = '-';
+
+                if (last - first < cur - buffer)
+                    return nullptr;
+                while (cur != buffer)
+                    *first++ = *--cur;
+                return first;
+            }
+        };
+#endif
+
+#if TYPE_SAFE_USE_FROM_CHARS && defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        template <typename T>
+        struct chars_formatter<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+        {
+            static char* format(char* first, char* last, T value) noexcept
+            {
+                // shortest representation that round trips
+                auto result = std::to_chars(first, last, value);
+                return result.ec == std::errc() ? result.ptr : nullptr;
+            }
+        };
+#endif
+
+        template <>
+        struct chars_formatter<bool>
+        {
+            static char* format(char* first, char* last, bool value) noexcept
+            {
+                return write_chars(first, last, value ? "true" : "false");
+            }
+        };
+
+        template <>
+        struct chars_formatter<boolean>
+        {
+            static char* format(char* first, char* last, boolean value) noexcept
+            {
+                return chars_formatter<bool>::format(first, last, static_cast<bool>(value));
+            }
+        };
+
+        template <typename IntegerT, class Policy>
+        struct chars_formatter<integer<IntegerT, Policy>>
+        {
+            static char* format(char* first, char* last, const integer<IntegerT, Policy>& value)
+            {
+                return chars_formatter<IntegerT>::format(first, last, static_cast<IntegerT>(value));
+            }
+        };
+
+        template <typename FloatT>
+        struct chars_formatter<floating_point<FloatT>>
+        {
+            static char* format(char* first, char* last, const floating_point<FloatT>& value)
+            {
+                return chars_formatter<FloatT>::format(first, last, static_cast<FloatT>(value));
+            }
+        };
+
+        template <typename StrongTypedef>
+        struct chars_formatter<StrongTypedef, decltype(void(detail::underlying_type(
+                                                  std::declval<StrongTypedef>())))>
+        {
+            using underlying = type_safe::underlying_type<StrongTypedef>;
+
+            static char* format(char* first, char* last, const StrongTypedef& value)
+            {
+                return chars_formatter<underlying>::format(first, last,
+                                                           static_cast<const underlying&>(value));
+            }
+        };
+
+        template <class StoragePolicy>
+        struct chars_formatter<basic_optional<StoragePolicy>>
+        {
+            using value_type =
+                typename std::decay<typename basic_optional<StoragePolicy>::value_type>::type;
+
+            static char* format(char* first, char* last, const basic_optional<StoragePolicy>& opt)
+            {
+                if (opt.has_value())
+                    return chars_formatter<value_type>::format(first, last, opt.value());
+                return write_chars(first, last, "nullopt");
+            }
+        };
+
+        struct variant_chars_visitor
+        {
+            char* first;
+            char* last;
+
+            char* operator()(nullvar_t) const noexcept
+            {
+                return write_chars(first, last, "nullvar");
+            }
+
+            template <typename T>
+            char* operator()(const T& value) const
+            {
+                return chars_formatter<T>::format(first, last, value);
+            }
+        };
+
+        template <class VariantPolicy, typename Head, typename... Types>
+        struct chars_formatter<basic_variant<VariantPolicy, Head, Types...>>
+        {
+            static char* format(char* first, char* last,
+                                const basic_variant<VariantPolicy, Head, Types...>& variant)
+            {
+                return visit(variant_chars_visitor{first, last}, variant);
+            }
+        };
+
+        template <typename Enum>
+        struct chars_formatter<flag_set<Enum>>
+        {
+            static char* format(char* first, char* last, const flag_set<Enum>& set) noexcept
+            {
+                auto size = flag_set_traits<Enum>::size();
+                if (static_cast<std::size_t>(last - first) < size)
+                    return nullptr;
+
+                // the last flag comes first, like std::bitset::to_string()
+                // queried flag by flag, so it works with more flags than the biggest integer
+                for (auto i = size; i != 0u; --i)
+                    *first++ = set.is_set(static_cast<Enum>(i - 1u)) ? '1' : '0';
+                return first;
+            }
+        };
+    } // namespace detail
+
+    /// \effects Writes the textual representation of `value` into `[first, last)`:
+    /// * integers are written in decimal with a minus sign if they are negative,
+    /// like with `std::to_chars()`
+    /// * floating points are written in the shortest representation that can be parsed back,
+    /// like with `std::to_chars()`
+    /// * `bool` and [ts::boolean]() are written as `true` or `false`
+    /// * [ts::integer](), [ts::floating_point]() and [ts::strong_typedef]() are written
+    /// as the type they wrap
+    /// * [ts::basic_optional]() is written as its value, or `nullopt` if it doesn't have one
+    /// * [ts::basic_variant]() is written as the currently active value,
+    /// or `nullvar` if it is empty
+    /// * [ts::flag_set]() is written as one `0` or `1` for each flag, starting with the last flag,
+    /// like `std::bitset::to_string()`
+    /// \returns A pointer one past the last character written,
+    /// or `nullptr` if `[first, last)` is too small, then its contents are unspecified.
+    /// \notes It does not allocate memory, throw exceptions or depend on the locale,
+    /// so it can be used instead of [ts::strong_typedef_op::output_operator]() for logging.
+    /// It uses `std::to_chars()` if it is available,
+    /// floating points are only supported then.
+    /// The result can be parsed back with [ts::parse]() for the types it supports.
+    /// \requires `T` must be an integer, floating point or boolean type,
+    /// or one of the types above of those types.
+    /// \module types
+    template <typename T>
+    char* to_chars(char* first, char* last, const T& value)
+    {
+        return detail::chars_formatter<T>::format(first, last, value);
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_FORMAT_HPP_INCLUDED
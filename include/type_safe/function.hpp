@@ -0,0 +1,195 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_FUNCTION_HPP_INCLUDED
+#define TYPE_SAFE_FUNCTION_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/reference.hpp>
+#include <type_safe/relocation.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        // the functor is required not to throw here, the move of the function is noexcept
+        template <typename Functor>
+        void relocate_functor(void* dest, void* src) noexcept
+        {
+            auto& functor = *static_cast<Functor*>(src);
+            ::new (dest) Functor(std::move(functor));
+            functor.~Functor();
+        }
+
+        template <typename Functor>
+        void destroy_functor(void* memory) noexcept
+        {
+            static_cast<Functor*>(memory)->~Functor();
+        }
+
+        // only needed for functors that are not trivially relocatable and destructible,
+        // relocate is null if the functor can be relocated with memcpy()
+        struct function_manager
+        {
+            void (*relocate)(void* dest, void* src) noexcept;
+            void (*destroy)(void* memory) noexcept;
+        };
+
+        template <typename Functor>
+        struct function_manager_for
+        {
+            static constexpr function_manager value = {is_trivially_relocatable<Functor>::value ?
+                                                           nullptr :
+                                                           &relocate_functor<Functor>,
+                                                       &destroy_functor<Functor>};
+        };
+
+        template <typename Functor>
+        constexpr function_manager function_manager_for<Functor>::value;
+    } // namespace detail
+
+    template <typename Signature, std::size_t BufferSize = 2 * sizeof(void*)>
+    class function;
+
+    /// An owning function wrapper with a fixed-size buffer.
+    ///
+    /// It is an alternative to [std::function]() that never allocates memory:
+    /// the functor is stored in a buffer of `BufferSize` bytes inside the object,
+    /// and functors that do not fit are rejected at compile-time.
+    /// Like [ts::function_ref]() calling it is a single indirect call.
+    ///
+    /// It can store any function that is compatible with the given signature,
+    /// see [ts::function_ref]() for the rules.
+    /// It is move-only, so it can also store move-only functors.
+    /// If the functor is [ts::is_trivially_relocatable](), moving it does not do any indirect call,
+    /// and if it is also trivially destructible, neither does destroying it.
+    /// \requires The move constructor and destructor of the functor must not throw,
+    /// moving and destroying the function are `noexcept`, so an exception calls [std::terminate]().
+    /// \notes A moved-from function must only be assigned to or destroyed.
+    template <typename Return, typename... Args, std::size_t BufferSize>
+    class function<Return(Args...), BufferSize>
+    {
+    public:
+        using signature = Return(Args...);
+
+        /// \effects Creates a function storing a copy/the moved functor.
+        /// \notes This constructor does not participate in overload resolution,
+        /// unless the functor is compatible with the specified signature.
+        /// \notes It is a compile-time error if the functor is bigger than `BufferSize`
+        /// or has a bigger alignment than the buffer.
+        /// \param 1
+        /// \exclude
+        template <typename Functor,
+                  typename = typename std::enable_if<
+                      !std::is_same<typename std::decay<Functor>::type, function>::value>::type,
+                  typename detail::enable_matching_function<typename std::decay<Functor>::type,
+                                                            Return, Args...>::type = 0>
+        function(Functor&& f)
+        : cb_(&invoke_functor<typename std::decay<Functor>::type>),
+          manager_(get_manager<typename std::decay<Functor>::type>())
+        {
+            using functor = typename std::decay<Functor>::type;
+            static_assert(sizeof(functor) <= BufferSize,
+                          "functor does not fit into the buffer, increase BufferSize");
+            static_assert(alignof(functor) <= alignof(storage),
+                          "functor has a bigger alignment than the buffer");
+            ::new (get_memory()) functor(std::forward<Functor>(f));
+        }
+
+        /// \effects Moves the functor stored in `other` into the new function,
+        /// leaving `other` in the moved-from state.
+        function(function&& other) noexcept : cb_(other.cb_), manager_(other.manager_)
+        {
+            relocate_from(other);
+        }
+
+        /// \effects Destroys the stored functor.
+        ~function() noexcept
+        {
+            destroy();
+        }
+
+        /// \effects Destroys the stored functor and moves the one of `other` into it,
+        /// leaving `other` in the moved-from state.
+        function& operator=(function&& other) noexcept
+        {
+            if (this != &other)
+            {
+                destroy();
+                cb_      = other.cb_;
+                manager_ = other.manager_;
+                relocate_from(other);
+            }
+            return *this;
+        }
+
+        /// \effects Invokes the stored function with the specified arguments and returns the result.
+        /// \requires The function must not be in the moved-from state.
+        Return operator()(Args... args) const
+        {
+            TYPE_SAFE_PRECONDITION(cb_, "function was moved from");
+            return cb_(get_memory(), static_cast<Args>(args)...);
+        }
+
+    private:
+        template <typename Functor>
+        static const detail::function_manager* get_manager() noexcept
+        {
+            return is_trivially_relocatable<Functor>::value
+                           && std::is_trivially_destructible<Functor>::value ?
+                       nullptr :
+                       &detail::function_manager_for<Functor>::value;
+        }
+
+        template <typename Functor>
+        static Return invoke_functor(const void* memory, Args... args)
+        {
+            auto& func = *static_cast<Functor*>(const_cast<void*>(memory));
+            return static_cast<Return>(func(static_cast<Args>(args)...));
+        }
+
+        void relocate_from(function& other) noexcept
+        {
+            if (manager_ && manager_->relocate)
+                manager_->relocate(get_memory(), other.get_memory());
+            else
+                std::memcpy(get_memory(), other.get_memory(), BufferSize);
+
+            other.cb_      = nullptr;
+            other.manager_ = nullptr;
+        }
+
+        void destroy() noexcept
+        {
+            if (manager_)
+                manager_->destroy(get_memory());
+        }
+
+        void* get_memory() noexcept
+        {
+            return &storage_;
+        }
+
+        const void* get_memory() const noexcept
+        {
+            return &storage_;
+        }
+
+        using storage  = typename std::aligned_storage<BufferSize>::type;
+        using callback = Return (*)(const void*, Args...);
+
+        storage                         storage_;
+        callback                        cb_;
+        const detail::function_manager* manager_;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_FUNCTION_HPP_INCLUDED
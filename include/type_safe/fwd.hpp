@@ -0,0 +1,72 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_FWD_HPP_INCLUDED
+#define TYPE_SAFE_FWD_HPP_INCLUDED
+
+#include <type_safe/config.hpp>
+
+// forward declarations of the commonly used types:
+// include it in headers that only need to name the types in declarations,
+// e.g. as parameter or return type of a function or as pointer or reference member,
+// and include the header that defines the type where it is actually used
+
+namespace type_safe
+{
+    //=== arithmetic_policy.hpp ===//
+    class undefined_behavior_arithmetic;
+    class default_arithmetic;
+
+#if TYPE_SAFE_ARITHMETIC_UB
+    /// The default `ArithmeticPolicy`.
+    ///
+    /// It depends on the [TYPE_SAFE_ARITHMETIC_UB]() macro,
+    /// and is either [ts::undefined_behavior_arithmetic]() or [ts::default_arithmetic]().
+    /// \exclude target
+    /// \module types
+    using arithmetic_policy_default = undefined_behavior_arithmetic;
+#else
+    using arithmetic_policy_default = default_arithmetic;
+#endif
+
+    //=== boolean.hpp ===//
+    class boolean;
+
+    //=== integer.hpp ===//
+    template <typename IntegerT, class Policy = arithmetic_policy_default>
+    class integer;
+
+    //=== floating_point.hpp ===//
+    template <typename FloatT>
+    class floating_point;
+
+    //=== strong_typedef.hpp ===//
+    template <class Tag, typename T>
+    class strong_typedef;
+
+    //=== optional.hpp ===//
+    template <class StoragePolicy>
+    class basic_optional;
+
+    template <typename T>
+    class direct_optional_storage;
+
+    /// A [ts::basic_optional]() that uses [ts::direct_optional_storage<T>]().
+    /// \module optional
+    template <typename T>
+    using optional = basic_optional<direct_optional_storage<T>>;
+
+    //=== variant.hpp ===//
+    template <class VariantPolicy, typename HeadT, typename... TailT>
+    class basic_variant;
+
+    //=== reference.hpp ===//
+    template <typename T, bool XValue = false>
+    class object_ref;
+
+    template <typename Signature>
+    class function_ref;
+} // namespace type_safe
+
+#endif // TYPE_SAFE_FWD_HPP_INCLUDED
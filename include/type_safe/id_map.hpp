@@ -0,0 +1,370 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_ID_MAP_HPP_INCLUDED
+#define TYPE_SAFE_ID_MAP_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/compact_optional.hpp>
+#include <type_safe/optional_ref.hpp>
+#include <type_safe/strong_typedef.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        constexpr std::size_t id_map_min_capacity = 16u;
+
+        // maximum load factor is 7/8
+        constexpr std::size_t id_map_max_size(std::size_t capacity) noexcept
+        {
+            return capacity - capacity / 8u;
+        }
+
+        inline std::size_t id_map_capacity_for(std::size_t size) noexcept
+        {
+            auto capacity = id_map_min_capacity;
+            while (id_map_max_size(capacity) < size)
+                capacity *= 2u;
+            return capacity;
+        }
+
+        template <class Key>
+        using id_map_default_policy =
+            compact_integer_policy<type_safe::underlying_type<Key>,
+                                   std::numeric_limits<type_safe::underlying_type<Key>>::max()>;
+    } // namespace detail
+
+    /// A hash map from [ts::strong_typedef]() ids to values.
+    ///
+    /// It is an open-addressing hash table using linear probing,
+    /// the keys and values are stored in two contiguous arrays,
+    /// so a lookup does not chase any pointers.
+    /// The `Key` must be a [ts::strong_typedef]() of an integer,
+    /// it is hashed like [ts::fast_hashable]() does.
+    ///
+    /// Empty slots are marked by storing the invalid value of the `KeyPolicy`
+    /// in the key array, which is a `CompactPolicy` like [ts::compact_integer_policy]().
+    /// By default it is the maximum value of the integer, so that key must not be inserted.
+    /// Erasing uses backward shift deletion,
+    /// so the table never contains tombstones.
+    /// \requires `Value` must be nothrow move constructible.
+    template <class Key, typename Value, class KeyPolicy = detail::id_map_default_policy<Key>>
+    class id_map
+    {
+        using key_int = underlying_type<Key>;
+        static_assert(std::is_integral<key_int>::value,
+                      "key must be a strong typedef of an integer");
+        static_assert(std::is_same<typename KeyPolicy::storage_type, key_int>::value,
+                      "policy must store the underlying integer of the key");
+        static_assert(std::is_nothrow_move_constructible<Value>::value,
+                      "value must be nothrow move constructible");
+
+    public:
+        using key_type    = Key;
+        using mapped_type = Value;
+
+        //=== constructors/destructor/assignment ===//
+        /// \effects Creates an empty map without allocating memory.
+        id_map() noexcept : size_(0u), capacity_(0u)
+        {
+        }
+
+        /// \effects Creates an empty map with enough capacity for `size` elements.
+        explicit id_map(std::size_t size) : id_map()
+        {
+            reserve(size);
+        }
+
+        /// \effects Copies all elements of `other`.
+        id_map(const id_map& other) : id_map(other.size_)
+        {
+            other.for_each([&](const Key& key, const Value& value) { emplace(key, value); });
+        }
+
+        /// \effects Moves all elements of `other`, which will be empty afterwards.
+        id_map(id_map&& other) noexcept : id_map()
+        {
+            swap(*this, other);
+        }
+
+        /// \effects Destroys all elements.
+        ~id_map() noexcept
+        {
+            clear();
+        }
+
+        /// \effects Copies (1)/moves (2) all elements of `other`.
+        /// \group assign
+        id_map& operator=(const id_map& other)
+        {
+            id_map tmp(other);
+            swap(*this, tmp);
+            return *this;
+        }
+
+        /// \group assign
+        id_map& operator=(id_map&& other) noexcept
+        {
+            id_map tmp(std::move(other));
+            swap(*this, tmp);
+            return *this;
+        }
+
+        /// \effects Swaps the two maps.
+        friend void swap(id_map& a, id_map& b) noexcept
+        {
+            using std::swap;
+            swap(a.keys_, b.keys_);
+            swap(a.values_, b.values_);
+            swap(a.size_, b.size_);
+            swap(a.capacity_, b.capacity_);
+        }
+
+        //=== capacity ===//
+        /// \returns The number of elements in the map.
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// \returns Whether or not the map is empty.
+        bool empty() const noexcept
+        {
+            return size_ == 0u;
+        }
+
+        /// \returns The number of slots of the table.
+        std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        /// \effects Ensures that `size` elements can be stored without rehashing.
+        void reserve(std::size_t size)
+        {
+            if (size > detail::id_map_max_size(capacity_))
+                rehash(detail::id_map_capacity_for(size));
+        }
+
+        //=== modifiers ===//
+        /// \effects If there is no element with the given key,
+        /// creates a new one by forwarding the arguments.
+        /// \returns `true` if an element was created, `false` if the key already existed.
+        /// \requires `key` must not be the invalid key of the policy.
+        template <typename... Args>
+        bool emplace(const Key& key, Args&&... args)
+        {
+            return try_emplace(key, std::forward<Args>(args)...).second;
+        }
+
+        /// \effects If there is no element with the given key, inserts `value`,
+        /// otherwise assigns it to the existing element.
+        /// \returns `true` if an element was created, `false` if it was assigned.
+        /// \requires `key` must not be the invalid key of the policy.
+        template <typename U>
+        bool insert_or_assign(const Key& key, U&& value)
+        {
+            auto result = try_emplace(key, std::forward<U>(value));
+            if (!result.second)
+                *result.first = std::forward<U>(value);
+            return result.second;
+        }
+
+        /// \effects Removes the element with the given key, if there is one.
+        /// \returns `true` if an element was removed, `false` otherwise.
+        bool erase(const Key& key) noexcept
+        {
+            auto index = find(get_int(key));
+            if (index == capacity_)
+                return false;
+
+            value_at(index).~Value();
+            --size_;
+            // backward shift deletion:
+            // move elements of the following cluster into the hole, if that is closer to their slot
+            auto hole = index;
+            for (auto cur = next(hole); !KeyPolicy::is_invalid(keys_[cur]); cur = next(cur))
+            {
+                auto ideal = slot(keys_[cur]);
+                if (((cur - ideal) & mask()) >= ((cur - hole) & mask()))
+                {
+                    keys_[hole] = keys_[cur];
+                    ::new (get_memory(hole)) Value(std::move(value_at(cur)));
+                    value_at(cur).~Value();
+                    hole = cur;
+                }
+            }
+            keys_[hole] = KeyPolicy::invalid_value();
+            return true;
+        }
+
+        /// \effects Destroys all elements, the capacity does not change.
+        void clear() noexcept
+        {
+            for (std::size_t i = 0u; i != capacity_; ++i)
+                if (!KeyPolicy::is_invalid(keys_[i]))
+                {
+                    value_at(i).~Value();
+                    keys_[i] = KeyPolicy::invalid_value();
+                }
+            size_ = 0u;
+        }
+
+        //=== lookup ===//
+        /// \returns A (`const`) [ts::optional_ref]() to the value of the given key,
+        /// or a null reference if there is no element with that key.
+        /// \group lookup
+        optional_ref<Value> lookup(const Key& key) noexcept
+        {
+            auto index = find(get_int(key));
+            return type_safe::opt_ref(index == capacity_ ? nullptr : &value_at(index));
+        }
+
+        /// \group lookup
+        optional_ref<const Value> lookup(const Key& key) const noexcept
+        {
+            auto index = find(get_int(key));
+            return type_safe::opt_ref(index == capacity_ ? nullptr : &value_at(index));
+        }
+
+        /// \returns Whether or not there is an element with the given key.
+        bool contains(const Key& key) const noexcept
+        {
+            return find(get_int(key)) != capacity_;
+        }
+
+        /// \effects Invokes `f` with the key and (`const`) value of every element,
+        /// in an unspecified order.
+        /// \notes `f` must not modify the map.
+        /// \group for_each
+        template <typename Func>
+        void for_each(Func&& f)
+        {
+            for (std::size_t i = 0u; i != capacity_; ++i)
+                if (!KeyPolicy::is_invalid(keys_[i]))
+                    f(Key(keys_[i]), value_at(i));
+        }
+
+        /// \group for_each
+        template <typename Func>
+        void for_each(Func&& f) const
+        {
+            for (std::size_t i = 0u; i != capacity_; ++i)
+                if (!KeyPolicy::is_invalid(keys_[i]))
+                    f(Key(keys_[i]), static_cast<const Value&>(value_at(i)));
+        }
+
+    private:
+        using storage = typename std::aligned_storage<sizeof(Value), alignof(Value)>::type;
+
+        static key_int get_int(const Key& key) noexcept
+        {
+            return static_cast<const key_int&>(key);
+        }
+
+        std::size_t mask() const noexcept
+        {
+            return capacity_ - 1u;
+        }
+
+        std::size_t slot(key_int key) const noexcept
+        {
+            return static_cast<std::size_t>(detail::hash_mix(static_cast<std::uint64_t>(key)))
+                   & mask();
+        }
+
+        std::size_t next(std::size_t index) const noexcept
+        {
+            return (index + 1u) & mask();
+        }
+
+        // returns capacity_ if not found
+        std::size_t find(key_int key) const noexcept
+        {
+            if (capacity_ == 0u)
+                return capacity_;
+
+            for (auto index = slot(key);; index = next(index))
+                if (keys_[index] == key)
+                    return index;
+                else if (KeyPolicy::is_invalid(keys_[index]))
+                    return capacity_;
+        }
+
+        template <typename... Args>
+        std::pair<Value*, bool> try_emplace(const Key& key, Args&&... args)
+        {
+            auto int_key = get_int(key);
+            TYPE_SAFE_PRECONDITION(!KeyPolicy::is_invalid(int_key),
+                                   "key must not be the invalid key");
+
+            reserve(size_ + 1u);
+            auto index = slot(int_key);
+            for (; !KeyPolicy::is_invalid(keys_[index]); index = next(index))
+                if (keys_[index] == int_key)
+                    return std::make_pair(&value_at(index), false);
+
+            ::new (get_memory(index)) Value(std::forward<Args>(args)...);
+            keys_[index] = int_key;
+            ++size_;
+            return std::make_pair(&value_at(index), true);
+        }
+
+        void rehash(std::size_t new_capacity)
+        {
+            id_map tmp;
+            tmp.keys_.reset(new key_int[new_capacity]);
+            tmp.values_.reset(new storage[new_capacity]);
+            tmp.capacity_ = new_capacity;
+            for (std::size_t i = 0u; i != new_capacity; ++i)
+                tmp.keys_[i] = KeyPolicy::invalid_value();
+
+            // moving is nothrow and there are no duplicates, so this cannot fail
+            for (std::size_t i = 0u; i != capacity_; ++i)
+                if (!KeyPolicy::is_invalid(keys_[i]))
+                {
+                    auto index = tmp.slot(keys_[i]);
+                    while (!KeyPolicy::is_invalid(tmp.keys_[index]))
+                        index = tmp.next(index);
+
+                    ::new (tmp.get_memory(index)) Value(std::move(value_at(i)));
+                    tmp.keys_[index] = keys_[i];
+                    ++tmp.size_;
+                }
+
+            swap(*this, tmp);
+        }
+
+        void* get_memory(std::size_t index) noexcept
+        {
+            return &values_[index];
+        }
+
+        Value& value_at(std::size_t index) noexcept
+        {
+            return *static_cast<Value*>(get_memory(index));
+        }
+
+        const Value& value_at(std::size_t index) const noexcept
+        {
+            return *static_cast<const Value*>(static_cast<const void*>(&values_[index]));
+        }
+
+        std::unique_ptr<key_int[]> keys_;
+        std::unique_ptr<storage[]> values_;
+        std::size_t                size_, capacity_;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_ID_MAP_HPP_INCLUDED
@@ -6,6 +6,8 @@
 #define TYPE_SAFE_INDEX_HPP_INCLUDED
 
 #include <cstddef>
+#include <iterator>
+#include <utility>
 
 #include <type_safe/config.hpp>
 #include <type_safe/strong_typedef.hpp>
@@ -198,12 +200,198 @@ namespace type_safe
     auto at(Indexable&& obj, const index_t& index)
         -> decltype(std::forward<Indexable>(obj)[static_cast<std::size_t>(get(index))])
     {
-        DEBUG_ASSERT(detail::index_valid(detail::member_size{}, obj,
-                                         static_cast<std::size_t>(get(index))),
-                     detail::precondition_error_handler{});
+        TYPE_SAFE_SAMPLED_PRECONDITION(detail::index_valid(detail::member_size{}, obj,
+                                                           static_cast<std::size_t>(get(index))),
+                                       "out of bounds index");
         return std::forward<Indexable>(obj)[static_cast<std::size_t>(get(index))];
     }
 
+    class index_range;
+
+    /// An [ts::index_t]() that is known to be a valid index.
+    ///
+    /// It can only be created by iterating over a [ts::index_range](),
+    /// which has validated the bounds at construction.
+    /// Accessing an element with it using [ts::at()]() does not check the index again.
+    /// \module types
+    class in_bounds_index
+    {
+    public:
+        /// \returns The index.
+        /// \group get
+        constexpr const index_t& get() const noexcept
+        {
+            return index_;
+        }
+
+        /// \group get
+        constexpr operator const index_t&() const noexcept
+        {
+            return index_;
+        }
+
+    private:
+        explicit constexpr in_bounds_index(std::size_t index) noexcept : index_(index)
+        {
+        }
+
+        index_t index_;
+
+        friend index_range;
+    };
+
+    /// \exclude
+    namespace detail
+    {
+        template <typename Indexable>
+        auto index_size(non_member_size, const Indexable& obj)
+            -> decltype(static_cast<std::size_t>(size(obj)))
+        {
+            return static_cast<std::size_t>(size(obj));
+        }
+
+        template <typename Indexable>
+        auto index_size(member_size, const Indexable& obj)
+            -> decltype(static_cast<std::size_t>(obj.size()))
+        {
+            return static_cast<std::size_t>(obj.size());
+        }
+
+        template <typename T, std::size_t Size>
+        std::size_t index_size(member_size, const T (&)[Size])
+        {
+            return Size;
+        }
+
+        struct subscript_size_t
+        {
+        };
+
+        struct subscript_in_bounds : subscript_size_t
+        {
+        };
+
+        template <typename Indexable>
+        auto unchecked_at(subscript_size_t, Indexable&& obj, const in_bounds_index& index)
+            -> decltype(std::forward<Indexable>(obj)[static_cast<std::size_t>(get(index.get()))])
+        {
+            return std::forward<Indexable>(obj)[static_cast<std::size_t>(get(index.get()))];
+        }
+
+        // for types like ts::array_ref whose operator[] checks the index itself
+        template <typename Indexable>
+        auto unchecked_at(subscript_in_bounds, Indexable&& obj, const in_bounds_index& index)
+            -> decltype(std::forward<Indexable>(obj)[index])
+        {
+            return std::forward<Indexable>(obj)[index];
+        }
+    } // namespace detail
+
+    /// A range of all valid indices of an object.
+    ///
+    /// It checks the size of the object once at construction
+    /// and then yields [ts::in_bounds_index]() objects for all indices from `0` to `size - 1`.
+    /// Use them with [ts::at()]() to access the elements without a bounds check for every access,
+    /// even if precondition checks are enabled.
+    /// \requires The size of the object must not shrink while the indices are used.
+    /// \module types
+    class index_range
+    {
+    public:
+        /// A forward iterator over the indices.
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = in_bounds_index;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const in_bounds_index*;
+            using reference         = in_bounds_index;
+
+            in_bounds_index operator*() const noexcept
+            {
+                return in_bounds_index(index_);
+            }
+
+            iterator& operator++() noexcept
+            {
+                ++index_;
+                return *this;
+            }
+
+            iterator operator++(int) noexcept
+            {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+            {
+                return lhs.index_ == rhs.index_;
+            }
+
+            friend bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
+
+        private:
+            explicit iterator(std::size_t index) noexcept : index_(index)
+            {
+            }
+
+            std::size_t index_;
+
+            friend index_range;
+        };
+
+        /// \effects Creates the range of valid indices of `obj`,
+        /// i.e. `[0, size)`, where `size` is `obj.size()`, `size(obj)` or the size of the C array.
+        template <typename Indexable>
+        explicit index_range(const Indexable& obj)
+        : size_(detail::index_size(detail::member_size{}, obj))
+        {
+        }
+
+        /// \returns An iterator to the first/one past the last index.
+        /// \group iter
+        iterator begin() const noexcept
+        {
+            return iterator(0u);
+        }
+
+        /// \group iter
+        iterator end() const noexcept
+        {
+            return iterator(size_);
+        }
+
+        /// \returns The number of indices.
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+    private:
+        std::size_t size_;
+    };
+
+    /// \returns The `i`th element of `obj` like the other overload,
+    /// but does not check the index, as it has already been validated by the [ts::index_range]().
+    /// \requires `index` must have been created by an [ts::index_range]() for `obj`
+    /// or an object with at most the same size.
+    /// \exclude return
+    /// \module types
+    template <typename Indexable>
+    auto at(Indexable&& obj, const in_bounds_index& index)
+        -> decltype(detail::unchecked_at(detail::subscript_in_bounds{},
+                                         std::forward<Indexable>(obj), index))
+    {
+        return detail::unchecked_at(detail::subscript_in_bounds{}, std::forward<Indexable>(obj),
+                                    index);
+    }
+
     /// \effects Increments the [ts::index_t]() by the specified distance.
     /// If the distance is negative, decrements the index instead.
     /// \notes This is the same as `index += dist` and the equivalent of [std::advance()]().
@@ -5,6 +5,7 @@
 #ifndef TYPE_SAFE_INTEGER_HPP_INCLUDED
 #define TYPE_SAFE_INTEGER_HPP_INCLUDED
 
+#include <functional>
 #include <iosfwd>
 #include <limits>
 #include <type_traits>
@@ -12,12 +13,10 @@
 #include <type_safe/detail/assert.hpp>
 #include <type_safe/detail/force_inline.hpp>
 #include <type_safe/arithmetic_policy.hpp>
+#include <type_safe/fwd.hpp>
 
 namespace type_safe
 {
-    template <typename IntegerT, class Policy = arithmetic_policy_default>
-    class integer;
-
     /// \exclude
     namespace detail
     {
@@ -353,9 +352,7 @@ namespace type_safe
         using result_type = make_signed_t<Integer>;
         return i <= Integer(std::numeric_limits<result_type>::max()) ?
                    static_cast<result_type>(i) :
-                   (DEBUG_UNREACHABLE(detail::precondition_error_handler{}, "conversion "
-                                                                            "would "
-                                                                            "overflow"),
+                   (TYPE_SAFE_PRECONDITION_UNREACHABLE("conversion would overflow"),
                     result_type());
     }
 
@@ -386,8 +383,7 @@ namespace type_safe
     {
         using result_type = make_unsigned_t<Integer>;
         return i >= Integer(0) ? static_cast<result_type>(i) :
-                                 (DEBUG_UNREACHABLE(detail::precondition_error_handler{},
-                                                    "conversion would underflow"),
+                                 (TYPE_SAFE_PRECONDITION_UNREACHABLE("conversion would underflow"),
                                   result_type(0));
     }
 
@@ -686,4 +682,18 @@ namespace type_safe
     }
 } // namespace type_safe
 
+namespace std
+{
+    /// Hash for [ts::integer]().
+    /// \module types
+    template <typename IntegerT, class Policy>
+    struct hash<type_safe::integer<IntegerT, Policy>>
+    {
+        std::size_t operator()(const type_safe::integer<IntegerT, Policy>& i) const noexcept
+        {
+            return std::hash<IntegerT>()(static_cast<IntegerT>(i));
+        }
+    };
+} // namespace std
+
 #endif // TYPE_SAFE_INTEGER_HPP_INCLUDED
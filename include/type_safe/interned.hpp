@@ -0,0 +1,195 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_INTERNED_HPP_INCLUDED
+#define TYPE_SAFE_INTERNED_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include <type_safe/reference.hpp>
+#include <type_safe/strong_typedef.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        struct interned_entry
+        {
+            std::size_t hash;
+            std::string str;
+        };
+
+        struct interned_entry_hash
+        {
+            std::size_t operator()(const interned_entry& entry) const noexcept
+            {
+                return entry.hash;
+            }
+        };
+
+        struct interned_entry_equal
+        {
+            bool operator()(const interned_entry& a, const interned_entry& b) const noexcept
+            {
+                return a.hash == b.hash && a.str == b.str;
+            }
+        };
+
+        inline const interned_entry& interned_empty_entry()
+        {
+            static const interned_entry entry{std::hash<std::string>{}(std::string()),
+                                              std::string()};
+            return entry;
+        }
+
+        // the nodes of an unordered_set are never moved, so the entries have stable addresses
+        class interned_table
+        {
+        public:
+            const interned_entry* intern(const char* str, std::size_t size)
+            {
+                if (size == 0u)
+                    return &interned_empty_entry();
+
+                interned_entry entry{0u, std::string(str, size)};
+                entry.hash = std::hash<std::string>{}(entry.str);
+
+                std::lock_guard<std::mutex> lock(mutex_);
+                return &*entries_.emplace(std::move(entry)).first;
+            }
+
+        private:
+            std::mutex                                                                mutex_;
+            std::unordered_set<interned_entry, interned_entry_hash, interned_entry_equal> entries_;
+        };
+
+        template <class Tag>
+        interned_table& get_interned_table()
+        {
+            static interned_table table;
+            return table;
+        }
+    } // namespace detail
+
+    /// An interned string, i.e. a [ts::strong_typedef]() over a pointer into an intern table.
+    ///
+    /// Each distinct string is stored only once in the table of the `Tag`,
+    /// so two interned strings of the same `Tag` are equal if and only if the pointers are equal,
+    /// and copying it is copying a pointer.
+    /// The hash is computed once when the string is interned,
+    /// so `std::hash` doesn't need to look at the characters either.
+    /// Use a different `Tag` for each kind of symbol,
+    /// so the strings of different kinds can't be compared.
+    ///
+    /// The table is thread-safe, but interning a string needs to lock a mutex,
+    /// so the strings should be interned once and then passed around.
+    /// The strings are never removed from the table.
+    /// \notes The table is a function-local `static` object,
+    /// so the strings must not be accessed after it has been destroyed when the program exits.
+    /// \module types
+    template <class Tag>
+    class interned : public strong_typedef<interned<Tag>, const detail::interned_entry*>,
+                     public strong_typedef_op::equality_comparison<interned<Tag>>
+    {
+        using base = strong_typedef<interned<Tag>, const detail::interned_entry*>;
+
+    public:
+        /// \effects Creates it with the empty string.
+        /// \notes It doesn't need to access the table.
+        interned() noexcept : base(&detail::interned_empty_entry())
+        {
+        }
+
+        /// \effects Interns the given string,
+        /// i.e. inserts it into the table if it isn't already there.
+        /// \throws Anything thrown by the allocation of the new string in the table.
+        /// \group ctor
+        explicit interned(const char* str) : interned(str, std::strlen(str))
+        {
+        }
+
+        /// \group ctor
+        interned(const char* str, std::size_t size)
+        : base(detail::get_interned_table<Tag>().intern(str, size))
+        {
+        }
+
+        /// \group ctor
+        explicit interned(const std::string& str) : interned(str.data(), str.size())
+        {
+        }
+
+        /// \group ctor
+        explicit interned(const array_ref<const char>& str)
+        : interned(str.data(), static_cast<std::size_t>(str.size()))
+        {
+        }
+
+        /// \returns A reference to the characters of the string.
+        array_ref<const char> view() const noexcept
+        {
+            return array_ref<const char>(data(), size());
+        }
+
+        /// \returns A reference to the string in the table.
+        const std::string& str() const noexcept
+        {
+            return get(*this)->str;
+        }
+
+        /// \returns A pointer to the null-terminated characters of the string.
+        /// \group data
+        const char* data() const noexcept
+        {
+            return str().c_str();
+        }
+
+        /// \group data
+        const char* c_str() const noexcept
+        {
+            return data();
+        }
+
+        /// \returns The size of the string.
+        std::size_t size() const noexcept
+        {
+            return str().size();
+        }
+
+        /// \returns Whether or not it is the empty string.
+        bool empty() const noexcept
+        {
+            return size() == 0u;
+        }
+
+        /// \returns The hash of the string, as computed by `std::hash<std::string>`.
+        std::size_t hash() const noexcept
+        {
+            return get(*this)->hash;
+        }
+    };
+} // namespace type_safe
+
+namespace std
+{
+    /// Hash for [ts::interned](),
+    /// it returns the precomputed hash.
+    /// \module types
+    template <class Tag>
+    struct hash<type_safe::interned<Tag>>
+    {
+        std::size_t operator()(const type_safe::interned<Tag>& str) const noexcept
+        {
+            return str.hash();
+        }
+    };
+} // namespace std
+
+#endif // TYPE_SAFE_INTERNED_HPP_INCLUDED
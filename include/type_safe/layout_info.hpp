@@ -0,0 +1,86 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_LAYOUT_INFO_HPP_INCLUDED
+#define TYPE_SAFE_LAYOUT_INFO_HPP_INCLUDED
+
+#include <cstddef>
+#include <type_traits>
+
+#include <type_safe/relocation.hpp>
+
+namespace type_safe
+{
+    /// Information about the layout of the type `T` compared to the type `Underlying`.
+    ///
+    /// It is meant to compare a wrapper type like [ts::basic_optional]() or [ts::basic_variant]()
+    /// with the type it stores,
+    /// e.g. `static_assert(ts::layout_info<ts::optional<int>, int>::overhead() <= alignof(int))`,
+    /// so that a change that increases the size or removes the triviality of a wrapper
+    /// is noticed at compile-time.
+    /// \module types
+    template <typename T, typename Underlying = T>
+    struct layout_info
+    {
+        using type            = T;
+        using underlying_type = Underlying;
+
+        /// \returns The size of `T`.
+        static constexpr std::size_t size() noexcept
+        {
+            return sizeof(T);
+        }
+
+        /// \returns The alignment of `T`.
+        static constexpr std::size_t alignment() noexcept
+        {
+            return alignof(T);
+        }
+
+        /// \returns The size of `Underlying`.
+        static constexpr std::size_t underlying_size() noexcept
+        {
+            return sizeof(Underlying);
+        }
+
+        /// \returns The number of bytes `T` is bigger than `Underlying`,
+        /// or `0` if it isn't bigger.
+        static constexpr std::size_t overhead() noexcept
+        {
+            return size() > underlying_size() ? size() - underlying_size() : 0u;
+        }
+
+        /// \returns Whether or not `T` is trivially copyable/destructible/relocatable.
+        /// \group trivial
+        static constexpr bool is_trivially_copyable() noexcept
+        {
+            return detail::is_trivially_copyable<T>::value;
+        }
+
+        /// \group trivial
+        static constexpr bool is_trivially_destructible() noexcept
+        {
+            return std::is_trivially_destructible<T>::value;
+        }
+
+        /// \group trivial
+        static constexpr bool is_trivially_relocatable() noexcept
+        {
+            return type_safe::is_trivially_relocatable<T>::value;
+        }
+
+        /// \returns Whether `T` is trivially copyable/destructible/relocatable,
+        /// if `Underlying` is.
+        static constexpr bool preserves_triviality() noexcept
+        {
+            return (!detail::is_trivially_copyable<Underlying>::value || is_trivially_copyable())
+                   && (!std::is_trivially_destructible<Underlying>::value
+                       || is_trivially_destructible())
+                   && (!type_safe::is_trivially_relocatable<Underlying>::value
+                       || is_trivially_relocatable());
+        }
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_LAYOUT_INFO_HPP_INCLUDED
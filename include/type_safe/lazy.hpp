@@ -0,0 +1,192 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_LAZY_HPP_INCLUDED
+#define TYPE_SAFE_LAZY_HPP_INCLUDED
+
+#include <atomic>
+#include <utility>
+
+#include <type_safe/config.hpp>
+#include <type_safe/atomic_flag.hpp>
+#include <type_safe/deferred_construction.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        enum lazy_state : atomic_flag_state
+        {
+            lazy_empty,
+            lazy_initializing,
+            lazy_initializing_waiting, // threads are blocked and need a notification
+            lazy_ready,
+        };
+
+        // how often the state is polled before blocking,
+        // the initialization is usually short
+        constexpr unsigned lazy_spin_count = 128u;
+    } // namespace detail
+
+    /// A value that is initialized on first access, which can happen concurrently.
+    ///
+    /// The value is created from the result of the `Init` function the first time it is accessed.
+    /// If the access happens concurrently, `Init` is only called by one of the threads,
+    /// the others wait until it has finished.
+    /// After the initialization an access is a single load with acquire semantics,
+    /// unlike `std::call_once()`, which usually needs a function call.
+    /// The waiting threads poll the state for a short while and then block,
+    /// like [ts::atomic_flag::wait()]().
+    /// If `Init` throws an exception, the exception is propagated to the calling thread,
+    /// and the value stays uninitialized, so the next access will call `Init` again.
+    ///
+    /// Example:
+    /// ```cpp
+    /// type_safe::lazy<table> lookup_table([] { return compute_table(); });
+    ///
+    /// // on any thread, computed the first time
+    /// auto entry = lookup_table->find(key);
+    /// ```
+    /// \requires `Init` must be a function object that can be called with no arguments,
+    /// returning a `T` or something `T` can be constructed from.
+    /// \notes The value is stored in a [ts::deferred_construction](),
+    /// the only additional state is the atomic 32bit integer used with the futex.
+    /// \module types
+    template <typename T, typename Init = T (*)()>
+    class lazy
+    {
+    public:
+        using value_type = T;
+
+        /// \effects Creates it uninitialized,
+        /// the value will be initialized by calling `init` on first access.
+        explicit lazy(Init init) : init_(std::move(init)), state_(detail::lazy_empty)
+        {
+        }
+
+        lazy(const lazy&) = delete;
+        lazy& operator=(const lazy&) = delete;
+
+        /// \returns Whether or not the value has been initialized already.
+        /// \notes Another thread may initialize the value at any time,
+        /// so it only makes sense when it returns `true`.
+        bool has_value() const noexcept
+        {
+            return state_.load(std::memory_order_acquire) == detail::lazy_ready;
+        }
+
+        /// \effects Initializes the value if that hasn't been done already,
+        /// or waits until another thread has initialized it.
+        /// \returns A (`const`) reference to the value.
+        /// \throws Anything thrown by `Init` or the constructor of `T`,
+        /// then the value is still uninitialized.
+        /// \notes Modifying the value through the non-`const` overloads isn't synchronized,
+        /// only the initialization is.
+        /// \group value
+        T& value()
+        {
+            if (!has_value())
+                initialize();
+            return value_.value();
+        }
+
+        /// \group value
+        const T& value() const
+        {
+            if (!has_value())
+                initialize();
+            return value_.value();
+        }
+
+        /// \group value
+        T& operator*()
+        {
+            return value();
+        }
+
+        /// \group value
+        const T& operator*() const
+        {
+            return value();
+        }
+
+        /// \returns A pointer to `value()`.
+        /// \group arrow
+        T* operator->()
+        {
+            return &value();
+        }
+
+        /// \group arrow
+        const T* operator->() const
+        {
+            return &value();
+        }
+
+    private:
+        void initialize() const
+        {
+            auto state = state_.load(std::memory_order_acquire);
+            for (auto spins = 0u; state != detail::lazy_ready;)
+            {
+                if (state == detail::lazy_empty)
+                {
+                    if (state_.compare_exchange_weak(state, detail::lazy_initializing,
+                                                     std::memory_order_acquire))
+                    {
+                        construct();
+                        return;
+                    }
+                }
+                else if (spins < detail::lazy_spin_count)
+                {
+                    ++spins;
+                    state = state_.load(std::memory_order_acquire);
+                }
+                else if (state == detail::lazy_initializing)
+                {
+                    // tell the initializing thread that it has to notify
+                    if (state_.compare_exchange_weak(state, detail::lazy_initializing_waiting,
+                                                     std::memory_order_acquire))
+                        state = detail::lazy_initializing_waiting;
+                }
+                else
+                {
+                    detail::atomic_flag_wait(state_, detail::lazy_initializing_waiting,
+                                             std::memory_order_acquire);
+                    state = state_.load(std::memory_order_acquire);
+                }
+            }
+        }
+
+        void construct() const
+        {
+            TYPE_SAFE_TRY
+            {
+                value_.emplace(init_());
+            }
+            TYPE_SAFE_CATCH_ALL
+            {
+                // let the next access try again
+                finish(detail::lazy_empty);
+                TYPE_SAFE_RETHROW;
+            }
+            finish(detail::lazy_ready);
+        }
+
+        void finish(detail::lazy_state new_state) const noexcept
+        {
+            if (state_.exchange(new_state, std::memory_order_release)
+                == detail::lazy_initializing_waiting)
+                detail::atomic_flag_notify(state_, true);
+        }
+
+        mutable Init                                   init_;
+        mutable deferred_construction<T>               value_;
+        mutable std::atomic<detail::atomic_flag_state> state_;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_LAZY_HPP_INCLUDED
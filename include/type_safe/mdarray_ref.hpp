@@ -0,0 +1,441 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_MDARRAY_REF_HPP_INCLUDED
+#define TYPE_SAFE_MDARRAY_REF_HPP_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include <type_safe/detail/all_of.hpp>
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/index.hpp>
+#include <type_safe/reference.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        // stores the index instead of a pointer,
+        // so the end iterator does not point outside of the array
+        template <typename T>
+        class strided_iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type        = typename std::remove_cv<T>::type;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = T*;
+            using reference         = T&;
+
+            strided_iterator() noexcept : data_(nullptr), stride_(0u), index_(0u)
+            {
+            }
+
+            strided_iterator(T* data, std::size_t stride, std::size_t index) noexcept
+            : data_(data), stride_(stride), index_(index)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return data_[index_ * stride_];
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &**this;
+            }
+
+            reference operator[](difference_type n) const noexcept
+            {
+                return *(*this + n);
+            }
+
+            strided_iterator& operator++() noexcept
+            {
+                ++index_;
+                return *this;
+            }
+
+            strided_iterator operator++(int) noexcept
+            {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            strided_iterator& operator--() noexcept
+            {
+                --index_;
+                return *this;
+            }
+
+            strided_iterator operator--(int) noexcept
+            {
+                auto tmp = *this;
+                --*this;
+                return tmp;
+            }
+
+            strided_iterator& operator+=(difference_type n) noexcept
+            {
+                index_ = static_cast<std::size_t>(static_cast<difference_type>(index_) + n);
+                return *this;
+            }
+
+            strided_iterator& operator-=(difference_type n) noexcept
+            {
+                return *this += -n;
+            }
+
+            friend strided_iterator operator+(strided_iterator iter, difference_type n) noexcept
+            {
+                return iter += n;
+            }
+
+            friend strided_iterator operator+(difference_type n, strided_iterator iter) noexcept
+            {
+                return iter += n;
+            }
+
+            friend strided_iterator operator-(strided_iterator iter, difference_type n) noexcept
+            {
+                return iter -= n;
+            }
+
+            friend difference_type operator-(const strided_iterator& lhs,
+                                             const strided_iterator& rhs) noexcept
+            {
+                return static_cast<difference_type>(lhs.index_)
+                       - static_cast<difference_type>(rhs.index_);
+            }
+
+            friend bool operator==(const strided_iterator& lhs,
+                                   const strided_iterator& rhs) noexcept
+            {
+                return lhs.index_ == rhs.index_;
+            }
+
+            friend bool operator!=(const strided_iterator& lhs,
+                                   const strided_iterator& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
+
+            friend bool operator<(const strided_iterator& lhs, const strided_iterator& rhs) noexcept
+            {
+                return lhs.index_ < rhs.index_;
+            }
+
+            friend bool operator<=(const strided_iterator& lhs,
+                                   const strided_iterator& rhs) noexcept
+            {
+                return !(rhs < lhs);
+            }
+
+            friend bool operator>(const strided_iterator& lhs, const strided_iterator& rhs) noexcept
+            {
+                return rhs < lhs;
+            }
+
+            friend bool operator>=(const strided_iterator& lhs,
+                                   const strided_iterator& rhs) noexcept
+            {
+                return !(lhs < rhs);
+            }
+
+        private:
+            T*          data_;
+            std::size_t stride_, index_;
+        };
+
+        template <typename T>
+        struct is_index : std::is_convertible<T, index_t>
+        {
+        };
+
+        template <typename T>
+        struct is_extent : std::is_convertible<T, size_t>
+        {
+        };
+    } // namespace detail
+
+    /// A reference to every `stride`th object of type `T` in an array.
+    ///
+    /// It is the strided version of [ts::array_ref]():
+    /// element `i` is located at `data()[i * stride()]`.
+    /// This allows referring to a column of a matrix or a channel of an interleaved buffer
+    /// without copying.
+    /// Use [ts::at()]() for checked access, it uses `size()` to check the index.
+    template <typename T>
+    class strided_array_ref
+    {
+        static_assert(!std::is_void<T>::value, "must not be void");
+        static_assert(!std::is_reference<T>::value, "pass the type without reference");
+
+    public:
+        using value_type     = T;
+        using reference_type = T&;
+        using iterator       = detail::strided_iterator<T>;
+
+        /// \effects Sets the reference to an empty array.
+        strided_array_ref(std::nullptr_t) noexcept : data_(nullptr), size_(0u), stride_(1u)
+        {
+        }
+
+        /// \effects Sets the reference to `size` elements starting at `data`,
+        /// each `stride` elements apart.
+        /// \requires `data` must not be `nullptr` and `stride` must not be `0`.
+        strided_array_ref(T* data, size_t size, size_t stride) noexcept
+        : data_(data), size_(size), stride_(stride)
+        {
+            TYPE_SAFE_PRECONDITION(data, "invalid array bounds");
+            TYPE_SAFE_PRECONDITION(stride_ != 0u, "stride must not be zero");
+        }
+
+        /// \effects Sets the reference to the same elements as the [ts::array_ref](),
+        /// i.e. with a stride of `1`.
+        template <typename U, bool XValue,
+                  typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+        strided_array_ref(const array_ref<U, XValue>& ref) noexcept
+        : data_(ref.data()), size_(ref.size()), stride_(1u)
+        {
+        }
+
+        /// \returns An iterator to the beginning of the array.
+        iterator begin() const noexcept
+        {
+            return iterator(data_, stride_.get(), 0u);
+        }
+
+        /// \returns An iterator one past the last element of the array.
+        iterator end() const noexcept
+        {
+            return iterator(data_, stride_.get(), size_.get());
+        }
+
+        /// \returns A pointer to the first element.
+        T* data() const noexcept
+        {
+            return data_;
+        }
+
+        /// \returns The number of elements.
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// \returns The distance between two consecutive elements in number of objects.
+        size_t stride() const noexcept
+        {
+            return stride_;
+        }
+
+        /// \returns A reference to the `i`th element of the array.
+        /// \requires `i < size()`.
+        reference_type operator[](index_t i) const noexcept
+        {
+            TYPE_SAFE_PRECONDITION(detail::index_valid(detail::member_size{}, *this,
+                                                       static_cast<std::size_t>(get(i))),
+                                   "out of bounds array access");
+            return data_[static_cast<std::size_t>(get(i)) * stride_.get()];
+        }
+
+        /// \returns The same as the other overload,
+        /// but does not check the index, as it has already been validated by a [ts::index_range]().
+        /// \requires `i` must have been created by an [ts::index_range]() for this array
+        /// or one with at most the same size.
+        reference_type operator[](const in_bounds_index& i) const noexcept
+        {
+            return data_[static_cast<std::size_t>(get(i.get())) * stride_.get()];
+        }
+
+        /// \returns A reference to the `size` elements starting at the `i`th element.
+        /// \requires `i + size <= size()`.
+        strided_array_ref subview(index_t i, size_t size) const noexcept
+        {
+            TYPE_SAFE_PRECONDITION(static_cast<std::size_t>(get(i)) + size.get() <= size_.get(),
+                                   "out of bounds subview");
+            return strided_array_ref(data_ + static_cast<std::size_t>(get(i)) * stride_.get(),
+                                     size, stride_);
+        }
+
+    private:
+        T*     data_;
+        size_t size_, stride_;
+    };
+
+    /// A reference to a multidimensional array of objects of type `T`.
+    ///
+    /// It is a pointer together with the number of elements (the extent)
+    /// and the stride of each of the `Rank` dimensions.
+    /// When created from a pointer and extents it refers to a contiguous array in row-major order,
+    /// i.e. like a nested C array.
+    /// Slicing it creates a reference with a lower rank without copying,
+    /// so it can refer to a column of a matrix.
+    /// \requires `Rank` must not be zero.
+    template <typename T, std::size_t Rank>
+    class mdarray_ref
+    {
+        static_assert(Rank > 0u, "rank must not be zero");
+        static_assert(!std::is_void<T>::value, "must not be void");
+        static_assert(!std::is_reference<T>::value, "pass the type without reference");
+
+    public:
+        using value_type     = T;
+        using reference_type = T&;
+        using extents_type   = std::array<std::size_t, Rank>;
+
+        /// \effects Sets the reference to the contiguous array in row-major order
+        /// starting at `data` with the given extents.
+        /// \requires `data` must not be `nullptr`.
+        /// \group extents
+        mdarray_ref(T* data, const extents_type& extents) noexcept : data_(data), extents_(extents)
+        {
+            TYPE_SAFE_PRECONDITION(data, "invalid array bounds");
+            std::size_t stride = 1u;
+            for (auto i = Rank; i != 0u; --i)
+            {
+                strides_[i - 1u] = stride;
+                stride *= extents_[i - 1u];
+            }
+        }
+
+        /// \group extents
+        /// \param 2
+        /// \exclude
+        template <typename... Extents,
+                  typename = typename std::enable_if<
+                      sizeof...(Extents) == Rank
+                      && detail::all_of<detail::is_extent<Extents>::value...>::value>::type>
+        mdarray_ref(T* data, Extents... extents) noexcept
+        : mdarray_ref(data, extents_type{{static_cast<std::size_t>(size_t(extents))...}})
+        {
+        }
+
+        /// \effects Sets the reference to the array starting at `data`
+        /// with the given extents and strides.
+        /// \requires `data` must not be `nullptr`.
+        mdarray_ref(T* data, const extents_type& extents, const extents_type& strides) noexcept
+        : data_(data), extents_(extents), strides_(strides)
+        {
+            TYPE_SAFE_PRECONDITION(data, "invalid array bounds");
+        }
+
+        /// \returns A pointer to the first element.
+        T* data() const noexcept
+        {
+            return data_;
+        }
+
+        /// \returns The rank, i.e. the number of dimensions.
+        static constexpr std::size_t rank() noexcept
+        {
+            return Rank;
+        }
+
+        /// \returns The number of elements in the given dimension.
+        /// \requires `dim < rank()`.
+        size_t extent(index_t dim) const noexcept
+        {
+            return at(extents_, dim);
+        }
+
+        /// \returns The distance between two consecutive elements of the given dimension
+        /// in number of objects.
+        /// \requires `dim < rank()`.
+        size_t stride(index_t dim) const noexcept
+        {
+            return at(strides_, dim);
+        }
+
+        /// \returns The total number of elements.
+        size_t size() const noexcept
+        {
+            std::size_t result = 1u;
+            for (auto extent : extents_)
+                result *= extent;
+            return result;
+        }
+
+        /// \returns A reference to the element with the given indices.
+        /// \requires There must be exactly `Rank` indices,
+        /// each must be less than the extent of its dimension.
+        /// \param 1
+        /// \exclude
+        template <typename... Indices,
+                  typename = typename std::enable_if<
+                      sizeof...(Indices) == Rank
+                      && detail::all_of<detail::is_index<Indices>::value...>::value>::type>
+        reference_type operator()(Indices... indices) const noexcept
+        {
+            const std::array<index_t, Rank> idx = {{index_t(indices)...}};
+            std::size_t                      offset = 0u;
+            for (std::size_t dim = 0u; dim != Rank; ++dim)
+            {
+                auto i = static_cast<std::size_t>(get(idx[dim]));
+                TYPE_SAFE_PRECONDITION(i < extents_[dim], "out of bounds array access");
+                offset += i * strides_[dim];
+            }
+            return data_[offset];
+        }
+
+        /// \returns A reference to all the elements whose index in dimension `dim` is `i`,
+        /// it has one dimension less.
+        /// \requires `Rank > 1`, `dim < rank()` and `i < extent(dim)`.
+        template <std::size_t R = Rank, typename = typename std::enable_if<(R > 1u)>::type>
+        mdarray_ref<T, Rank - 1u> slice(index_t dim, index_t i) const noexcept
+        {
+            auto d     = static_cast<std::size_t>(get(dim));
+            auto index = static_cast<std::size_t>(get(i));
+            TYPE_SAFE_PRECONDITION(d < Rank, "invalid dimension");
+            TYPE_SAFE_PRECONDITION(index < extents_[d], "out of bounds slice");
+
+            std::array<std::size_t, Rank - 1u> extents, strides;
+            for (std::size_t cur = 0u, result = 0u; cur != Rank; ++cur)
+                if (cur != d)
+                {
+                    extents[result] = extents_[cur];
+                    strides[result] = strides_[cur];
+                    ++result;
+                }
+            return mdarray_ref<T, Rank - 1u>(data_ + index * strides_[d], extents, strides);
+        }
+
+        /// \returns A reference to the `i`th row/column of a two dimensional array.
+        /// \requires `Rank == 2` and `i` must be less than the number of rows/columns.
+        /// \group row_column
+        template <std::size_t R = Rank, typename = typename std::enable_if<R == 2u>::type>
+        strided_array_ref<T> row(index_t i) const noexcept
+        {
+            return slice(0u, i).as_strided();
+        }
+
+        /// \group row_column
+        template <std::size_t R = Rank, typename = typename std::enable_if<R == 2u>::type>
+        strided_array_ref<T> column(index_t i) const noexcept
+        {
+            return slice(1u, i).as_strided();
+        }
+
+        /// \returns The elements of a one dimensional array as [ts::strided_array_ref]().
+        /// \requires `Rank == 1`.
+        template <std::size_t R = Rank, typename = typename std::enable_if<R == 1u>::type>
+        strided_array_ref<T> as_strided() const noexcept
+        {
+            return strided_array_ref<T>(data_, extents_[0], strides_[0]);
+        }
+
+    private:
+        T*           data_;
+        extents_type extents_, strides_;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_MDARRAY_REF_HPP_INCLUDED
@@ -5,8 +5,16 @@
 #ifndef TYPE_SAFE_NARROW_CAST_HPP_INCLUDED
 #define TYPE_SAFE_NARROW_CAST_HPP_INCLUDED
 
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <type_traits>
+
+#include <type_safe/detail/assert.hpp>
 #include <type_safe/floating_point.hpp>
 #include <type_safe/integer.hpp>
+#include <type_safe/reference.hpp>
 
 namespace type_safe
 {
@@ -45,7 +53,9 @@ namespace type_safe
             using limits = std::numeric_limits<Target>;
             return sizeof(Target) < sizeof(Source) // no narrowing possible
                    && (source > Source(limits::max())
-                       || source < Source(limits::min())); // otherwise check bounds
+                       // unsigned values are never below the minimum of the target
+                       || (std::is_signed<Source>::value
+                           && source < Source(limits::min()))); // otherwise check bounds
         }
 
         template <typename Target, typename Source>
@@ -72,8 +82,7 @@ namespace type_safe
     TYPE_SAFE_FORCE_INLINE constexpr Target narrow_cast(const Source& source) noexcept
     {
         return detail::is_narrowing<Target>(source) ?
-                   (DEBUG_UNREACHABLE(detail::precondition_error_handler{},
-                                      "conversion would truncate value"),
+                   (TYPE_SAFE_PRECONDITION_UNREACHABLE("conversion would truncate value"),
                     Target()) :
                    static_cast<Target>(source);
     }
@@ -108,6 +117,127 @@ namespace type_safe
         using target_t     = typename target_float::floating_point_type;
         return narrow_cast<target_t>(static_cast<Source>(source));
     }
+
+    /// \exclude
+    namespace detail
+    {
+        //=== batch narrowing check ===//
+        // integers: in range iff minimum and maximum are, computed in one vectorized pass
+        template <typename Target, typename Source>
+        bool batch_is_narrowing(std::true_type, const Source* source, std::size_t size) noexcept
+        {
+            if (size == 0u)
+                return false;
+
+            auto min = source[0], max = source[0];
+            for (std::size_t i = 1u; i != size; ++i)
+            {
+                min = source[i] < min ? source[i] : min;
+                max = source[i] > max ? source[i] : max;
+            }
+            return is_narrowing<Target>(min) || is_narrowing<Target>(max);
+        }
+
+        // floating points: round trip each value, no early exit so the loop is vectorized
+        template <typename Target, typename Source>
+        bool batch_is_narrowing(std::false_type, const Source* source, std::size_t size) noexcept
+        {
+            std::uint_least64_t result = 0u; // a bool accumulator prevents vectorization
+            for (std::size_t i = 0u; i != size; ++i)
+                result |= static_cast<Source>(static_cast<Target>(source[i])) != source[i];
+            return result != 0u;
+        }
+
+        template <typename Target, typename Source>
+        bool batch_is_narrowing(const Source* source, std::size_t size) noexcept
+        {
+            return sizeof(Target) < sizeof(Source)
+                   && batch_is_narrowing<Target>(std::is_integral<Source>{}, source, size);
+        }
+
+        // only searched after the batch check failed
+        template <typename Target, typename Source>
+        std::size_t first_narrowing(const Source* source, std::size_t size) noexcept
+        {
+            for (std::size_t i = 0u; i != size; ++i)
+                if (is_narrowing<Target>(source[i]))
+                    return i;
+            return size;
+        }
+
+#if !TYPE_SAFE_PRECONDITION_TELEMETRY
+        template <typename Target, typename Source>
+        struct batch_narrowing
+        {
+            const Source* source;
+            std::size_t   size;
+        };
+
+        // formats the failing index into the message, the handler doesn't keep it
+        struct narrow_cast_all_handler
+            : debug_assert::set_level<TYPE_SAFE_ENABLE_PRECONDITION_CHECKS>,
+              debug_assert::default_handler
+        {
+            template <typename Target, typename Source>
+            static void handle(const debug_assert::source_location& loc, const char* expression,
+                               const batch_narrowing<Target, Source>& info) noexcept
+            {
+                char message[64];
+                std::snprintf(message, sizeof(message),
+                              "conversion would truncate value at index %lu",
+                              static_cast<unsigned long>(
+                                  first_narrowing<Target>(info.source, info.size)));
+                default_handler::handle(loc, expression, message);
+            }
+        };
+#endif
+    } // namespace detail
+
+    /// Converts an array of arithmetic values to a different type.
+    /// \effects Same as `destination[i] = narrow_cast<Target>(source[i])` for each index,
+    /// but it checks all values at once, which can be vectorized,
+    /// and then converts them in a single pass.
+    /// For integers the check only needs the minimum and maximum of the values.
+    /// \returns `source.size()`, unless the precondition check is done and fails
+    /// and the violation handler returns, as with [TYPE_SAFE_PRECONDITION_TELEMETRY](),
+    /// then it returns the index of the first value that isn't representable.
+    /// \requires `source` and `destination` must have the same size
+    /// and all values of `source` must be representable by `Target`.
+    /// A violation of the latter is reported with the index of the first value that isn't:
+    /// it is part of the message passed to the precondition handler,
+    /// or, with telemetry, which only records a fixed message, the return value.
+    /// \notes `Source` and `Target` must be built-in arithmetic types, that are either both integers
+    /// or both floating points.
+    /// \module types
+    template <typename Source, typename Target>
+    size_t narrow_cast_all(const array_ref<const Source>& source,
+                           const array_ref<Target>&       destination) noexcept
+    {
+        static_assert(std::is_arithmetic<Source>::value && std::is_arithmetic<Target>::value,
+                      "can only convert built-in arithmetic types");
+        static_assert(std::is_integral<Source>::value == std::is_integral<Target>::value,
+                      "cannot convert between integers and floating points");
+        TYPE_SAFE_PRECONDITION(source.size() == destination.size(), "mismatched array sizes");
+
+        auto size  = static_cast<std::size_t>(source.size());
+        auto first = size;
+#if TYPE_SAFE_PRECONDITION_TELEMETRY
+        if (detail::batch_is_narrowing<Target>(source.data(), size))
+        {
+            first = detail::first_narrowing<Target>(source.data(), size);
+            TYPE_SAFE_PRECONDITION_UNREACHABLE("conversion would truncate value");
+        }
+#else
+        DEBUG_ASSERT(!detail::batch_is_narrowing<Target>(source.data(), size),
+                     detail::narrow_cast_all_handler{},
+                     detail::batch_narrowing<Target, Source>{source.data(), size});
+#endif
+
+        auto dest = destination.data();
+        for (std::size_t i = 0u; i != size; ++i)
+            dest[i] = static_cast<Target>(source.data()[i]);
+        return first;
+    }
 } // namespace type_safe
 
 #endif // TYPE_SAFE_NARROW_CAST_HPP_INCLUDED
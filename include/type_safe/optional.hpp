@@ -14,6 +14,8 @@
 #include <type_safe/detail/copy_move_control.hpp>
 #include <type_safe/detail/is_nothrow_swappable.hpp>
 #include <type_safe/detail/map_invoke.hpp>
+#include <type_safe/fwd.hpp>
+#include <type_safe/relocation.hpp>
 
 namespace type_safe
 {
@@ -24,36 +26,36 @@ namespace type_safe
     namespace detail
     {
         template <class StoragePolicy>
-        struct optional_storage
+        struct non_trivial_optional_storage
         {
             StoragePolicy storage;
 
-            optional_storage() noexcept = default;
+            non_trivial_optional_storage() noexcept = default;
 
-            optional_storage(const optional_storage& other)
+            non_trivial_optional_storage(const non_trivial_optional_storage& other)
             {
                 storage.create_value(other.storage);
             }
 
-            optional_storage(optional_storage&& other) noexcept(
+            non_trivial_optional_storage(non_trivial_optional_storage&& other) noexcept(
                 std::is_nothrow_move_constructible<typename StoragePolicy::value_type>::value)
             {
                 storage.create_value(std::move(other.storage));
             }
 
-            ~optional_storage() noexcept
+            ~non_trivial_optional_storage() noexcept
             {
                 if (storage.has_value())
                     storage.destroy_value();
             }
 
-            optional_storage& operator=(const optional_storage& other)
+            non_trivial_optional_storage& operator=(const non_trivial_optional_storage& other)
             {
                 storage.copy_value(other.storage);
                 return *this;
             }
 
-            optional_storage& operator=(optional_storage&& other) noexcept(
+            non_trivial_optional_storage& operator=(non_trivial_optional_storage&& other) noexcept(
                 std::is_nothrow_move_constructible<typename StoragePolicy::value_type>::value
                 && (!std::is_move_assignable<typename StoragePolicy::value_type>::value
                     || std::is_nothrow_move_assignable<typename StoragePolicy::value_type>::value))
@@ -63,6 +65,25 @@ namespace type_safe
             }
         };
 
+        // the value and the storage policy are trivially copyable, so is the optional:
+        // copy, move and destruction are trivial and the optional can be memcpy'ied
+        template <class StoragePolicy>
+        struct trivial_optional_storage
+        {
+            StoragePolicy storage;
+        };
+
+        template <class StoragePolicy>
+        using optional_trivial = std::integral_constant<
+            bool, is_trivially_copyable<typename StoragePolicy::value_type>::value
+                      && is_trivially_copyable<StoragePolicy>::value>;
+
+        template <class StoragePolicy>
+        using optional_storage =
+            typename std::conditional<optional_trivial<StoragePolicy>::value,
+                                      trivial_optional_storage<StoragePolicy>,
+                                      non_trivial_optional_storage<StoragePolicy>>::type;
+
         template <typename T>
         using optional_copy = copy_control<std::is_copy_constructible<T>::value>;
 
@@ -87,6 +108,12 @@ namespace type_safe
     template <class StoragePolicy>
     class basic_optional;
 
+    /// \exclude
+    namespace detail
+    {
+        struct compact_optional_access;
+    } // namespace detail
+
     //=== basic_optional ===//
     /// Tag type to mark a [ts::basic_optional]() without a value.
     /// \module optional
@@ -100,7 +127,7 @@ namespace type_safe
 
     /// Tag object of type [ts::nullopt_t]().
     /// \module optional
-    constexpr nullopt_t nullopt;
+    TYPE_SAFE_INLINE_VARIABLE constexpr nullopt_t nullopt;
 
     /// Selects the storage policy used when rebinding a [ts::basic_optional]().
     ///
@@ -162,7 +189,87 @@ namespace type_safe
             conditional<std::is_void<T>::value, void,
                         basic_optional<select_optional_storage_policy<
                             typename optional_storage_policy_for<T>::type, Fallback>>>::type;
-    }
+
+        template <typename First, typename Second>
+        struct optional_chain_compose
+        {
+            First  first;
+            Second second;
+
+            template <typename Value>
+            auto operator()(Value&& value)
+                -> decltype(map_invoke(std::declval<Second&>(),
+                                       map_invoke(std::declval<First&>(),
+                                                  std::forward<Value>(value))))
+            {
+                return map_invoke(second, map_invoke(first, std::forward<Value>(value)));
+            }
+        };
+
+        // Optional is a reference to the source optional
+        template <class Optional, typename Func>
+        class optional_chain
+        {
+            using optional_type = typename std::remove_reference<Optional>::type;
+
+        public:
+            using result_type =
+                decltype(map_invoke(std::declval<Func&>(), std::declval<Optional>().value()));
+
+            optional_chain(optional_type& opt, Func f) : opt_(&opt), f_(std::move(f))
+            {
+            }
+
+            // an lvalue chain can be continued multiple times, so it copies the functions
+            template <typename NextFunc>
+            auto then(NextFunc&& f) const TYPE_SAFE_LVALUE_REF -> optional_chain<
+                Optional, optional_chain_compose<Func, typename std::decay<NextFunc>::type>>
+            {
+                using compose =
+                    optional_chain_compose<Func, typename std::decay<NextFunc>::type>;
+                return {*opt_, compose{f_, std::forward<NextFunc>(f)}};
+            }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+            template <typename NextFunc>
+            auto then(NextFunc&& f) && -> optional_chain<
+                Optional, optional_chain_compose<Func, typename std::decay<NextFunc>::type>>
+            {
+                using compose =
+                    optional_chain_compose<Func, typename std::decay<NextFunc>::type>;
+                return {*opt_, compose{std::move(f_), std::forward<NextFunc>(f)}};
+            }
+#endif
+
+            bool has_value() const noexcept
+            {
+                return opt_->has_value();
+            }
+
+            auto value() -> result_type
+            {
+                return map_invoke(f_, std::forward<Optional>(*opt_).value());
+            }
+
+            template <typename U>
+            auto value_or(U&& u) -> typename std::decay<result_type>::type
+            {
+                using type = typename std::decay<result_type>::type;
+                return has_value() ? static_cast<type>(value()) :
+                                     static_cast<type>(std::forward<U>(u));
+            }
+
+            auto result() -> typename optional_type::template rebind<result_type>
+            {
+                using type = typename optional_type::template rebind<result_type>;
+                return has_value() ? type(value()) : static_cast<type>(nullopt);
+            }
+
+        private:
+            optional_type* opt_;
+            Func           f_;
+        };
+    } // namespace detail
 
     /// An optional type, i.e. a type that may or may not be there.
     ///
@@ -186,6 +293,9 @@ namespace type_safe
     /// * `U get_value() (const)& noexcept` - returns a reference to the stored value, U is one of the `XXX_reference` typedefs
     /// * `U get_value() (const)&& noexcept` - returns a reference to the stored value, U is one of the `XXX_reference` typedefs
     /// * `U get_value_or(T&& val) [const&/&&]` - returns either `get_value()` or `val`
+    ///
+    /// If both `value_type` and the `StoragePolicy` are trivially copyable,
+    /// the optional is trivially copyable as well.
     /// \module optional
     template <class StoragePolicy>
     class basic_optional : detail::optional_storage<StoragePolicy>,
@@ -208,6 +318,8 @@ namespace type_safe
         using rebind = detail::rebind_optional<U, typename StoragePolicy::template rebind<U>>;
 
     private:
+        friend detail::compact_optional_access;
+
         storage& get_storage() TYPE_SAFE_LVALUE_REF noexcept
         {
             return static_cast<detail::optional_storage<StoragePolicy>&>(*this).storage;
@@ -421,7 +533,7 @@ namespace type_safe
         /// \group value
         auto value() TYPE_SAFE_LVALUE_REF noexcept -> decltype(std::declval<storage&>().get_value())
         {
-            DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(has_value(), "optional does not have a value");
             return get_storage().get_value();
         }
 
@@ -429,7 +541,7 @@ namespace type_safe
         auto value() const TYPE_SAFE_LVALUE_REF noexcept
             -> decltype(std::declval<const storage&>().get_value())
         {
-            DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(has_value(), "optional does not have a value");
             return get_storage().get_value();
         }
 
@@ -437,14 +549,14 @@ namespace type_safe
         /// \group value
         auto value() && noexcept -> decltype(std::declval<storage&&>().get_value())
         {
-            DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(has_value(), "optional does not have a value");
             return std::move(get_storage()).get_value();
         }
 
         /// \group value
         auto value() const && noexcept -> decltype(std::declval<const storage&&>().get_value())
         {
-            DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(has_value(), "optional does not have a value");
             return std::move(get_storage()).get_value();
         }
 #endif
@@ -549,6 +661,166 @@ namespace type_safe
                 return static_cast<rebind<return_type>>(nullopt);
         }
 #endif
+
+        /// Lazily maps an optional.
+        /// \returns An object representing the chain of functions applied to the value,
+        /// with the following member functions:
+        /// * `then(g)` - returns a new chain that also applies `g` to the result of the previous function
+        /// * `has_value()` - returns whether or not the optional has a value
+        /// * `value()` - applies all functions to the value and returns the result
+        /// * `value_or(u)` - returns `value()` if there is a value, `u` converted to the result type otherwise
+        /// * `result()` - returns the same optional as the equivalent chain of `map()` calls
+        ///
+        /// Unlike a chain of `map()` calls, it checks whether there is a value only once
+        /// and does not create an optional for the intermediate results:
+        /// they are passed directly from one function to the next.
+        /// The value is forwarded to the first function as (`const`) lvalue or rvalue,
+        /// depending on the value category of the optional.
+        /// \requires `f` and each function passed to `then()` must either be a function
+        /// or function object of matching signature, or a member function pointer of compatible signature.
+        /// \notes The chain only stores a reference to the optional,
+        /// so it must not outlive it; it is meant to be used in a single expression like
+        /// `opt.then(f).then(g).value_or(x)`.
+        /// \group then
+        /// \exclude return
+        template <typename Func>
+        auto then(Func&& f) TYPE_SAFE_LVALUE_REF
+            -> detail::optional_chain<basic_optional&, typename std::decay<Func>::type>
+        {
+            return {*this, std::forward<Func>(f)};
+        }
+
+        /// \group then
+        /// \exclude return
+        template <typename Func>
+        auto then(Func&& f) const TYPE_SAFE_LVALUE_REF
+            -> detail::optional_chain<const basic_optional&, typename std::decay<Func>::type>
+        {
+            return {*this, std::forward<Func>(f)};
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group then
+        /// \exclude return
+        template <typename Func>
+        auto then(Func&& f) && -> detail::optional_chain<basic_optional&&,
+                                                         typename std::decay<Func>::type>
+        {
+            return {*this, std::forward<Func>(f)};
+        }
+
+        /// \group then
+        /// \exclude return
+        template <typename Func>
+        auto then(Func&& f) const && -> detail::optional_chain<const basic_optional&&,
+                                                               typename std::decay<Func>::type>
+        {
+            return {*this, std::forward<Func>(f)};
+        }
+#endif
+
+        /// Maps an optional with a function returning an optional.
+        /// \effects If the optional contains a value,
+        /// calls the function with the (`const`) lvalue or rvalue value followed by the additional arguments perfectly forwarded.
+        /// \returns The result of the function if it was called,
+        /// an empty optional of the same type otherwise.
+        /// \requires `f` must either be a function or function object of matching signature,
+        /// or a member function pointer of the stored type with compatible signature,
+        /// returning a [ts::basic_optional]().
+        /// \notes Unlike `map()`, it does not create a new optional,
+        /// but returns the result of the function directly.
+        /// \group and_then
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto and_then(Func&& f, Args&&... args) TYPE_SAFE_LVALUE_REF
+            -> decltype(detail::map_invoke(std::forward<Func>(f), this->value(),
+                                           std::forward<Args>(args)...))
+        {
+            using return_type = decltype(
+                detail::map_invoke(std::forward<Func>(f), value(), std::forward<Args>(args)...));
+            static_assert(detail::is_optional<return_type>::value, "function must return an optional");
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), value(),
+                                          std::forward<Args>(args)...);
+            else
+                return static_cast<return_type>(nullopt);
+        }
+
+        /// \group and_then
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto and_then(Func&& f, Args&&... args) const TYPE_SAFE_LVALUE_REF
+            -> decltype(detail::map_invoke(std::forward<Func>(f), this->value(),
+                                           std::forward<Args>(args)...))
+        {
+            using return_type = decltype(
+                detail::map_invoke(std::forward<Func>(f), value(), std::forward<Args>(args)...));
+            static_assert(detail::is_optional<return_type>::value, "function must return an optional");
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), value(),
+                                          std::forward<Args>(args)...);
+            else
+                return static_cast<return_type>(nullopt);
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group and_then
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto and_then(Func&& f, Args&&... args) && -> decltype(
+            detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                               std::forward<Args>(args)...))
+        {
+            using return_type = decltype(detail::map_invoke(std::forward<Func>(f),
+                                                            std::move(*this).value(),
+                                                            std::forward<Args>(args)...));
+            static_assert(detail::is_optional<return_type>::value, "function must return an optional");
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                                          std::forward<Args>(args)...);
+            else
+                return static_cast<return_type>(nullopt);
+        }
+
+        /// \group and_then
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto and_then(Func&& f, Args&&... args) const && -> decltype(
+            detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                               std::forward<Args>(args)...))
+        {
+            using return_type = decltype(detail::map_invoke(std::forward<Func>(f),
+                                                            std::move(*this).value(),
+                                                            std::forward<Args>(args)...));
+            static_assert(detail::is_optional<return_type>::value, "function must return an optional");
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                                          std::forward<Args>(args)...);
+            else
+                return static_cast<return_type>(nullopt);
+        }
+#endif
+
+        /// \returns A copy (1)/the moved (2) optional if it has a value,
+        /// otherwise the result of `f()` converted to the optional.
+        /// \requires `f` must be a function or function object taking no arguments
+        /// whose result is convertible to the optional.
+        /// \group or_else
+        template <typename Func>
+        basic_optional or_else(Func&& f) const TYPE_SAFE_LVALUE_REF
+        {
+            return has_value() ? *this : static_cast<basic_optional>(std::forward<Func>(f)());
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group or_else
+        template <typename Func>
+        basic_optional or_else(Func&& f) &&
+        {
+            return has_value() ? std::move(*this) :
+                                 static_cast<basic_optional>(std::forward<Func>(f)());
+        }
+#endif
     };
 
 /// \entity TYPE_SAFE_DETAIL_MAKE_OP
@@ -950,10 +1222,19 @@ namespace type_safe
         bool      empty_;
     };
 
-    /// A [ts::basic_optional]() that uses [ts::direct_optional_storage<T>]().
-    /// \module optional
+    /// \exclude
+    template <class StoragePolicy>
+    struct is_trivially_relocatable<basic_optional<StoragePolicy>>
+    : is_trivially_relocatable<StoragePolicy>
+    {
+    };
+
+    /// \exclude
     template <typename T>
-    using optional = basic_optional<direct_optional_storage<T>>;
+    struct is_trivially_relocatable<direct_optional_storage<T>>
+    : is_trivially_relocatable<typename std::remove_cv<T>::type>
+    {
+    };
 
     /// Uses [ts::optional_storage_policy_for]() to select the appropriate [ts::basic_optional]().
     ///
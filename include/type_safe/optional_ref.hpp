@@ -159,6 +159,12 @@ namespace type_safe
         T* pointer_;
     };
 
+    /// \exclude
+    template <typename T, bool XValue>
+    struct is_trivially_relocatable<reference_optional_storage<T, XValue>> : std::true_type
+    {
+    };
+
     /// A [ts::basic_optional]() that uses [ts::reference_optional_storage]().
     /// It is an optional reference.
     /// \notes `T` is the type without the reference, i.e. `optional_ref<int>`.
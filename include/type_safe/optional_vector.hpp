@@ -0,0 +1,416 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_OPTIONAL_VECTOR_HPP_INCLUDED
+#define TYPE_SAFE_OPTIONAL_VECTOR_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/bitmap.hpp>
+#include <type_safe/index.hpp>
+#include <type_safe/optional_ref.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        template <typename T, typename U>
+        void bulk_value_or(T* result, const T* values, const bitmap_word* words,
+                           std::size_t size, const U& fallback)
+        {
+            for (std::size_t i = 0u; i != size; ++i)
+                result[i] = bitmap_test(words, i) ? values[i] : static_cast<T>(fallback);
+        }
+
+        template <typename R, typename T, typename Func>
+        void bulk_map(R* result, const T* values, const bitmap_word* words, std::size_t size,
+                      Func& f)
+        {
+            for (std::size_t i = 0u; i != size; ++i)
+                if (bitmap_test(words, i))
+                    result[i] = f(values[i]);
+        }
+    } // namespace detail
+
+    /// A container of optional values of type `T`, stored as a struct of arrays.
+    ///
+    /// Unlike a [std::vector]() of [ts::optional]() it stores the values contiguously
+    /// and whether or not an element has a value in a separate bitmap,
+    /// so each element only needs a single bit of extra storage.
+    /// Element access returns a [ts::optional_ref]() to the value.
+    /// \requires `T` must be default constructible,
+    /// as the element of an empty optional stores a default constructed object.
+    /// It must not be `bool`, as the values are stored in a [std::vector]()
+    /// and the bit-packed `std::vector<bool>` cannot return a reference or pointer to an element;
+    /// use an `unsigned char` instead.
+    /// \module optional
+    template <typename T>
+    class optional_vector
+    {
+        static_assert(std::is_default_constructible<T>::value, "T must be default constructible");
+        static_assert(!std::is_same<typename std::remove_cv<T>::type, bool>::value,
+                      "optional_vector<bool> is not supported, use unsigned char instead");
+
+    public:
+        using value_type = T;
+
+        //=== constructors ===//
+        /// \effects Creates an empty container.
+        optional_vector() = default;
+
+        /// \effects Creates a container with the given number of empty optionals.
+        explicit optional_vector(size_t size)
+        : values_(static_cast<std::size_t>(size)),
+          bits_(detail::bitmap_word_count(static_cast<std::size_t>(size)), 0u)
+        {
+        }
+
+        //=== size ===//
+        /// \returns The number of elements, i.e. the number of optionals.
+        size_t size() const noexcept
+        {
+            return values_.size();
+        }
+
+        /// \returns Whether or not the container has no elements.
+        bool empty() const noexcept
+        {
+            return values_.empty();
+        }
+
+        /// \returns The number of elements that have a value.
+        size_t count() const noexcept
+        {
+            return detail::bitmap_count(bits_.data(), bits_.size());
+        }
+
+        /// \effects Reserves memory for the given number of elements.
+        void reserve(size_t capacity)
+        {
+            values_.reserve(static_cast<std::size_t>(capacity));
+            bits_.reserve(detail::bitmap_word_count(static_cast<std::size_t>(capacity)));
+        }
+
+        /// \effects Changes the number of elements to the given size,
+        /// removing elements at the end or adding empty optionals.
+        void resize(size_t new_size)
+        {
+            auto size = static_cast<std::size_t>(new_size);
+            // clear the bits of removed elements
+            for (auto i = size; i < values_.size(); ++i)
+                detail::bitmap_reset(bits_.data(), i);
+
+            values_.resize(size);
+            bits_.resize(detail::bitmap_word_count(size), 0u);
+        }
+
+        /// \effects Removes all elements.
+        void clear() noexcept
+        {
+            values_.clear();
+            bits_.clear();
+        }
+
+        //=== modifiers ===//
+        /// \effects Adds a new element at the end
+        /// that is empty (1)/contains a value created by forwarding the arguments (2).
+        /// \group push_back
+        void push_back(nullopt_t)
+        {
+            push_back_impl(false);
+        }
+
+        /// \group push_back
+        /// \param 1
+        /// \exclude
+        template <typename... Args,
+                  typename = typename std::enable_if<std::is_constructible<T, Args&&...>::value>::type>
+        void emplace_back(Args&&... args)
+        {
+            push_back_impl(true, std::forward<Args>(args)...);
+        }
+
+        /// \effects Same as `emplace_back(value)` or `push_back(nullopt)`,
+        /// depending on whether or not the optional has a value.
+        /// \group push_back_opt
+        void push_back(const optional<T>& opt)
+        {
+            if (opt.has_value())
+                emplace_back(opt.value());
+            else
+                push_back(nullopt);
+        }
+
+        /// \group push_back_opt
+        void push_back(optional<T>&& opt)
+        {
+            if (opt.has_value())
+                emplace_back(std::move(opt).value());
+            else
+                push_back(nullopt);
+        }
+
+        /// \effects Removes the last element.
+        /// \requires The container must not be empty.
+        void pop_back() noexcept
+        {
+            TYPE_SAFE_PRECONDITION(!empty(), "container is empty");
+            resize(values_.size() - 1u);
+        }
+
+        /// \effects Sets the `i`th element to the value created by forwarding the arguments.
+        /// \returns A reference to the new value.
+        /// \requires `i < size()`.
+        /// \param 2
+        /// \exclude
+        template <typename... Args,
+                  typename = typename std::enable_if<std::is_constructible<T, Args&&...>::value>::type>
+        T& emplace(index_t i, Args&&... args)
+        {
+            auto index     = checked_index(i);
+            values_[index] = T(std::forward<Args>(args)...);
+            detail::bitmap_set(bits_.data(), index);
+            return values_[index];
+        }
+
+        /// \effects Sets the `i`th element to an empty optional.
+        /// \requires `i < size()`.
+        void reset(index_t i)
+        {
+            auto index     = checked_index(i);
+            values_[index] = T();
+            detail::bitmap_reset(bits_.data(), index);
+        }
+
+        //=== access ===//
+        /// \returns Whether or not the `i`th element has a value.
+        /// \requires `i < size()`.
+        bool has_value(index_t i) const noexcept
+        {
+            return detail::bitmap_test(bits_.data(), checked_index(i));
+        }
+
+        /// \returns A (`const`) [ts::optional_ref]() to the value of the `i`th element.
+        /// If it doesn't have a value, returns a null reference.
+        /// \requires `i < size()`.
+        /// \group index
+        optional_ref<T> operator[](index_t i) noexcept
+        {
+            auto index = checked_index(i);
+            return type_safe::opt_ref(detail::bitmap_test(bits_.data(), index) ? &values_[index]
+                                                                             : nullptr);
+        }
+
+        /// \group index
+        optional_ref<const T> operator[](index_t i) const noexcept
+        {
+            auto index = checked_index(i);
+            return type_safe::opt_ref(detail::bitmap_test(bits_.data(), index) ? &values_[index]
+                                                                             : nullptr);
+        }
+
+        /// \returns A pointer to the contiguous array of values.
+        /// Elements without a value point to a default constructed object.
+        const T* data() const noexcept
+        {
+            return values_.data();
+        }
+
+        //=== bulk operations ===//
+        /// \returns A [std::vector]() containing the value of each element
+        /// or `fallback` converted to `T` if it doesn't have a value.
+        template <typename U>
+        std::vector<T> value_or(const U& fallback) const
+        {
+            std::vector<T> result(values_.size());
+            detail::bulk_value_or(result.data(), values_.data(), bits_.data(), values_.size(),
+                                  fallback);
+            return result;
+        }
+
+        /// \returns A new container where each element with a value has the result of `f(value)`,
+        /// and the other elements are empty.
+        /// \requires The result of `f` must be default constructible.
+        template <typename Func>
+        auto map(Func&& f) const
+            -> optional_vector<typename std::decay<decltype(f(std::declval<const T&>()))>::type>
+        {
+            using result_type =
+                typename std::decay<decltype(f(std::declval<const T&>()))>::type;
+
+            optional_vector<result_type> result(values_.size());
+            detail::bulk_map(result.values_.data(), values_.data(), bits_.data(), values_.size(),
+                             f);
+            result.bits_ = bits_;
+            return result;
+        }
+
+    private:
+        std::size_t checked_index(index_t i) const noexcept
+        {
+            auto index = static_cast<std::size_t>(get(i));
+            TYPE_SAFE_PRECONDITION(index < values_.size(), "out of bounds access");
+            return index;
+        }
+
+        template <typename... Args>
+        void push_back_impl(bool has_value, Args&&... args)
+        {
+            auto index = values_.size();
+            if (detail::bitmap_word_count(index + 1u) > bits_.size())
+                bits_.push_back(0u);
+            values_.emplace_back(std::forward<Args>(args)...);
+            if (has_value)
+                detail::bitmap_set(bits_.data(), index);
+        }
+
+        std::vector<T>                   values_;
+        std::vector<detail::bitmap_word> bits_;
+
+        template <typename U>
+        friend class optional_vector;
+    };
+
+    /// A fixed-size array of `N` optional values of type `T`, stored as a struct of arrays.
+    ///
+    /// It is the fixed-size equivalent of [ts::optional_vector]().
+    /// \requires `T` must be default constructible,
+    /// as the element of an empty optional stores a default constructed object.
+    /// \module optional
+    template <typename T, std::size_t N>
+    class optional_array
+    {
+        static_assert(std::is_default_constructible<T>::value, "T must be default constructible");
+
+    public:
+        using value_type = T;
+
+        //=== constructors ===//
+        /// \effects Creates an array where all elements are empty.
+        optional_array() : values_(), bits_()
+        {
+        }
+
+        //=== size ===//
+        /// \returns The number of elements, i.e. `N`.
+        static constexpr size_t size() noexcept
+        {
+            return N;
+        }
+
+        /// \returns The number of elements that have a value.
+        size_t count() const noexcept
+        {
+            return detail::bitmap_count(bits_.data(), bits_.size());
+        }
+
+        //=== modifiers ===//
+        /// \effects Sets the `i`th element to the value created by forwarding the arguments.
+        /// \returns A reference to the new value.
+        /// \requires `i < N`.
+        /// \param 2
+        /// \exclude
+        template <typename... Args,
+                  typename = typename std::enable_if<std::is_constructible<T, Args&&...>::value>::type>
+        T& emplace(index_t i, Args&&... args)
+        {
+            auto index     = checked_index(i);
+            values_[index] = T(std::forward<Args>(args)...);
+            detail::bitmap_set(bits_.data(), index);
+            return values_[index];
+        }
+
+        /// \effects Sets the `i`th element to an empty optional.
+        /// \requires `i < N`.
+        void reset(index_t i)
+        {
+            auto index     = checked_index(i);
+            values_[index] = T();
+            detail::bitmap_reset(bits_.data(), index);
+        }
+
+        //=== access ===//
+        /// \returns Whether or not the `i`th element has a value.
+        /// \requires `i < N`.
+        bool has_value(index_t i) const noexcept
+        {
+            return detail::bitmap_test(bits_.data(), checked_index(i));
+        }
+
+        /// \returns A (`const`) [ts::optional_ref]() to the value of the `i`th element.
+        /// If it doesn't have a value, returns a null reference.
+        /// \requires `i < N`.
+        /// \group index
+        optional_ref<T> operator[](index_t i) noexcept
+        {
+            auto index = checked_index(i);
+            return type_safe::opt_ref(detail::bitmap_test(bits_.data(), index) ? &values_[index]
+                                                                             : nullptr);
+        }
+
+        /// \group index
+        optional_ref<const T> operator[](index_t i) const noexcept
+        {
+            auto index = checked_index(i);
+            return type_safe::opt_ref(detail::bitmap_test(bits_.data(), index) ? &values_[index]
+                                                                             : nullptr);
+        }
+
+        /// \returns A pointer to the contiguous array of values.
+        /// Elements without a value point to a default constructed object.
+        const T* data() const noexcept
+        {
+            return values_.data();
+        }
+
+        //=== bulk operations ===//
+        /// \returns A [std::array]() containing the value of each element
+        /// or `fallback` converted to `T` if it doesn't have a value.
+        template <typename U>
+        std::array<T, N> value_or(const U& fallback) const
+        {
+            std::array<T, N> result;
+            detail::bulk_value_or(result.data(), values_.data(), bits_.data(), N, fallback);
+            return result;
+        }
+
+        /// \returns A new array where each element with a value has the result of `f(value)`,
+        /// and the other elements are empty.
+        /// \requires The result of `f` must be default constructible.
+        template <typename Func>
+        auto map(Func&& f) const
+            -> optional_array<typename std::decay<decltype(f(std::declval<const T&>()))>::type, N>
+        {
+            using result_type =
+                typename std::decay<decltype(f(std::declval<const T&>()))>::type;
+
+            optional_array<result_type, N> result;
+            detail::bulk_map(result.values_.data(), values_.data(), bits_.data(), N, f);
+            result.bits_ = bits_;
+            return result;
+        }
+
+    private:
+        static std::size_t checked_index(index_t i) noexcept
+        {
+            auto index = static_cast<std::size_t>(get(i));
+            TYPE_SAFE_PRECONDITION(index < N, "out of bounds access");
+            return index;
+        }
+
+        std::array<T, N>                                                 values_;
+        std::array<detail::bitmap_word, detail::bitmap_word_count(N)> bits_;
+
+        template <typename U, std::size_t M>
+        friend class optional_array;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_OPTIONAL_VECTOR_HPP_INCLUDED
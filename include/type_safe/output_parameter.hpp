@@ -6,12 +6,34 @@
 #define TYPE_SAFE_OUTPUT_PARAMETER_HPP_INCLUDED
 
 #include <new>
+#include <type_traits>
+#include <utility>
 
 #include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/uncaught_exceptions.hpp>
+#include <type_safe/config.hpp>
 #include <type_safe/deferred_construction.hpp>
+#include <type_safe/reference.hpp>
 
 namespace type_safe
 {
+    /// \exclude
+    namespace detail
+    {
+        template <typename T, typename U>
+        auto assign_output(T& obj, U&& u) ->
+            typename std::enable_if<std::is_assignable<T&, decltype(std::forward<U>(u))>::value>::type
+        {
+            obj = std::forward<U>(u);
+        }
+
+        template <typename T, typename... Args>
+        void assign_output(T& obj, Args&&... args)
+        {
+            obj = T(std::forward<Args>(args)...);
+        }
+    } // namespace detail
+
     /// A tiny wrapper modelling an output parameter of a function.
     ///
     /// An output paramater is a paramter that will be used to transport output of a function to its caller,
@@ -118,7 +140,7 @@ namespace type_safe
         T& assign(Args&&... args)
         {
             if (is_normal_ptr_)
-                assign_impl(std::forward<Args>(args)...);
+                detail::assign_output(*static_cast<T*>(ptr_), std::forward<Args>(args)...);
             else
             {
                 auto defer = static_cast<deferred_construction<T>*>(ptr_);
@@ -132,19 +154,6 @@ namespace type_safe
         }
 
     private:
-        template <typename U>
-        auto assign_impl(U&& u) -> typename std::
-            enable_if<std::is_assignable<T&, decltype(std::forward<U>(u))>::value>::type
-        {
-            *static_cast<T*>(ptr_) = std::forward<U>(u);
-        }
-
-        template <typename... Args>
-        void assign_impl(Args&&... args)
-        {
-            *static_cast<T*>(ptr_) = T(std::forward<Args>(args)...);
-        }
-
         void* ptr_;
         bool  is_normal_ptr_;
     };
@@ -162,6 +171,181 @@ namespace type_safe
     {
         return output_parameter<T>(o);
     }
+
+    /// \exclude
+    namespace detail
+    {
+        template <class Container>
+        auto reserve_output(int, Container& c, std::size_t count)
+            -> decltype(c.reserve(c.size() + count), void())
+        {
+            c.reserve(c.size() + count);
+        }
+
+        template <class Container>
+        void reserve_output(short, Container&, std::size_t)
+        {
+        }
+
+        template <class Container, typename T>
+        T& append_output(void* container, T&& value)
+        {
+            auto& c = *static_cast<Container*>(container);
+            c.push_back(std::move(value));
+            return c.back();
+        }
+    } // namespace detail
+
+    /// A tiny wrapper modelling an output parameter consisting of a sequence of values.
+    ///
+    /// It is like [ts::output_parameter]() but for functions producing a range of values,
+    /// which would otherwise return a [std::vector]() by value.
+    /// It has a fixed number of *slots* that have to be written in order using `assign()`.
+    /// The slots are either the elements of a caller provided [ts::array_ref](),
+    /// which are assigned,
+    /// or new elements appended to a container, which reserves memory for all slots up front.
+    ///
+    /// \notes It checks that all slots are written when it is destroyed,
+    /// unless it is destroyed due to an exception.
+    /// This check is an internal assertion, it is enabled by `TYPE_SAFE_ENABLE_ASSERTIONS`.
+    template <typename T>
+    class output_range
+    {
+    public:
+        using parameter_type = T;
+
+        //=== constructors/destructor ===//
+        /// \effects Creates it from an array of slots.
+        /// The `i`th output will be assigned to the `i`th element of the array.
+        /// \requires The referred array must live as long as the function has not returned.
+        explicit output_range(const array_ref<T>& slots) noexcept
+        : target_(slots.data()),
+          append_(nullptr),
+          size_(static_cast<std::size_t>(slots.size())),
+          written_(0u),
+          uncaught_(detail::uncaught_exceptions())
+        {
+        }
+
+        /// \effects Creates it from a container and the number of slots.
+        /// It will reserve memory for `count` additional elements, if the container supports it,
+        /// and the output will be appended using `push_back()`.
+        /// \requires The container must have a `push_back()` and `back()` member function,
+        /// its `value_type` must be `T`,
+        /// and it must live as long as the function has not returned.
+        /// \throws Anything thrown by `reserve()`.
+        /// \param 1
+        /// \exclude
+        template <class Container,
+                  typename = typename std::enable_if<
+                      std::is_same<typename Container::value_type, T>::value>::type>
+        output_range(Container& container, size_t count)
+        : target_(&container),
+          append_(&detail::append_output<Container, T>),
+          size_(static_cast<std::size_t>(count)),
+          written_(0u),
+          uncaught_(detail::uncaught_exceptions())
+        {
+            detail::reserve_output(0, container, size_);
+        }
+
+        /// \effects Moves an output range.
+        /// This will put `other` in an invalid state, it must not be used afterwards.
+        /// \notes Like the move constructor of [ts::output_parameter](),
+        /// this constructor is only there so the `out_range()` functions can be implemented.
+        output_range(output_range&& other) noexcept
+        : target_(other.target_),
+          append_(other.append_),
+          size_(other.size_),
+          written_(other.written_),
+          uncaught_(other.uncaught_)
+        {
+            other.target_  = nullptr;
+            other.size_    = 0u;
+            other.written_ = 0u;
+        }
+
+        /// \effects Does nothing.
+        /// \requires All slots must have been written,
+        /// unless it is destroyed due to an exception.
+        ~output_range() noexcept
+        {
+            DEBUG_ASSERT(written_ == size_ || detail::uncaught_exceptions() > uncaught_,
+                         detail::assert_handler{}, "not all slots of output range written");
+        }
+
+        /// \group delete_assign
+        output_range& operator=(const output_range&) = delete;
+        /// \group delete_assign
+        output_range& operator=(output_range&&) = delete;
+
+        //=== modifiers ===//
+        /// \effects Writes the next slot:
+        /// If it is an element of an array, it behaves like [ts::output_parameter::assign]().
+        /// Otherwise it creates an object by forwarding `args` and appends that to the container.
+        /// \returns A reference to the value that was written.
+        /// \throws Anything thrown by the constructor for `T`, the chosen assignment operator,
+        /// or `push_back()`.
+        /// If anything is thrown, the slot is not considered written.
+        /// \requires `full() == false`.
+        template <typename... Args>
+        T& assign(Args&&... args)
+        {
+            TYPE_SAFE_PRECONDITION(written_ < size_, "all slots of output range already written");
+            if (append_)
+            {
+                auto& result = append_(target_, T(std::forward<Args>(args)...));
+                ++written_;
+                return result;
+            }
+            else
+            {
+                auto& result = static_cast<T*>(target_)[written_];
+                detail::assign_output(result, std::forward<Args>(args)...);
+                ++written_;
+                return result;
+            }
+        }
+
+        //=== observers ===//
+        /// \returns The total number of slots.
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// \returns The number of slots already written.
+        size_t written() const noexcept
+        {
+            return written_;
+        }
+
+        /// \returns Whether or not all slots have been written.
+        bool full() const noexcept
+        {
+            return written_ == size_;
+        }
+
+    private:
+        void* target_;
+        T& (*append_)(void*, T&&);
+        std::size_t size_, written_;
+        int         uncaught_;
+    };
+
+    /// \returns A new [ts::output_range]() using the elements of the array as slots.
+    template <typename T>
+    output_range<T> out_range(const array_ref<T>& slots) noexcept
+    {
+        return output_range<T>(slots);
+    }
+
+    /// \returns A new [ts::output_range]() appending `count` elements to the container.
+    template <class Container>
+    output_range<typename Container::value_type> out_range(Container& container, size_t count)
+    {
+        return output_range<typename Container::value_type>(container, count);
+    }
 } // namespace type_safe
 
 #endif //TYPE_SAFE_OUTPUT_PARAMETER_HPP_INCLUDED
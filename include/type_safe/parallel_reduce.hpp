@@ -0,0 +1,338 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_PARALLEL_REDUCE_HPP_INCLUDED
+#define TYPE_SAFE_PARALLEL_REDUCE_HPP_INCLUDED
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <type_safe/config.hpp>
+#include <type_safe/batch_arithmetic.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/reference.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        // the chunks don't depend on the number of threads, so neither does the result
+        constexpr std::size_t batch_reduce_chunk_size = 64u * batch_block_size;
+
+        template <typename T>
+        struct batch_chunk_result
+        {
+            T                  sum;
+            bool               error;
+            std::exception_ptr exception;
+        };
+
+        // sums without calling the policy, returns false if a partial sum overflows
+        template <typename T, class Policy>
+        bool batch_try_sum_exact(T& total, const integer<T, Policy>* values,
+                                 std::size_t size) noexcept
+        {
+            auto sum = total;
+            for (std::size_t i = 0u; i != size; ++i)
+            {
+                if (batch_addition::will_error(arithmetic_tag_for<T>{}, sum, values[i].get()))
+                    return false;
+                sum = batch_addition::apply(sum, values[i].get());
+            }
+            total = sum;
+            return true;
+        }
+
+        template <typename Tag, typename T, class Policy>
+        bool batch_try_sum_chunk(Tag tag, std::true_type, T& total,
+                                 const integer<T, Policy>* values, std::size_t size) noexcept
+        {
+            // the block check is conservative, so check again if it fails
+            return batch_try_sum_block(tag, total, values, size)
+                   || batch_try_sum_exact(total, values, size);
+        }
+
+        template <typename Tag, typename T, class Policy>
+        bool batch_try_sum_chunk(Tag, std::false_type, T& total, const integer<T, Policy>* values,
+                                 std::size_t size) noexcept
+        {
+            return batch_try_sum_exact(total, values, size);
+        }
+
+        // a chunk has a try_sum() that is called concurrently and doesn't report errors,
+        // and a sum() that is called by the calling thread and lets the policy report them
+        template <typename T, class Policy>
+        class batch_sum_chunk
+        {
+        public:
+            explicit batch_sum_chunk(const integer<T, Policy>* values) noexcept : values_(values)
+            {
+            }
+
+            bool try_sum(std::size_t begin, std::size_t end, T& total) const noexcept
+            {
+                return try_sum(typename batch_policy_tag<Policy>::type{}, begin, end, total);
+            }
+
+            T sum(T total, std::size_t begin, std::size_t end) const
+            {
+                return batch_sum(batch_scalar_tag{}, total, values_ + begin, end - begin);
+            }
+
+        private:
+            bool try_sum(batch_unchecked_tag, std::size_t begin, std::size_t end, T& total) const
+                noexcept
+            {
+                total = batch_sum(batch_unchecked_tag{}, T(0), values_ + begin, end - begin);
+                return true;
+            }
+
+            bool try_sum(batch_checked_tag, std::size_t begin, std::size_t end, T& total) const
+                noexcept
+            {
+                using has_wide =
+                    std::integral_constant<bool, !std::is_void<batch_wide_int<T>>::value>;
+
+                total = T(0);
+                for (auto i = begin; i < end; i += batch_block_size)
+                {
+                    auto block_size = end - i < batch_block_size ? end - i : batch_block_size;
+                    if (!batch_try_sum_chunk(arithmetic_tag_for<T>{}, has_wide{}, total,
+                                             values_ + i, block_size))
+                        return false;
+                }
+                return true;
+            }
+
+            const integer<T, Policy>* values_;
+        };
+
+        template <typename T, class Policy, typename U, typename Transform>
+        class batch_transform_sum_chunk
+        {
+        public:
+            batch_transform_sum_chunk(const U* values, const Transform& f) noexcept
+            : values_(values), f_(&f)
+            {
+            }
+
+            bool try_sum(std::size_t begin, std::size_t end, T& total) const
+            {
+                return try_sum(typename batch_policy_tag<Policy>::type{}, begin, end, total);
+            }
+
+            T sum(T total, std::size_t begin, std::size_t end) const
+            {
+                for (auto i = begin; i != end; ++i)
+                    total = Policy::template do_addition(total, transform(i));
+                return total;
+            }
+
+        private:
+            T transform(std::size_t i) const
+            {
+                return static_cast<T>(integer<T, Policy>((*f_)(values_[i])));
+            }
+
+            bool try_sum(batch_unchecked_tag, std::size_t begin, std::size_t end, T& total) const
+            {
+                total = T(0);
+                for (auto i = begin; i != end; ++i)
+                    total = batch_addition::apply(total, transform(i));
+                return true;
+            }
+
+            bool try_sum(batch_checked_tag, std::size_t begin, std::size_t end, T& total) const
+            {
+                total = T(0);
+                for (auto i = begin; i != end; ++i)
+                {
+                    auto value = transform(i);
+                    if (batch_addition::will_error(arithmetic_tag_for<T>{}, total, value))
+                        return false;
+                    total = batch_addition::apply(total, value);
+                }
+                return true;
+            }
+
+            const U*         values_;
+            const Transform* f_;
+        };
+
+        constexpr std::size_t batch_chunk_end(std::size_t i, std::size_t size) noexcept
+        {
+            return size - i * batch_reduce_chunk_size < batch_reduce_chunk_size ?
+                       size :
+                       (i + 1u) * batch_reduce_chunk_size;
+        }
+
+        template <typename T, class Chunk>
+        void batch_reduce_chunks(batch_chunk_result<T>* results, std::size_t chunk_count,
+                                 std::size_t size, std::atomic<std::size_t>& next,
+                                 const Chunk& chunk) noexcept
+        {
+            while (true)
+            {
+                auto i = next.fetch_add(1u, std::memory_order_relaxed);
+                if (i >= chunk_count)
+                    break;
+
+                TYPE_SAFE_TRY
+                {
+                    results[i].error = !chunk.try_sum(i * batch_reduce_chunk_size,
+                                                      batch_chunk_end(i, size), results[i].sum);
+                }
+                TYPE_SAFE_CATCH_ALL
+                {
+                    results[i].exception = std::current_exception();
+                }
+            }
+        }
+
+        template <class Policy, typename T, class Chunk>
+        T batch_parallel_reduce(T init, std::size_t size, unsigned thread_count,
+                                const Chunk& chunk)
+        {
+            auto chunk_count = (size + batch_reduce_chunk_size - 1u) / batch_reduce_chunk_size;
+            std::vector<batch_chunk_result<T>> results(chunk_count);
+            std::atomic<std::size_t>           next(0u);
+
+            if (thread_count == 0u)
+                thread_count = std::thread::hardware_concurrency();
+            auto worker_count =
+                thread_count < chunk_count ? std::size_t(thread_count) : chunk_count;
+
+            // the calling thread is a worker as well
+            std::vector<std::thread> workers;
+            TYPE_SAFE_TRY
+            {
+                for (std::size_t i = 1u; i < worker_count; ++i)
+                    workers.emplace_back([&] {
+                        batch_reduce_chunks(results.data(), chunk_count, size, next, chunk);
+                    });
+            }
+            TYPE_SAFE_CATCH_ALL
+            {
+                // continue with the threads that could be created
+            }
+            batch_reduce_chunks(results.data(), chunk_count, size, next, chunk);
+            for (auto& worker : workers)
+                worker.join();
+
+            // merge in order, so the reported error doesn't depend on the scheduling
+            auto total = init;
+            for (std::size_t i = 0u; i != chunk_count; ++i)
+            {
+                if (results[i].exception)
+                    std::rethrow_exception(results[i].exception);
+                else if (results[i].error)
+                {
+                    // let the policy report the first error of the chunk
+                    results[i].sum =
+                        chunk.sum(T(0), i * batch_reduce_chunk_size, batch_chunk_end(i, size));
+                }
+                total = Policy::template do_addition(total, results[i].sum);
+            }
+            return total;
+        }
+
+        // any other policy might not be associative, so it is done serially
+        template <typename T, class Policy>
+        T checked_reduce(batch_scalar_tag, T init, const integer<T, Policy>* values,
+                         std::size_t size, unsigned)
+        {
+            return batch_sum(batch_scalar_tag{}, init, values, size);
+        }
+
+        template <class Tag, typename T, class Policy>
+        T checked_reduce(Tag, T init, const integer<T, Policy>* values, std::size_t size,
+                         unsigned thread_count)
+        {
+            return batch_parallel_reduce<Policy>(init, size, thread_count,
+                                                 batch_sum_chunk<T, Policy>(values));
+        }
+
+        template <class Policy, typename T, typename U, typename Transform>
+        T checked_transform_reduce(batch_scalar_tag, T init, const U* values, std::size_t size,
+                                   const Transform& f, unsigned)
+        {
+            using chunk = batch_transform_sum_chunk<T, Policy, U, Transform>;
+            return chunk(values, f).sum(init, 0u, size);
+        }
+
+        template <class Policy, class Tag, typename T, typename U, typename Transform>
+        T checked_transform_reduce(Tag, T init, const U* values, std::size_t size,
+                                   const Transform& f, unsigned thread_count)
+        {
+            using chunk = batch_transform_sum_chunk<T, Policy, U, Transform>;
+            return batch_parallel_reduce<Policy>(init, size, thread_count, chunk(values, f));
+        }
+    } // namespace detail
+
+    /// \returns The sum of `init` and all elements of the array,
+    /// computed in parallel by `thread_count` threads,
+    /// or as many threads as the hardware supports if it is `0`.
+    ///
+    /// The array is split into chunks of a fixed size, which are summed by the threads,
+    /// and the sums of the chunks are added to `init` from left to right by the calling thread.
+    /// As the chunks don't depend on the number of threads,
+    /// the result and any error are deterministic.
+    /// For [ts::checked_arithmetic]() and [ts::undefined_behavior_arithmetic]()
+    /// the threads only detect an overflow of a partial sum of a chunk, like [ts::batch_sum](),
+    /// which is then reported by the policy in the calling thread,
+    /// so there are no data races and the first chunk with an error is reported.
+    /// [ts::default_arithmetic]() does no checks at all,
+    /// any other policy might not be associative, so the sum is computed serially instead.
+    /// \notes As the elements are added in a different order,
+    /// it can report an error even if the equivalent loop doesn't and vice versa.
+    /// \group checked_reduce
+    /// \module types
+    template <typename T, class Policy>
+    integer<T, Policy> checked_reduce(const array_ref<const integer<T, Policy>>& values,
+                                      const integer<T, Policy>& init         = T(0),
+                                      unsigned                  thread_count = 0u)
+    {
+        return integer<T, Policy>(
+            detail::checked_reduce(typename detail::batch_policy_tag<Policy>::type{}, init.get(),
+                                   values.data(), static_cast<std::size_t>(values.size()),
+                                   thread_count));
+    }
+
+    /// \group checked_reduce
+    template <typename T, class Policy>
+    integer<T, Policy> checked_reduce(const array_ref<integer<T, Policy>>& values,
+                                      const integer<T, Policy>&            init         = T(0),
+                                      unsigned                             thread_count = 0u)
+    {
+        return checked_reduce(detail::make_const_array_ref(values), init, thread_count);
+    }
+
+    /// \returns The sum of `init` and `f(value)` converted to [ts::integer]() for each element,
+    /// computed in parallel like [ts::checked_reduce]().
+    /// If `f` throws an exception in one of the threads,
+    /// it is rethrown in the calling thread,
+    /// unless a chunk before that has an error.
+    /// \requires `f` must be safe to call concurrently on different elements
+    /// and it must not have side effects, as it can be called multiple times for an element.
+    /// \module types
+    template <typename U, typename T, class Policy, typename Transform>
+    integer<T, Policy> checked_transform_reduce(const array_ref<U>&       values,
+                                                const integer<T, Policy>& init, Transform f,
+                                                unsigned thread_count = 0u)
+    {
+        using tag = typename detail::batch_policy_tag<Policy>::type;
+        return integer<T, Policy>(
+            detail::checked_transform_reduce<Policy>(tag{}, init.get(),
+                                                     static_cast<const U*>(values.data()),
+                                                     static_cast<std::size_t>(values.size()), f,
+                                                     thread_count));
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_PARALLEL_REDUCE_HPP_INCLUDED
@@ -0,0 +1,193 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_PARSE_HPP_INCLUDED
+#define TYPE_SAFE_PARSE_HPP_INCLUDED
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <type_safe/config.hpp>
+
+#if TYPE_SAFE_USE_FROM_CHARS
+#include <charconv>
+#include <system_error>
+#endif
+
+#include <type_safe/constrained_type.hpp>
+#include <type_safe/floating_point.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/optional.hpp>
+#include <type_safe/strong_typedef.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        template <typename T, typename = void>
+        struct parser;
+
+        template <typename T>
+        using enable_parse_integer = typename std::enable_if<
+            std::is_integral<T>::value && !std::is_same<T, bool>::value>::type;
+
+#if TYPE_SAFE_USE_FROM_CHARS
+        template <typename T>
+        struct parser<T, enable_parse_integer<T>>
+        {
+            static optional<T> parse(const char* first, const char* last) noexcept
+            {
+                T    value{};
+                auto result = std::from_chars(first, last, value);
+                if (result.ec != std::errc() || result.ptr != last)
+                    return nullopt;
+                return value;
+            }
+        };
+#else
+        // same syntax as std::from_chars(): an optional minus sign followed by decimal digits
+        template <typename T>
+        struct parser<T, enable_parse_integer<T>>
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+
+            static optional<T> parse(const char* first, const char* last) noexcept
+            {
+                auto negative = std::is_signed<T>::value && first != last && *first == '-';
+                if (negative)
+                    ++first;
+                if (first == last)
+                    return nullopt;
+
+                // the magnitude of the minimum is one greater than the maximum
+                auto max   = static_cast<unsigned_type>(std::numeric_limits<T>::max());
+                auto limit = negative ? static_cast<unsigned_type>(max + 1u) : max;
+
+                unsigned_type value = 0u;
+                for (; first != last; ++first)
+                {
+                    auto digit = static_cast<unsigned>(*first - '0');
+                    if (digit > 9u || value > (limit - digit) / 10u)
+                        return nullopt;
+                    value = static_cast<unsigned_type>(value * 10u + digit);
+                }
+
+                if (!negative)
+                    return static_cast<T>(value);
+                else if (value == 0u)
+                    return T(0);
+                else
+                    // negate without overflowing for the minimum
+                    return static_cast<T>(-static_cast<T>(value - 1u) - 1);
+            }
+        };
+#endif
+
+#if TYPE_SAFE_USE_FROM_CHARS && defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        template <typename T>
+        struct parser<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+        {
+            static optional<T> parse(const char* first, const char* last) noexcept
+            {
+                T    value{};
+                auto result = std::from_chars(first, last, value);
+                if (result.ec != std::errc() || result.ptr != last)
+                    return nullopt;
+                return value;
+            }
+        };
+#endif
+
+        template <typename IntegerT, class Policy>
+        struct parser<integer<IntegerT, Policy>>
+        {
+            static optional<integer<IntegerT, Policy>> parse(const char* first, const char* last)
+            {
+                auto value = parser<IntegerT>::parse(first, last);
+                if (!value)
+                    return nullopt;
+                return integer<IntegerT, Policy>(value.value());
+            }
+        };
+
+        template <typename FloatT>
+        struct parser<floating_point<FloatT>>
+        {
+            static optional<floating_point<FloatT>> parse(const char* first, const char* last)
+            {
+                auto value = parser<FloatT>::parse(first, last);
+                if (!value)
+                    return nullopt;
+                return floating_point<FloatT>(value.value());
+            }
+        };
+
+        template <typename StrongTypedef>
+        struct parser<StrongTypedef,
+                      decltype(void(detail::underlying_type(std::declval<StrongTypedef>())))>
+        {
+            using underlying = type_safe::underlying_type<StrongTypedef>;
+
+            static optional<StrongTypedef> parse(const char* first, const char* last)
+            {
+                auto value = parser<underlying>::parse(first, last);
+                if (!value)
+                    return nullopt;
+                return StrongTypedef(std::move(value).value());
+            }
+        };
+
+        template <typename T, typename Constraint, class Verifier>
+        struct parser<constrained_type<T, Constraint, Verifier>>
+        {
+            using type = constrained_type<T, Constraint, Verifier>;
+
+            static optional<type> parse(const char* first, const char* last,
+                                        Constraint predicate = {})
+            {
+                auto value = parser<typename type::value_type>::parse(first, last);
+                // check here, so the verifier doesn't fail or throw
+                if (!value || !predicate(value.value()))
+                    return nullopt;
+                return type(std::move(value).value(), std::move(predicate));
+            }
+        };
+    } // namespace detail
+
+    /// \returns The value of type `T` represented by the characters in `[first, last)`,
+    /// or [ts::nullopt]() if they don't represent one of its values.
+    /// All characters need to be part of the value, i.e. there must not be any whitespace,
+    /// and integers are decimal with an optional minus sign, like with `std::from_chars()`.
+    /// An integer that doesn't fit into `T` is invalid.
+    /// If `T` is a [ts::constrained_type](), e.g. a [ts::bounded_type](),
+    /// the value must also fulfill the constraint,
+    /// which is checked before it is constructed, so the `Verifier` never fails.
+    /// \notes It does not allocate memory, throw exceptions or depend on the locale.
+    /// It uses `std::from_chars()` if it is available,
+    /// floating points are only supported then.
+    /// \requires `T` must be an integer or floating point type,
+    /// or a [ts::integer](), [ts::floating_point](), [ts::strong_typedef]() or [ts::constrained_type]()
+    /// of those types.
+    /// \module types
+    template <typename T>
+    optional<T> parse(const char* first, const char* last)
+    {
+        return detail::parser<T>::parse(first, last);
+    }
+
+    /// \returns The same as the other overload,
+    /// but the [ts::constrained_type]() uses the given `predicate` instead of a default constructed one,
+    /// e.g. for a [ts::bounded_type]() with bounds that are only known at runtime.
+    /// \module types
+    template <typename T>
+    optional<T> parse(const char* first, const char* last,
+                      typename T::constraint_predicate predicate)
+    {
+        return detail::parser<T>::parse(first, last, std::move(predicate));
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_PARSE_HPP_INCLUDED
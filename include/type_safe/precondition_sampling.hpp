@@ -0,0 +1,69 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_PRECONDITION_SAMPLING_HPP_INCLUDED
+#define TYPE_SAFE_PRECONDITION_SAMPLING_HPP_INCLUDED
+
+#include <atomic>
+#include <cstdint>
+
+#include <type_safe/config.hpp>
+
+#ifndef TYPE_SAFE_PRECONDITION_SAMPLE_RATE
+/// The initial value of [ts::precondition_sample_rate]().
+///
+/// It is `100` by default.
+#define TYPE_SAFE_PRECONDITION_SAMPLE_RATE 100
+#endif
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        inline std::atomic<std::uint_least32_t>& get_precondition_sample_rate() noexcept
+        {
+            static std::atomic<std::uint_least32_t> rate(TYPE_SAFE_PRECONDITION_SAMPLE_RATE);
+            return rate;
+        }
+
+        inline bool precondition_sampled() noexcept
+        {
+            // per thread, so the hot path is a decrement without any synchronization
+            static thread_local std::uint_least32_t countdown = 0u;
+            if (countdown != 0u)
+            {
+                --countdown;
+                return false;
+            }
+
+            auto rate = get_precondition_sample_rate().load(std::memory_order_relaxed);
+            if (rate == 0u)
+                return false;
+            countdown = rate - 1u;
+            return true;
+        }
+    } // namespace detail
+
+    /// \returns The current sample rate N of the sampled precondition checks,
+    /// i.e. they run for one in N invocations on each thread.
+    /// \notes It only has an effect if [TYPE_SAFE_PRECONDITION_SAMPLING]() is enabled.
+    /// \module types
+    inline std::uint_least32_t precondition_sample_rate() noexcept
+    {
+        return detail::get_precondition_sample_rate().load(std::memory_order_relaxed);
+    }
+
+    /// \effects Sets the sample rate N of the sampled precondition checks,
+    /// a rate of `1` checks every invocation, a rate of `0` none.
+    /// \notes A thread picks up the new rate after its next sampled check,
+    /// i.e. after at most the previous rate number of invocations.
+    /// \module types
+    inline void set_precondition_sample_rate(std::uint_least32_t rate) noexcept
+    {
+        detail::get_precondition_sample_rate().store(rate, std::memory_order_relaxed);
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_PRECONDITION_SAMPLING_HPP_INCLUDED
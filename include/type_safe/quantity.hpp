@@ -0,0 +1,298 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_QUANTITY_HPP_INCLUDED
+#define TYPE_SAFE_QUANTITY_HPP_INCLUDED
+
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+#include <type_safe/floating_point.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/strong_typedef.hpp>
+
+namespace type_safe
+{
+    /// The physical dimension of a [ts::quantity]().
+    ///
+    /// Each exponent is the power of one base dimension,
+    /// e.g. a velocity has exponent `1` for length and `-1` for time.
+    /// The dimensions in the `dimensions` namespace use the seven SI base dimensions
+    /// in the order length, mass, time, electric current, temperature, amount of substance
+    /// and luminous intensity,
+    /// but any number of base dimensions can be used,
+    /// as long as they are not mixed.
+    template <int... Exponents>
+    struct dimension
+    {
+    };
+
+    /// \exclude
+    namespace detail
+    {
+        template <class A, class B>
+        struct dimension_product;
+
+        template <int... A, int... B>
+        struct dimension_product<dimension<A...>, dimension<B...>>
+        {
+            static_assert(sizeof...(A) == sizeof...(B), "mismatched number of base dimensions");
+            using type = dimension<(A + B)...>;
+        };
+
+        template <class A, class B>
+        struct dimension_quotient;
+
+        template <int... A, int... B>
+        struct dimension_quotient<dimension<A...>, dimension<B...>>
+        {
+            static_assert(sizeof...(A) == sizeof...(B), "mismatched number of base dimensions");
+            using type = dimension<(A - B)...>;
+        };
+
+        template <class Dim>
+        struct dimension_inverse;
+
+        template <int... Exponents>
+        struct dimension_inverse<dimension<Exponents...>>
+        {
+            using type = dimension<(-Exponents)...>;
+        };
+    } // namespace detail
+
+    /// The dimension of the product of quantities with dimension `A` and `B`.
+    template <class A, class B>
+    using dimension_multiply = typename detail::dimension_product<A, B>::type;
+
+    /// The dimension of the quotient of quantities with dimension `A` and `B`.
+    template <class A, class B>
+    using dimension_divide = typename detail::dimension_quotient<A, B>::type;
+
+    /// The SI base dimensions and some common derived dimensions.
+    namespace dimensions
+    {
+        using dimensionless = dimension<0, 0, 0, 0, 0, 0, 0>;
+
+        using length      = dimension<1, 0, 0, 0, 0, 0, 0>;
+        using mass        = dimension<0, 1, 0, 0, 0, 0, 0>;
+        using time        = dimension<0, 0, 1, 0, 0, 0, 0>;
+        using current     = dimension<0, 0, 0, 1, 0, 0, 0>;
+        using temperature = dimension<0, 0, 0, 0, 1, 0, 0>;
+        using amount      = dimension<0, 0, 0, 0, 0, 1, 0>;
+        using luminosity  = dimension<0, 0, 0, 0, 0, 0, 1>;
+
+        using area         = dimension_multiply<length, length>;
+        using volume       = dimension_multiply<area, length>;
+        using frequency    = dimension_divide<dimensionless, time>;
+        using velocity     = dimension_divide<length, time>;
+        using acceleration = dimension_divide<velocity, time>;
+        using force        = dimension_multiply<mass, acceleration>;
+        using energy       = dimension_multiply<force, length>;
+        using power        = dimension_divide<energy, time>;
+    } // namespace dimensions
+
+    template <class Dim, typename Rep, class Scale>
+    class quantity;
+
+    /// \exclude
+    namespace detail
+    {
+        template <class T>
+        struct is_quantity : std::false_type
+        {
+        };
+
+        template <class Dim, typename Rep, class Scale>
+        struct is_quantity<quantity<Dim, Rep, Scale>> : std::true_type
+        {
+        };
+
+        // floating point: a single multiplication with a constant factor
+        template <typename To, class Ratio, typename From>
+        constexpr To scale_quantity(std::true_type, const From& value)
+        {
+            using common = typename std::common_type<To, From>::type;
+            return static_cast<To>(static_cast<common>(value)
+                                   * (static_cast<common>(Ratio::num)
+                                      / static_cast<common>(Ratio::den)));
+        }
+
+        // integer: multiply and divide, one of them is usually by one and optimized away
+        template <typename To, class Ratio, typename From>
+        constexpr To scale_quantity(std::false_type, const From& value)
+        {
+            using common = typename std::common_type<To, From, std::intmax_t>::type;
+            return static_cast<To>(static_cast<common>(value) * static_cast<common>(Ratio::num)
+                                   / static_cast<common>(Ratio::den));
+        }
+
+        template <typename To, class Ratio, typename From>
+        constexpr To scale_quantity(const From& value)
+        {
+            return scale_quantity<To, Ratio>(
+                std::is_floating_point<typename std::common_type<To, From>::type>{}, value);
+        }
+
+        // representation doesn't narrow, integers can become floating points like in std::chrono
+        template <typename ToRep, typename FromRep>
+        struct is_non_narrowing_rep
+            : std::integral_constant<bool,
+                                     std::is_same<ToRep, FromRep>::value
+                                         || is_safe_integer_conversion<FromRep, ToRep>::value
+                                         || is_safe_floating_point_conversion<FromRep, ToRep>::value
+                                         || (std::is_integral<FromRep>::value
+                                             && std::is_floating_point<ToRep>::value)>
+        {
+        };
+
+        // conversion doesn't truncate
+        template <typename ToRep, class ToScale, typename FromRep, class FromScale>
+        struct is_exact_quantity_conversion
+            : std::integral_constant<bool,
+                                     is_non_narrowing_rep<ToRep, FromRep>::value
+                                         && (std::is_floating_point<ToRep>::value
+                                             || (std::ratio_divide<FromScale, ToScale>::den == 1
+                                                 && !std::is_floating_point<FromRep>::value))>
+        {
+        };
+    } // namespace detail
+
+    /// A physical quantity with a dimension checked at compile-time.
+    ///
+    /// It is a [ts::strong_typedef]() of `Rep` where the value is measured in units of `Scale`,
+    /// a [std::ratio]() relative to the base unit of the dimension.
+    /// Quantities of the same type can be compared, added and subtracted,
+    /// and they can be multiplied by and divided by a `Rep`.
+    /// Multiplying or dividing two quantities creates a quantity of a new dimension,
+    /// which is computed at compile-time.
+    /// The resulting value is just the product/quotient of the values,
+    /// so it has no overhead compared to using `Rep` directly.
+    ///
+    /// A quantity is implicitly convertible to one of the same dimension with a different `Rep` or `Scale`,
+    /// as long as that is exact, i.e. the target is floating point
+    /// or the target unit divides the source unit,
+    /// and the `Rep` isn't narrowed, e.g. from `double` to `float` or from `std::int64_t` to `std::int8_t`,
+    /// otherwise use [ts::quantity_cast]().
+    /// The conversion factor is a compile-time constant.
+    ///
+    /// Example:
+    /// ```cpp
+    /// using meters     = ts::quantity<ts::dimensions::length>;
+    /// using kilometers = ts::quantity<ts::dimensions::length, double, std::kilo>;
+    /// using seconds    = ts::quantity<ts::dimensions::time>;
+    ///
+    /// auto v = meters(kilometers(1.5)) / seconds(10.); // quantity<velocity>
+    /// ```
+    /// \requires `Dim` must be a [ts::dimension](), `Rep` an arithmetic type,
+    /// `Scale` a [std::ratio]().
+    template <class Dim, typename Rep = double, class Scale = std::ratio<1>>
+    class quantity : public strong_typedef<quantity<Dim, Rep, Scale>, Rep>,
+                     public strong_typedef_op::equality_comparison<quantity<Dim, Rep, Scale>>,
+                     public strong_typedef_op::relational_comparison<quantity<Dim, Rep, Scale>>,
+                     public strong_typedef_op::unary_plus<quantity<Dim, Rep, Scale>>,
+                     public strong_typedef_op::unary_minus<quantity<Dim, Rep, Scale>>,
+                     public strong_typedef_op::addition<quantity<Dim, Rep, Scale>>,
+                     public strong_typedef_op::subtraction<quantity<Dim, Rep, Scale>>,
+                     public strong_typedef_op::mixed_multiplication<quantity<Dim, Rep, Scale>, Rep>
+    {
+        static_assert(std::is_arithmetic<Rep>::value, "representation must be arithmetic");
+
+    public:
+        using dimension = Dim;
+        using rep       = Rep;
+        using scale     = Scale;
+
+        /// \effects Initializes it to zero.
+        constexpr quantity() noexcept : strong_typedef<quantity, Rep>()
+        {
+        }
+
+        /// \effects Initializes it with the given value measured in units of `Scale`.
+        explicit constexpr quantity(const Rep& value) noexcept
+        : strong_typedef<quantity, Rep>(value)
+        {
+        }
+
+        /// \effects Initializes it with the value of `other` converted to units of `Scale`.
+        /// \notes This constructor only participates in overload resolution,
+        /// if the conversion is exact.
+        /// \param 2
+        /// \exclude
+        template <typename Rep2, class Scale2,
+                  typename = typename std::enable_if<
+                      detail::is_exact_quantity_conversion<Rep, Scale, Rep2, Scale2>::value>::type>
+        constexpr quantity(const quantity<Dim, Rep2, Scale2>& other) noexcept
+        : strong_typedef<quantity, Rep>(
+              detail::scale_quantity<Rep, std::ratio_divide<Scale2, Scale>>(get(other)))
+        {
+        }
+
+        /// \effects Divides the value by `factor`.
+        quantity& operator/=(const Rep& factor) noexcept
+        {
+            get(*this) /= factor;
+            return *this;
+        }
+    };
+
+    /// \returns The quantity `q` converted to the quantity `To`
+    /// by scaling the value with the ratio of the units and converting it to `To::rep`.
+    /// \requires `To` must be a [ts::quantity]() with the same dimension.
+    /// \notes Unlike the converting constructor of [ts::quantity]() this allows truncation.
+    template <class To, class Dim, typename Rep, class Scale>
+    constexpr To quantity_cast(const quantity<Dim, Rep, Scale>& q) noexcept
+    {
+        static_assert(detail::is_quantity<To>::value, "can only cast to a quantity");
+        static_assert(std::is_same<typename To::dimension, Dim>::value,
+                      "cannot convert between different dimensions");
+        return To(detail::scale_quantity<typename To::rep,
+                                         std::ratio_divide<Scale, typename To::scale>>(get(q)));
+    }
+
+    /// \returns The quantity whose value is the product of the values,
+    /// with product of the dimensions and the units.
+    template <class DimA, class ScaleA, class DimB, class ScaleB, typename Rep>
+    constexpr quantity<dimension_multiply<DimA, DimB>, Rep, std::ratio_multiply<ScaleA, ScaleB>>
+        operator*(const quantity<DimA, Rep, ScaleA>& a,
+                  const quantity<DimB, Rep, ScaleB>& b) noexcept
+    {
+        return quantity<dimension_multiply<DimA, DimB>, Rep, std::ratio_multiply<ScaleA, ScaleB>>(
+            get(a) * get(b));
+    }
+
+    /// \returns The quantity whose value is the quotient of the values,
+    /// with the quotient of the dimensions and the units.
+    template <class DimA, class ScaleA, class DimB, class ScaleB, typename Rep>
+    constexpr quantity<dimension_divide<DimA, DimB>, Rep, std::ratio_divide<ScaleA, ScaleB>>
+        operator/(const quantity<DimA, Rep, ScaleA>& a,
+                  const quantity<DimB, Rep, ScaleB>& b) noexcept
+    {
+        return quantity<dimension_divide<DimA, DimB>, Rep, std::ratio_divide<ScaleA, ScaleB>>(
+            get(a) / get(b));
+    }
+
+    /// \returns The quantity `q` with its value divided by `factor`.
+    template <class Dim, typename Rep, class Scale>
+    constexpr quantity<Dim, Rep, Scale> operator/(
+        const quantity<Dim, Rep, Scale>&               q,
+        const typename quantity<Dim, Rep, Scale>::rep& factor) noexcept
+    {
+        return quantity<Dim, Rep, Scale>(get(q) / factor);
+    }
+
+    /// \returns The quantity with the inverse dimension and unit
+    /// whose value is `value` divided by the value of `q`.
+    template <class Dim, typename Rep, class Scale>
+    constexpr quantity<typename detail::dimension_inverse<Dim>::type, Rep,
+                       std::ratio_divide<std::ratio<1>, Scale>>
+        operator/(const typename quantity<Dim, Rep, Scale>::rep& value,
+                  const quantity<Dim, Rep, Scale>&               q) noexcept
+    {
+        return quantity<typename detail::dimension_inverse<Dim>::type, Rep,
+                        std::ratio_divide<std::ratio<1>, Scale>>(value / get(q));
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_QUANTITY_HPP_INCLUDED
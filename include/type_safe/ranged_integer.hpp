@@ -0,0 +1,596 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_RANGED_INTEGER_HPP_INCLUDED
+#define TYPE_SAFE_RANGED_INTEGER_HPP_INCLUDED
+
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/force_inline.hpp>
+#include <type_safe/bounded_type.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/narrow_cast.hpp>
+
+namespace type_safe
+{
+    template <long long Min, long long Max>
+    class ranged_integer;
+
+    /// \exclude
+    namespace detail
+    {
+        // smallest integer type that can store all values in [Min, Max]
+        template <long long Min, long long Max>
+        using ranged_integer_storage = typename std::conditional<
+            (Min >= 0),
+            typename std::conditional<
+                (Max <= UINT_LEAST8_MAX), std::uint_least8_t,
+                typename std::conditional<
+                    (Max <= UINT_LEAST16_MAX), std::uint_least16_t,
+                    typename std::conditional<(Max <= UINT_LEAST32_MAX), std::uint_least32_t,
+                                              std::uint_least64_t>::type>::type>::type,
+            typename std::conditional<
+                (Min >= INT_LEAST8_MIN && Max <= INT_LEAST8_MAX), std::int_least8_t,
+                typename std::conditional<
+                    (Min >= INT_LEAST16_MIN && Max <= INT_LEAST16_MAX), std::int_least16_t,
+                    typename std::conditional<(Min >= INT_LEAST32_MIN && Max <= INT_LEAST32_MAX),
+                                              std::int_least32_t,
+                                              std::int_least64_t>::type>::type>::type>::type;
+
+        //=== bounds of the result ===//
+        constexpr bool ranged_addition_overflows(long long a, long long b) noexcept
+        {
+            return b > 0 ? a > LLONG_MAX - b : a < LLONG_MIN - b;
+        }
+
+        constexpr bool ranged_subtraction_overflows(long long a, long long b) noexcept
+        {
+            return b < 0 ? a > LLONG_MAX + b : a < LLONG_MIN + b;
+        }
+
+        constexpr bool ranged_multiplication_overflows(long long a, long long b) noexcept
+        {
+            return a > 0 ? (b > 0 ? a > LLONG_MAX / b : b < LLONG_MIN / a) :
+                           (b > 0 ? a < LLONG_MIN / b : a != 0 && b < LLONG_MAX / a);
+        }
+
+        constexpr long long ranged_min(long long a, long long b) noexcept
+        {
+            return a < b ? a : b;
+        }
+
+        constexpr long long ranged_max(long long a, long long b) noexcept
+        {
+            return a < b ? b : a;
+        }
+
+        template <long long AMin, long long AMax, long long BMin, long long BMax>
+        struct ranged_addition
+        {
+            static_assert(!ranged_addition_overflows(AMin, BMin)
+                              && !ranged_addition_overflows(AMax, BMax),
+                          "bounds of the sum don't fit in a long long");
+
+            using type = ranged_integer<AMin + BMin, AMax + BMax>;
+        };
+
+        template <long long AMin, long long AMax, long long BMin, long long BMax>
+        struct ranged_subtraction
+        {
+            static_assert(!ranged_subtraction_overflows(AMin, BMax)
+                              && !ranged_subtraction_overflows(AMax, BMin),
+                          "bounds of the difference don't fit in a long long");
+
+            using type = ranged_integer<AMin - BMax, AMax - BMin>;
+        };
+
+        template <long long AMin, long long AMax, long long BMin, long long BMax>
+        struct ranged_multiplication
+        {
+            static_assert(!ranged_multiplication_overflows(AMin, BMin)
+                              && !ranged_multiplication_overflows(AMin, BMax)
+                              && !ranged_multiplication_overflows(AMax, BMin)
+                              && !ranged_multiplication_overflows(AMax, BMax),
+                          "bounds of the product don't fit in a long long");
+
+            // the extremes of the product are the products of the bounds
+            using type =
+                ranged_integer<ranged_min(ranged_min(AMin * BMin, AMin * BMax),
+                                          ranged_min(AMax * BMin, AMax * BMax)),
+                               ranged_max(ranged_max(AMin * BMin, AMin * BMax),
+                                          ranged_max(AMax * BMin, AMax * BMax))>;
+        };
+
+        template <long long Min, long long Max>
+        struct ranged_negation
+        {
+            static_assert(Min != LLONG_MIN, "negated bound doesn't fit in a long long");
+
+            using type = ranged_integer<-Max, (Min == LLONG_MIN ? LLONG_MAX : -Min)>;
+        };
+
+        //=== range checks ===//
+        // the bounds of T clamped to long long, the values of a range always fit
+        template <typename T>
+        constexpr long long ranged_lowest() noexcept
+        {
+            return std::is_signed<T>::value ?
+                       static_cast<long long>(std::numeric_limits<T>::min()) :
+                       0;
+        }
+
+        template <typename T>
+        constexpr long long ranged_highest() noexcept
+        {
+            return static_cast<unsigned long long>(std::numeric_limits<T>::max())
+                           > static_cast<unsigned long long>(LLONG_MAX) ?
+                       LLONG_MAX :
+                       static_cast<long long>(std::numeric_limits<T>::max());
+        }
+
+        // a value of type T, the compiler can omit the comparisons that are always true
+        template <long long Min, long long Max, typename T>
+        constexpr bool is_in_range(const T& value) noexcept
+        {
+            return !constraints::detail::integer_less(value, Min)
+                   && !constraints::detail::integer_less(Max, value);
+        }
+
+        // a value in [SourceMin, SourceMax], the comparisons that are known to be true are omitted
+        template <long long Min, long long Max, long long SourceMin, long long SourceMax>
+        constexpr bool is_in_range(long long value) noexcept
+        {
+            return (SourceMin >= Min || value >= Min) && (SourceMax <= Max || value <= Max);
+        }
+
+        // whether all values of the integer type T are in [Min, Max]
+        template <bool IsInteger, typename T, long long Min, long long Max>
+        struct is_contained_integer_impl : std::false_type
+        {
+        };
+
+        template <typename T, long long Min, long long Max>
+        struct is_contained_integer_impl<true, T, Min, Max>
+        : std::integral_constant<bool, Min <= ranged_lowest<T>() && ranged_highest<T>() <= Max
+                                           && static_cast<unsigned long long>(
+                                                  std::numeric_limits<T>::max())
+                                                  <= static_cast<unsigned long long>(LLONG_MAX)>
+        {
+        };
+
+        template <typename T, long long Min, long long Max>
+        using is_contained_integer =
+            is_contained_integer_impl<detail::is_integer<T>::value, T, Min, Max>;
+
+        template <typename T, long long Min, long long Max>
+        using enable_contained_integer =
+            typename std::enable_if<is_contained_integer<T, Min, Max>::value>::type;
+
+        template <typename T, long long Min, long long Max>
+        using enable_checked_integer =
+            typename std::enable_if<detail::is_integer<T>::value
+                                    && !is_contained_integer<T, Min, Max>::value>::type;
+
+        // whether all values of a bounded type with static integer bounds are in [Min, Max]
+        template <bool Checkable, long long Min, long long Max, bool LowerInclusive,
+                  bool UpperInclusive, typename LowerBound, typename UpperBound>
+        struct is_contained_bounded : std::false_type
+        {
+        };
+
+        template <long long Min, long long Max, bool LowerInclusive, bool UpperInclusive,
+                  typename LowerBound, typename UpperBound>
+        struct is_contained_bounded<true, Min, Max, LowerInclusive, UpperInclusive, LowerBound,
+                                    UpperBound>
+        : std::integral_constant<
+              bool,
+              (LowerInclusive ?
+                   !constraints::detail::integer_less(LowerBound::value, Min) :
+                   Min == LLONG_MIN
+                       || !constraints::detail::integer_less(LowerBound::value, Min - 1))
+                  && (UpperInclusive ?
+                          !constraints::detail::integer_less(Max, UpperBound::value) :
+                          Max == LLONG_MAX
+                              || !constraints::detail::integer_less(Max + 1, UpperBound::value))>
+        {
+        };
+
+        template <long long Min, long long Max, bool LowerInclusive, bool UpperInclusive,
+                  typename LowerBound, typename UpperBound>
+        using enable_contained_bounded = typename std::enable_if<
+            is_contained_bounded<constraints::detail::is_integer_bound<LowerBound>::value
+                                     && constraints::detail::is_integer_bound<UpperBound>::value,
+                                 Min, Max, LowerInclusive, UpperInclusive, LowerBound,
+                                 UpperBound>::value>::type;
+
+        struct ranged_integer_access
+        {
+            // the value must be in the range of the result
+            template <class Ranged>
+            static constexpr Ranged make(long long value) noexcept
+            {
+                return Ranged(ranged_integer_access{}, value);
+            }
+        };
+    } // namespace detail
+
+    /// An integer whose value is known to be in the interval `[Min, Max]`.
+    ///
+    /// Unlike [ts::integer]() it does not check the arithmetic operations at run-time,
+    /// but computes the interval of the result at compile-time,
+    /// the result of `+`, `-` and `*` is a `ranged_integer` of that interval,
+    /// e.g. the sum of two `ranged_integer<0, 100>` is a `ranged_integer<0, 200>`.
+    /// So the operations can never overflow,
+    /// it is a compilation error if the bounds of the result do not fit in a `long long`.
+    /// The value is stored in the smallest integer type that can store all values of the interval.
+    ///
+    /// A run-time check is only needed when a value is converted to a type
+    /// that can't store all values of the interval, like a `ranged_integer` with a smaller interval
+    /// or a built-in integer type using [ts::narrow_cast]().
+    /// Then only the bounds that can actually be exceeded are checked.
+    /// A [ts::bounded_type]() with static integer bounds and integer types whose values are all in the interval
+    /// are converted implicitly without a check.
+    /// \module types
+    template <long long Min, long long Max>
+    class ranged_integer
+    {
+        static_assert(Min <= Max, "invalid interval");
+
+    public:
+        using integer_type = detail::ranged_integer_storage<Min, Max>;
+
+        /// \returns The lower bound of the values.
+        static constexpr long long min() noexcept
+        {
+            return Min;
+        }
+
+        /// \returns The upper bound of the values.
+        static constexpr long long max() noexcept
+        {
+            return Max;
+        }
+
+        //=== constructors ===//
+        /// \exclude
+        ranged_integer() = delete;
+
+        /// \effects Initializes it with the compile-time constant `Value`.
+        /// It is checked with a `static_assert()` that it is in the interval.
+        /// \param 2
+        /// \exclude
+        template <typename T, T Value>
+        TYPE_SAFE_FORCE_INLINE constexpr ranged_integer(std::integral_constant<T, Value>) noexcept
+        : value_(static_cast<integer_type>(Value))
+        {
+            static_assert(detail::is_in_range<Min, Max>(Value), "constant not in interval");
+        }
+
+        /// \effects Initializes it with the value of an integer whose interval is contained in this one.
+        /// \notes This constructor does not participate in overload resolution,
+        /// unless `[OtherMin, OtherMax]` is a subset of `[Min, Max]`.
+        /// \param 2
+        /// \exclude
+        template <long long OtherMin, long long OtherMax,
+                  typename = typename std::enable_if<(Min <= OtherMin && OtherMax <= Max)>::type>
+        TYPE_SAFE_FORCE_INLINE constexpr ranged_integer(
+            const ranged_integer<OtherMin, OtherMax>& other) noexcept
+        : value_(static_cast<integer_type>(other.get()))
+        {
+        }
+
+        /// \effects Initializes it with the given value.
+        /// \notes This constructor does not participate in overload resolution,
+        /// unless `T` is an integer type where all values are in the interval.
+        /// \group contained_ctor
+        /// \param 1
+        /// \exclude
+        template <typename T, typename = detail::enable_contained_integer<T, Min, Max>>
+        TYPE_SAFE_FORCE_INLINE constexpr ranged_integer(const T& value) noexcept
+        : value_(static_cast<integer_type>(value))
+        {
+        }
+
+        /// \group contained_ctor
+        /// \param 1
+        /// \exclude
+        template <typename T, class Policy,
+                  typename = detail::enable_contained_integer<T, Min, Max>>
+        TYPE_SAFE_FORCE_INLINE constexpr ranged_integer(const integer<T, Policy>& value) noexcept
+        : value_(static_cast<integer_type>(static_cast<T>(value)))
+        {
+        }
+
+        /// \effects Initializes it with the given value.
+        /// \requires The value must be in the interval.
+        /// \notes This constructor does not participate in overload resolution,
+        /// unless `T` is an integer type with values outside of the interval,
+        /// it is `explicit` as it has to check the value.
+        /// \group checked_ctor
+        /// \param 1
+        /// \exclude
+        template <typename T, typename = detail::enable_checked_integer<T, Min, Max>,
+                  typename = void>
+        TYPE_SAFE_FORCE_INLINE explicit constexpr ranged_integer(const T& value) noexcept
+        : value_(detail::is_in_range<Min, Max>(value) ?
+                     static_cast<integer_type>(value) :
+                     (TYPE_SAFE_PRECONDITION_UNREACHABLE("value not in interval"),
+                      static_cast<integer_type>(Min)))
+        {
+        }
+
+        /// \group checked_ctor
+        /// \param 2
+        /// \exclude
+        template <typename T, class Policy, typename = detail::enable_checked_integer<T, Min, Max>,
+                  typename = void>
+        TYPE_SAFE_FORCE_INLINE explicit constexpr ranged_integer(
+            const integer<T, Policy>& value) noexcept
+        : ranged_integer(static_cast<T>(value))
+        {
+        }
+
+        /// \effects Initializes it with the value of a [ts::bounded_type]().
+        /// \notes This constructor does not participate in overload resolution,
+        /// unless the bounded type has static integer bounds
+        /// and all values between the bounds are in the interval.
+        /// \param 6
+        /// \exclude
+        template <typename T, bool LowerInclusive, bool UpperInclusive, typename LowerBound,
+                  typename UpperBound, class Verifier,
+                  typename = detail::enable_contained_bounded<Min, Max, LowerInclusive,
+                                                              UpperInclusive, LowerBound,
+                                                              UpperBound>>
+        TYPE_SAFE_FORCE_INLINE ranged_integer(
+            const constrained_type<T,
+                                   constraints::bounded<T, LowerInclusive, UpperInclusive,
+                                                        LowerBound, UpperBound>,
+                                   Verifier>& value) noexcept
+        : value_(static_cast<integer_type>(value.get_value()))
+        {
+        }
+
+        //=== conversion back ===//
+        /// \returns The stored value as the native integer type.
+        /// \group conversion
+        TYPE_SAFE_FORCE_INLINE explicit constexpr operator integer_type() const noexcept
+        {
+            return value_;
+        }
+
+        /// \group conversion
+        TYPE_SAFE_FORCE_INLINE constexpr integer_type get() const noexcept
+        {
+            return value_;
+        }
+
+        /// \returns A [ts::bounded_type]() with the same value and the interval as static bounds.
+        /// \notes The [ts::bounded_type]() verifies the value as usual.
+        template <typename T = integer_type>
+        bounded_type<T, true, true, std::integral_constant<long long, Min>,
+                     std::integral_constant<long long, Max>>
+            to_bounded() const
+        {
+            static_assert(Min >= detail::ranged_lowest<T>() && Max <= detail::ranged_highest<T>(),
+                          "interval does not fit in the type");
+            return bounded_type<T, true, true, std::integral_constant<long long, Min>,
+                                std::integral_constant<long long, Max>>(static_cast<T>(value_));
+        }
+
+        //=== unary operators ===//
+        /// \returns The integer unchanged.
+        TYPE_SAFE_FORCE_INLINE constexpr ranged_integer operator+() const noexcept
+        {
+            return *this;
+        }
+
+        /// \returns The negative integer, its interval is `[-Max, -Min]`.
+        /// \notes It is a compilation error if `Min` is `LLONG_MIN`.
+        /// \param 0
+        /// \exclude
+        template <long long M = Min>
+        TYPE_SAFE_FORCE_INLINE constexpr auto operator-() const noexcept ->
+            typename detail::ranged_negation<M, Max>::type
+        {
+            return detail::ranged_integer_access::make<
+                typename detail::ranged_negation<M, Max>::type>(-static_cast<long long>(value_));
+        }
+
+    private:
+        TYPE_SAFE_FORCE_INLINE constexpr ranged_integer(detail::ranged_integer_access,
+                                                        long long value) noexcept
+        : value_(static_cast<integer_type>(value))
+        {
+        }
+
+        integer_type value_;
+
+        friend detail::ranged_integer_access;
+    };
+
+    //=== arithmetic ===//
+    /// \returns The sum of both values, its interval is the sum of the intervals.
+    /// \notes Overflow is impossible, so there is no check.
+    /// \module types
+    /// \exclude return
+    template <long long AMin, long long AMax, long long BMin, long long BMax>
+    TYPE_SAFE_FORCE_INLINE constexpr auto operator+(const ranged_integer<AMin, AMax>& a,
+                                                    const ranged_integer<BMin, BMax>& b) noexcept ->
+        typename detail::ranged_addition<AMin, AMax, BMin, BMax>::type
+    {
+        return detail::ranged_integer_access::make<
+            typename detail::ranged_addition<AMin, AMax, BMin, BMax>::type>(
+            static_cast<long long>(a.get()) + static_cast<long long>(b.get()));
+    }
+
+    /// \returns The difference of both values, its interval is `[AMin - BMax, AMax - BMin]`.
+    /// \notes Overflow is impossible, so there is no check.
+    /// \module types
+    /// \exclude return
+    template <long long AMin, long long AMax, long long BMin, long long BMax>
+    TYPE_SAFE_FORCE_INLINE constexpr auto operator-(const ranged_integer<AMin, AMax>& a,
+                                                    const ranged_integer<BMin, BMax>& b) noexcept ->
+        typename detail::ranged_subtraction<AMin, AMax, BMin, BMax>::type
+    {
+        return detail::ranged_integer_access::make<
+            typename detail::ranged_subtraction<AMin, AMax, BMin, BMax>::type>(
+            static_cast<long long>(a.get()) - static_cast<long long>(b.get()));
+    }
+
+    /// \returns The product of both values,
+    /// its interval is given by the minimum and maximum of the products of the bounds.
+    /// \notes Overflow is impossible, so there is no check.
+    /// \module types
+    /// \exclude return
+    template <long long AMin, long long AMax, long long BMin, long long BMax>
+    TYPE_SAFE_FORCE_INLINE constexpr auto operator*(const ranged_integer<AMin, AMax>& a,
+                                                    const ranged_integer<BMin, BMax>& b) noexcept ->
+        typename detail::ranged_multiplication<AMin, AMax, BMin, BMax>::type
+    {
+        return detail::ranged_integer_access::make<
+            typename detail::ranged_multiplication<AMin, AMax, BMin, BMax>::type>(
+            static_cast<long long>(a.get()) * static_cast<long long>(b.get()));
+    }
+
+    //=== comparison ===//
+    /// Compares two [ts::ranged_integer]()s.
+    /// \notes If the result follows from the intervals alone, it doesn't look at the values.
+    /// \group ranged_comp
+    /// \module types
+    template <long long AMin, long long AMax, long long BMin, long long BMax>
+    TYPE_SAFE_FORCE_INLINE constexpr bool operator==(const ranged_integer<AMin, AMax>& a,
+                                                     const ranged_integer<BMin, BMax>& b) noexcept
+    {
+        return AMax < BMin || BMax < AMin ?
+                   false :
+                   static_cast<long long>(a.get()) == static_cast<long long>(b.get());
+    }
+
+    /// \group ranged_comp
+    template <long long AMin, long long AMax, long long BMin, long long BMax>
+    TYPE_SAFE_FORCE_INLINE constexpr bool operator!=(const ranged_integer<AMin, AMax>& a,
+                                                     const ranged_integer<BMin, BMax>& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    /// \group ranged_comp
+    template <long long AMin, long long AMax, long long BMin, long long BMax>
+    TYPE_SAFE_FORCE_INLINE constexpr bool operator<(const ranged_integer<AMin, AMax>& a,
+                                                    const ranged_integer<BMin, BMax>& b) noexcept
+    {
+        return AMax < BMin ? true :
+                             BMax <= AMin ? false :
+                                            static_cast<long long>(a.get())
+                                                < static_cast<long long>(b.get());
+    }
+
+    /// \group ranged_comp
+    template <long long AMin, long long AMax, long long BMin, long long BMax>
+    TYPE_SAFE_FORCE_INLINE constexpr bool operator<=(const ranged_integer<AMin, AMax>& a,
+                                                     const ranged_integer<BMin, BMax>& b) noexcept
+    {
+        return !(b < a);
+    }
+
+    /// \group ranged_comp
+    template <long long AMin, long long AMax, long long BMin, long long BMax>
+    TYPE_SAFE_FORCE_INLINE constexpr bool operator>(const ranged_integer<AMin, AMax>& a,
+                                                    const ranged_integer<BMin, BMax>& b) noexcept
+    {
+        return b < a;
+    }
+
+    /// \group ranged_comp
+    template <long long AMin, long long AMax, long long BMin, long long BMax>
+    TYPE_SAFE_FORCE_INLINE constexpr bool operator>=(const ranged_integer<AMin, AMax>& a,
+                                                     const ranged_integer<BMin, BMax>& b) noexcept
+    {
+        return !(a < b);
+    }
+
+    /// \exclude
+    namespace detail
+    {
+        template <typename Target>
+        struct ranged_narrow_target
+        {
+            using integer_type = Target;
+            using type         = Target;
+
+            static constexpr long long min() noexcept
+            {
+                return ranged_lowest<Target>();
+            }
+
+            static constexpr long long max() noexcept
+            {
+                return ranged_highest<Target>();
+            }
+
+            static constexpr type make(long long value) noexcept
+            {
+                return static_cast<Target>(value);
+            }
+        };
+
+        template <typename T, class Policy>
+        struct ranged_narrow_target<integer<T, Policy>> : ranged_narrow_target<T>
+        {
+            using type = integer<T, Policy>;
+
+            static constexpr type make(long long value) noexcept
+            {
+                return type(static_cast<T>(value));
+            }
+        };
+
+        template <long long Min, long long Max>
+        struct ranged_narrow_target<ranged_integer<Min, Max>>
+        {
+            using type = ranged_integer<Min, Max>;
+
+            static constexpr long long min() noexcept
+            {
+                return Min;
+            }
+
+            static constexpr long long max() noexcept
+            {
+                return Max;
+            }
+
+            static constexpr type make(long long value) noexcept
+            {
+                return ranged_integer_access::make<type>(value);
+            }
+        };
+    } // namespace detail
+
+    /// \returns The value of the [ts::ranged_integer]() converted to `Target`,
+    /// which can be a built-in integer type, a [ts::integer]() or a [ts::ranged_integer]().
+    /// \requires The value must be representable by `Target`.
+    /// \notes Only the bounds of `Target` that are inside of the interval `[Min, Max]` are checked,
+    /// so there is no check at all if the target can represent all values of the interval.
+    /// \module types
+    /// \exclude return
+    template <typename Target, long long Min, long long Max>
+    TYPE_SAFE_FORCE_INLINE constexpr auto narrow_cast(
+        const ranged_integer<Min, Max>& source) noexcept ->
+        typename detail::ranged_narrow_target<Target>::type
+    {
+        using target = detail::ranged_narrow_target<Target>;
+        return detail::is_in_range<target::min(), target::max(), Min, Max>(
+                   static_cast<long long>(source.get())) ?
+                   target::make(static_cast<long long>(source.get())) :
+                   (TYPE_SAFE_PRECONDITION_UNREACHABLE("conversion would truncate value"),
+                    target::make(target::min()));
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_RANGED_INTEGER_HPP_INCLUDED
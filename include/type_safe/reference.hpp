@@ -12,13 +12,12 @@
 #include <type_safe/detail/assert.hpp>
 #include <type_safe/detail/aligned_union.hpp>
 #include <type_safe/detail/map_invoke.hpp>
+#include <type_safe/fwd.hpp>
 #include <type_safe/index.hpp>
+#include <type_safe/relocation.hpp>
 
 namespace type_safe
 {
-    template <typename T, bool XValue = false>
-    class object_ref;
-
     /// \exclude
     namespace detail
     {
@@ -135,6 +134,12 @@ namespace type_safe
         }
     };
 
+    /// \exclude
+    template <typename T, bool XValue>
+    struct is_trivially_relocatable<object_ref<T, XValue>> : std::true_type
+    {
+    };
+
     template <typename T, bool XValue>
     class reference_optional_storage;
 
@@ -342,8 +347,7 @@ namespace type_safe
         /// \group range
         void assign(T* begin, T* end) noexcept
         {
-            DEBUG_ASSERT(begin && end && begin <= end, detail::precondition_error_handler{},
-                         "invalid array bounds");
+            TYPE_SAFE_PRECONDITION(begin && end && begin <= end, "invalid array bounds");
             begin_ = begin;
             size_  = static_cast<size_t>(make_unsigned(end - begin));
         }
@@ -351,7 +355,7 @@ namespace type_safe
         /// \group ptr_size
         void assign(T* array, size_t size) noexcept
         {
-            DEBUG_ASSERT(array, detail::precondition_error_handler{}, "invalid array bounds");
+            TYPE_SAFE_PRECONDITION(array, "invalid array bounds");
             begin_ = array;
             size_  = size;
         }
@@ -393,11 +397,19 @@ namespace type_safe
         /// \requires `i < size()`.
         reference_type operator[](index_t i) const noexcept
         {
-            DEBUG_ASSERT(static_cast<size_t&>(i) < size_, detail::precondition_error_handler{},
-                         "out of bounds array access");
+            TYPE_SAFE_PRECONDITION(static_cast<size_t&>(i) < size_, "out of bounds array access");
             return static_cast<reference_type>(at(begin_, i));
         }
 
+        /// \returns The same as the other overload,
+        /// but does not check the index, as it has already been validated by a [ts::index_range]().
+        /// \requires `i` must have been created by an [ts::index_range]() for this array
+        /// or one with at most the same size.
+        reference_type operator[](const in_bounds_index& i) const noexcept
+        {
+            return static_cast<reference_type>(begin_[static_cast<std::size_t>(get(i.get()))]);
+        }
+
     private:
         T*     begin_;
         size_t size_;
@@ -485,6 +497,68 @@ namespace type_safe
         return array_xvalue_ref<T>(array, size);
     }
 
+    /// \exclude
+    namespace detail
+    {
+        template <typename From, typename To>
+        using copy_const_t =
+            typename std::conditional<std::is_const<From>::value, const To, To>::type;
+
+        template <class StrongTypedef, typename T>
+        struct check_typed_view
+        {
+            using underlying = type_safe::underlying_type<StrongTypedef>;
+            static_assert(std::is_same<typename std::remove_const<T>::type, underlying>::value,
+                          "array must be of the underlying type");
+            static_assert(std::is_standard_layout<StrongTypedef>::value,
+                          "strong typedef must be standard layout");
+            static_assert(sizeof(StrongTypedef) == sizeof(underlying)
+                              && alignof(StrongTypedef) == alignof(underlying),
+                          "strong typedef must have the same size and alignment");
+            static constexpr bool value = true;
+        };
+
+        template <typename To, typename From>
+        array_ref<To> reinterpret_array_ref(const array_ref<From>& ref) noexcept
+        {
+            return ref.size() == 0u ?
+                       array_ref<To>(nullptr) :
+                       array_ref<To>(reinterpret_cast<To*>(ref.data()), ref.size());
+        }
+    } // namespace detail
+
+    /// Views an array of the underlying type as an array of the [ts::strong_typedef]().
+    /// \returns An [ts::array_ref]() to the same memory,
+    /// to `const` if the array is `const`.
+    /// No copies or conversions are made.
+    /// \requires `T` must be the underlying type of `StrongTypedef` (optionally `const`),
+    /// and `StrongTypedef` must have the same layout as `T`,
+    /// i.e. be standard layout with the same size and alignment.
+    /// This is checked with a `static_assert()`.
+    template <class StrongTypedef, typename T>
+    array_ref<detail::copy_const_t<T, StrongTypedef>> typed_view(const array_ref<T>& ref) noexcept
+    {
+        static_assert(detail::check_typed_view<StrongTypedef, T>::value, "");
+        return detail::reinterpret_array_ref<detail::copy_const_t<T, StrongTypedef>>(ref);
+    }
+
+    /// Views an array of a [ts::strong_typedef]() as an array of its underlying type.
+    /// \returns An [ts::array_ref]() to the same memory,
+    /// to `const` if the array is `const`.
+    /// No copies or conversions are made.
+    /// \requires Same as for [ts::typed_view]().
+    template <class StrongTypedef>
+    auto underlying_view(const array_ref<StrongTypedef>& ref) noexcept -> array_ref<
+        detail::copy_const_t<StrongTypedef, type_safe::underlying_type<StrongTypedef>>>
+    {
+        using underlying = type_safe::underlying_type<StrongTypedef>;
+        static_assert(detail::check_typed_view<typename std::remove_const<StrongTypedef>::type,
+                                               underlying>::value,
+                      "");
+        return detail::reinterpret_array_ref<detail::copy_const_t<StrongTypedef, underlying>>(
+            ref);
+    }
+
     /// \exclude
     namespace detail
     {
@@ -512,6 +586,9 @@ namespace type_safe
         struct matching_functor_tag
         {
         };
+        struct matching_static_function_tag
+        {
+        };
         struct invalid_functor_tag
         {
         };
@@ -558,6 +635,8 @@ namespace type_safe
     /// But if it is created with a function pointer or something convertible to a function pointer,
     /// it will store the function pointer itself.
     /// This allows creating it from stateless lambdas.
+    /// If the function is known at compile-time, use [*make]() instead,
+    /// which avoids the second indirect call through the stored function pointer.
     /// \notes Due to implementation reasons,
     /// it does not support member function pointers,
     /// as it requires regular function call syntax.
@@ -643,6 +722,31 @@ namespace type_safe
         {
         }
 
+        /// \effects Creates a reference to the function `Fptr` known at compile-time.
+        /// \returns A reference that calls `Fptr` directly,
+        /// i.e. calling it is a single indirect call and the function pointer is not stored.
+        /// \notes (1) requires a function pointer of exactly the specified signature,
+        /// (2) accepts any function pointer type that is compatible with the specified signature,
+        /// e.g. `function_ref<void(int)>::make<decltype(&f), &f>()`.
+        /// \group make
+        template <Return (*Fptr)(Args...)>
+        static function_ref make() noexcept
+        {
+            return make<Return (*)(Args...), Fptr>();
+        }
+
+        /// \group make
+        /// \param 2
+        /// \exclude
+        template <typename PointerT, PointerT Fptr,
+                  typename detail::enable_matching_function<PointerT, Return, Args...>::type = 0>
+        static function_ref make() noexcept
+        {
+            static_assert(Fptr != nullptr, "function pointer must not be null");
+            return function_ref(detail::matching_static_function_tag{},
+                                &invoke_static_function<PointerT, Fptr>);
+        }
+
         /// \effects Rebinds the reference to the specified functor.
         /// \notes This assignment operator only participates in overload resolution,
         /// if the argument can also be a valid constructor argument.
@@ -667,6 +771,9 @@ namespace type_safe
         }
 
     private:
+        using storage  = detail::aligned_union_t<void*, Return (*)(Args...)>;
+        using callback = Return (*)(const void*, Args...);
+
         template <typename Functor>
         static Return invoke_functor(const void* memory, Args... args)
         {
@@ -684,14 +791,24 @@ namespace type_safe
             return static_cast<Return>(func(static_cast<Args>(args)...));
         }
 
+        template <typename PointerT, PointerT Fptr>
+        static Return invoke_static_function(const void*, Args... args)
+        {
+            return static_cast<Return>(Fptr(static_cast<Args>(args)...));
+        }
+
+        function_ref(detail::matching_static_function_tag, callback cb) noexcept
+        : storage_(), cb_(cb)
+        {
+        }
+
         template <typename Return2, typename... Args2>
         function_ref(detail::matching_function_pointer_tag, Return2 (*fptr)(Args2...))
         {
             using pointer_type        = Return2 (*)(Args2...);
             using stored_pointer_type = Return (*)(Args...);
 
-            DEBUG_ASSERT(fptr, detail::precondition_error_handler{},
-                         "function pointer must not be null");
+            TYPE_SAFE_PRECONDITION(fptr, "function pointer must not be null");
             ::new (get_memory()) stored_pointer_type(reinterpret_cast<stored_pointer_type>(fptr));
 
             cb_ = &invoke_function_pointer<pointer_type, stored_pointer_type>;
@@ -707,9 +824,6 @@ namespace type_safe
             return &storage_;
         }
 
-        using storage  = detail::aligned_union_t<void*, Return (*)(Args...)>;
-        using callback = Return (*)(const void*, Args...);
-
         storage  storage_;
         callback cb_;
     };
@@ -0,0 +1,150 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_RELOCATION_HPP_INCLUDED
+#define TYPE_SAFE_RELOCATION_HPP_INCLUDED
+
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <type_safe/strong_typedef.hpp>
+
+namespace type_safe
+{
+    template <typename T>
+    struct is_trivially_relocatable;
+
+    /// \exclude
+    namespace detail
+    {
+        template <typename T>
+#if !defined(__clang__) && defined(__GNUC__) && __GNUC__ < 5
+        // does not have is_trivially_copyable
+        using is_trivially_copyable = std::is_trivial<T>;
+#else
+        using is_trivially_copyable = std::is_trivially_copyable<T>;
+#endif
+
+        // a strong typedef is relocatable if the underlying type is,
+        // as long as the derived class doesn't add any members
+        template <typename T, typename = void>
+        struct is_relocatable_strong_typedef : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_relocatable_strong_typedef<T, decltype(void(detail::underlying_type(
+                                                    std::declval<T>())))>
+        : std::integral_constant<bool,
+                                 sizeof(T) == sizeof(type_safe::underlying_type<T>)
+                                     && is_trivially_relocatable<
+                                            type_safe::underlying_type<T>>::value>
+        {
+        };
+    } // namespace detail
+
+    /// Whether or not `T` is trivially relocatable.
+    ///
+    /// A type is trivially relocatable if moving an object to a new location
+    /// and destroying the old one is equivalent to copying its bytes with `std::memcpy()`
+    /// and forgetting about the old one.
+    /// This is true for all trivially copyable types, [ts::strong_typedef]() of trivially relocatable types,
+    /// `std::allocator`, and the library's wrapper types if the types they store are trivially relocatable,
+    /// i.e. [ts::object_ref](), [ts::tagged_union](), [ts::basic_variant](), [ts::basic_optional](),
+    /// [ts::constrained_type]() and [ts::boxed]().
+    /// It can be specialized for user-defined types.
+    ///
+    /// It is used by [ts::relocate_at]() and [ts::uninitialized_relocate]().
+    /// \module types
+    template <typename T>
+    struct is_trivially_relocatable
+    : std::integral_constant<bool, detail::is_trivially_copyable<T>::value
+                                       || detail::is_relocatable_strong_typedef<T>::value>
+    {
+    };
+
+    /// \exclude
+    template <typename T>
+    struct is_trivially_relocatable<std::allocator<T>> : std::true_type
+    {
+    };
+
+    /// \exclude
+    namespace detail
+    {
+        template <typename T>
+        T* relocate_at(std::true_type, T* src, T* dest) noexcept
+        {
+            std::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), sizeof(T));
+            return dest;
+        }
+
+        template <typename T>
+        T* relocate_at(std::false_type, T* src, T* dest) noexcept(
+            std::is_nothrow_move_constructible<T>::value)
+        {
+            auto result = ::new (static_cast<void*>(dest)) T(std::move(*src));
+            src->~T();
+            return result;
+        }
+
+        template <typename T>
+        T* uninitialized_relocate(std::true_type, T* first, T* last, T* dest) noexcept
+        {
+            auto size = static_cast<std::size_t>(last - first);
+            if (size != 0u)
+                // memcpy() must not be given a null pointer, even for size zero
+                std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first),
+                            size * sizeof(T));
+            return dest + size;
+        }
+
+        template <typename T>
+        T* uninitialized_relocate(std::false_type, T* first, T* last, T* dest) noexcept(
+            std::is_nothrow_move_constructible<T>::value)
+        {
+            auto result = std::uninitialized_copy(std::make_move_iterator(first),
+                                                  std::make_move_iterator(last), dest);
+            for (; first != last; ++first)
+                first->~T();
+            return result;
+        }
+    } // namespace detail
+
+    /// \effects Relocates the object at `src` to `dest`,
+    /// i.e. creates an object at `dest` by moving `*src` and destroys `*src` afterwards.
+    /// If `T` is [ts::is_trivially_relocatable](), this is a single `std::memcpy()`.
+    /// \returns A pointer to the new object.
+    /// \throws Anything thrown by the move constructor of `T`,
+    /// in which case `*src` is not destroyed.
+    /// \requires `src` must point to an object and `dest` to uninitialized memory for a `T`.
+    template <typename T>
+    T* relocate_at(T* src, T* dest) noexcept(
+        is_trivially_relocatable<T>::value || std::is_nothrow_move_constructible<T>::value)
+    {
+        return detail::relocate_at(is_trivially_relocatable<T>{}, src, dest);
+    }
+
+    /// \effects Relocates the objects in the range `[first, last)` to the memory starting at `dest`,
+    /// i.e. creates objects there by moving the objects in the range and destroys them afterwards.
+    /// If `T` is [ts::is_trivially_relocatable](), this is a single `std::memcpy()`.
+    /// \returns A pointer past the last relocated object.
+    /// \throws Anything thrown by the move constructor of `T`,
+    /// in which case the objects created so far are destroyed and the range is not destroyed.
+    /// \requires `[first, last)` must be a valid range of objects,
+    /// `dest` must point to uninitialized memory for `last - first` objects,
+    /// and the two ranges must not overlap.
+    template <typename T>
+    T* uninitialized_relocate(T* first, T* last, T* dest) noexcept(
+        is_trivially_relocatable<T>::value || std::is_nothrow_move_constructible<T>::value)
+    {
+        return detail::uninitialized_relocate(is_trivially_relocatable<T>{}, first, last, dest);
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_RELOCATION_HPP_INCLUDED
@@ -0,0 +1,759 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_RESULT_HPP_INCLUDED
+#define TYPE_SAFE_RESULT_HPP_INCLUDED
+
+#include <type_traits>
+#include <utility>
+
+#include <type_safe/config.hpp>
+#include <type_safe/detail/map_invoke.hpp>
+#include <type_safe/variant.hpp>
+
+#if TYPE_SAFE_USE_COROUTINES
+#include <coroutine>
+
+#include <type_safe/deferred_construction.hpp>
+#endif
+
+namespace type_safe
+{
+    /// A wrapper marking an error of type `E` that is stored in a [ts::result]().
+    ///
+    /// It is needed to create a result containing an error,
+    /// even if the value and error type are the same.
+    /// \module variant
+    template <typename E>
+    class error
+    {
+        static_assert(!std::is_reference<E>::value, "error type must not be a reference");
+
+    public:
+        using value_type = E;
+
+        /// \effects Creates the error by calling `E`s constructor with the perfectly forwarded arguments.
+        /// \throws Anything thrown by `E`s constructor.
+        /// \notes This constructor only participates in overload resolution,
+        /// if `E` is constructible from the arguments.
+        /// \param 1
+        /// \exclude
+        template <typename... Args, typename = typename std::enable_if<
+                                        std::is_constructible<E, Args&&...>::value>::type>
+        explicit constexpr error(Args&&... args) : value_(std::forward<Args>(args)...)
+        {
+        }
+
+        /// \returns A (`const`) lvalue (1, 2)/rvalue (3, 4) reference to the error.
+        /// \group value
+        TYPE_SAFE_CONSTEXPR14 E& value() TYPE_SAFE_LVALUE_REF noexcept
+        {
+            return value_;
+        }
+
+        /// \group value
+        constexpr const E& value() const TYPE_SAFE_LVALUE_REF noexcept
+        {
+            return value_;
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group value
+        TYPE_SAFE_CONSTEXPR14 E&& value() && noexcept
+        {
+            return std::move(value_);
+        }
+
+        /// \group value
+        constexpr const E&& value() const && noexcept
+        {
+            return std::move(value_);
+        }
+#endif
+
+    private:
+        E value_;
+    };
+
+    /// \returns A [ts::error]() containing a copy of the given object.
+    /// \module variant
+    template <typename E>
+    constexpr error<typename std::decay<E>::type> make_error(E&& e)
+    {
+        return error<typename std::decay<E>::type>(std::forward<E>(e));
+    }
+
+    template <typename T, typename E>
+    class result;
+
+    /// \exclude
+    namespace detail
+    {
+        template <typename T>
+        struct is_result_impl : std::false_type
+        {
+        };
+
+        template <typename T, typename E>
+        struct is_result_impl<result<T, E>> : std::true_type
+        {
+        };
+
+        template <typename T>
+        using is_result = is_result_impl<typename std::decay<T>::type>;
+
+        template <typename T>
+        struct is_error_impl : std::false_type
+        {
+        };
+
+        template <typename E>
+        struct is_error_impl<error<E>> : std::true_type
+        {
+        };
+
+        template <typename T>
+        using is_error = is_error_impl<typename std::decay<T>::type>;
+
+        template <typename T, typename U>
+        using enable_result_value =
+            typename std::enable_if<!is_result<U>::value && !is_error<U>::value
+                                    && std::is_constructible<T, U&&>::value>::type;
+
+        template <typename Result>
+        using result_error_type = typename std::decay<Result>::type::error_type;
+
+#if TYPE_SAFE_USE_COROUTINES
+        template <typename T, typename E>
+        class result_promise;
+#endif
+    } // namespace detail
+
+    /// The result of an operation that can fail,
+    /// either a value of type `T` or an error of type `E`.
+    ///
+    /// It is a [ts::basic_variant]() of `T` and [ts::error<E>]() using the [ts::never_empty_variant_policy](),
+    /// so it has the same layout as the [ts::tagged_union]() of the two types
+    /// and always contains either the value or the error.
+    /// Checking whether the operation has failed is a single comparison of the tag.
+    /// Use it instead of exceptions when failure is expected,
+    /// or instead of [ts::optional]() when the reason for the failure is needed.
+    ///
+    /// It provides the monadic operations `map()`, `map_error()` and `and_then()`
+    /// with the same semantics as the ones of [ts::basic_optional]().
+    /// The error of a result can be propagated to the caller with [TYPE_SAFE_TRY_RESULT](),
+    /// or with `co_await` inside a function returning a result, if C++20 coroutines are available.
+    /// \requires `T` and `E` must not be references or `void`.
+    /// \module variant
+    template <typename T, typename E>
+    class result
+    {
+        static_assert(!std::is_reference<T>::value && !std::is_void<T>::value,
+                      "value type must not be a reference or void");
+
+        using storage_t = basic_variant<never_empty_variant_policy, T, type_safe::error<E>>;
+
+    public:
+        using value_type = T;
+        using error_type = E;
+
+#if TYPE_SAFE_USE_COROUTINES
+        /// \exclude
+        using promise_type = detail::result_promise<T, E>;
+#endif
+
+        //=== constructors/assignment ===//
+        /// \effects Creates it containing a value constructed from the perfectly forwarded argument.
+        /// \throws Anything thrown by `T`s constructor.
+        /// \notes This constructor only participates in overload resolution,
+        /// if `T` is constructible from `U`, which must not be a [ts::error]() or [ts::result]().
+        /// \param 1
+        /// \exclude
+        template <typename U, typename = detail::enable_result_value<T, U>>
+        constexpr result(U&& value) : storage_(variant_type<T>{}, std::forward<U>(value))
+        {
+        }
+
+        /// \effects Creates it containing a copy (1)/move (2) of the error of `e`,
+        /// converted to `E`.
+        /// \throws Anything thrown by `E`s constructor.
+        /// \notes This constructor only participates in overload resolution,
+        /// if `E` is constructible from `G`.
+        /// \group ctor_error
+        /// \param 1
+        /// \exclude
+        template <typename G, typename = typename std::enable_if<
+                                  std::is_constructible<E, const G&>::value>::type>
+        constexpr result(const type_safe::error<G>& e)
+        : storage_(variant_type<type_safe::error<E>>{}, e.value())
+        {
+        }
+
+        /// \group ctor_error
+        /// \param 1
+        /// \exclude
+        template <typename G,
+                  typename = typename std::enable_if<std::is_constructible<E, G&&>::value>::type>
+        TYPE_SAFE_CONSTEXPR14 result(type_safe::error<G>&& e)
+        : storage_(variant_type<type_safe::error<E>>{}, std::move(e.value()))
+        {
+        }
+
+        /// \effects Changes the stored value or error to the given one.
+        /// \throws Anything thrown by the constructor or assignment operator of `T` or `E`.
+        /// \notes If the move constructor throws when it stores a value after an error or vice versa,
+        /// [std::terminate()]() is called, as the result must never be empty.
+        /// \group assign
+        /// \param 1
+        /// \exclude
+        template <typename U, typename = detail::enable_result_value<T, U>>
+        result& operator=(U&& value)
+        {
+            storage_.emplace(variant_type<T>{}, std::forward<U>(value));
+            return *this;
+        }
+
+        /// \group assign
+        /// \param 1
+        /// \exclude
+        template <typename G, typename = typename std::enable_if<
+                                  std::is_constructible<E, const G&>::value>::type>
+        result& operator=(const type_safe::error<G>& e)
+        {
+            storage_.emplace(variant_type<type_safe::error<E>>{}, e.value());
+            return *this;
+        }
+
+        /// \group assign
+        /// \param 1
+        /// \exclude
+        template <typename G,
+                  typename = typename std::enable_if<std::is_constructible<E, G&&>::value>::type>
+        result& operator=(type_safe::error<G>&& e)
+        {
+            storage_.emplace(variant_type<type_safe::error<E>>{}, std::move(e.value()));
+            return *this;
+        }
+
+        //=== observers ===//
+        /// \returns `true` if it contains a value,
+        /// `false` if it contains an error.
+        /// \group has_value
+        constexpr bool has_value() const noexcept
+        {
+            return storage_.has_value(variant_type<T>{});
+        }
+
+        /// \group has_value
+        explicit constexpr operator bool() const noexcept
+        {
+            return has_value();
+        }
+
+        /// \returns `true` if it contains an error,
+        /// `false` if it contains a value.
+        constexpr bool has_error() const noexcept
+        {
+            return !has_value();
+        }
+
+        /// \returns A (`const`) lvalue (1, 2)/rvalue (3, 4) reference to the stored value.
+        /// \requires `has_value() == true`.
+        /// \group value
+        TYPE_SAFE_CONSTEXPR14 T& value() TYPE_SAFE_LVALUE_REF noexcept
+        {
+            return storage_.value(variant_type<T>{});
+        }
+
+        /// \group value
+        constexpr const T& value() const TYPE_SAFE_LVALUE_REF noexcept
+        {
+            return storage_.value(variant_type<T>{});
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group value
+        TYPE_SAFE_CONSTEXPR14 T&& value() && noexcept
+        {
+            return std::move(storage_).value(variant_type<T>{});
+        }
+
+        /// \group value
+        constexpr const T&& value() const && noexcept
+        {
+            return std::move(storage_).value(variant_type<T>{});
+        }
+#endif
+
+        /// \returns A (`const`) lvalue (1, 2)/rvalue (3, 4) reference to the stored error.
+        /// \requires `has_error() == true`.
+        /// \group error
+        TYPE_SAFE_CONSTEXPR14 E& error() TYPE_SAFE_LVALUE_REF noexcept
+        {
+            return storage_.value(variant_type<type_safe::error<E>>{}).value();
+        }
+
+        /// \group error
+        constexpr const E& error() const TYPE_SAFE_LVALUE_REF noexcept
+        {
+            return storage_.value(variant_type<type_safe::error<E>>{}).value();
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group error
+        TYPE_SAFE_CONSTEXPR14 E&& error() && noexcept
+        {
+            return std::move(storage_).value(variant_type<type_safe::error<E>>{}).value();
+        }
+
+        /// \group error
+        constexpr const E&& error() const && noexcept
+        {
+            return std::move(storage_).value(variant_type<type_safe::error<E>>{}).value();
+        }
+#endif
+
+        /// \returns If it contains a value, a copy (1)/move (2) of it,
+        /// otherwise `u` converted to `T`.
+        /// \throws Anything thrown by `T`s copy (1)/move (2) constructor or the converting constructor.
+        /// \group value_or
+        template <typename U>
+        T value_or(U&& u) const TYPE_SAFE_LVALUE_REF
+        {
+            return has_value() ? value() : static_cast<T>(std::forward<U>(u));
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group value_or
+        template <typename U>
+        T value_or(U&& u) &&
+        {
+            return has_value() ? std::move(value()) : static_cast<T>(std::forward<U>(u));
+        }
+#endif
+
+        //=== monadic operations ===//
+        /// Maps the value of a result.
+        /// \effects If it contains a value,
+        /// calls the function with the (`const`) lvalue or rvalue value followed by the additional arguments perfectly forwarded.
+        /// \returns A result with the result of the function if it was called,
+        /// otherwise a result with a copy (1, 2)/move (3, 4) of the error.
+        /// \requires `f` must either be a function or function object of matching signature,
+        /// or a member function pointer of the stored type with compatible signature,
+        /// not returning `void`.
+        /// \group map
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto map(Func&& f, Args&&... args) TYPE_SAFE_LVALUE_REF
+            -> result<decltype(detail::map_invoke(std::forward<Func>(f), this->value(),
+                                                  std::forward<Args>(args)...)),
+                      E>
+        {
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), value(),
+                                          std::forward<Args>(args)...);
+            else
+                return type_safe::error<E>(error());
+        }
+
+        /// \group map
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto map(Func&& f, Args&&... args) const TYPE_SAFE_LVALUE_REF
+            -> result<decltype(detail::map_invoke(std::forward<Func>(f), this->value(),
+                                                  std::forward<Args>(args)...)),
+                      E>
+        {
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), value(),
+                                          std::forward<Args>(args)...);
+            else
+                return type_safe::error<E>(error());
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group map
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto map(Func&& f, Args&&... args) && -> result<
+            decltype(detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                                        std::forward<Args>(args)...)),
+            E>
+        {
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                                          std::forward<Args>(args)...);
+            else
+                return type_safe::error<E>(std::move(*this).error());
+        }
+
+        /// \group map
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto map(Func&& f, Args&&... args) const && -> result<
+            decltype(detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                                        std::forward<Args>(args)...)),
+            E>
+        {
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                                          std::forward<Args>(args)...);
+            else
+                return type_safe::error<E>(std::move(*this).error());
+        }
+#endif
+
+        /// Maps the error of a result.
+        /// \effects If it contains an error,
+        /// calls the function with the (`const`) lvalue or rvalue error followed by the additional arguments perfectly forwarded.
+        /// \returns A result with the result of the function as error if it was called,
+        /// otherwise a result with a copy (1, 2)/move (3, 4) of the value.
+        /// \requires `f` must either be a function or function object of matching signature,
+        /// or a member function pointer of the error type with compatible signature,
+        /// not returning `void`.
+        /// \group map_error
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto map_error(Func&& f, Args&&... args) TYPE_SAFE_LVALUE_REF
+            -> result<T, decltype(detail::map_invoke(std::forward<Func>(f), this->error(),
+                                                     std::forward<Args>(args)...))>
+        {
+            using error_t = decltype(
+                detail::map_invoke(std::forward<Func>(f), error(), std::forward<Args>(args)...));
+            if (has_value())
+                return value();
+            else
+                return type_safe::error<error_t>(detail::map_invoke(std::forward<Func>(f), error(),
+                                                                    std::forward<Args>(args)...));
+        }
+
+        /// \group map_error
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto map_error(Func&& f, Args&&... args) const TYPE_SAFE_LVALUE_REF
+            -> result<T, decltype(detail::map_invoke(std::forward<Func>(f), this->error(),
+                                                     std::forward<Args>(args)...))>
+        {
+            using error_t = decltype(
+                detail::map_invoke(std::forward<Func>(f), error(), std::forward<Args>(args)...));
+            if (has_value())
+                return value();
+            else
+                return type_safe::error<error_t>(detail::map_invoke(std::forward<Func>(f), error(),
+                                                                    std::forward<Args>(args)...));
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group map_error
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto map_error(Func&& f, Args&&... args) && -> result<
+            T, decltype(detail::map_invoke(std::forward<Func>(f), std::move(*this).error(),
+                                           std::forward<Args>(args)...))>
+        {
+            using error_t = decltype(detail::map_invoke(std::forward<Func>(f),
+                                                        std::move(*this).error(),
+                                                        std::forward<Args>(args)...));
+            if (has_value())
+                return std::move(*this).value();
+            else
+                return type_safe::error<error_t>(
+                    detail::map_invoke(std::forward<Func>(f), std::move(*this).error(),
+                                       std::forward<Args>(args)...));
+        }
+
+        /// \group map_error
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto map_error(Func&& f, Args&&... args) const && -> result<
+            T, decltype(detail::map_invoke(std::forward<Func>(f), std::move(*this).error(),
+                                           std::forward<Args>(args)...))>
+        {
+            using error_t = decltype(detail::map_invoke(std::forward<Func>(f),
+                                                        std::move(*this).error(),
+                                                        std::forward<Args>(args)...));
+            if (has_value())
+                return std::move(*this).value();
+            else
+                return type_safe::error<error_t>(
+                    detail::map_invoke(std::forward<Func>(f), std::move(*this).error(),
+                                       std::forward<Args>(args)...));
+        }
+#endif
+
+        /// Maps a result with a function returning a result.
+        /// \effects If it contains a value,
+        /// calls the function with the (`const`) lvalue or rvalue value followed by the additional arguments perfectly forwarded.
+        /// \returns The result of the function if it was called,
+        /// otherwise a result of the same type with a copy (1, 2)/move (3, 4) of the error.
+        /// \requires `f` must either be a function or function object of matching signature,
+        /// or a member function pointer of the stored type with compatible signature,
+        /// returning a [ts::result]() whose error type can be constructed from `E`.
+        /// \notes Unlike `map()`, it does not create a nested result,
+        /// but returns the result of the function directly.
+        /// \group and_then
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto and_then(Func&& f, Args&&... args) TYPE_SAFE_LVALUE_REF
+            -> decltype(detail::map_invoke(std::forward<Func>(f), this->value(),
+                                           std::forward<Args>(args)...))
+        {
+            using return_type = decltype(
+                detail::map_invoke(std::forward<Func>(f), value(), std::forward<Args>(args)...));
+            static_assert(detail::is_result<return_type>::value, "function must return a result");
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), value(),
+                                          std::forward<Args>(args)...);
+            else
+                return type_safe::error<detail::result_error_type<return_type>>(error());
+        }
+
+        /// \group and_then
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto and_then(Func&& f, Args&&... args) const TYPE_SAFE_LVALUE_REF
+            -> decltype(detail::map_invoke(std::forward<Func>(f), this->value(),
+                                           std::forward<Args>(args)...))
+        {
+            using return_type = decltype(
+                detail::map_invoke(std::forward<Func>(f), value(), std::forward<Args>(args)...));
+            static_assert(detail::is_result<return_type>::value, "function must return a result");
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), value(),
+                                          std::forward<Args>(args)...);
+            else
+                return type_safe::error<detail::result_error_type<return_type>>(error());
+        }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+        /// \group and_then
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto and_then(Func&& f, Args&&... args) && -> decltype(
+            detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                               std::forward<Args>(args)...))
+        {
+            using return_type = decltype(detail::map_invoke(std::forward<Func>(f),
+                                                            std::move(*this).value(),
+                                                            std::forward<Args>(args)...));
+            static_assert(detail::is_result<return_type>::value, "function must return a result");
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                                          std::forward<Args>(args)...);
+            else
+                return type_safe::error<detail::result_error_type<return_type>>(
+                    std::move(*this).error());
+        }
+
+        /// \group and_then
+        /// \exclude return
+        template <typename Func, typename... Args>
+        auto and_then(Func&& f, Args&&... args) const && -> decltype(
+            detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                               std::forward<Args>(args)...))
+        {
+            using return_type = decltype(detail::map_invoke(std::forward<Func>(f),
+                                                            std::move(*this).value(),
+                                                            std::forward<Args>(args)...));
+            static_assert(detail::is_result<return_type>::value, "function must return a result");
+            if (has_value())
+                return detail::map_invoke(std::forward<Func>(f), std::move(*this).value(),
+                                          std::forward<Args>(args)...);
+            else
+                return type_safe::error<detail::result_error_type<return_type>>(
+                    std::move(*this).error());
+        }
+#endif
+
+    private:
+        storage_t storage_;
+    };
+
+    /// Compares two [ts::result]() objects.
+    /// \returns `true` if both contain a value and the values are equal,
+    /// or both contain an error and the errors are equal,
+    /// `false` otherwise.
+    /// \group result_equal
+    /// \module variant
+    template <typename T, typename E>
+    bool operator==(const result<T, E>& lhs, const result<T, E>& rhs)
+    {
+        if (lhs.has_value() != rhs.has_value())
+            return false;
+        return lhs.has_value() ? lhs.value() == rhs.value() : lhs.error() == rhs.error();
+    }
+
+    /// \group result_equal
+    template <typename T, typename E>
+    bool operator!=(const result<T, E>& lhs, const result<T, E>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    /// \exclude
+    namespace detail
+    {
+        template <class Result>
+        error<result_error_type<Result>> propagate_error(Result&& r)
+        {
+            return error<result_error_type<Result>>(std::forward<Result>(r).error());
+        }
+    } // namespace detail
+
+#if TYPE_SAFE_USE_COROUTINES
+    /// \exclude
+    namespace detail
+    {
+        // the ramp function of a coroutine returning a result converts this object
+        // to the result when it returns, i.e. after the body has finished,
+        // as the body never suspends without finishing
+        template <typename T, typename E>
+        class result_return_object
+        {
+        public:
+            explicit result_return_object(result_promise<T, E>& promise) noexcept
+            {
+                promise.storage_ = &storage_;
+            }
+
+            result_return_object(const result_return_object&) = delete;
+            result_return_object& operator=(const result_return_object&) = delete;
+
+            operator result<T, E>()
+            {
+                return std::move(storage_.value());
+            }
+
+        private:
+            deferred_construction<result<T, E>> storage_;
+        };
+
+        template <typename T, typename E>
+        class result_promise
+        {
+        public:
+            result_return_object<T, E> get_return_object() noexcept
+            {
+                return result_return_object<T, E>(*this);
+            }
+
+            std::suspend_never initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            template <typename U>
+            void return_value(U&& value)
+            {
+                storage_->emplace(std::forward<U>(value));
+            }
+
+            void unhandled_exception()
+            {
+                TYPE_SAFE_RETHROW;
+            }
+
+        private:
+            deferred_construction<result<T, E>>* storage_ = nullptr;
+
+            friend result_return_object<T, E>;
+
+            template <class Result>
+            friend class result_awaiter;
+        };
+
+        template <class Result>
+        class result_awaiter
+        {
+        public:
+            explicit result_awaiter(Result&& r) noexcept : result_(std::forward<Result>(r))
+            {
+            }
+
+            bool await_ready() const noexcept
+            {
+                return result_.has_value();
+            }
+
+            // propagates the error and ends the coroutine
+            template <typename U, typename G>
+            void await_suspend(std::coroutine_handle<result_promise<U, G>> handle)
+            {
+                handle.promise().storage_->emplace(
+                    propagate_error(std::forward<Result>(result_)));
+                handle.destroy();
+            }
+
+            auto await_resume() -> decltype(std::declval<Result&&>().value())
+            {
+                return std::forward<Result>(result_).value();
+            }
+
+        private:
+            Result&& result_;
+        };
+    } // namespace detail
+
+    /// \returns An awaitable that propagates the error of the result.
+    /// \effects `co_await r` inside of a function returning a [ts::result]()
+    /// evaluates to the value of `r` if it contains a value.
+    /// Otherwise, the function returns immediately with the error of `r`,
+    /// without resuming the coroutine.
+    /// The functions are coroutines that don't suspend
+    /// and their frame can usually be allocated on the stack of the caller,
+    /// so it is similar to [TYPE_SAFE_TRY_RESULT]().
+    /// \requires The coroutine must return a [ts::result]() with an error type
+    /// that can be constructed from `E`,
+    /// and the compiler must convert the return object when the coroutine returns,
+    /// like GCC, MSVC and Clang 16 or later.
+    /// \group result_co_await
+    /// \module variant
+    template <typename T, typename E>
+    detail::result_awaiter<const result<T, E>&> operator co_await(const result<T, E>& r) noexcept
+    {
+        return detail::result_awaiter<const result<T, E>&>(r);
+    }
+
+    /// \group result_co_await
+    template <typename T, typename E>
+    detail::result_awaiter<result<T, E>&&> operator co_await(result<T, E>&& r) noexcept
+    {
+        return detail::result_awaiter<result<T, E>&&>(std::move(r));
+    }
+#endif
+} // namespace type_safe
+
+/// \exclude
+#define TYPE_SAFE_DETAIL_RESULT_CAT2(A, B) A##B
+/// \exclude
+#define TYPE_SAFE_DETAIL_RESULT_CAT(A, B) TYPE_SAFE_DETAIL_RESULT_CAT2(A, B)
+
+/// \exclude
+#define TYPE_SAFE_DETAIL_TRY_RESULT(Tmp, Decl, Expr)                                               \
+    auto&& Tmp = Expr;                                                                             \
+    if (!Tmp.has_value())                                                                          \
+        return type_safe::detail::propagate_error(std::forward<decltype(Tmp)>(Tmp));               \
+    Decl = std::forward<decltype(Tmp)>(Tmp).value()
+
+/// Propagates the error of a [ts::result]() to the caller.
+///
+/// It can be used in a function returning a [ts::result]()
+/// with an error type that can be constructed from the error type of `Expr`.
+/// \effects Evaluates `Expr`, which must return a [ts::result]().
+/// If it contains an error, returns the error from the current function.
+/// Otherwise initializes `Decl` with the value, e.g. `TYPE_SAFE_TRY_RESULT(auto x, parse(str));`.
+/// The check is a single comparison of the tag and the error is moved if `Expr` is an rvalue.
+/// \notes It expands to multiple statements,
+/// so it can't be used as the body of an `if` without braces.
+/// \module variant
+#define TYPE_SAFE_TRY_RESULT(Decl, Expr)                                                           \
+    TYPE_SAFE_DETAIL_TRY_RESULT(TYPE_SAFE_DETAIL_RESULT_CAT(type_safe_try_result_, __LINE__),     \
+                                Decl, Expr)
+
+#endif // TYPE_SAFE_RESULT_HPP_INCLUDED
@@ -0,0 +1,295 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_SLOT_MAP_HPP_INCLUDED
+#define TYPE_SAFE_SLOT_MAP_HPP_INCLUDED
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/config.hpp>
+#include <type_safe/index.hpp>
+#include <type_safe/optional_ref.hpp>
+#include <type_safe/strong_typedef.hpp>
+
+namespace type_safe
+{
+    template <typename T, class Tag>
+    class slot_map;
+
+    /// A handle to an element of a [ts::slot_map]().
+    ///
+    /// It is a [ts::strong_typedef]() of a 64bit integer,
+    /// storing the index of the slot in the lower and its generation in the upper 32bit.
+    /// The generation changes whenever the element of the slot is erased,
+    /// so a handle to an erased element is detected as stale,
+    /// even if the slot has been reused.
+    /// The `Tag` is used to differentiate between handles of different maps.
+    template <class Tag>
+    class slot_handle : public strong_typedef<slot_handle<Tag>, std::uint64_t>,
+                        public strong_typedef_op::equality_comparison<slot_handle<Tag>>
+    {
+    public:
+        /// \effects Creates a handle that does not refer to any element.
+        constexpr slot_handle() noexcept : strong_typedef<slot_handle, std::uint64_t>(0u)
+        {
+        }
+
+        /// \returns The index of the slot it refers to.
+        index_t index() const noexcept
+        {
+            return index_t(static_cast<std::size_t>(get(*this) & 0xFFFFFFFFu));
+        }
+
+        /// \returns The generation of the slot it refers to.
+        std::uint32_t generation() const noexcept
+        {
+            return static_cast<std::uint32_t>(get(*this) >> 32u);
+        }
+
+    private:
+        constexpr slot_handle(std::uint32_t index, std::uint32_t generation) noexcept
+        : strong_typedef<slot_handle, std::uint64_t>((std::uint64_t(generation) << 32u) | index)
+        {
+        }
+
+        template <typename, class>
+        friend class slot_map;
+    };
+
+    /// A container giving out stable handles to its elements.
+    ///
+    /// Inserting an element returns a [ts::slot_handle](),
+    /// which can be used to access the element until it is erased.
+    /// Unlike pointers or indices, the handle stays valid when other elements are inserted or erased,
+    /// and a handle to an erased element is detected.
+    /// Insertion, erasure and lookup are all `O(1)`.
+    ///
+    /// The elements are stored densely in a contiguous array,
+    /// so iteration is as fast as iterating over a [std::vector]().
+    /// Erasing an element moves the last element into its place,
+    /// so the order of elements is unspecified.
+    /// The handle refers to a slot in a separate array,
+    /// which stores the index into the dense array.
+    /// \requires `T` must be move constructible and move assignable.
+    template <typename T, class Tag = T>
+    class slot_map
+    {
+        // the generation of a slot is odd if it stores an element
+        struct slot
+        {
+            // index into the dense array if occupied, next free slot otherwise
+            std::uint32_t index;
+            std::uint32_t generation;
+        };
+
+        static constexpr std::uint32_t no_slot = 0xFFFFFFFFu;
+
+    public:
+        using value_type     = T;
+        using handle         = slot_handle<Tag>;
+        using iterator       = T*;
+        using const_iterator = const T*;
+
+        /// \effects Creates an empty map.
+        slot_map() noexcept : free_head_(no_slot)
+        {
+        }
+
+        //=== capacity ===//
+        /// \returns The number of elements.
+        std::size_t size() const noexcept
+        {
+            return values_.size();
+        }
+
+        /// \returns Whether or not there are any elements.
+        bool empty() const noexcept
+        {
+            return values_.empty();
+        }
+
+        /// \effects Reserves memory for `size` elements.
+        void reserve(std::size_t size)
+        {
+            values_.reserve(size);
+            slot_of_.reserve(size);
+            slots_.reserve(size);
+        }
+
+        //=== modifiers ===//
+        /// \effects Creates a new element by forwarding the arguments.
+        /// \returns A handle to the new element.
+        /// \throws Anything thrown by the constructor of `T` or allocation failure,
+        /// in which case the map is not modified.
+        template <typename... Args>
+        handle emplace(Args&&... args)
+        {
+            if (free_head_ == no_slot)
+            {
+                TYPE_SAFE_PRECONDITION(slots_.size() < no_slot, "too many elements in slot_map");
+                // new slot is free, so nothing needs to be undone if anything below throws
+                slots_.push_back(slot{no_slot, 0u});
+                free_head_ = static_cast<std::uint32_t>(slots_.size() - 1u);
+            }
+
+            slot_of_.push_back(free_head_);
+            TYPE_SAFE_TRY
+            {
+                values_.emplace_back(std::forward<Args>(args)...);
+            }
+            TYPE_SAFE_CATCH_ALL
+            {
+                slot_of_.pop_back();
+                TYPE_SAFE_RETHROW;
+            }
+
+            auto slot_index = free_head_;
+            free_head_      = slots_[slot_index].index;
+
+            auto& s = slots_[slot_index];
+            s.index = static_cast<std::uint32_t>(values_.size() - 1u);
+            ++s.generation;
+            return handle(slot_index, s.generation);
+        }
+
+        /// \effects Inserts a copy (1)/the moved (2) value.
+        /// \returns A handle to the new element.
+        /// \group insert
+        handle insert(const T& value)
+        {
+            return emplace(value);
+        }
+
+        /// \group insert
+        handle insert(T&& value)
+        {
+            return emplace(std::move(value));
+        }
+
+        /// \effects Erases the element referred to by the handle, if there is one.
+        /// The last element will be moved into its place.
+        /// \returns `true` if an element was erased, `false` if the handle was stale.
+        bool erase(const handle& h)
+        {
+            auto s = get_slot(h);
+            if (!s)
+                return false;
+
+            auto index = s->index;
+            if (index + 1u != values_.size())
+            {
+                values_[index]                = std::move(values_.back());
+                slot_of_[index]               = slot_of_.back();
+                slots_[slot_of_[index]].index = index;
+            }
+            values_.pop_back();
+            slot_of_.pop_back();
+
+            ++s->generation;
+            s->index   = free_head_;
+            free_head_ = static_cast<std::uint32_t>(s - slots_.data());
+            return true;
+        }
+
+        /// \effects Erases all elements.
+        /// All existing handles will be stale afterwards.
+        void clear() noexcept
+        {
+            for (auto index : slot_of_)
+            {
+                ++slots_[index].generation;
+                slots_[index].index = free_head_;
+                free_head_          = index;
+            }
+            values_.clear();
+            slot_of_.clear();
+        }
+
+        //=== lookup ===//
+        /// \returns A (`const`) [ts::optional_ref]() to the element referred to by the handle,
+        /// or a null reference if the handle is stale.
+        /// \group lookup
+        optional_ref<T> lookup(const handle& h) noexcept
+        {
+            auto s = get_slot(h);
+            return type_safe::opt_ref(s ? &values_[s->index] : nullptr);
+        }
+
+        /// \group lookup
+        optional_ref<const T> lookup(const handle& h) const noexcept
+        {
+            auto s = get_slot(h);
+            return type_safe::opt_ref(s ? &values_[s->index] : nullptr);
+        }
+
+        /// \returns Whether or not the handle refers to an element.
+        bool contains(const handle& h) const noexcept
+        {
+            return get_slot(h) != nullptr;
+        }
+
+        /// \returns The handle of the element at the given index of the dense array.
+        /// \requires `i < size()`.
+        handle handle_at(index_t i) const noexcept
+        {
+            auto slot_index = at(slot_of_, i);
+            return handle(slot_index, slots_[slot_index].generation);
+        }
+
+        //=== iteration ===//
+        /// \returns An iterator to the beginning/end of the dense array of elements.
+        /// \group begin
+        iterator begin() noexcept
+        {
+            return values_.data();
+        }
+
+        /// \group begin
+        const_iterator begin() const noexcept
+        {
+            return values_.data();
+        }
+
+        /// \group end
+        iterator end() noexcept
+        {
+            return values_.data() + values_.size();
+        }
+
+        /// \group end
+        const_iterator end() const noexcept
+        {
+            return values_.data() + values_.size();
+        }
+
+    private:
+        slot* get_slot(const handle& h) noexcept
+        {
+            auto index = static_cast<std::size_t>(get(h) & 0xFFFFFFFFu);
+            if (index >= slots_.size() || slots_[index].generation != h.generation()
+                || (h.generation() & 1u) == 0u)
+                return nullptr;
+            return &slots_[index];
+        }
+
+        const slot* get_slot(const handle& h) const noexcept
+        {
+            return const_cast<slot_map&>(*this).get_slot(h);
+        }
+
+        std::vector<T>             values_;
+        std::vector<std::uint32_t> slot_of_; // slot of each element in values_
+        std::vector<slot>          slots_;
+        std::uint32_t              free_head_;
+    };
+
+    template <typename T, class Tag>
+    constexpr std::uint32_t slot_map<T, Tag>::no_slot;
+} // namespace type_safe
+
+#endif // TYPE_SAFE_SLOT_MAP_HPP_INCLUDED
@@ -5,6 +5,9 @@
 #ifndef TYPE_SAFE_STRONG_TYPEDEF_HPP_INCLUDED
 #define TYPE_SAFE_STRONG_TYPEDEF_HPP_INCLUDED
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iosfwd>
 #include <iterator>
 #include <type_traits>
@@ -143,6 +146,84 @@ namespace type_safe
         return static_cast<const T&&>(static_cast<const T&>(type));
     }
 
+    /// Inherit from it in the `std::hash` specialization of a [ts::strong_typedef]()
+    /// to make it hashable like the underlying type.
+    ///
+    /// Example:
+    /// ```cpp
+    /// namespace std
+    /// {
+    ///     template <>
+    ///     struct hash<my_handle> : type_safe::hashable<my_handle>
+    ///     {
+    ///     };
+    /// }
+    /// ```
+    template <class StrongTypedef>
+    struct hashable : std::hash<underlying_type<StrongTypedef>>
+    {
+        using underlying_type = type_safe::underlying_type<StrongTypedef>;
+        using underlying_hash = std::hash<underlying_type>;
+
+        std::size_t operator()(const StrongTypedef& value) const
+            noexcept(noexcept(underlying_hash{}(std::declval<const underlying_type&>())))
+        {
+            return underlying_hash::operator()(static_cast<const underlying_type&>(value));
+        }
+    };
+
+    /// \exclude
+    namespace detail
+    {
+        constexpr std::uint64_t hash_mix_shift(std::uint64_t value) noexcept
+        {
+            return value ^ (value >> 33u);
+        }
+
+        // finalizer of MurmurHash3
+        constexpr std::uint64_t hash_mix(std::uint64_t value) noexcept
+        {
+            return hash_mix_shift(hash_mix_shift(hash_mix_shift(value) * 0xff51afd7ed558ccdu)
+                                  * 0xc4ceb9fe1a85ec53u);
+        }
+
+        // a ts::integer only converts to its integer type
+        template <typename T>
+        constexpr auto hash_key(const T& value, int) noexcept
+            -> decltype(static_cast<std::uint64_t>(static_cast<typename T::integer_type>(value)))
+        {
+            return static_cast<std::uint64_t>(static_cast<typename T::integer_type>(value));
+        }
+
+        template <typename T>
+        constexpr std::uint64_t hash_key(const T& value, short) noexcept
+        {
+            return static_cast<std::uint64_t>(value);
+        }
+    } // namespace detail
+
+    /// Inherit from it in the `std::hash` specialization of a [ts::strong_typedef]()
+    /// whose underlying type is an integer to get a well-distributed hash.
+    ///
+    /// Unlike [ts::hashable](),
+    /// which usually returns the integer itself,
+    /// it mixes all bits of the value using the finalizer of MurmurHash3.
+    /// Use it for sequential ids stored in hash tables with open addressing,
+    /// which otherwise suffer from clustering.
+    /// \requires The underlying type must be explicitly convertible to `std::uint64_t`,
+    /// i.e. a built-in integer, an enumeration or a [ts::integer]().
+    template <class StrongTypedef>
+    struct fast_hashable
+    {
+        using underlying_type = type_safe::underlying_type<StrongTypedef>;
+
+        constexpr std::size_t operator()(const StrongTypedef& value) const noexcept
+        {
+            return static_cast<std::size_t>(
+                detail::hash_mix(detail::hash_key(static_cast<const underlying_type&>(value), 0)));
+        }
+    };
+
     /// Some operations for [ts::strong_typedef]().
     ///
     /// They all generate operators forwarding to the underlying type,
@@ -162,6 +243,11 @@ namespace type_safe
             using enable_if_convertible_same = typename std::
                 enable_if<std::is_convertible<typename std::decay<From>::type, To>::value>::type;
 
+            // the result of a comparison of vector types, a vector of booleans or integers
+            template <class StrongTypedef>
+            using simd_mask = decltype(std::declval<const underlying_type<StrongTypedef>&>()
+                                       == std::declval<const underlying_type<StrongTypedef>&>());
+
             template <class StrongTypedef>
             constexpr const underlying_type<StrongTypedef>& get_underlying(
                 const StrongTypedef& type)
@@ -473,6 +559,48 @@ namespace type_safe
         {
         };
 
+        /// Arithmetic for a vector type like GCC's vector extensions or `std::experimental::simd`,
+        /// the operations are done for each element.
+        /// Use e.g. [ts::strong_typedef_op::mixed_multiplication]() to combine it with a scalar.
+        template <class StrongTypedef>
+        struct simd_arithmetic : unary_plus<StrongTypedef>,
+                                 unary_minus<StrongTypedef>,
+                                 addition<StrongTypedef>,
+                                 subtraction<StrongTypedef>,
+                                 multiplication<StrongTypedef>,
+                                 division<StrongTypedef>
+        {
+        };
+
+        /// Comparison for a vector type like GCC's vector extensions or `std::experimental::simd`.
+        /// Unlike [ts::strong_typedef_op::equality_comparison]() and
+        /// [ts::strong_typedef_op::relational_comparison]()
+        /// the operators don't return `bool`, but the mask the comparison of the vectors returns,
+        /// i.e. the result of the comparison for each element.
+        template <class StrongTypedef>
+        struct simd_comparison
+        {
+        };
+        TYPE_SAFE_DETAIL_MAKE_OP(==, simd_comparison, detail::simd_mask<StrongTypedef>)
+        TYPE_SAFE_DETAIL_MAKE_OP(!=, simd_comparison, detail::simd_mask<StrongTypedef>)
+        TYPE_SAFE_DETAIL_MAKE_OP(<, simd_comparison, detail::simd_mask<StrongTypedef>)
+        TYPE_SAFE_DETAIL_MAKE_OP(<=, simd_comparison, detail::simd_mask<StrongTypedef>)
+        TYPE_SAFE_DETAIL_MAKE_OP(>, simd_comparison, detail::simd_mask<StrongTypedef>)
+        TYPE_SAFE_DETAIL_MAKE_OP(>=, simd_comparison, detail::simd_mask<StrongTypedef>)
+
+        /// Same as [ts::strong_typedef_op::simd_comparison](),
+        /// but compares with `Other`, e.g. a scalar that is compared with all elements.
+        template <class StrongTypedef, typename Other>
+        struct mixed_simd_comparison
+        {
+        };
+        TYPE_SAFE_DETAIL_MAKE_OP_MIXED(==, mixed_simd_comparison, detail::simd_mask<StrongTypedef>)
+        TYPE_SAFE_DETAIL_MAKE_OP_MIXED(!=, mixed_simd_comparison, detail::simd_mask<StrongTypedef>)
+        TYPE_SAFE_DETAIL_MAKE_OP_MIXED(<, mixed_simd_comparison, detail::simd_mask<StrongTypedef>)
+        TYPE_SAFE_DETAIL_MAKE_OP_MIXED(<=, mixed_simd_comparison, detail::simd_mask<StrongTypedef>)
+        TYPE_SAFE_DETAIL_MAKE_OP_MIXED(>, mixed_simd_comparison, detail::simd_mask<StrongTypedef>)
+        TYPE_SAFE_DETAIL_MAKE_OP_MIXED(>=, mixed_simd_comparison, detail::simd_mask<StrongTypedef>)
+
         template <class StrongTypedef>
         struct complement
         {
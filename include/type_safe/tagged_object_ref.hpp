@@ -0,0 +1,307 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_TAGGED_OBJECT_REF_HPP_INCLUDED
+#define TYPE_SAFE_TAGGED_OBJECT_REF_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <type_safe/compact_optional.hpp>
+#include <type_safe/flag_set.hpp>
+#include <type_safe/reference.hpp>
+#include <type_safe/relocation.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        // number of low bits that are zero in every address with the given alignment
+        constexpr std::size_t alignment_bits(std::size_t alignment) noexcept
+        {
+            return alignment <= 1u ? 0u : 1u + alignment_bits(alignment / 2u);
+        }
+    } // namespace detail
+
+    template <typename T, typename Enum>
+    class compact_tagged_object_ref_policy;
+
+    /// A [ts::object_ref]() to an object of type `T` combined with a [ts::flag_set]() of `Enum`.
+    ///
+    /// The flags are stored in the low bits of the address,
+    /// which are always zero due to the alignment of `T`,
+    /// so it has the size of a pointer,
+    /// instead of a pointer and a separate [ts::flag_set]().
+    /// It provides the interface of [ts::object_ref]() to access the object,
+    /// and the flag operations of [ts::flag_set]() to access the flags.
+    /// \requires `Enum` must be a flag, i.e. valid with the [ts::flag_set_traits](),
+    /// and the number of flags must be at most the binary logarithm of `alignof(T)`.
+    /// \notes `T` is the type without the reference, ie. `tagged_object_ref<int, Enum>`.
+    /// \module types
+    template <typename T, typename Enum>
+    class tagged_object_ref
+    {
+        static_assert(!std::is_void<T>::value, "must not be void");
+        static_assert(!std::is_reference<T>::value, "pass the type without reference");
+        static_assert(flag_set_traits<Enum>::value, "invalid enum for flag_set");
+        static_assert(flag_set_traits<Enum>::size() <= detail::alignment_bits(alignof(T)),
+                      "alignment of T is too small to store all flags");
+
+        using flags_int = typename detail::flag_set_impl<Enum>::int_type;
+
+        static constexpr std::uintptr_t flags_mask =
+            (std::uintptr_t(1u) << flag_set_traits<Enum>::size()) - 1u;
+
+    public:
+        using value_type     = T;
+        using reference_type = T&;
+
+        /// \effects Binds the reference to the given object and sets the given flags.
+        /// \notes These constructors will only participate in overload resolution
+        /// if `U` is a compatible type (i.e. non-const variant or derived type).
+        /// \group ctor
+        /// \param 2
+        /// \exclude
+        template <typename U, typename = decltype(std::declval<T*&>() = std::declval<U*>())>
+        explicit tagged_object_ref(U& obj, const flag_set<Enum>& flags = noflag) noexcept
+        : bits_(to_bits(&obj, flags))
+        {
+        }
+
+        /// \group ctor
+        /// \param 2
+        /// \exclude
+        template <typename U, typename = decltype(std::declval<T*&>() = std::declval<U*>())>
+        explicit tagged_object_ref(const object_ref<U>& obj,
+                                   const flag_set<Enum>& flags = noflag) noexcept
+        : bits_(to_bits(obj.operator->(), flags))
+        {
+        }
+
+        /// \effects Rebinds the reference to the given object,
+        /// the flags are not changed.
+        /// \notes This function will only participate in overload resolution
+        /// if `U` is a compatible type (i.e. non-const variant or derived type).
+        /// \param 1
+        /// \exclude
+        template <typename U, typename = decltype(std::declval<T*&>() = std::declval<U*>())>
+        tagged_object_ref& operator=(const object_ref<U>& obj) noexcept
+        {
+            bits_ = to_bits(obj.operator->(), flags());
+            return *this;
+        }
+
+        //=== object_ref interface ===//
+        /// \returns A native reference to the referenced object.
+        /// \group deref
+        reference_type get() const noexcept
+        {
+            return **this;
+        }
+
+        /// \group deref
+        reference_type operator*() const noexcept
+        {
+            return *operator->();
+        }
+
+        /// Member access operator.
+        T* operator->() const noexcept
+        {
+            return reinterpret_cast<T*>(bits_ & ~flags_mask);
+        }
+
+        /// \returns A [ts::object_ref]() to the referenced object, without the flags.
+        object_ref<T> ref() const noexcept
+        {
+            return object_ref<T>(get());
+        }
+
+        //=== flag_set interface ===//
+        /// \returns The flags.
+        flag_set<Enum> flags() const noexcept
+        {
+            using combo = detail::flag_combo<Enum>;
+            return flag_set<Enum>(combo::from_int(static_cast<flags_int>(bits_ & flags_mask)));
+        }
+
+        /// \effects Replaces the flags with the given ones,
+        /// the reference is not changed.
+        void set_flags(const flag_set<Enum>& flags) noexcept
+        {
+            bits_ = to_bits(operator->(), flags);
+        }
+
+        /// \effects Sets the specified flag to `1` (1)/`value` (2/3).
+        /// \notes (2) does not participate in overload resolution
+        /// unless `U` is a boolean-like type.
+        /// \group set
+        void set(const Enum& flag) noexcept
+        {
+            modify_flags([&](flag_set<Enum>& current) { current.set(flag); });
+        }
+
+        /// \group set
+        /// \param 1
+        /// \exclude
+        template <typename U, typename = detail::enable_boolean<U>>
+        void set(const Enum& flag, U value) noexcept
+        {
+            modify_flags([&](flag_set<Enum>& current) { current.set(flag, value); });
+        }
+
+        /// \group set
+        void set(const Enum& f, flag value) noexcept
+        {
+            set(f, value == true);
+        }
+
+        /// \effects Sets the specified flag to `0`.
+        void reset(const Enum& flag) noexcept
+        {
+            modify_flags([&](flag_set<Enum>& current) { current.reset(flag); });
+        }
+
+        /// \effects Toggles the specified flag.
+        void toggle(const Enum& flag) noexcept
+        {
+            modify_flags([&](flag_set<Enum>& current) { current.toggle(flag); });
+        }
+
+        /// \effects Sets/resets all flags.
+        /// \group all
+        void set_all() noexcept
+        {
+            bits_ |= flags_mask;
+        }
+
+        /// \group all
+        void reset_all() noexcept
+        {
+            bits_ &= ~flags_mask;
+        }
+
+        /// \returns Whether or not the specified flag is set.
+        bool is_set(const Enum& flag) const noexcept
+        {
+            return flags().is_set(flag);
+        }
+
+        /// \returns Same as `flag(is_set(flag))`.
+        flag as_flag(const Enum& flag) const noexcept
+        {
+            return is_set(flag);
+        }
+
+        /// \returns Whether any/all/none of the flags are set.
+        /// \group any
+        bool any() const noexcept
+        {
+            return (bits_ & flags_mask) != 0u;
+        }
+
+        /// \group any
+        bool all() const noexcept
+        {
+            return (bits_ & flags_mask) == flags_mask;
+        }
+
+        /// \group any
+        bool none() const noexcept
+        {
+            return !any();
+        }
+
+    private:
+        struct invalid_tag
+        {
+        };
+
+        // the null pointer without flags, no object_ref is ever bound to it
+        explicit tagged_object_ref(invalid_tag) noexcept : bits_(0u)
+        {
+        }
+
+        static std::uintptr_t to_bits(T* ptr, const flag_set<Enum>& flags) noexcept
+        {
+            return reinterpret_cast<std::uintptr_t>(ptr)
+                   | static_cast<std::uintptr_t>(flags.template to_int<flags_int>());
+        }
+
+        template <typename Func>
+        void modify_flags(Func f) noexcept
+        {
+            auto flags = this->flags();
+            f(flags);
+            set_flags(flags);
+        }
+
+        std::uintptr_t bits_;
+
+        friend compact_tagged_object_ref_policy<T, Enum>;
+    };
+
+    /// \exclude
+    template <typename T, typename Enum>
+    struct is_trivially_relocatable<tagged_object_ref<T, Enum>> : std::true_type
+    {
+    };
+
+    /// Comparison operator for [ts::tagged_object_ref]().
+    ///
+    /// Two references are equal if both refer to the same object and have the same flags.
+    /// \group tagged_ref_compare Tagged object reference comparison
+    template <typename T, typename Enum>
+    bool operator==(const tagged_object_ref<T, Enum>& a,
+                    const tagged_object_ref<T, Enum>& b) noexcept
+    {
+        return a.operator->() == b.operator->() && a.flags() == b.flags();
+    }
+
+    /// \group tagged_ref_compare
+    template <typename T, typename Enum>
+    bool operator!=(const tagged_object_ref<T, Enum>& a,
+                    const tagged_object_ref<T, Enum>& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    /// A `CompactPolicy` for [ts::compact_optional_storage]() for [ts::tagged_object_ref]().
+    ///
+    /// The null pointer will be used to mark an empty optional,
+    /// so the optional has the size of a pointer as well.
+    /// \module optional
+    template <typename T, typename Enum>
+    class compact_tagged_object_ref_policy
+    {
+    public:
+        using value_type   = tagged_object_ref<T, Enum>;
+        using storage_type = tagged_object_ref<T, Enum>;
+
+        static storage_type invalid_value() noexcept
+        {
+            return storage_type(typename storage_type::invalid_tag{});
+        }
+
+        static bool is_invalid(const storage_type& storage) noexcept
+        {
+            return storage.operator->() == nullptr;
+        }
+    };
+
+    /// Sets the [ts::basic_optional]() storage policy for [ts::tagged_object_ref]()
+    /// to [ts::compact_optional_storage]() with the [ts::compact_tagged_object_ref_policy]().
+    ///
+    /// It will be used when the optional is rebound.
+    /// \module optional
+    template <typename T, typename Enum>
+    struct optional_storage_policy_for<tagged_object_ref<T, Enum>>
+    {
+        using type = compact_optional_storage<compact_tagged_object_ref_policy<T, Enum>>;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_TAGGED_OBJECT_REF_HPP_INCLUDED
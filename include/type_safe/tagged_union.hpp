@@ -5,12 +5,20 @@
 #ifndef TYPE_SAFE_TAGGED_UNION_HPP_INCLUDED
 #define TYPE_SAFE_TAGGED_UNION_HPP_INCLUDED
 
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <new>
 
 #include <type_safe/detail/aligned_union.hpp>
 #include <type_safe/detail/all_of.hpp>
 #include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/copy_move_control.hpp>
+#include <type_safe/detail/type_list.hpp>
+#include <type_safe/detail/variant_jump.hpp>
 #include <type_safe/config.hpp>
+#include <type_safe/relocation.hpp>
 #include <type_safe/strong_typedef.hpp>
 
 namespace type_safe
@@ -25,33 +33,77 @@ namespace type_safe
             using strong_typedef<union_type_id, std::size_t>::strong_typedef;
         };
 
-        //=== get_type_index ==//
-        template <typename T, typename... Ts>
-        struct get_type_index_impl;
-
-        // type not found at all
-        template <typename T>
-        struct get_type_index_impl<T> : std::integral_constant<std::size_t, 0>
+        // smallest unsigned integer type that can store all type ids
+        template <std::size_t MaxId>
+        using select_union_type_id_int = typename std::conditional<
+            MaxId <= UINT_LEAST8_MAX, std::uint_least8_t,
+            typename std::conditional<MaxId <= UINT_LEAST16_MAX, std::uint_least16_t,
+                                      std::uint_least32_t>::type>::type;
+
+        template <typename... Types>
+        using union_trivial = all_of<is_trivially_copyable<Types>::value...>;
+
+        // a union can only be used if it doesn't change the layout,
+        // i.e. if there is no padding after the biggest type the tag could use
+        template <typename... Types>
+        using union_constexpr =
+            all_of<union_trivial<Types...>::value,
+                   aligned_union<Types...>::size_value % aligned_union<Types...>::alignment_value
+                       == 0u>;
+
+        // storage with a member for each type, so it can be used in constant expressions
+        template <typename... Types>
+        union constexpr_union;
+
+        template <>
+        union constexpr_union<>
         {
         };
 
-        // found type at the beginning
-        template <typename T, typename... Tail>
-        struct get_type_index_impl<T, T, Tail...> : std::integral_constant<std::size_t, 1>
+        template <typename Head, typename... Tail>
+        union constexpr_union<Head, Tail...>
         {
+            constexpr constexpr_union() noexcept : empty()
+            {
+            }
+
+            template <typename... Args>
+            constexpr constexpr_union(std::integral_constant<std::size_t, 0u>, Args&&... args)
+            : head(std::forward<Args>(args)...)
+            {
+            }
+
+            template <std::size_t I, typename... Args>
+            constexpr constexpr_union(std::integral_constant<std::size_t, I>, Args&&... args)
+            : tail(std::integral_constant<std::size_t, I - 1u>{}, std::forward<Args>(args)...)
+            {
+            }
+
+            char                     empty;
+            Head                     head;
+            constexpr_union<Tail...> tail;
         };
 
-        // type not in the beginning
-        template <typename T, typename Head, typename... Tail>
-        struct get_type_index_impl<T, Head, Tail...>
-            : std::integral_constant<std::size_t, get_type_index_impl<T, Tail...>::value == 0u ?
-                                                      0u :
-                                                      1 + get_type_index_impl<T, Tail...>::value>
+        template <std::size_t I>
+        struct constexpr_union_access
         {
+            template <class Union>
+            static constexpr auto get(Union& u) noexcept
+                -> decltype(constexpr_union_access<I - 1u>::get(u.tail))
+            {
+                return constexpr_union_access<I - 1u>::get(u.tail);
+            }
         };
 
-        template <typename T, typename... Types>
-        using get_type_index = get_type_index_impl<T, typename std::decay<Types>::type...>;
+        template <>
+        struct constexpr_union_access<0u>
+        {
+            template <class Union>
+            static constexpr auto get(Union& u) noexcept -> decltype((u.head))
+            {
+                return u.head;
+            }
+        };
 
         template <class Union>
         struct destroy_union;
@@ -84,17 +136,21 @@ namespace type_safe
     /// but remembers which type it currently stores.
     /// It can either store one of the given types or no type at all.
     /// \notes Like the C `union` it does not automatically destroy the currently stored type,
-    /// and copy operations are deleted.
+    /// and copy operations are deleted,
+    /// unless all types are trivially copyable, then it is trivially copyable as well.
+    /// \notes The tag is the smallest unsigned integer type that can represent all types,
+    /// and it is placed directly after the bytes of the biggest type,
+    /// so it may share the space that would otherwise be padding required for the alignment.
+    /// \notes If all types are trivially copyable and there is no such padding,
+    /// the types are stored in a `union` instead of raw bytes, with the same layout.
+    /// Then it can be used in constant expressions:
+    /// the default and type + argument constructors and the `const` accessors are `constexpr`.
     /// \module variant
     template <typename... Types>
-    class tagged_union
+    class tagged_union : detail::copy_control<detail::union_trivial<Types...>::value>,
+                         detail::move_control<detail::union_trivial<Types...>::value>
     {
-#if !defined(__clang__) && defined(__GNUC__) && __GNUC__ < 5
-        // does not have is_trivially_copyable
-        using trivial = detail::all_of<std::is_trivial<Types>::value...>;
-#else
-        using trivial = detail::all_of<std::is_trivially_copyable<Types>::value...>;
-#endif
+        using trivial = detail::union_trivial<Types...>;
 
         template <class Union>
         friend struct detail::destroy_union;
@@ -103,14 +159,17 @@ namespace type_safe
         template <class Union>
         friend struct detail::move_union;
 
+        using id_int = detail::select_union_type_id_int<sizeof...(Types)>;
+
     public:
         using types = union_types<typename std::decay<Types>::type...>;
 
         /// The id of a type.
         ///
-        /// It is a [ts::strong_typedef]() for `std::size_t`
+        /// It is a [ts::strong_typedef]() for the smallest unsigned integer type
+        /// that can represent the number of types plus one,
         /// and provides equality and relational comparison.
-        class type_id : public strong_typedef<type_id, std::size_t>,
+        class type_id : public strong_typedef<type_id, id_int>,
                         public strong_typedef_op::equality_comparison<type_id>,
                         public strong_typedef_op::relational_comparison<type_id>
         {
@@ -124,7 +183,7 @@ namespace type_safe
 
             /// \effects Initializes it to an invalid value.
             /// \notes The invalid value compares less than all valid values.
-            constexpr type_id() noexcept : strong_typedef<type_id, std::size_t>(0u)
+            constexpr type_id() noexcept : strong_typedef<type_id, id_int>(id_int(0u))
             {
             }
 
@@ -144,9 +203,25 @@ namespace type_safe
                 return *this != type_id();
             }
 
+            /// \returns The numerical value of the id.
+            /// It is `0` for the invalid id and `i` for the `i`th type.
+            explicit constexpr operator std::size_t() const noexcept
+            {
+                return static_cast<std::size_t>(get(*this));
+            }
+
+            /// A hash function for the id, to use it as key of unordered containers.
+            struct hash
+            {
+                std::size_t operator()(const type_id& id) const noexcept
+                {
+                    return static_cast<std::size_t>(id);
+                }
+            };
+
         private:
             explicit constexpr type_id(std::size_t value)
-            : strong_typedef<type_id, std::size_t>(value)
+            : strong_typedef<type_id, id_int>(static_cast<id_int>(value))
             {
             }
         };
@@ -157,12 +232,19 @@ namespace type_safe
         //=== constructors/destructors/assignment ===//
         tagged_union() noexcept = default;
 
+        /// \effects Creates an object of given type by perfectly forwarding `args`,
+        /// like [*emplace()]() on an empty union.
+        /// \throws Anything thrown by `T`s constructor.
+        /// \requires `T` must be a valid type and constructible from the arguments.
+        template <typename T, typename... Args>
+        constexpr tagged_union(union_type<T> type, Args&&... args)
+        : tagged_union(constexpr_storage{}, type, std::forward<Args>(args)...)
+        {
+        }
+
         /// \notes Does not destroy the currently stored type.
         ~tagged_union() noexcept = default;
 
-        tagged_union(const tagged_union&) = delete;
-        tagged_union& operator=(const tagged_union&) = delete;
-
         //=== modifiers ===//
         /// \effects Creates a new object of given type by perfectly forwarding `args`.
         /// \throws Anything thrown by `T`s constructor,
@@ -196,14 +278,14 @@ namespace type_safe
         //=== accessors ===//
         /// \returns The [*type_id]() of the type currently stored,
         /// or [*invalid_type]() if there is none.
-        const type_id& type() const noexcept
+        constexpr const type_id& type() const noexcept
         {
             return cur_type_;
         }
 
         /// \returns `true` if there is a type stored,
         /// `false` otherwise.
-        bool has_value() const noexcept
+        constexpr bool has_value() const noexcept
         {
             return type() != invalid_type;
         }
@@ -212,39 +294,86 @@ namespace type_safe
         /// \requires The union must currently store an object of the given type.
         /// \group value
         template <typename T>
-        T& value(union_type<T> type) TYPE_SAFE_LVALUE_REF noexcept
+        TYPE_SAFE_CONSTEXPR14 T& value(union_type<T> type) TYPE_SAFE_LVALUE_REF noexcept
         {
-            check(type);
-            return *static_cast<T*>(get_memory());
+            return check(type), get_value(type, storage_);
         }
 
         /// \group value
         template <typename T>
-        const T& value(union_type<T> type) const TYPE_SAFE_LVALUE_REF noexcept
+        constexpr const T& value(union_type<T> type) const TYPE_SAFE_LVALUE_REF noexcept
         {
-            check(type);
-            return *static_cast<const T*>(get_memory());
+            return check(type), get_value(type, storage_);
         }
 
 #if TYPE_SAFE_USE_REF_QUALIFIERS
         /// \group value
         template <typename T>
-            T&& value(union_type<T> type) && noexcept
+            TYPE_SAFE_CONSTEXPR14 T&& value(union_type<T> type) && noexcept
         {
-            check(type);
-            return std::move(*static_cast<T*>(get_memory()));
+            return check(type), std::move(get_value(type, storage_));
         }
 
         /// \group value
         template <typename T>
-        const T&& value(union_type<T> type) const && noexcept
+        constexpr const T&& value(union_type<T> type) const && noexcept
         {
-            check(type);
-            return std::move(*static_cast<const T*>(get_memory()));
+            return check(type), std::move(get_value(type, storage_));
         }
 #endif
 
     private:
+        using constexpr_storage = detail::union_constexpr<Types...>;
+
+        template <typename T, typename... Args>
+        constexpr tagged_union(std::true_type, union_type<T> type, Args&&... args)
+        : storage_(std::integral_constant<std::size_t, union_index<T>()>{},
+                   std::forward<Args>(args)...),
+          cur_type_(type)
+        {
+            static_assert(type_id::template is_valid<T>(), "T must not be stored in variant");
+            static_assert(std::is_constructible<T, Args&&...>::value,
+                          "T not constructible from arguments");
+        }
+
+        template <typename T, typename... Args>
+        tagged_union(std::false_type, union_type<T> type, Args&&... args)
+        {
+            emplace(type, std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        static constexpr std::size_t union_index() noexcept
+        {
+            return detail::get_type_index<T, Types...>::value - 1u;
+        }
+
+        template <typename T>
+        static TYPE_SAFE_CONSTEXPR14 T& get_value(
+            union_type<T>, detail::constexpr_union<Types...>& storage) noexcept
+        {
+            return detail::constexpr_union_access<union_index<T>()>::get(storage);
+        }
+
+        template <typename T>
+        static constexpr const T& get_value(
+            union_type<T>, const detail::constexpr_union<Types...>& storage) noexcept
+        {
+            return detail::constexpr_union_access<union_index<T>()>::get(storage);
+        }
+
+        template <typename T>
+        static T& get_value(union_type<T>, unsigned char* storage) noexcept
+        {
+            return *static_cast<T*>(static_cast<void*>(storage));
+        }
+
+        template <typename T>
+        static const T& get_value(union_type<T>, const unsigned char* storage) noexcept
+        {
+            return *static_cast<const T*>(static_cast<const void*>(storage));
+        }
+
         void* get_memory() noexcept
         {
             return static_cast<void*>(&storage_);
@@ -255,22 +384,43 @@ namespace type_safe
             return static_cast<const void*>(&storage_);
         }
 
+        // the handler is only called on failure, so it can be used in constant expressions,
+        // and the numerical values are compared,
+        // as the comparison of the strong typedef with an rvalue isn't constexpr in C++11
         template <typename T>
-        void check(union_type<T> type) const noexcept
+        constexpr bool check(union_type<T> type) const noexcept
         {
-            DEBUG_ASSERT(cur_type_ == type, detail::precondition_error_handler{},
-                         "different type stored in union");
+            return (TYPE_SAFE_PRECONDITION_SAMPLE()
+                    && static_cast<std::size_t>(cur_type_)
+                           != static_cast<std::size_t>(type_id(type))) ?
+                       (TYPE_SAFE_PRECONDITION_UNREACHABLE("different type stored in union"),
+                        false) :
+                       true;
         }
 
-        using storage_t = detail::aligned_union_t<Types...>;
-        storage_t storage_;
-        type_id   cur_type_;
+        static constexpr auto storage_size      = detail::aligned_union<Types...>::size_value;
+        static constexpr auto storage_alignment = detail::aligned_union<Types...>::alignment_value;
+
+        // not std::aligned_storage, it would round the size up to the alignment
+        using storage_type =
+            typename std::conditional<constexpr_storage::value, detail::constexpr_union<Types...>,
+                                      unsigned char[storage_size]>::type;
+
+        alignas(storage_alignment) storage_type storage_;
+        type_id cur_type_;
     };
 
     /// \exclude
     template <typename... Types>
     constexpr typename tagged_union<Types...>::type_id tagged_union<Types...>::invalid_type;
 
+    /// \exclude
+    template <typename... Types>
+    struct is_trivially_relocatable<tagged_union<Types...>>
+    : detail::all_of<is_trivially_relocatable<typename std::decay<Types>::type>::value...>
+    {
+    };
+
     /// \exclude
     namespace detail
     {
@@ -280,16 +430,31 @@ namespace type_safe
         template <typename Func, class Union, typename... Types, typename... Args>
         class with_union<Func, Union, union_types<Types...>, Args...>
         {
+            using indices = make_index_sequence<sizeof...(Types) + 1u>;
+
         public:
+            using result   = void;
+            using function = void (*)(Union&&, Func&&, Args&&...);
+
             static void with(Union&& u, Func&& func, Args&&... args)
             {
-                with_impl(typename std::decay<Union>::type::types{}, std::forward<Union>(u),
-                          std::forward<Func>(func), std::forward<Args>(args)...);
+                auto id = static_cast<std::size_t>(u.type());
+                variant_jump<indices>::template call<with_union>(id, std::forward<Union>(u),
+                                                                 std::forward<Func>(func),
+                                                                 std::forward<Args>(args)...);
+            }
+
+            // type id 0 is the empty state, type id i is the (i - 1)th type
+            template <std::size_t I>
+            static void call(Union&& u, Func&& func, Args&&... args)
+            {
+                call_id(std::integral_constant<std::size_t, I>{}, std::forward<Union>(u),
+                        std::forward<Func>(func), std::forward<Args>(args)...);
             }
 
         private:
             template <typename T>
-            static auto call(int, Union&& u, Func&& func, Args&&... args)
+            static auto call_impl(int, Union&& u, Func&& func, Args&&... args)
                 -> decltype(std::forward<Func>(func)(std::forward<Union>(u).value(union_type<T>{}),
                                                      std::forward<Args>(args)...))
             {
@@ -298,24 +463,21 @@ namespace type_safe
             }
 
             template <typename T>
-            static void call(short, Union&&, Func&&, Args&&...)
+            static void call_impl(short, Union&&, Func&&, Args&&...)
             {
             }
 
-            static void with_impl(union_types<>, Union&&, Func&&, Args&&...)
+            static void call_id(std::integral_constant<std::size_t, 0u>, Union&&, Func&&, Args&&...)
             {
             }
 
-            template <typename Head, typename... Tail>
-            static void with_impl(union_types<Head, Tail...>, Union&& u, Func&& func,
-                                  Args&&... args)
+            template <std::size_t I>
+            static void call_id(std::integral_constant<std::size_t, I>, Union&& u, Func&& func,
+                                Args&&... args)
             {
-                if (u.type() == union_type<Head>{})
-                    call<Head>(0, std::forward<Union>(u), std::forward<Func>(func),
-                               std::forward<Args>(args)...);
-                else
-                    with_impl(union_types<Tail...>{}, std::forward<Union>(u),
-                              std::forward<Func>(func), std::forward<Args>(args)...);
+                using type = typename type_at<I - 1u, Types...>::type;
+                call_impl<type>(0, std::forward<Union>(u), std::forward<Func>(func),
+                                std::forward<Args>(args)...);
             }
         };
     } // namespace detail
@@ -401,7 +563,7 @@ namespace type_safe
             {
                 if (Union::trivial::value)
                 {
-                    dest.storage_  = org.storage_;
+                    std::memcpy(dest.get_memory(), org.get_memory(), sizeof(org.storage_));
                     dest.cur_type_ = org.cur_type_;
                 }
                 else
@@ -425,7 +587,7 @@ namespace type_safe
             {
                 if (Union::trivial::value)
                 {
-                    dest.storage_  = org.storage_;
+                    std::memcpy(dest.get_memory(), org.get_memory(), sizeof(org.storage_));
                     dest.cur_type_ = org.cur_type_;
                 }
                 else
@@ -456,7 +618,7 @@ namespace type_safe
     template <typename... Types>
     void copy(tagged_union<Types...>& dest, const tagged_union<Types...>& org)
     {
-        DEBUG_ASSERT(!dest.has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_PRECONDITION(!dest.has_value(), "destination not empty");
         detail::copy_union<tagged_union<Types...>>::copy(dest, org);
     }
 
@@ -466,9 +628,196 @@ namespace type_safe
     template <typename... Types>
     void move(tagged_union<Types...>& dest, tagged_union<Types...>&& org)
     {
-        DEBUG_ASSERT(!dest.has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_PRECONDITION(!dest.has_value(), "destination not empty");
         detail::move_union<tagged_union<Types...>>::move(dest, std::move(org));
     }
+
+    /// \exclude
+    namespace detail
+    {
+        // compares or hashes the values of unions with a single jump on the type id,
+        // the type ids must have been compared before
+        template <class Union, class Types>
+        struct compare_union;
+
+        template <class Union, typename... Types>
+        struct compare_union<Union, union_types<Types...>>
+        {
+            using indices = make_index_sequence<sizeof...(Types) + 1u>;
+
+            // type id 0 is the empty state, type id i is the (i - 1)th type
+            template <std::size_t I>
+            using type = typename type_at<I - 1u, Types...>::type;
+
+            struct equal
+            {
+                using result   = bool;
+                using function = bool (*)(const Union&, const Union&);
+
+                template <std::size_t I>
+                static bool call(const Union& a, const Union& b)
+                {
+                    return call_id(std::integral_constant<std::size_t, I>{}, a, b);
+                }
+
+                static bool call_id(std::integral_constant<std::size_t, 0u>, const Union&,
+                                    const Union&)
+                {
+                    return true;
+                }
+
+                template <std::size_t I>
+                static bool call_id(std::integral_constant<std::size_t, I>, const Union& a,
+                                    const Union& b)
+                {
+                    return a.value(union_type<type<I>>{}) == b.value(union_type<type<I>>{});
+                }
+            };
+
+            struct less
+            {
+                using result   = bool;
+                using function = bool (*)(const Union&, const Union&);
+
+                template <std::size_t I>
+                static bool call(const Union& a, const Union& b)
+                {
+                    return call_id(std::integral_constant<std::size_t, I>{}, a, b);
+                }
+
+                static bool call_id(std::integral_constant<std::size_t, 0u>, const Union&,
+                                    const Union&)
+                {
+                    return false;
+                }
+
+                template <std::size_t I>
+                static bool call_id(std::integral_constant<std::size_t, I>, const Union& a,
+                                    const Union& b)
+                {
+                    return a.value(union_type<type<I>>{}) < b.value(union_type<type<I>>{});
+                }
+            };
+
+            struct hash
+            {
+                using result   = std::size_t;
+                using function = std::size_t (*)(const Union&);
+
+                template <std::size_t I>
+                static std::size_t call(const Union& u)
+                {
+                    return call_id(std::integral_constant<std::size_t, I>{}, u);
+                }
+
+                static std::size_t call_id(std::integral_constant<std::size_t, 0u>, const Union&)
+                {
+                    return 19937; // magic value, same as for an empty optional
+                }
+
+                template <std::size_t I>
+                static std::size_t call_id(std::integral_constant<std::size_t, I>, const Union& u)
+                {
+                    auto value_hash = std::hash<type<I>>{}(u.value(union_type<type<I>>{}));
+                    // mix in the type id, so equal values of different types hash differently
+                    return value_hash ^ (I + 0x9e3779b9u + (value_hash << 6) + (value_hash >> 2));
+                }
+            };
+
+            static bool equal_values(const Union& a, const Union& b)
+            {
+                auto id = static_cast<std::size_t>(a.type());
+                return variant_jump<indices>::template call<equal>(id, a, b);
+            }
+
+            static bool less_values(const Union& a, const Union& b)
+            {
+                auto id = static_cast<std::size_t>(a.type());
+                return variant_jump<indices>::template call<less>(id, a, b);
+            }
+
+            static std::size_t hash_value(const Union& u)
+            {
+                auto id = static_cast<std::size_t>(u.type());
+                return variant_jump<indices>::template call<hash>(id, u);
+            }
+        };
+
+        template <typename... Types>
+        using compare_union_for =
+            compare_union<tagged_union<Types...>, typename tagged_union<Types...>::types>;
+    } // namespace detail
+
+    /// Compares two [ts::tagged_union]()s.
+    ///
+    /// They compare equal if both store the same type (or none) and the stored object compares equal.
+    /// A union is less than another if they store mismatched types and the type id of the first is less than the other,
+    /// or if they store the same type and the stored object compares less.
+    /// The other comparisons behave accordingly.
+    /// \notes The type ids are compared first,
+    /// then there is a single jump to the comparison of the stored type.
+    /// \group union_comp
+    /// \module variant
+    template <typename... Types>
+    bool operator==(const tagged_union<Types...>& lhs, const tagged_union<Types...>& rhs)
+    {
+        return lhs.type() == rhs.type()
+               && detail::compare_union_for<Types...>::equal_values(lhs, rhs);
+    }
+
+    /// \group union_comp
+    template <typename... Types>
+    bool operator!=(const tagged_union<Types...>& lhs, const tagged_union<Types...>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    /// \group union_comp
+    template <typename... Types>
+    bool operator<(const tagged_union<Types...>& lhs, const tagged_union<Types...>& rhs)
+    {
+        if (lhs.type() != rhs.type())
+            return lhs.type() < rhs.type();
+        return detail::compare_union_for<Types...>::less_values(lhs, rhs);
+    }
+
+    /// \group union_comp
+    template <typename... Types>
+    bool operator<=(const tagged_union<Types...>& lhs, const tagged_union<Types...>& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    /// \group union_comp
+    template <typename... Types>
+    bool operator>(const tagged_union<Types...>& lhs, const tagged_union<Types...>& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    /// \group union_comp
+    template <typename... Types>
+    bool operator>=(const tagged_union<Types...>& lhs, const tagged_union<Types...>& rhs)
+    {
+        return !(lhs < rhs);
+    }
 } // namespace type_safe
 
+namespace std
+{
+    /// Hash for [ts::tagged_union]().
+    ///
+    /// It mixes the type id with the `std::hash` of the stored object,
+    /// using a single jump to the hash of the stored type.
+    /// \module variant
+    template <typename... Types>
+    struct hash<type_safe::tagged_union<Types...>>
+    {
+        std::size_t operator()(const type_safe::tagged_union<Types...>& u) const
+        {
+            return type_safe::detail::compare_union_for<Types...>::hash_value(u);
+        }
+    };
+} // namespace std
+
 #endif // TYPE_SAFE_TAGGED_UNION_HPP_INCLUDED
@@ -31,7 +31,7 @@ namespace type_safe
 
     /// Tag object of type [ts::nullvar_t]().
     /// \module variant
-    constexpr nullvar_t nullvar;
+    TYPE_SAFE_INLINE_VARIABLE constexpr nullvar_t nullvar;
 
     /// An improved `union` storing at most one of the given types at a time (or possibly none).
     ///
@@ -46,6 +46,11 @@ namespace type_safe
     /// * `void change_value(variant_type<T>, tagged_union<Types...>&, Args&&... args)` - changes the value and type.
     /// It will be called when the variant already contains an object of a different type.
     /// It must destroy the old type and create a new one with the given type and arguments.
+    /// \notes If the underlying [ts::tagged_union]() can be used in constant expressions,
+    /// i.e. usually if all types are trivially copyable, so can the variant:
+    /// it can be constructed as empty or with a value and queried in constant expressions,
+    /// and visited with [ts::visit]() since C++14,
+    /// e.g. to build a dispatch table as a `constexpr` array of variants.
     /// \module variant
     template <class VariantPolicy, typename HeadT, typename... TailT>
     class basic_variant : detail::variant_copy<HeadT, TailT...>,
@@ -74,7 +79,7 @@ namespace type_safe
         template <
             typename Dummy = void,
             typename = typename std::enable_if<VariantPolicy::allow_empty::value, Dummy>::type>
-        basic_variant() noexcept
+        constexpr basic_variant() noexcept
         {
         }
 
@@ -86,7 +91,7 @@ namespace type_safe
         template <
             typename Dummy = void,
             typename = typename std::enable_if<VariantPolicy::allow_empty::value, Dummy>::type>
-        basic_variant(nullvar_t) noexcept : basic_variant()
+        constexpr basic_variant(nullvar_t) noexcept : basic_variant()
         {
         }
 
@@ -114,9 +119,9 @@ namespace type_safe
         /// \exclude
         template <typename T, typename... Args,
                   typename = detail::enable_variant_type<union_t, T, Args&&...>>
-        explicit basic_variant(variant_type<T> type, Args&&... args)
+        explicit constexpr basic_variant(variant_type<T> type, Args&&... args)
+        : storage_(type, std::forward<Args>(args)...)
         {
-            storage_.get_union().emplace(type, std::forward<Args>(args)...);
         }
 
         /// Initializes it with a copy of the given object.
@@ -128,7 +133,7 @@ namespace type_safe
         /// \param 1
         /// \exclude
         template <typename T, typename = detail::enable_variant_type<union_t, T, T&&>>
-        basic_variant(T&& obj)
+        constexpr basic_variant(T&& obj)
         : basic_variant(variant_type<typename std::decay<T>::type>{}, std::forward<T>(obj))
         {
         }
@@ -142,14 +147,14 @@ namespace type_safe
         /// \group ctor_union
         explicit basic_variant(const tagged_union<HeadT, TailT...>& u)
         {
-            DEBUG_ASSERT(allow_empty::value || u.has_value(), detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(allow_empty::value || u.has_value(), "union is empty");
             copy(storage_.get_union(), u);
         }
 
         /// \group ctor_union
         explicit basic_variant(tagged_union<HeadT, TailT...>&& u)
         {
-            DEBUG_ASSERT(allow_empty::value || u.has_value(), detail::precondition_error_handler{});
+            TYPE_SAFE_PRECONDITION(allow_empty::value || u.has_value(), "union is empty");
             move(storage_.get_union(), std::move(u));
         }
 
@@ -315,7 +320,7 @@ namespace type_safe
         //=== abservers ===//
         /// \returns The type id representing the type of the value currently stored in the variant.
         /// \notes If it does not have a value stored, returns [*invalid_type]().
-        type_id type() const noexcept
+        constexpr type_id type() const noexcept
         {
             return storage_.get_union().type();
         }
@@ -325,19 +330,19 @@ namespace type_safe
         /// \notes Depending on the variant policy,
         /// it can be guaranteed to return `true` all the time.
         /// \group has_value
-        bool has_value() const noexcept
+        constexpr bool has_value() const noexcept
         {
             return storage_.get_union().has_value();
         }
 
         /// \group has_value
-        explicit operator bool() const noexcept
+        explicit constexpr operator bool() const noexcept
         {
             return has_value();
         }
 
         /// \group has_value
-        bool has_value(variant_type<nullvar_t>) const noexcept
+        constexpr bool has_value(variant_type<nullvar_t>) const noexcept
         {
             return !has_value();
         }
@@ -345,29 +350,36 @@ namespace type_safe
         /// \returns `true` if the variant currently stores an object of type `T`,
         /// `false` otherwise.
         /// \notes `T` must not necessarily be a type that can be stored in the variant.
+        /// \notes Unlike [ts::visit](), it does not unwrap a [ts::boxed](),
+        /// so `T` must be the `boxed` itself.
         template <typename T>
-        bool has_value(variant_type<T> type) const noexcept
+        constexpr bool has_value(variant_type<T> type) const noexcept
         {
-            return this->type() == type_id(type);
+            // the comparison of the strong typedef with an rvalue isn't constexpr in C++11
+            return static_cast<std::size_t>(this->type())
+                   == static_cast<std::size_t>(type_id(type));
         }
 
         /// \returns A copy of [ts::nullvar]().
         /// \requires The variant must be empty.
-        nullvar_t value(variant_type<nullvar_t>) const noexcept
+        constexpr nullvar_t value(variant_type<nullvar_t>) const noexcept
         {
-            DEBUG_ASSERT(!has_value(), detail::precondition_error_handler{});
-            return nullvar;
+            return has_value() ?
+                       (TYPE_SAFE_PRECONDITION_UNREACHABLE("variant not empty"), nullvar) :
+                       nullvar;
         }
 
         /// \returns A (`const`) lvalue (1, 2)/rvalue (3, 4) reference to the stored object of the given type.
         /// \requires The variant must currently store an object of the given type,
         /// i.e. `has_value(type)` must return `true`.
+        /// \notes Unlike [ts::visit](), it does not unwrap a [ts::boxed](),
+        /// i.e. it returns the `boxed` itself.
         /// \group value
         /// \param 1
         /// \exclude
         template <typename T,
                   typename = typename std::enable_if<type_id::template is_valid<T>()>::type>
-        T& value(variant_type<T> type) TYPE_SAFE_LVALUE_REF noexcept
+        TYPE_SAFE_CONSTEXPR14 T& value(variant_type<T> type) TYPE_SAFE_LVALUE_REF noexcept
         {
             return storage_.get_union().value(type);
         }
@@ -377,7 +389,7 @@ namespace type_safe
         /// \exclude
         template <typename T,
                   typename = typename std::enable_if<type_id::template is_valid<T>()>::type>
-        const T& value(variant_type<T> type) const TYPE_SAFE_LVALUE_REF noexcept
+        constexpr const T& value(variant_type<T> type) const TYPE_SAFE_LVALUE_REF noexcept
         {
             return storage_.get_union().value(type);
         }
@@ -388,7 +400,7 @@ namespace type_safe
         /// \exclude
         template <typename T,
                   typename = typename std::enable_if<type_id::template is_valid<T>()>::type>
-            T&& value(variant_type<T> type) && noexcept
+            TYPE_SAFE_CONSTEXPR14 T&& value(variant_type<T> type) && noexcept
         {
             return std::move(storage_.get_union()).value(type);
         }
@@ -398,7 +410,7 @@ namespace type_safe
         /// \exclude
         template <typename T,
                   typename = typename std::enable_if<type_id::template is_valid<T>()>::type>
-        const T&& value(variant_type<T> type) const && noexcept
+        constexpr const T&& value(variant_type<T> type) const && noexcept
         {
             return std::move(storage_.get_union()).value(type);
         }
@@ -561,6 +573,13 @@ namespace type_safe
     constexpr typename basic_variant<VariantPolicy, Head, Types...>::type_id
         basic_variant<VariantPolicy, Head, Types...>::invalid_type;
 
+    /// \exclude
+    template <class VariantPolicy, typename Head, typename... Types>
+    struct is_trivially_relocatable<basic_variant<VariantPolicy, Head, Types...>>
+    : is_trivially_relocatable<tagged_union<Head, Types...>>
+    {
+    };
+
 //=== comparison ===//
 /// \exclude
 #define TYPE_SAFE_DETAIL_MAKE_OP(Op, Expr, Expr2)                                                  \
@@ -698,14 +717,16 @@ namespace type_safe
     /// A variant is less than another if they store mismatched types and the type id of the first is less than the other,
     /// or if they store the same type and the stored object compares less.
     /// The other comparisons behave accordingly.
+    /// \notes It compares the underlying [ts::tagged_union](),
+    /// so the type ids are compared first and then there is a single jump to the comparison of the stored type.
     /// \module variant
     /// \group variant_comp
     template <class VariantPolicy, typename Head, typename... Types>
     bool operator==(const basic_variant<VariantPolicy, Head, Types...>& lhs,
                     const basic_variant<VariantPolicy, Head, Types...>& rhs)
     {
-        return detail::compare_variant<basic_variant<VariantPolicy, Head,
-                                                     Types...>>::compare_equal(lhs, rhs);
+        return detail::storage_access::get(lhs).get_union()
+               == detail::storage_access::get(rhs).get_union();
     }
 
     /// \group variant_comp
@@ -721,8 +742,8 @@ namespace type_safe
     bool operator<(const basic_variant<VariantPolicy, Head, Types...>& lhs,
                    const basic_variant<VariantPolicy, Head, Types...>& rhs)
     {
-        return detail::compare_variant<basic_variant<VariantPolicy, Head,
-                                                     Types...>>::compare_less(lhs, rhs);
+        return detail::storage_access::get(lhs).get_union()
+               < detail::storage_access::get(rhs).get_union();
     }
 
     /// \group variant_comp
@@ -979,4 +1000,23 @@ namespace type_safe
     using variant = typename detail::select_variant_policy<Types...>::type;
 } // namespace type_safe
 
+namespace std
+{
+    /// Hash for [ts::basic_variant]().
+    ///
+    /// It is the hash of the underlying [ts::tagged_union](),
+    /// which mixes the type id with the `std::hash` of the stored object.
+    /// \module variant
+    template <class VariantPolicy, typename Head, typename... Types>
+    struct hash<type_safe::basic_variant<VariantPolicy, Head, Types...>>
+    {
+        std::size_t operator()(
+            const type_safe::basic_variant<VariantPolicy, Head, Types...>& variant) const
+        {
+            return std::hash<type_safe::tagged_union<Head, Types...>>{}(
+                type_safe::detail::storage_access::get(variant).get_union());
+        }
+    };
+} // namespace std
+
 #endif // TYPE_SAFE_VARIANT_HPP_INCLUDED
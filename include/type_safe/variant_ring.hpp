@@ -0,0 +1,343 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_VARIANT_RING_HPP_INCLUDED
+#define TYPE_SAFE_VARIANT_RING_HPP_INCLUDED
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include <type_safe/config.hpp>
+#include <type_safe/tagged_union.hpp>
+#include <type_safe/variant.hpp>
+
+namespace type_safe
+{
+    /// \exclude
+    namespace detail
+    {
+        template <typename... Types>
+        struct alignas(TYPE_SAFE_CACHE_LINE_SIZE) variant_ring_slot
+        {
+            tagged_union<Types...> value;
+        };
+
+        template <typename... Types>
+        struct alignas(TYPE_SAFE_CACHE_LINE_SIZE) mpmc_variant_ring_slot
+        {
+            std::atomic<std::size_t> sequence;
+            tagged_union<Types...>   value;
+        };
+
+        constexpr bool is_valid_ring_capacity(std::size_t capacity) noexcept
+        {
+            return capacity != 0u && (capacity & (capacity - 1u)) == 0u;
+        }
+    } // namespace detail
+
+    /// A bounded single-producer/single-consumer queue of messages of the given types.
+    ///
+    /// The messages are stored in-place as a [ts::tagged_union]() in a ring buffer of `Capacity` slots,
+    /// each slot is aligned to a cache line (`TYPE_SAFE_CACHE_LINE_SIZE`, `64` by default),
+    /// as are the producer and consumer index.
+    /// A message is constructed directly in its slot by `emplace()`
+    /// and visited in its slot by `try_visit()`,
+    /// so it is never copied or moved.
+    ///
+    /// Exactly one thread may call the producer functions `try_emplace()` and `emplace()`,
+    /// and exactly one thread may call the consumer function `try_visit()` at the same time.
+    /// Use [ts::mpmc_variant_ring]() if there are multiple producers or consumers.
+    /// \requires `Capacity` must be a power of two.
+    /// \notes The type is over-aligned,
+    /// before C++17 allocating it with `new` does not respect that alignment,
+    /// which doesn't break anything but can introduce false sharing.
+    /// \module variant
+    template <std::size_t Capacity, typename... Types>
+    class variant_ring
+    {
+        static_assert(detail::is_valid_ring_capacity(Capacity), "capacity must be a power of two");
+
+    public:
+        //=== constructors/destructor ===//
+        /// \effects Creates an empty ring.
+        variant_ring() noexcept : tail_(0u), cached_head_(0u), head_(0u), cached_tail_(0u)
+        {
+        }
+
+        variant_ring(const variant_ring&) = delete;
+        variant_ring& operator=(const variant_ring&) = delete;
+
+        /// \effects Destroys all messages that haven't been consumed.
+        ~variant_ring() noexcept
+        {
+            for (auto& slot : slots_)
+                destroy(slot.value);
+        }
+
+        //=== producer ===//
+        /// \effects If the ring isn't full,
+        /// creates a new message of type `T` in the next slot by perfectly forwarding the arguments.
+        /// \returns `true` if the message was created, `false` if the ring was full.
+        /// \throws Anything thrown by the constructor of `T`,
+        /// in which case the ring is not modified.
+        /// \requires Must only be called by the producer.
+        template <typename T, typename... Args>
+        bool try_emplace(variant_type<T> type, Args&&... args)
+        {
+            auto tail = tail_.load(std::memory_order_relaxed);
+            if (tail - cached_head_ == Capacity)
+            {
+                // only look at the consumer index when the cached value says it's full
+                cached_head_ = head_.load(std::memory_order_acquire);
+                if (tail - cached_head_ == Capacity)
+                    return false;
+            }
+
+            slots_[tail % Capacity].value.emplace(type, std::forward<Args>(args)...);
+            tail_.store(tail + 1u, std::memory_order_release);
+            return true;
+        }
+
+        /// \effects Same as `try_emplace()`, but waits until there is a free slot.
+        /// \requires Must only be called by the producer.
+        template <typename T, typename... Args>
+        void emplace(variant_type<T> type, Args&&... args)
+        {
+            // the arguments are only forwarded if the message is actually created
+            while (!try_emplace(type, std::forward<Args>(args)...))
+                std::this_thread::yield();
+        }
+
+        //=== consumer ===//
+        /// \effects If the ring isn't empty,
+        /// calls `with(u, visitor)`, where `u` is the [ts::tagged_union]() storing the oldest message,
+        /// i.e. the visitor is called with an lvalue referring to the message in its slot,
+        /// it may move from it.
+        /// Then the message is destroyed and the slot released,
+        /// this is done even if the visitor throws.
+        /// \returns `true` if a message was consumed, `false` if the ring was empty.
+        /// \requires Must only be called by the consumer.
+        template <typename Visitor>
+        bool try_visit(Visitor&& visitor)
+        {
+            auto head = head_.load(std::memory_order_relaxed);
+            if (head == cached_tail_)
+            {
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+                if (head == cached_tail_)
+                    return false;
+            }
+
+            consume_guard guard{*this, head};
+            with(slots_[head % Capacity].value, std::forward<Visitor>(visitor));
+            return true;
+        }
+
+        //=== observers ===//
+        /// \returns Whether or not there are no messages.
+        /// \notes If called by a thread that is neither producer nor consumer,
+        /// the result may be outdated immediately.
+        bool empty() const noexcept
+        {
+            return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+        }
+
+        /// \returns The maximal number of messages.
+        static constexpr std::size_t capacity() noexcept
+        {
+            return Capacity;
+        }
+
+    private:
+        struct consume_guard
+        {
+            variant_ring& ring;
+            std::size_t   head;
+
+            ~consume_guard() noexcept
+            {
+                destroy(ring.slots_[head % Capacity].value);
+                ring.head_.store(head + 1u, std::memory_order_release);
+            }
+        };
+
+        // the cached index of the other side is only accessed by the owner of the line
+        alignas(TYPE_SAFE_CACHE_LINE_SIZE) std::atomic<std::size_t> tail_;
+        std::size_t cached_head_;
+        alignas(TYPE_SAFE_CACHE_LINE_SIZE) std::atomic<std::size_t> head_;
+        std::size_t cached_tail_;
+
+        detail::variant_ring_slot<Types...> slots_[Capacity];
+    };
+
+    /// A bounded multi-producer/multi-consumer queue of messages of the given types.
+    ///
+    /// It has the same interface as [ts::variant_ring](),
+    /// but any number of threads may call all member functions concurrently.
+    /// It is a bounded queue where each slot has a sequence number
+    /// that tells producers and consumers whether it is ready for them,
+    /// so a thread only contends with others on the shared index.
+    /// \requires `Capacity` must be a power of two.
+    /// \notes If the constructor of a message throws,
+    /// the slot has already been claimed, so it is released empty and consumers skip it.
+    /// \module variant
+    template <std::size_t Capacity, typename... Types>
+    class mpmc_variant_ring
+    {
+        static_assert(detail::is_valid_ring_capacity(Capacity), "capacity must be a power of two");
+
+    public:
+        //=== constructors/destructor ===//
+        /// \effects Creates an empty ring.
+        mpmc_variant_ring() noexcept : tail_(0u), head_(0u)
+        {
+            for (auto i = std::size_t(0u); i != Capacity; ++i)
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        mpmc_variant_ring(const mpmc_variant_ring&) = delete;
+        mpmc_variant_ring& operator=(const mpmc_variant_ring&) = delete;
+
+        /// \effects Destroys all messages that haven't been consumed.
+        ~mpmc_variant_ring() noexcept
+        {
+            for (auto& slot : slots_)
+                destroy(slot.value);
+        }
+
+        //=== producer ===//
+        /// \effects If the ring isn't full,
+        /// creates a new message of type `T` in the next slot by perfectly forwarding the arguments.
+        /// \returns `true` if the message was created, `false` if the ring was full.
+        /// \throws Anything thrown by the constructor of `T`.
+        template <typename T, typename... Args>
+        bool try_emplace(variant_type<T> type, Args&&... args)
+        {
+            auto pos = tail_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto seq  = slots_[pos % Capacity].sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(seq - pos);
+                if (diff == 0)
+                {
+                    // slot is free, try to claim it
+                    if (tail_.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                    // slot still contains the message of the previous round
+                    return false;
+                else
+                    // another producer claimed it
+                    pos = tail_.load(std::memory_order_relaxed);
+            }
+
+            publish_guard guard{slots_[pos % Capacity], pos + 1u};
+            guard.slot.value.emplace(type, std::forward<Args>(args)...);
+            return true;
+        }
+
+        /// \effects Same as `try_emplace()`, but waits until there is a free slot.
+        template <typename T, typename... Args>
+        void emplace(variant_type<T> type, Args&&... args)
+        {
+            // the arguments are only forwarded if the message is actually created
+            while (!try_emplace(type, std::forward<Args>(args)...))
+                std::this_thread::yield();
+        }
+
+        //=== consumer ===//
+        /// \effects If the ring isn't empty,
+        /// calls `with(u, visitor)`, where `u` is the [ts::tagged_union]() storing the oldest message,
+        /// i.e. the visitor is called with an lvalue referring to the message in its slot,
+        /// it may move from it.
+        /// Then the message is destroyed and the slot released,
+        /// this is done even if the visitor throws.
+        /// \returns `true` if a message was consumed, `false` if the ring was empty.
+        template <typename Visitor>
+        bool try_visit(Visitor&& visitor)
+        {
+            for (;;)
+            {
+                auto pos = head_.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    auto seq  = slots_[pos % Capacity].sequence.load(std::memory_order_acquire);
+                    auto diff = static_cast<std::intptr_t>(seq - (pos + 1u));
+                    if (diff == 0)
+                    {
+                        // slot contains a message, try to claim it
+                        if (head_.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if (diff < 0)
+                        // slot is not published yet
+                        return false;
+                    else
+                        // another consumer claimed it
+                        pos = head_.load(std::memory_order_relaxed);
+                }
+
+                consume_guard guard{slots_[pos % Capacity], pos + Capacity};
+                if (guard.slot.value.has_value())
+                {
+                    with(guard.slot.value, std::forward<Visitor>(visitor));
+                    return true;
+                }
+                // constructor threw, so skip it
+            }
+        }
+
+        //=== observers ===//
+        /// \returns Whether or not there are no messages.
+        /// \notes The result may be outdated immediately.
+        bool empty() const noexcept
+        {
+            return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+        }
+
+        /// \returns The maximal number of messages.
+        static constexpr std::size_t capacity() noexcept
+        {
+            return Capacity;
+        }
+
+    private:
+        using slot_type = detail::mpmc_variant_ring_slot<Types...>;
+
+        // hands the slot over to the consumers
+        struct publish_guard
+        {
+            slot_type&  slot;
+            std::size_t sequence;
+
+            ~publish_guard() noexcept
+            {
+                slot.sequence.store(sequence, std::memory_order_release);
+            }
+        };
+
+        // destroys the message and hands the slot over to the producers of the next round
+        struct consume_guard
+        {
+            slot_type&  slot;
+            std::size_t sequence;
+
+            ~consume_guard() noexcept
+            {
+                destroy(slot.value);
+                slot.sequence.store(sequence, std::memory_order_release);
+            }
+        };
+
+        alignas(TYPE_SAFE_CACHE_LINE_SIZE) std::atomic<std::size_t> tail_;
+        alignas(TYPE_SAFE_CACHE_LINE_SIZE) std::atomic<std::size_t> head_;
+
+        slot_type slots_[Capacity];
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_VARIANT_RING_HPP_INCLUDED
@@ -0,0 +1,426 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_VARIANT_VECTOR_HPP_INCLUDED
+#define TYPE_SAFE_VARIANT_VECTOR_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <type_safe/detail/all_of.hpp>
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/index_sequence.hpp>
+#include <type_safe/detail/variant_jump.hpp>
+#include <type_safe/index.hpp>
+#include <type_safe/optional_ref.hpp>
+#include <type_safe/reference.hpp>
+#include <type_safe/tagged_union.hpp>
+#include <type_safe/variant.hpp>
+
+namespace type_safe
+{
+    template <typename... Types>
+    class variant_vector;
+
+    /// \exclude
+    namespace detail
+    {
+        template <std::size_t I, typename T>
+        struct variant_column
+        {
+            std::vector<T> values;
+        };
+
+        // derives from variant_column<I, T> for each type, like detail::indexed_types
+        template <class Indices, typename... Types>
+        struct variant_columns_impl;
+
+        template <std::size_t... Is, typename... Types>
+        struct variant_columns_impl<index_sequence<Is...>, Types...> : variant_column<Is, Types>...
+        {
+            void clear() noexcept
+            {
+                int dummy[] = {(static_cast<variant_column<Is, Types>&>(*this).values.clear(),
+                                0)...};
+                (void)dummy;
+            }
+        };
+
+        template <typename... Types>
+        using variant_columns =
+            variant_columns_impl<make_index_sequence<sizeof...(Types)>, Types...>;
+
+        // deduction fails if T isn't a base or appears more than once
+        template <typename T, std::size_t I>
+        std::vector<T>& get_column_of(variant_column<I, T>& column) noexcept
+        {
+            return column.values;
+        }
+
+        template <typename T, std::size_t I>
+        const std::vector<T>& get_column_of(const variant_column<I, T>& column) noexcept
+        {
+            return column.values;
+        }
+
+        template <std::size_t I, typename T>
+        std::vector<T>& get_column_at(variant_column<I, T>& column) noexcept
+        {
+            return column.values;
+        }
+
+        template <std::size_t I, typename T>
+        const std::vector<T>& get_column_at(const variant_column<I, T>& column) noexcept
+        {
+            return column.values;
+        }
+
+        // dispatchers for variant_jump, the index is the type id minus one
+        template <class Columns, typename Pointer>
+        struct variant_column_element
+        {
+            using result   = Pointer;
+            using function = result (*)(Columns&, std::size_t);
+
+            template <std::size_t I>
+            static result call(Columns& columns, std::size_t position) noexcept
+            {
+                return &get_column_at<I>(columns)[position];
+            }
+        };
+
+        template <class Columns>
+        struct variant_column_pop
+        {
+            using result   = void;
+            using function = result (*)(Columns&);
+
+            template <std::size_t I>
+            static result call(Columns& columns) noexcept
+            {
+                get_column_at<I>(columns).pop_back();
+            }
+        };
+
+        template <typename T>
+        array_ref<T> make_column_ref(std::vector<T>& column) noexcept
+        {
+            return column.empty() ? array_ref<T>(nullptr) :
+                                    array_ref<T>(column.data(), column.size());
+        }
+
+        template <typename T>
+        array_ref<const T> make_column_ref(const std::vector<T>& column) noexcept
+        {
+            return column.empty() ? array_ref<const T>(nullptr) :
+                                    array_ref<const T>(column.data(), column.size());
+        }
+    } // namespace detail
+
+    /// A reference to an element of a [ts::variant_vector]().
+    ///
+    /// It has the same observers as [ts::basic_variant](),
+    /// but it can't change the type of the element, only the value.
+    /// If `Const` is `true`, it only gives `const` access to the value.
+    /// \notes It is a proxy and only valid as long as the element isn't removed
+    /// and no element is added to the container.
+    /// \module variant
+    template <bool Const, typename... Types>
+    class basic_variant_ref
+    {
+        using pointer = typename std::conditional<Const, const void*, void*>::type;
+
+        template <typename T>
+        using value_t = typename std::conditional<Const, const T, T>::type;
+
+    public:
+        using types   = variant_types<Types...>;
+        using type_id = typename tagged_union<Types...>::type_id;
+
+        /// \effects Converts a reference to a `const` reference.
+        /// \notes This function does not participate in overload resolution,
+        /// unless `Const` is `true`.
+        /// \param 1
+        /// \exclude
+        template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+        basic_variant_ref(const basic_variant_ref<OtherConst, Types...>& other) noexcept
+        : type_(other.type_), ptr_(other.ptr_)
+        {
+        }
+
+        /// \returns The type id of the type of the element.
+        type_id type() const noexcept
+        {
+            return type_;
+        }
+
+        /// \returns `true`, an element always has a value.
+        /// \group has_value
+        bool has_value() const noexcept
+        {
+            return true;
+        }
+
+        /// \returns `true` if the element has type `T`, `false` otherwise.
+        /// \group has_value
+        template <typename T>
+        bool has_value(variant_type<T> type) const noexcept
+        {
+            return type_ == type_id(type);
+        }
+
+        /// \returns A (`const`) reference to the value of the given type.
+        /// \requires The element must have the given type, i.e. `has_value(type)` must be `true`.
+        template <typename T,
+                  typename = typename std::enable_if<type_id::template is_valid<T>()>::type>
+        value_t<T>& value(variant_type<T> type) const noexcept
+        {
+            TYPE_SAFE_PRECONDITION(has_value(type), "different type stored in variant");
+            return *static_cast<value_t<T>*>(ptr_);
+        }
+
+        /// \returns A (`const`) [ts::optional_ref]() to the value of the given type.
+        /// If it has a different type, returns a null reference.
+        template <typename T>
+        optional_ref<value_t<T>> optional_value(variant_type<T> type) const noexcept
+        {
+            return has_value(type) ? type_safe::opt_ref(static_cast<value_t<T>*>(ptr_)) : nullptr;
+        }
+
+    private:
+        basic_variant_ref(type_id type, pointer ptr) noexcept : type_(type), ptr_(ptr)
+        {
+        }
+
+        type_id type_;
+        pointer ptr_;
+
+        template <bool, typename...>
+        friend class basic_variant_ref;
+        friend class variant_vector<Types...>;
+    };
+
+    /// A [ts::basic_variant_ref]() that gives non-`const` access to the value.
+    /// \module variant
+    template <typename... Types>
+    using variant_ref = basic_variant_ref<false, Types...>;
+
+    /// A [ts::basic_variant_ref]() that only gives `const` access to the value.
+    /// \module variant
+    template <typename... Types>
+    using variant_cref = basic_variant_ref<true, Types...>;
+
+    /// A container of variants of the given types, stored as a struct of arrays.
+    ///
+    /// Unlike a [std::vector]() of [ts::variant]() it stores a separate contiguous array
+    /// for each type, so each element only takes the space of its own type,
+    /// not the one of the biggest type.
+    /// The type of each element is stored in a separate array of [ts::tagged_union]() type ids,
+    /// which are the smallest integer type that can represent them,
+    /// together with the position of the value in the array of its type,
+    /// which is a 32 bit offset, so there can be at most `2^32` values of each type.
+    /// The values of one type can be accessed as an [ts::array_ref]() with `values()`,
+    /// so processing them only touches the memory of that type.
+    /// Element access returns a [ts::basic_variant_ref]().
+    /// \requires None of the types may be `bool`, as each array is a [std::vector]()
+    /// and the bit-packed `std::vector<bool>` cannot return a reference or pointer to an element;
+    /// use an `unsigned char` instead.
+    /// \notes The type of an element can't be changed,
+    /// as that would require moving the values of the old type.
+    /// \module variant
+    template <typename... Types>
+    class variant_vector
+    {
+        static_assert(detail::all_of<!std::is_same<typename std::remove_cv<Types>::type,
+                                                   bool>::value...>::value,
+                      "variant_vector of bool is not supported, use unsigned char instead");
+
+        using columns = detail::variant_columns<Types...>;
+
+    public:
+        using types           = variant_types<Types...>;
+        using type_id         = typename tagged_union<Types...>::type_id;
+        using reference       = variant_ref<Types...>;
+        using const_reference = variant_cref<Types...>;
+
+        //=== constructors ===//
+        /// \effects Creates an empty container.
+        variant_vector() = default;
+
+        //=== size ===//
+        /// \returns The number of elements.
+        size_t size() const noexcept
+        {
+            return tags_.size();
+        }
+
+        /// \returns Whether or not the container has no elements.
+        bool empty() const noexcept
+        {
+            return tags_.empty();
+        }
+
+        /// \returns The number of elements of the given type.
+        template <typename T>
+        size_t count(variant_type<T>) const noexcept
+        {
+            return detail::get_column_of<T>(columns_).size();
+        }
+
+        /// \effects Reserves memory for the given number of elements (1)/elements of a type (2).
+        /// \group reserve
+        void reserve(size_t capacity)
+        {
+            tags_.reserve(static_cast<std::size_t>(capacity));
+            positions_.reserve(static_cast<std::size_t>(capacity));
+        }
+
+        /// \group reserve
+        template <typename T>
+        void reserve(variant_type<T>, size_t capacity)
+        {
+            detail::get_column_of<T>(columns_).reserve(static_cast<std::size_t>(capacity));
+        }
+
+        /// \effects Removes all elements.
+        void clear() noexcept
+        {
+            tags_.clear();
+            positions_.clear();
+            columns_.clear();
+        }
+
+        //=== modifiers ===//
+        /// \effects Adds a new element at the end
+        /// that stores an object of the given type created by forwarding the arguments.
+        /// If an exception is thrown, the container is unchanged.
+        /// \returns A reference to the new value.
+        /// \requires There must be less than `2^32` values of the given type.
+        /// \param 2
+        /// \exclude
+        template <typename T, typename... Args,
+                  typename = typename std::enable_if<
+                      type_id::template is_valid<T>()
+                      && std::is_constructible<T, Args&&...>::value>::type>
+        T& emplace_back(variant_type<T> type, Args&&... args)
+        {
+            auto& column = detail::get_column_of<T>(columns_);
+            TYPE_SAFE_PRECONDITION(column.size() <= std::numeric_limits<position_type>::max(),
+                                   "too many values of one type");
+            column.emplace_back(std::forward<Args>(args)...);
+            TYPE_SAFE_TRY
+            {
+                tags_.push_back(type_id(type));
+                positions_.push_back(static_cast<position_type>(column.size() - 1u));
+            }
+            TYPE_SAFE_CATCH_ALL
+            {
+                if (tags_.size() != positions_.size())
+                    tags_.pop_back();
+                column.pop_back();
+                TYPE_SAFE_RETHROW;
+            }
+            return column.back();
+        }
+
+        /// \effects Same as `emplace_back(variant_type<std::decay_t<T>>{}, std::forward<T>(obj))`.
+        /// \notes This function does not participate in overload resolution,
+        /// unless `std::decay_t<T>` is one of the types.
+        /// \param 1
+        /// \exclude
+        template <typename T, typename = typename std::enable_if<type_id::template is_valid<
+                                  typename std::decay<T>::type>()>::type>
+        void push_back(T&& obj)
+        {
+            emplace_back(variant_type<typename std::decay<T>::type>{}, std::forward<T>(obj));
+        }
+
+        /// \effects Removes the last element.
+        /// \requires The container must not be empty.
+        void pop_back() noexcept
+        {
+            TYPE_SAFE_PRECONDITION(!empty(), "container is empty");
+            // the last element is always the last value of its type
+            jump<detail::variant_column_pop<columns>>(tags_.back(), columns_);
+            tags_.pop_back();
+            positions_.pop_back();
+        }
+
+        //=== access ===//
+        /// \returns The type id of the type of the `i`th element.
+        /// \requires `i < size()`.
+        type_id type(index_t i) const noexcept
+        {
+            return tags_[checked_index(i)];
+        }
+
+        /// \returns A (`const`) [ts::basic_variant_ref]() to the `i`th element.
+        /// \requires `i < size()`.
+        /// \group index
+        reference operator[](index_t i) noexcept
+        {
+            auto index = checked_index(i);
+            return reference(tags_[index], element<void*>(columns_, index));
+        }
+
+        /// \group index
+        const_reference operator[](index_t i) const noexcept
+        {
+            auto index = checked_index(i);
+            return const_reference(tags_[index], element<const void*>(columns_, index));
+        }
+
+        /// \returns A (`const`) [ts::array_ref]() to the contiguous array of all values
+        /// of type `T`, in the order they were added.
+        /// \group values
+        template <typename T>
+        array_ref<T> values(variant_type<T>) noexcept
+        {
+            return detail::make_column_ref(detail::get_column_of<T>(columns_));
+        }
+
+        /// \group values
+        template <typename T>
+        array_ref<const T> values(variant_type<T>) const noexcept
+        {
+            return detail::make_column_ref(detail::get_column_of<T>(columns_));
+        }
+
+    private:
+        std::size_t checked_index(index_t i) const noexcept
+        {
+            auto index = static_cast<std::size_t>(get(i));
+            TYPE_SAFE_PRECONDITION(index < tags_.size(), "out of bounds access");
+            return index;
+        }
+
+        template <class Dispatcher, typename... Args>
+        static typename Dispatcher::result jump(type_id type, Args&&... args) noexcept
+        {
+            using indices = detail::make_index_sequence<sizeof...(Types)>;
+            return detail::variant_jump<indices>::template call<Dispatcher>(
+                static_cast<std::size_t>(type) - 1u, std::forward<Args>(args)...);
+        }
+
+        template <typename Pointer, class Columns>
+        Pointer element(Columns& columns, std::size_t index) const noexcept
+        {
+            return jump<detail::variant_column_element<Columns, Pointer>>(tags_[index], columns,
+                                                                           positions_[index]);
+        }
+
+        // half the size of std::size_t on 64 bit
+        using position_type = std::uint32_t;
+
+        std::vector<type_id>       tags_;
+        std::vector<position_type> positions_;
+        columns                    columns_;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_VARIANT_VECTOR_HPP_INCLUDED
@@ -0,0 +1,191 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_VIOLATION_STATS_HPP_INCLUDED
+#define TYPE_SAFE_VIOLATION_STATS_HPP_INCLUDED
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <debug_assert.hpp>
+
+#include <type_safe/config.hpp>
+
+#ifndef TYPE_SAFE_VIOLATION_STATS_CAPACITY
+/// The maximal number of call sites whose precondition violations can be recorded.
+///
+/// Violations at further call sites are only counted by [ts::violation_overflow_count]().
+/// It is `256` by default.
+#define TYPE_SAFE_VIOLATION_STATS_CAPACITY 256
+#endif
+
+namespace type_safe
+{
+    /// The recorded precondition violations of a single call site.
+    /// \module types
+    struct violation_record
+    {
+        debug_assert::source_location location;
+        const char*                   expression;
+        const char*                   message;
+        std::uint_least64_t           count;
+    };
+
+    /// The type of function that can be passed to [ts::set_violation_sampler]().
+    /// \module types
+    using violation_sampler = void (*)(const violation_record& record);
+
+    /// \exclude
+    namespace detail
+    {
+        struct violation_slot
+        {
+            std::atomic<unsigned>            state; // 0 = empty, 1 = being claimed, 2 = ready
+            const char*                      file;
+            unsigned                         line;
+            const char*                      expression;
+            const char*                      message;
+            std::atomic<std::uint_least64_t> count;
+        };
+
+        struct violation_registry
+        {
+            violation_slot                   slots[TYPE_SAFE_VIOLATION_STATS_CAPACITY];
+            std::atomic<std::uint_least64_t> overflow;
+            std::atomic<violation_sampler>   sampler;
+            std::atomic<std::uint_least64_t> sample_interval;
+        };
+
+        inline violation_registry& get_violation_registry() noexcept
+        {
+            // trivially default constructible, so it is zero initialized without a guard
+            static violation_registry registry;
+            return registry;
+        }
+
+        inline std::size_t hash_source_location(const debug_assert::source_location& loc) noexcept
+        {
+            // FNV-1a of the file name and line,
+            // the file name is hashed by content as string literals aren't merged across TUs
+            std::size_t hash = 2166136261u;
+            for (auto str = loc.file_name; *str; ++str)
+                hash = (hash ^ static_cast<unsigned char>(*str)) * 16777619u;
+            return (hash ^ loc.line_number) * 16777619u;
+        }
+
+        inline violation_slot* get_violation_slot(const debug_assert::source_location& loc,
+                                                  const char* expression,
+                                                  const char* message) noexcept
+        {
+            auto& registry = get_violation_registry();
+            auto  hash     = hash_source_location(loc);
+            for (std::size_t i = 0u; i != TYPE_SAFE_VIOLATION_STATS_CAPACITY; ++i)
+            {
+                auto& slot  = registry.slots[(hash + i) % TYPE_SAFE_VIOLATION_STATS_CAPACITY];
+                auto  state = slot.state.load(std::memory_order_acquire);
+                if (state == 0u
+                    && slot.state.compare_exchange_strong(state, 1u, std::memory_order_acquire))
+                {
+                    slot.file       = loc.file_name;
+                    slot.line       = loc.line_number;
+                    slot.expression = expression;
+                    slot.message    = message;
+                    slot.state.store(2u, std::memory_order_release);
+                    return &slot;
+                }
+
+                // slots are never released, so another thread claiming it will finish soon
+                while (state != 2u)
+                    state = slot.state.load(std::memory_order_acquire);
+                if (slot.line == loc.line_number && std::strcmp(slot.file, loc.file_name) == 0)
+                    return &slot;
+            }
+
+            return nullptr;
+        }
+
+        inline void on_precondition_violation(const debug_assert::source_location& loc,
+                                              const char* expression, const char* message) noexcept
+        {
+            auto& registry = get_violation_registry();
+            auto  slot     = get_violation_slot(loc, expression, message);
+            if (!slot)
+            {
+                registry.overflow.fetch_add(1u, std::memory_order_relaxed);
+                return;
+            }
+
+            auto count   = slot->count.fetch_add(1u, std::memory_order_relaxed) + 1u;
+            auto sampler = registry.sampler.load(std::memory_order_acquire);
+            if (sampler)
+            {
+                auto interval = registry.sample_interval.load(std::memory_order_relaxed);
+                if (count == 1u || (interval != 0u && count % interval == 0u))
+                    sampler(violation_record{loc, expression, message, count});
+            }
+        }
+    } // namespace detail
+
+    /// \returns A snapshot of the precondition violations recorded so far,
+    /// one [ts::violation_record]() for each call site that has been violated since the last reset.
+    /// \notes Violations are only recorded if [TYPE_SAFE_PRECONDITION_TELEMETRY]() is enabled.
+    /// The counters are read one by one,
+    /// so violations happening concurrently may or may not be included.
+    /// \module types
+    inline std::vector<violation_record> violation_stats()
+    {
+        std::vector<violation_record> result;
+        for (auto& slot : detail::get_violation_registry().slots)
+        {
+            if (slot.state.load(std::memory_order_acquire) != 2u)
+                continue;
+
+            auto count = slot.count.load(std::memory_order_relaxed);
+            if (count != 0u)
+                result.push_back(violation_record{{slot.file, slot.line},
+                                                  slot.expression,
+                                                  slot.message,
+                                                  count});
+        }
+        return result;
+    }
+
+    /// \returns The number of precondition violations that couldn't be attributed to their call site,
+    /// because [TYPE_SAFE_VIOLATION_STATS_CAPACITY]() other call sites have already been recorded.
+    /// \module types
+    inline std::uint_least64_t violation_overflow_count() noexcept
+    {
+        return detail::get_violation_registry().overflow.load(std::memory_order_relaxed);
+    }
+
+    /// \effects Resets all counters to zero.
+    /// \notes The call sites stay registered, they are just not reported until violated again.
+    /// \module types
+    inline void reset_violation_stats() noexcept
+    {
+        auto& registry = detail::get_violation_registry();
+        for (auto& slot : registry.slots)
+            slot.count.store(0u, std::memory_order_relaxed);
+        registry.overflow.store(0u, std::memory_order_relaxed);
+    }
+
+    /// \effects Sets the function that is called when a precondition violation is recorded,
+    /// for the first violation of each call site and then for every `interval`-th one.
+    /// This can be used to capture a stack trace using a platform specific API,
+    /// as the sampler is called directly from the violating function.
+    /// A `nullptr` disables sampling, an `interval` of zero only samples the first violation.
+    /// \requires `sampler` must not throw and must be safe to call from multiple threads.
+    /// \module types
+    inline void set_violation_sampler(violation_sampler   sampler,
+                                      std::uint_least64_t interval = 0u) noexcept
+    {
+        auto& registry = detail::get_violation_registry();
+        registry.sample_interval.store(interval, std::memory_order_relaxed);
+        registry.sampler.store(sampler, std::memory_order_release);
+    }
+} // namespace type_safe
+
+#endif // TYPE_SAFE_VIOLATION_STATS_HPP_INCLUDED
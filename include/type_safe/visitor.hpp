@@ -7,6 +7,11 @@
 
 #include <utility>
 
+#include <type_safe/detail/all_of.hpp>
+#include <type_safe/detail/index_sequence.hpp>
+#include <type_safe/detail/type_list.hpp>
+#include <type_safe/detail/variant_jump.hpp>
+#include <type_safe/boxed.hpp>
 #include <type_safe/optional.hpp>
 #include <type_safe/variant.hpp>
 
@@ -176,7 +181,7 @@ namespace type_safe
         class visit_variant_impl<AllowIncomplete, Visitor>
         {
             template <typename... Args>
-            static auto call_impl(int, Visitor&& visitor, Args&&... args)
+            static TYPE_SAFE_CONSTEXPR14 auto call_impl(int, Visitor&& visitor, Args&&... args)
                 -> decltype(std::forward<Visitor>(visitor)(std::forward<Args>(args)...))
             {
                 return std::forward<Visitor>(visitor)(std::forward<Args>(args)...);
@@ -190,7 +195,7 @@ namespace type_safe
 
         public:
             template <typename... Args>
-            static auto call(Visitor&& visitor, Args&&... args)
+            static TYPE_SAFE_CONSTEXPR14 auto call(Visitor&& visitor, Args&&... args)
                 -> decltype(call_impl(0, std::forward<Visitor>(visitor),
                                       std::forward<Args>(args)...))
             {
@@ -205,6 +210,12 @@ namespace type_safe
             return var.value(variant_type<Head>{});
         }
 
+        template <typename Variant, typename T, class Allocator, typename... Types>
+        T get_dummy_type(const Variant& var, variant_types<boxed<T, Allocator>, Types...>)
+        {
+            return var.value(variant_type<boxed<T, Allocator>>{}).value();
+        }
+
         template <typename Variant>
         auto get_dummy_type(const Variant& var)
             -> decltype(get_dummy_type(var, typename Variant::types{}))
@@ -212,179 +223,225 @@ namespace type_safe
             return get_dummy_type(var, typename Variant::types{});
         }
 
-        template <bool AllowIncomplete, typename Visitor, class Variant>
-        class visit_variant_impl<AllowIncomplete, Visitor, Variant>
-        {
-            template <typename, typename... Args,
-                      typename Variant2 = typename std::decay<Variant>::type>
-            static auto call_type(Visitor&& visitor, variant_types<>, Variant&& variant,
-                                  Args&&... args) ->
-                typename std::enable_if<Variant2::allow_empty::value,
-                                        decltype(visit_variant_impl<AllowIncomplete, Visitor>::call(
-                                            std::forward<Visitor>(visitor),
-                                            std::forward<Args>(args)..., nullvar))>::type
+        // common type of a list of types, where void is wildcard
+        template <typename... Ts>
+        struct common_type_list;
+
+        template <typename T>
+        struct common_type_list<T>
+        {
+            using type = T;
+        };
+
+        template <typename Head, typename... Tail>
+        struct common_type_list<Head, Tail...>
+        {
+            using type = common_type_t<Head, typename common_type_list<Tail...>::type>;
+        };
+
+        template <typename... Ts>
+        using common_type_list_t = typename common_type_list<Ts...>::type;
+
+        //=== flattened type ids ===//
+        // the type ids of multiple variants are combined into a single index, row-major,
+        // where each variant contributes its number of types plus one for the empty state
+        template <class Types>
+        struct variant_id_count_impl;
+
+        template <typename... Types>
+        struct variant_id_count_impl<variant_types<Types...>>
+        : std::integral_constant<std::size_t, sizeof...(Types) + 1u>
+        {
+        };
+
+        template <class Variant>
+        using variant_id_count =
+            variant_id_count_impl<typename std::decay<Variant>::type::types>;
+
+        constexpr std::size_t id_count_product() noexcept
+        {
+            return 1u;
+        }
+
+        template <typename... Tail>
+        constexpr std::size_t id_count_product(std::size_t head, Tail... tail) noexcept
+        {
+            return head * id_count_product(tail...);
+        }
+
+        constexpr std::size_t id_count_at(std::size_t) noexcept
+        {
+            return 1u;
+        }
+
+        template <typename... Tail>
+        constexpr std::size_t id_count_at(std::size_t i, std::size_t head, Tail... tail) noexcept
+        {
+            return i == 0u ? head : id_count_at(i - 1u, tail...);
+        }
+
+        constexpr std::size_t id_count_stride(std::size_t) noexcept
+        {
+            return 1u;
+        }
+
+        template <typename... Tail>
+        constexpr std::size_t id_count_stride(std::size_t i, std::size_t, Tail... tail) noexcept
+        {
+            return i == 0u ? id_count_product(tail...) : id_count_stride(i - 1u, tail...);
+        }
+
+        // the type id of the ith variant in the flattened index
+        template <class... Variants>
+        constexpr std::size_t unflatten_type_id(std::size_t index, std::size_t i) noexcept
+        {
+            return index / id_count_stride(i, variant_id_count<Variants>::value...)
+                   % id_count_at(i, variant_id_count<Variants>::value...);
+        }
+
+        template <class Variant>
+        constexpr std::size_t get_type_id_value(const Variant& variant) noexcept
+        {
+            return static_cast<std::size_t>(variant.type());
+        }
+
+        template <class... Variants>
+        TYPE_SAFE_CONSTEXPR14 std::size_t flatten_type_ids(const Variants&... variants) noexcept
+        {
+            const std::size_t ids[]    = {get_type_id_value(variants)...};
+            const std::size_t counts[] = {variant_id_count<Variants>::value...};
+
+            auto result = std::size_t(0u);
+            for (auto i = 0u; i != sizeof...(Variants); ++i)
+                result = result * counts[i] + ids[i];
+            return result;
+        }
+
+        //=== variant_unpack ===//
+        // obtains the value for a given type id of the variant
+        // type id 0 is the empty state, type id i is the (i - 1)th type
+        template <class Variant, class Types = typename std::decay<Variant>::type::types>
+        class variant_unpack;
+
+        template <class Variant, typename... Types>
+        class variant_unpack<Variant, variant_types<Types...>>
+        {
+            static TYPE_SAFE_CONSTEXPR14 nullvar_t get_empty(std::true_type,
+                                                             Variant&& variant) noexcept
             {
-                DEBUG_ASSERT(!variant.has_value(), assert_handler{},
-                             "it has a value but we are in this overload?!");
-                return visit_variant_impl<AllowIncomplete, Visitor>::call(std::forward<Visitor>(
-                                                                              visitor),
-                                                                          std::forward<Args>(
-                                                                              args)...,
-                                                                          nullvar);
+                if (variant.has_value())
+                    DEBUG_UNREACHABLE(assert_handler{},
+                                      "it has a value but we are in this overload?!");
+                return nullvar;
             }
 
-            template <typename, typename... Args,
-                      typename Variant2 = typename std::decay<Variant>::type>
-            static auto call_type(Visitor&& visitor, variant_types<>, Variant&& variant,
-                                  Args&&... args) ->
-                typename std::enable_if<!Variant2::allow_empty::value,
-                                        decltype(visit_variant_impl<AllowIncomplete, Visitor>::call(
-                                            std::forward<Visitor>(visitor),
-                                            std::forward<Args>(args)...,
-                                            get_dummy_type(variant)))>::type
+            static auto get_empty(std::false_type, Variant&& variant)
+                -> decltype(get_dummy_type(variant))
             {
                 DEBUG_ASSERT(!variant.has_value(), assert_handler{},
                              "it has a value but we are in this overload?!");
-                DEBUG_UNREACHABLE(precondition_error_handler{},
-                                  "variant in invalid state for visit");
-                return visit_variant_impl<AllowIncomplete, Visitor>::call(std::forward<Visitor>(
-                                                                              visitor),
-                                                                          std::forward<Args>(
-                                                                              args)...,
-                                                                          get_dummy_type(variant));
+                TYPE_SAFE_PRECONDITION_UNREACHABLE("variant in invalid state for visit");
+                return get_dummy_type(variant);
             }
 
-            template <typename RecursiveDecltype, typename Head, typename... Tail, typename... Args>
-            static auto call_type(Visitor&& visitor, variant_types<Head, Tail...>,
-                                  Variant&& variant, Args&&... args)
-                -> common_type_t<decltype(visit_variant_impl<AllowIncomplete, Visitor>::call(
-                                     std::forward<Visitor>(visitor), std::forward<Args>(args)...,
-                                     std::forward<Variant>(variant).value(variant_type<Head>{}))),
-                                 decltype(RecursiveDecltype::template call_type<RecursiveDecltype>(
-                                     std::forward<Visitor>(visitor), variant_types<Tail...>{},
-                                     std::forward<Variant>(variant), std::forward<Args>(args)...))>
+            static TYPE_SAFE_CONSTEXPR14 auto get_impl(variant_type<nullvar_t>, Variant&& variant)
+                -> decltype(get_empty(typename std::decay<Variant>::type::allow_empty{},
+                                      std::forward<Variant>(variant)))
             {
-                if (variant.has_value(variant_type<Head>{}))
-                    return visit_variant_impl<AllowIncomplete,
-                                              Visitor>::call(std::forward<Visitor>(visitor),
-                                                             std::forward<Args>(args)...,
-                                                             std::forward<Variant>(variant).value(
-                                                                 variant_type<Head>{}));
-                else
-                    return RecursiveDecltype::
-                        template call_type<RecursiveDecltype>(std::forward<Visitor>(visitor),
-                                                              variant_types<Tail...>{},
-                                                              std::forward<Variant>(variant),
-                                                              std::forward<Args>(args)...);
+                return get_empty(typename std::decay<Variant>::type::allow_empty{},
+                                 std::forward<Variant>(variant));
             }
 
-        public:
-            template <typename... Args>
-            static auto call(Visitor&& visitor, Variant&& variant, Args&&... args)
-                -> decltype(call_type<visit_variant_impl>(
-                    std::forward<Visitor>(visitor), typename std::decay<Variant>::type::types{},
-                    std::forward<Variant>(variant), std::forward<Args>(args)...))
+            template <typename T>
+            static TYPE_SAFE_CONSTEXPR14 auto get_impl(variant_type<T> type, Variant&& variant)
+                -> decltype(std::forward<Variant>(variant).value(type))
             {
-                return visit_variant_impl::
-                    call_type<visit_variant_impl>(std::forward<Visitor>(visitor),
-                                                  typename std::decay<Variant>::type::types{},
-                                                  std::forward<Variant>(variant),
-                                                  std::forward<Args>(args)...);
+                return std::forward<Variant>(variant).value(type);
             }
-        };
 
-        template <bool AllowIncomplete, typename Visitor, class Variant, class... Rest>
-        class visit_variant_impl<AllowIncomplete, Visitor, Variant, Rest...>
-        {
-            template <typename, typename... Args,
-                      typename Variant2 = typename std::decay<Variant>::type>
-            static auto call_type(Visitor&& visitor, variant_types<>, Variant&& variant,
-                                  Rest&&... rest, Args&&... args) -> typename std::
-                enable_if<Variant2::allow_empty::value,
-                          decltype(visit_variant_impl<AllowIncomplete, Visitor, Rest...>::call(
-                              std::forward<Visitor>(visitor), std::forward<Rest>(rest)...,
-                              std::forward<Args>(args)..., nullvar))>::type
+            // boxed values are unwrapped
+            template <typename T, class Allocator>
+            static auto get_impl(variant_type<boxed<T, Allocator>> type, Variant&& variant)
+                -> decltype(std::forward<Variant>(variant).value(type).value())
             {
-                DEBUG_ASSERT(std::decay<Variant>::type::allow_empty::value && !variant.has_value(),
-                             precondition_error_handler{}, "variant in invalid state for visitor");
-                return visit_variant_impl<AllowIncomplete, Visitor,
-                                          Rest...>::call(std::forward<Visitor>(visitor),
-                                                         std::forward<Rest>(rest)...,
-                                                         std::forward<Args>(args)..., nullvar);
+                return std::forward<Variant>(variant).value(type).value();
             }
 
-            template <typename, typename... Args,
-                      typename Variant2 = typename std::decay<Variant>::type>
-            static auto call_type(Visitor&& visitor, variant_types<>, Variant&& variant,
-                                  Rest&&... rest, Args&&... args) -> typename std::
-                enable_if<!Variant2::allow_empty::value,
-                          decltype(visit_variant_impl<AllowIncomplete, Visitor, Rest...>::call(
-                              std::forward<Visitor>(visitor), std::forward<Rest>(rest)...,
-                              std::forward<Args>(args)..., get_dummy_type(variant)))>::type
+        public:
+            template <std::size_t Id>
+            static TYPE_SAFE_CONSTEXPR14 auto get(Variant&& variant)
+                -> decltype(get_impl(variant_type<typename type_at<Id, nullvar_t, Types...>::type>{},
+                                     std::forward<Variant>(variant)))
             {
-                DEBUG_ASSERT(!variant.has_value(), assert_handler{},
-                             "it has a value but we are in this overload?!");
-                DEBUG_UNREACHABLE(precondition_error_handler{},
-                                  "variant in invalid state for visit");
-                return visit_variant_impl<AllowIncomplete, Visitor,
-                                          Rest...>::call(std::forward<Visitor>(visitor),
-                                                         std::forward<Rest>(rest)...,
-                                                         std::forward<Args>(args)...,
-                                                         get_dummy_type(variant));
+                using type = typename type_at<Id, nullvar_t, Types...>::type;
+                return get_impl(variant_type<type>{}, std::forward<Variant>(variant));
             }
+        };
 
-            template <typename RecursiveDecltype, typename Head, typename... Tail, typename... Args>
-            static auto call_type(Visitor&& visitor, variant_types<Head, Tail...>,
-                                  Variant&& variant, Rest&&... rest, Args&&... args)
-                -> common_type_t<decltype(
-                                     visit_variant_impl<AllowIncomplete, Visitor, Rest...>::call(
-                                         std::forward<Visitor>(visitor),
-                                         std::forward<Rest>(rest)..., std::forward<Args>(args)...,
-                                         std::forward<Variant>(variant).value(
-                                             variant_type<Head>{}))),
-                                 decltype(RecursiveDecltype::template call_type<RecursiveDecltype>(
-                                     std::forward<Visitor>(visitor), variant_types<Tail...>{},
-                                     std::forward<Variant>(variant), std::forward<Rest>(rest)...,
-                                     std::forward<Args>(args)...))>
+        template <bool AllowIncomplete, typename Visitor, class... Variants>
+        class visit_variant_impl
+        {
+            using next = visit_variant_impl<AllowIncomplete, Visitor>;
+
+            template <std::size_t I, std::size_t... Vs>
+            static TYPE_SAFE_CONSTEXPR14 auto call_unpacked(index_sequence<Vs...>,
+                                                            Visitor&& visitor,
+                                                            Variants&&... variants)
+                -> decltype(next::call(std::forward<Visitor>(visitor),
+                                       variant_unpack<Variants>::template get<
+                                           unflatten_type_id<Variants...>(I, Vs)>(
+                                           std::forward<Variants>(variants))...))
             {
-                if (variant.has_value(variant_type<Head>{}))
-                    return visit_variant_impl<AllowIncomplete, Visitor,
-                                              Rest...>::call(std::forward<Visitor>(visitor),
-                                                             std::forward<Rest>(rest)...,
-                                                             std::forward<Args>(args)...,
-                                                             std::forward<Variant>(variant).value(
-                                                                 variant_type<Head>{}));
-                else
-                    return RecursiveDecltype::
-                        template call_type<RecursiveDecltype>(std::forward<Visitor>(visitor),
-                                                              variant_types<Tail...>{},
-                                                              std::forward<Variant>(variant),
-                                                              std::forward<Rest>(rest)...,
-                                                              std::forward<Args>(args)...);
+                return next::call(std::forward<Visitor>(visitor),
+                                  variant_unpack<Variants>::template get<
+                                      unflatten_type_id<Variants...>(I, Vs)>(
+                                      std::forward<Variants>(variants))...);
             }
 
+            using positions = make_index_sequence<sizeof...(Variants)>;
+
+            template <class Indices>
+            class dispatcher;
+
+            template <std::size_t... Is>
+            class dispatcher<index_sequence<Is...>>
+            {
+            public:
+                using result = common_type_list_t<decltype(
+                    visit_variant_impl::call_unpacked<Is>(positions{}, std::declval<Visitor>(),
+                                                          std::declval<Variants>()...))...>;
+
+                using function = result (*)(Visitor&&, Variants&&...);
+
+                template <std::size_t I>
+                static TYPE_SAFE_CONSTEXPR14 result call(Visitor&& visitor, Variants&&... variants)
+                {
+                    return visit_variant_impl::call_unpacked<I>(positions{},
+                                                                std::forward<Visitor>(visitor),
+                                                                std::forward<Variants>(
+                                                                    variants)...);
+                }
+            };
+
+            using indices =
+                make_index_sequence<id_count_product(variant_id_count<Variants>::value...)>;
+
         public:
-            template <typename... Args>
-            static auto call(Visitor&& visitor, Variant&& variant, Rest&&... rest, Args&&... args)
-                -> decltype(call_type<visit_variant_impl>(
-                    std::forward<Visitor>(visitor), typename std::decay<Variant>::type::types{},
-                    std::forward<Variant>(variant), std::forward<Rest>(rest)...,
-                    std::forward<Args>(args)...))
+            static TYPE_SAFE_CONSTEXPR14 auto call(Visitor&& visitor, Variants&&... variants) ->
+                typename dispatcher<indices>::result
             {
-                return visit_variant_impl::
-                    call_type<visit_variant_impl>(std::forward<Visitor>(visitor),
-                                                  typename std::decay<Variant>::type::types{},
-                                                  std::forward<Variant>(variant),
-                                                  std::forward<Rest>(rest)...,
-                                                  std::forward<Args>(args)...);
+                return variant_jump<indices>::template call<dispatcher<indices>>(
+                    flatten_type_ids(variants...), std::forward<Visitor>(visitor),
+                    std::forward<Variants>(variants)...);
             }
         };
 
         template <class Visitor, class... Variants>
-        auto visit_variant(Visitor&& visitor, Variants&&... variants) -> decltype(
-            visit_variant_impl<visitor_allow_incomplete<Visitor>::value, Visitor&&,
-                               Variants&&...>::call(std::forward<Visitor>(visitor),
-                                                    std::forward<Variants>(variants)...))
+        TYPE_SAFE_CONSTEXPR14 auto visit_variant(Visitor&& visitor, Variants&&... variants)
+            -> decltype(visit_variant_impl<visitor_allow_incomplete<Visitor>::value, Visitor&&,
+                                           Variants&&...>::call(std::forward<Visitor>(visitor),
+                                                                std::forward<Variants>(
+                                                                    variants)...))
         {
             return visit_variant_impl<visitor_allow_incomplete<Visitor>::value, Visitor&&,
                                       Variants&&...>::call(std::forward<Visitor>(visitor),
@@ -397,6 +454,7 @@ namespace type_safe
     /// where `Ts...` are the types of the currently active element in the variant,
     /// i.e. it calls the `operator()` of the `visitor` where the `i`th argument is the currently stored value in the `i`th variant,
     /// perfectly forwarded.
+    /// If the active element is a [ts::boxed](), the stored value is passed instead.
     /// If the `i`th variant is empty and it allows the empty state,
     /// it passes `nullvar` as parameter,
     /// otherwise the behavior is undefined.
@@ -411,13 +469,301 @@ namespace type_safe
     template <class Visitor, class... Variants,
               typename = typename std::
                   enable_if<detail::all_of<detail::is_variant<Variants>::value...>::value>::type>
-    auto visit(Visitor&& visitor, Variants&&... variants)
+    TYPE_SAFE_CONSTEXPR14 auto visit(Visitor&& visitor, Variants&&... variants)
         -> decltype(detail::visit_variant(std::forward<Visitor>(visitor),
                                           std::forward<Variants>(variants)...))
     {
         return detail::visit_variant(std::forward<Visitor>(visitor),
                                      std::forward<Variants>(variants)...);
     }
+
+    /// \exclude
+    namespace detail
+    {
+        template <typename Functor>
+        struct match_otherwise
+        {
+            Functor functor;
+        };
+
+        // inherits the operator() of all handlers, the wildcard is stored separately
+        template <typename... Handlers>
+        struct match_overload;
+
+        template <typename Functor>
+        struct match_overload<match_otherwise<Functor>>
+        {
+            Functor otherwise;
+
+            explicit match_overload(match_otherwise<Functor> o) : otherwise(std::move(o.functor))
+            {
+            }
+        };
+
+        template <typename Handler>
+        struct match_overload<Handler> : Handler
+        {
+            explicit match_overload(Handler handler) : Handler(std::move(handler))
+            {
+            }
+
+            using Handler::operator();
+        };
+
+        template <typename Handler, typename Functor>
+        struct match_overload<Handler, match_otherwise<Functor>> : Handler
+        {
+            Functor otherwise;
+
+            match_overload(Handler handler, match_otherwise<Functor> o)
+            : Handler(std::move(handler)), otherwise(std::move(o.functor))
+            {
+            }
+
+            using Handler::operator();
+        };
+
+        template <typename Handler, typename... Tail>
+        struct match_overload<Handler, Tail...> : Handler, match_overload<Tail...>
+        {
+            match_overload(Handler handler, Tail... tail)
+            : Handler(std::move(handler)), match_overload<Tail...>(std::move(tail)...)
+            {
+            }
+
+            using Handler::operator();
+            using match_overload<Tail...>::operator();
+        };
+
+        template <typename T>
+        struct is_match_otherwise : std::false_type
+        {
+        };
+
+        template <typename Functor>
+        struct is_match_otherwise<match_otherwise<Functor>> : std::true_type
+        {
+        };
+
+        template <typename T>
+        struct match_void
+        {
+            using type = void;
+        };
+
+        // the parameter of a single, non-template call operator
+        template <typename MemFn>
+        struct match_member_parameter
+        {
+        };
+
+        template <class C, typename R, typename P>
+        struct match_member_parameter<R (C::*)(P)>
+        {
+            using type = P;
+        };
+
+        template <class C, typename R, typename P>
+        struct match_member_parameter<R (C::*)(P) const>
+        {
+            using type = P;
+        };
+
+#if defined(__cpp_noexcept_function_type)
+        template <class C, typename R, typename P>
+        struct match_member_parameter<R (C::*)(P) noexcept>
+        {
+            using type = P;
+        };
+
+        template <class C, typename R, typename P>
+        struct match_member_parameter<R (C::*)(P) const noexcept>
+        {
+            using type = P;
+        };
+#endif
+
+        template <typename Handler, typename = void>
+        struct match_parameter
+        {
+        };
+
+        template <typename Handler>
+        struct match_parameter<Handler, decltype(void(&Handler::operator()))>
+        : match_member_parameter<decltype(&Handler::operator())>
+        {
+        };
+
+        template <typename Param>
+        struct match_picked
+        {
+            using type = Param;
+        };
+
+        // has the same overload as the handler, but returns the parameter,
+        // which is void if it can't be determined, e.g. for a generic lambda
+        template <typename Handler, typename = void>
+        struct match_picker
+        {
+            template <typename Arg>
+            auto operator()(Arg&& arg) const
+                -> decltype(void(std::declval<Handler&>()(std::forward<Arg>(arg))),
+                            match_picked<void>{});
+        };
+
+        template <typename Handler>
+        struct match_picker<Handler,
+                            typename match_void<typename match_parameter<Handler>::type>::type>
+        {
+            match_picked<typename match_parameter<Handler>::type> operator()(
+                typename match_parameter<Handler>::type) const;
+        };
+
+        template <typename... Handlers>
+        struct match_pickers;
+
+        template <typename Handler>
+        struct match_pickers<Handler> : match_picker<Handler>
+        {
+            using match_picker<Handler>::operator();
+        };
+
+        template <typename Handler, typename... Tail>
+        struct match_pickers<Handler, Tail...> : match_picker<Handler>, match_pickers<Tail...>
+        {
+            using match_picker<Handler>::operator();
+            using match_pickers<Tail...>::operator();
+        };
+
+        // the parameter of the handler overload resolution picks for the argument
+        template <class Pickers, typename Arg, typename = void>
+        struct match_picked_parameter
+        {
+            using type = void;
+        };
+
+        template <class Pickers, typename Arg>
+        struct match_picked_parameter<Pickers, Arg,
+                                      typename match_void<decltype(std::declval<const Pickers&>()(
+                                          std::declval<Arg>()))>::type>
+        : decltype(std::declval<const Pickers&>()(std::declval<Arg>()))
+        {
+        };
+
+        template <typename T>
+        using match_is_number =
+            std::integral_constant<bool, std::is_arithmetic<T>::value || std::is_enum<T>::value>;
+
+        template <typename T>
+        using match_decay = typename std::decay<T>::type;
+
+        // narrowing if list-initialization of the parameter is ill-formed
+        template <typename Param, typename Arg, typename = void>
+        struct match_is_narrowing
+        : std::integral_constant<bool, match_is_number<match_decay<Param>>::value
+                                           && match_is_number<match_decay<Arg>>::value>
+        {
+        };
+
+        template <typename Param, typename Arg>
+        struct match_is_narrowing<
+            Param, Arg,
+            typename match_void<decltype(match_decay<Param>{std::declval<Arg>()})>::type>
+        : std::false_type
+        {
+        };
+
+        // with a wildcard, the picked handler must not narrow the value
+        template <bool Wildcard, class Pickers, typename... Args>
+        struct match_narrows : std::false_type
+        {
+        };
+
+        template <class Pickers, typename Arg>
+        struct match_narrows<true, Pickers, Arg>
+        : match_is_narrowing<typename match_picked_parameter<Pickers, Arg>::type, Arg>
+        {
+        };
+
+        template <typename... Handlers>
+        class matcher : match_overload<Handlers...>
+        {
+            using overload     = match_overload<Handlers...>;
+            using pickers      = match_pickers<Handlers...>;
+            using has_wildcard = std::integral_constant<
+                bool, !all_of<!is_match_otherwise<Handlers>::value...>::value>;
+
+            template <typename... Args,
+                      typename = typename std::enable_if<
+                          !match_narrows<has_wildcard::value, pickers, Args&&...>::value>::type>
+            auto call(int, Args&&... args)
+                -> decltype(std::declval<overload&>()(std::forward<Args>(args)...))
+            {
+                return static_cast<overload&>(*this)(std::forward<Args>(args)...);
+            }
+
+            // only called if no handler accepts the arguments
+            template <class Overload = overload, typename... Args>
+            auto call(short, Args&&...) -> decltype(std::declval<Overload&>().otherwise())
+            {
+                return static_cast<Overload&>(*this).otherwise();
+            }
+
+        public:
+            explicit matcher(Handlers... handlers) : overload(std::move(handlers)...)
+            {
+            }
+
+            template <typename... Args>
+            auto operator()(Args&&... args)
+                -> decltype(this->call(0, std::forward<Args>(args)...))
+            {
+                return call(0, std::forward<Args>(args)...);
+            }
+        };
+    } // namespace detail
+
+    /// \returns A wildcard for [ts::match]() that calls `functor()` without arguments
+    /// for all types no other handler accepts.
+    /// \notes If there is a wildcard, the handler is chosen by overload resolution as usual,
+    /// but if it would narrow an arithmetic or enumeration value, the wildcard is called instead,
+    /// i.e. a `double` is not passed to a handler taking an `int`.
+    /// This is only checked for handlers with a single non-template `operator()`,
+    /// like a non-generic lambda, as otherwise the parameter type isn't known.
+    /// \module variant
+    template <typename Functor>
+    detail::match_otherwise<typename std::decay<Functor>::type> otherwise(Functor&& functor)
+    {
+        return {std::forward<Functor>(functor)};
+    }
+
+    /// Pattern matching on a [ts::basic_variant]().
+    /// \effects Combines all `handlers` into one overload set and [ts::visit]()s the variant,
+    /// i.e. it calls the handler whose `operator()` is the best match for the active value.
+    /// The last handler can be a [ts::otherwise]() wildcard,
+    /// which is called for all types that no other handler accepts without narrowing conversion.
+    /// If a type isn't accepted by any handler and there is no wildcard,
+    /// the program is ill-formed.
+    /// This includes the empty state, if the variant allows it,
+    /// then it needs a handler for [ts::nullvar_t]().
+    /// \returns The result of the chosen handler,
+    /// its type is the common type of all possible handlers.
+    /// \requires Each handler must be a function object of a different class type, like a lambda.
+    /// \notes It dispatches via a single `switch` or jump table on the type id,
+    /// like [ts::visit](), and the handlers can be inlined there.
+    /// \exclude return
+    /// \module variant
+    template <class Variant, typename... Handlers,
+              typename = typename std::enable_if<detail::is_variant<Variant>::value>::type>
+    auto match(Variant&& variant, Handlers&&... handlers)
+        -> decltype(visit(detail::matcher<typename std::decay<Handlers>::type...>(
+                              std::forward<Handlers>(handlers)...),
+                          std::forward<Variant>(variant)))
+    {
+        return visit(detail::matcher<typename std::decay<Handlers>::type...>(
+                         std::forward<Handlers>(handlers)...),
+                     std::forward<Variant>(variant));
+    }
 } // namespace type_safe
 
 #endif // TYPE_SAFE_VISITOR_HPP_INCLUDED
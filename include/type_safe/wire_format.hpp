@@ -0,0 +1,734 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_WIRE_FORMAT_HPP_INCLUDED
+#define TYPE_SAFE_WIRE_FORMAT_HPP_INCLUDED
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <type_safe/boolean.hpp>
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/flag_set.hpp>
+#include <type_safe/floating_point.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/optional.hpp>
+#include <type_safe/reference.hpp>
+#include <type_safe/strong_typedef.hpp>
+#include <type_safe/variant.hpp>
+
+namespace type_safe
+{
+    static_assert(CHAR_BIT == 8, "wire format requires 8 bit bytes");
+
+    /// Describes the wire format of a `T`.
+    ///
+    /// Every supported type has a fixed size encoding without any alignment or padding,
+    /// so it can be read in place from any buffer, e.g. a memory mapped file or a network packet:
+    /// * integers and enumerations are stored as `sizeof(T)` bytes in little endian,
+    /// using the two's complement for signed integers
+    /// * `bool` and [ts::boolean]() are stored as a single byte that is `0` or `1`
+    /// * floating points are stored as the little endian bytes of their IEEE 754 representation
+    /// * [ts::integer]() and [ts::floating_point]() are stored as the type they wrap
+    /// * [ts::strong_typedef]() is stored as its underlying type
+    /// * [ts::basic_optional]() is stored as a presence byte that is `0` or `1`,
+    /// followed by the encoding of the value, which is all zeros if there is none;
+    /// reading any other presence byte is a precondition violation
+    /// * [ts::basic_variant]() is stored as a tag with the width of its `type_id`,
+    /// i.e. `0` if it is empty and `i` for the `i`th type,
+    /// followed by the encoding of the value, padded with zeros to the size of the largest type
+    /// * [ts::flag_set]() is stored as its integer representation,
+    /// with the width of the smallest unsigned integer type that has a bit for each flag;
+    /// with more than 64 flags it is stored as one 8 byte integer for each group of 64 flags,
+    /// so the `i`th flag is always bit `i % 8` of byte `i / 8`
+    ///
+    /// A specialization must provide a `static constexpr std::size_t size()` function
+    /// returning the size of the encoding,
+    /// a `static void write(unsigned char* out, const T& value)` function
+    /// that writes `size()` bytes to `out`,
+    /// and a `static T read(const unsigned char* in)` function that reads them back.
+    /// It can be specialized for user-defined types.
+    /// \module types
+    template <typename T, typename = void>
+    struct wire_traits;
+
+    /// \exclude
+    namespace detail
+    {
+        template <std::size_t Size>
+        struct wire_uint;
+
+        template <>
+        struct wire_uint<1u>
+        {
+            using type = std::uint8_t;
+        };
+
+        template <>
+        struct wire_uint<2u>
+        {
+            using type = std::uint16_t;
+        };
+
+        template <>
+        struct wire_uint<4u>
+        {
+            using type = std::uint32_t;
+        };
+
+        template <>
+        struct wire_uint<8u>
+        {
+            using type = std::uint64_t;
+        };
+
+        template <typename T>
+        using wire_uint_for = typename wire_uint<sizeof(T)>::type;
+
+        // byte by byte, so it doesn't depend on the endianness or alignment,
+        // compilers turn it into a single (unaligned) load or store
+        template <typename UInt>
+        void store_little_endian(unsigned char* out, UInt value) noexcept
+        {
+            for (std::size_t i = 0u; i != sizeof(UInt); ++i)
+                out[i] = static_cast<unsigned char>(value >> (i * CHAR_BIT));
+        }
+
+        template <typename UInt>
+        UInt load_little_endian(const unsigned char* in) noexcept
+        {
+            UInt result = 0u;
+            for (std::size_t i = 0u; i != sizeof(UInt); ++i)
+                result = static_cast<UInt>(result | UInt(UInt(in[i]) << (i * CHAR_BIT)));
+            return result;
+        }
+
+        template <typename T>
+        struct wire_integer
+        {
+            static constexpr std::size_t size() noexcept
+            {
+                return sizeof(T);
+            }
+
+            static void write(unsigned char* out, const T& value) noexcept
+            {
+                store_little_endian(out, static_cast<wire_uint_for<T>>(value));
+            }
+
+            static T read(const unsigned char* in) noexcept
+            {
+                return static_cast<T>(load_little_endian<wire_uint_for<T>>(in));
+            }
+        };
+
+        template <typename T>
+        struct wire_enum
+        {
+            using underlying = typename std::underlying_type<T>::type;
+
+            static constexpr std::size_t size() noexcept
+            {
+                return sizeof(T);
+            }
+
+            static void write(unsigned char* out, const T& value) noexcept
+            {
+                wire_integer<underlying>::write(out, static_cast<underlying>(value));
+            }
+
+            static T read(const unsigned char* in) noexcept
+            {
+                return static_cast<T>(wire_integer<underlying>::read(in));
+            }
+        };
+
+        template <typename T>
+        using enable_wire_integer = typename std::enable_if<
+            std::is_integral<T>::value && !std::is_same<T, bool>::value>::type;
+    } // namespace detail
+
+    /// \exclude
+    template <typename T>
+    struct wire_traits<T, detail::enable_wire_integer<T>> : detail::wire_integer<T>
+    {
+    };
+
+    /// \exclude
+    template <typename T>
+    struct wire_traits<T, typename std::enable_if<std::is_enum<T>::value>::type>
+    : detail::wire_enum<T>
+    {
+    };
+
+    /// \exclude
+    template <>
+    struct wire_traits<bool>
+    {
+        static constexpr std::size_t size() noexcept
+        {
+            return 1u;
+        }
+
+        static void write(unsigned char* out, const bool& value) noexcept
+        {
+            *out = value ? 1u : 0u;
+        }
+
+        static bool read(const unsigned char* in) noexcept
+        {
+            return *in != 0u;
+        }
+    };
+
+    /// \exclude
+    template <typename T>
+    struct wire_traits<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+    {
+        static_assert(std::numeric_limits<T>::is_iec559, "wire format requires IEEE 754");
+
+        static constexpr std::size_t size() noexcept
+        {
+            return sizeof(T);
+        }
+
+        static void write(unsigned char* out, const T& value) noexcept
+        {
+            detail::wire_uint_for<T> bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            detail::store_little_endian(out, bits);
+        }
+
+        static T read(const unsigned char* in) noexcept
+        {
+            auto bits = detail::load_little_endian<detail::wire_uint_for<T>>(in);
+            T    result;
+            std::memcpy(&result, &bits, sizeof(T));
+            return result;
+        }
+    };
+
+    /// \exclude
+    template <>
+    struct wire_traits<boolean>
+    {
+        static constexpr std::size_t size() noexcept
+        {
+            return 1u;
+        }
+
+        static void write(unsigned char* out, const boolean& value) noexcept
+        {
+            wire_traits<bool>::write(out, static_cast<bool>(value));
+        }
+
+        static boolean read(const unsigned char* in) noexcept
+        {
+            return boolean(wire_traits<bool>::read(in));
+        }
+    };
+
+    /// \exclude
+    template <typename IntegerT, class Policy>
+    struct wire_traits<integer<IntegerT, Policy>>
+    {
+        static constexpr std::size_t size() noexcept
+        {
+            return wire_traits<IntegerT>::size();
+        }
+
+        static void write(unsigned char* out, const integer<IntegerT, Policy>& value) noexcept
+        {
+            wire_traits<IntegerT>::write(out, value.get());
+        }
+
+        static integer<IntegerT, Policy> read(const unsigned char* in) noexcept
+        {
+            return integer<IntegerT, Policy>(wire_traits<IntegerT>::read(in));
+        }
+    };
+
+    /// \exclude
+    template <typename FloatT>
+    struct wire_traits<floating_point<FloatT>>
+    {
+        static constexpr std::size_t size() noexcept
+        {
+            return wire_traits<FloatT>::size();
+        }
+
+        static void write(unsigned char* out, const floating_point<FloatT>& value) noexcept
+        {
+            wire_traits<FloatT>::write(out, value.get());
+        }
+
+        static floating_point<FloatT> read(const unsigned char* in) noexcept
+        {
+            return floating_point<FloatT>(wire_traits<FloatT>::read(in));
+        }
+    };
+
+    /// \exclude
+    template <typename StrongTypedef>
+    struct wire_traits<StrongTypedef,
+                       decltype(void(detail::underlying_type(std::declval<StrongTypedef>())))>
+    {
+        using underlying = type_safe::underlying_type<StrongTypedef>;
+
+        static constexpr std::size_t size() noexcept
+        {
+            return wire_traits<underlying>::size();
+        }
+
+        static void write(unsigned char* out, const StrongTypedef& value)
+        {
+            wire_traits<underlying>::write(out, static_cast<const underlying&>(value));
+        }
+
+        static StrongTypedef read(const unsigned char* in)
+        {
+            return StrongTypedef(wire_traits<underlying>::read(in));
+        }
+    };
+
+    /// \exclude
+    template <class StoragePolicy>
+    struct wire_traits<basic_optional<StoragePolicy>>
+    {
+        using optional_type = basic_optional<StoragePolicy>;
+        using value_traits  = wire_traits<typename optional_type::value_type>;
+
+        static constexpr std::size_t size() noexcept
+        {
+            return 1u + value_traits::size();
+        }
+
+        static void write(unsigned char* out, const optional_type& value)
+        {
+            if (value.has_value())
+            {
+                *out = 1u;
+                value_traits::write(out + 1, value.value());
+            }
+            else
+                std::memset(out, 0, size());
+        }
+
+        static bool read_presence(const unsigned char* in) noexcept
+        {
+            TYPE_SAFE_PRECONDITION(*in <= 1u, "invalid optional presence byte");
+            return *in == 1u;
+        }
+
+        static optional_type read(const unsigned char* in)
+        {
+            return read_presence(in) ? optional_type(value_traits::read(in + 1)) :
+                                       optional_type(nullopt);
+        }
+    };
+
+    /// \exclude
+    namespace detail
+    {
+        constexpr std::size_t wire_max_size() noexcept
+        {
+            return 0u;
+        }
+
+        template <typename... Sizes>
+        constexpr std::size_t wire_max_size(std::size_t head, Sizes... tail) noexcept
+        {
+            return head > wire_max_size(tail...) ? head : wire_max_size(tail...);
+        }
+
+        template <class Variant, typename... Types>
+        struct wire_variant_alternatives;
+
+        template <class Variant>
+        struct wire_variant_alternatives<Variant>
+        {
+            static void write(unsigned char*, const Variant&) noexcept
+            {
+            }
+
+            static Variant read(const unsigned char*, std::size_t) noexcept
+            {
+                return Variant(nullvar);
+            }
+        };
+
+        template <class Variant, typename Head, typename... Tail>
+        struct wire_variant_alternatives<Variant, Head, Tail...>
+        {
+            using next = wire_variant_alternatives<Variant, Tail...>;
+
+            static void write(unsigned char* out, const Variant& variant)
+            {
+                if (variant.has_value(variant_type<Head>{}))
+                    wire_traits<Head>::write(out, variant.value(variant_type<Head>{}));
+                else
+                    next::write(out, variant);
+            }
+
+            // index is 1 for Head
+            static Variant read(const unsigned char* in, std::size_t index)
+            {
+                // the last type of a variant that can't be empty is read without checking,
+                // the index has already been validated
+                return read(in, index,
+                            std::integral_constant<bool, sizeof...(Tail) == 0u
+                                                             && !Variant::allow_empty::value>{});
+            }
+
+            static Variant read(const unsigned char* in, std::size_t, std::true_type)
+            {
+                return Variant(variant_type<Head>{}, wire_traits<Head>::read(in));
+            }
+
+            static Variant read(const unsigned char* in, std::size_t index, std::false_type)
+            {
+                return index == 1u ? Variant(variant_type<Head>{}, wire_traits<Head>::read(in)) :
+                                     next::read(in, index - 1u);
+            }
+        };
+    } // namespace detail
+
+    /// \exclude
+    template <class VariantPolicy, typename HeadT, typename... TailT>
+    struct wire_traits<basic_variant<VariantPolicy, HeadT, TailT...>>
+    {
+        using variant_type_ = basic_variant<VariantPolicy, HeadT, TailT...>;
+        using tag_type      = type_safe::underlying_type<typename variant_type_::type_id>;
+        using alternatives  = detail::wire_variant_alternatives<variant_type_, HeadT, TailT...>;
+
+        static constexpr std::size_t tag_size() noexcept
+        {
+            return wire_traits<tag_type>::size();
+        }
+
+        static constexpr std::size_t payload_size() noexcept
+        {
+            return detail::wire_max_size(wire_traits<HeadT>::size(),
+                                         wire_traits<TailT>::size()...);
+        }
+
+        static constexpr std::size_t size() noexcept
+        {
+            return tag_size() + payload_size();
+        }
+
+        static void write(unsigned char* out, const variant_type_& value)
+        {
+            wire_traits<tag_type>::write(out, static_cast<tag_type>(
+                                                  static_cast<std::size_t>(value.type())));
+            std::memset(out + tag_size(), 0, payload_size());
+            alternatives::write(out + tag_size(), value);
+        }
+
+        static std::size_t read_index(const unsigned char* in) noexcept
+        {
+            return static_cast<std::size_t>(wire_traits<tag_type>::read(in));
+        }
+
+        static variant_type_ read(const unsigned char* in)
+        {
+            auto index = read_index(in);
+            TYPE_SAFE_PRECONDITION(index <= 1u + sizeof...(TailT)
+                                       && (variant_type_::allow_empty::value || index != 0u),
+                                   "invalid variant tag");
+            return alternatives::read(in + tag_size(), index);
+        }
+    };
+
+    /// \exclude
+    namespace detail
+    {
+        template <typename Enum, typename IntType = typename flag_set_impl<Enum>::int_type>
+        struct wire_flag_set
+        {
+            using impl = flag_set_impl<Enum>;
+
+            static constexpr std::size_t size() noexcept
+            {
+                return wire_traits<IntType>::size();
+            }
+
+            static void write(unsigned char* out, const flag_set<Enum>& value) noexcept
+            {
+                wire_traits<IntType>::write(out, value.template to_int<IntType>());
+            }
+
+            static flag_set<Enum> read(const unsigned char* in) noexcept
+            {
+                // bits without a flag are ignored
+                auto bits =
+                    impl::from_int(wire_traits<IntType>::read(in)).bitwise_and(impl::all_set());
+                return flag_set<Enum>(flag_combo<Enum>(bits));
+            }
+        };
+
+        // more flags than the biggest integer, stored like one little endian integer per word
+        template <typename Enum, std::size_t N>
+        struct wire_flag_set<Enum, flag_set_words<N>>
+        {
+            static constexpr std::size_t size() noexcept
+            {
+                return N * sizeof(flag_set_word);
+            }
+
+            static void write(unsigned char* out, const flag_set<Enum>& value) noexcept
+            {
+                std::memset(out, 0, size());
+                for (Enum flag : value)
+                {
+                    auto  index = static_cast<std::size_t>(flag);
+                    auto& byte  = out[index / CHAR_BIT];
+                    byte        = static_cast<unsigned char>(byte | (1u << (index % CHAR_BIT)));
+                }
+            }
+
+            static flag_set<Enum> read(const unsigned char* in) noexcept
+            {
+                // bits without a flag are ignored
+                flag_set<Enum> result;
+                for (std::size_t i = 0u; i != flag_set_traits<Enum>::size(); ++i)
+                    if ((in[i / CHAR_BIT] >> (i % CHAR_BIT)) & 1u)
+                        result.set(static_cast<Enum>(i));
+                return result;
+            }
+        };
+    } // namespace detail
+
+    /// \exclude
+    template <typename Enum>
+    struct wire_traits<flag_set<Enum>> : detail::wire_flag_set<Enum>
+    {
+    };
+
+    /// \returns The size of the encoding of a `T` in bytes,
+    /// as specified by the [ts::wire_traits]().
+    /// \module types
+    template <typename T>
+    constexpr std::size_t wire_size() noexcept
+    {
+        return wire_traits<T>::size();
+    }
+
+    /// \effects Writes the encoding of `value` to the beginning of `buffer`.
+    /// \returns The number of bytes written, i.e. [ts::wire_size]().
+    /// \requires `buffer` must have at least [ts::wire_size]() bytes.
+    /// \module types
+    template <typename T>
+    std::size_t write_wire(array_ref<unsigned char> buffer, const T& value)
+    {
+        TYPE_SAFE_PRECONDITION(static_cast<std::size_t>(buffer.size()) >= wire_size<T>(),
+                               "buffer too small");
+        wire_traits<T>::write(buffer.data(), value);
+        return wire_size<T>();
+    }
+
+    /// \exclude
+    namespace detail
+    {
+        template <typename T>
+        class wire_view_base
+        {
+        public:
+            using value_type = T;
+
+            explicit wire_view_base(array_ref<const unsigned char> buffer) noexcept
+            : data_(buffer.data())
+            {
+                TYPE_SAFE_PRECONDITION(static_cast<std::size_t>(buffer.size()) >= wire_size<T>(),
+                                       "buffer too small");
+            }
+
+            // the bytes of the encoding
+            array_ref<const unsigned char> bytes() const noexcept
+            {
+                return array_ref<const unsigned char>(data_, wire_size<T>());
+            }
+
+            // the decoded value
+            T get() const
+            {
+                return wire_traits<T>::read(data_);
+            }
+
+        protected:
+            const unsigned char* data_;
+        };
+    } // namespace detail
+
+    /// A view of the encoding of a `T` in a buffer.
+    ///
+    /// It is a pointer into the buffer, creating it as well as copying it
+    /// does not read or validate the encoding.
+    /// `bytes()` returns the bytes of the encoding and `get()` decodes the value.
+    /// The specializations for [ts::basic_optional](), [ts::basic_variant]() and [ts::flag_set]()
+    /// provide access to the parts of the value without decoding all of it.
+    /// \requires `T` must be supported by the [ts::wire_traits]().
+    /// \module types
+    template <typename T>
+    class wire_view : public detail::wire_view_base<T>
+    {
+    public:
+        /// \effects Creates a view of the encoding at the beginning of `buffer`.
+        /// \requires `buffer` must have at least [ts::wire_size]() bytes,
+        /// and it must outlive the view.
+        explicit wire_view(array_ref<const unsigned char> buffer) noexcept
+        : detail::wire_view_base<T>(buffer)
+        {
+        }
+    };
+
+    /// A view of the encoding of a [ts::basic_optional]().
+    /// \module types
+    template <class StoragePolicy>
+    class wire_view<basic_optional<StoragePolicy>>
+    : public detail::wire_view_base<basic_optional<StoragePolicy>>
+    {
+        using base       = detail::wire_view_base<basic_optional<StoragePolicy>>;
+        using value_type = typename basic_optional<StoragePolicy>::value_type;
+
+    public:
+        /// \effects Same as the primary template.
+        explicit wire_view(array_ref<const unsigned char> buffer) noexcept : base(buffer)
+        {
+        }
+
+        /// \returns Whether or not the encoded optional has a value.
+        /// \requires The presence byte must be `0` or `1`.
+        bool has_value() const noexcept
+        {
+            return wire_traits<basic_optional<StoragePolicy>>::read_presence(this->data_);
+        }
+
+        /// \returns A view of the encoded value.
+        /// \requires `has_value() == true`.
+        wire_view<value_type> value() const noexcept
+        {
+            TYPE_SAFE_PRECONDITION(has_value(), "optional does not have a value");
+            return wire_view<value_type>(
+                array_ref<const unsigned char>(this->data_ + 1, wire_size<value_type>()));
+        }
+    };
+
+    /// A view of the encoding of a [ts::basic_variant]().
+    /// \module types
+    template <class VariantPolicy, typename HeadT, typename... TailT>
+    class wire_view<basic_variant<VariantPolicy, HeadT, TailT...>>
+    : public detail::wire_view_base<basic_variant<VariantPolicy, HeadT, TailT...>>
+    {
+        using variant_type_ = basic_variant<VariantPolicy, HeadT, TailT...>;
+        using base          = detail::wire_view_base<variant_type_>;
+        using traits        = wire_traits<variant_type_>;
+
+    public:
+        /// \effects Same as the primary template.
+        explicit wire_view(array_ref<const unsigned char> buffer) noexcept : base(buffer)
+        {
+        }
+
+        /// \returns The encoded tag of the variant,
+        /// i.e. `0` if it is empty and `i` if it stores the `i`th type,
+        /// the same as `static_cast<std::size_t>(variant.type())`.
+        std::size_t index() const noexcept
+        {
+            return traits::read_index(this->data_);
+        }
+
+        /// \returns Whether or not the encoded variant has a value (1)/a value of type `T` (2).
+        /// \group has_value
+        bool has_value() const noexcept
+        {
+            return index() != 0u;
+        }
+
+        /// \group has_value
+        template <typename T>
+        bool has_value(variant_type<T>) const noexcept
+        {
+            return index() == detail::get_type_index<T, HeadT, TailT...>::value;
+        }
+
+        /// \returns A view of the encoded value of type `T`.
+        /// \requires `has_value(type) == true`.
+        template <typename T>
+        wire_view<T> value(variant_type<T> type) const noexcept
+        {
+            static_assert(detail::get_type_index<T, HeadT, TailT...>::value != 0u,
+                          "not a type of the variant");
+            TYPE_SAFE_PRECONDITION(has_value(type), "wrong type");
+            return wire_view<T>(
+                array_ref<const unsigned char>(this->data_ + traits::tag_size(), wire_size<T>()));
+        }
+    };
+
+    /// A view of the encoding of a [ts::flag_set]().
+    /// \module types
+    template <typename Enum>
+    class wire_view<flag_set<Enum>> : public detail::wire_view_base<flag_set<Enum>>
+    {
+        using base = detail::wire_view_base<flag_set<Enum>>;
+
+    public:
+        /// \effects Same as the primary template.
+        explicit wire_view(array_ref<const unsigned char> buffer) noexcept : base(buffer)
+        {
+        }
+
+        /// \returns Whether or not the given flag is set in the encoded set.
+        bool is_set(const Enum& flag) const noexcept
+        {
+            auto index = static_cast<std::size_t>(flag);
+            return (this->data_[index / CHAR_BIT] >> (index % CHAR_BIT)) & 1u;
+        }
+    };
+
+    /// A view of consecutive encodings of `T`s in a buffer,
+    /// e.g. a stream of records that have been written with [ts::write_wire]() one after the other.
+    ///
+    /// Like [ts::wire_view]() it does not read or validate anything on creation.
+    /// \module types
+    template <typename T>
+    class wire_array_view
+    {
+    public:
+        using value_type = T;
+
+        /// \effects Creates a view of all complete encodings in `buffer`,
+        /// trailing bytes that don't form a complete encoding are ignored.
+        /// \requires `buffer` must outlive the view.
+        explicit wire_array_view(array_ref<const unsigned char> buffer) noexcept
+        : data_(buffer.data()), size_(static_cast<std::size_t>(buffer.size()) / wire_size<T>())
+        {
+        }
+
+        /// \returns The number of encodings.
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// \returns A view of the `i`th encoding.
+        /// \requires `i < size()`.
+        wire_view<T> operator[](index_t i) const noexcept
+        {
+            auto index = static_cast<std::size_t>(get(i));
+            TYPE_SAFE_PRECONDITION(index < size_, "out of bounds wire access");
+            return wire_view<T>(
+                array_ref<const unsigned char>(data_ + index * wire_size<T>(), wire_size<T>()));
+        }
+
+    private:
+        const unsigned char* data_;
+        std::size_t          size_;
+    };
+} // namespace type_safe
+
+#endif // TYPE_SAFE_WIRE_FORMAT_HPP_INCLUDED
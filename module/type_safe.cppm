@@ -0,0 +1,507 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// the C++20 module interface of the library, i.e. `import type_safe;`:
+// the headers are included in the global module fragment,
+// so the entities are still attached to the global module
+// and the module can be used together with the headers in another translation unit,
+// the module itself only exports them by using declarations
+
+module;
+
+#include <type_safe/arena.hpp>
+#include <type_safe/arithmetic_policy.hpp>
+#include <type_safe/atomic_flag.hpp>
+#include <type_safe/atomic_flag_set.hpp>
+#include <type_safe/batch_arithmetic.hpp>
+#include <type_safe/batch_constrained.hpp>
+#include <type_safe/batch_visit.hpp>
+#include <type_safe/boolean.hpp>
+#include <type_safe/boolean_array.hpp>
+#include <type_safe/bounded_type.hpp>
+#include <type_safe/boxed.hpp>
+#include <type_safe/compact_optional.hpp>
+#include <type_safe/compact_variant.hpp>
+#include <type_safe/config.hpp>
+#include <type_safe/constrained_type.hpp>
+#include <type_safe/deferred_array.hpp>
+#include <type_safe/deferred_construction.hpp>
+#include <type_safe/downcast.hpp>
+#include <type_safe/fixed_point.hpp>
+#include <type_safe/flag.hpp>
+#include <type_safe/flag_set.hpp>
+#include <type_safe/floating_point.hpp>
+#include <type_safe/format.hpp>
+#include <type_safe/function.hpp>
+#include <type_safe/fwd.hpp>
+#include <type_safe/id_map.hpp>
+#include <type_safe/index.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/interned.hpp>
+#include <type_safe/layout_info.hpp>
+#include <type_safe/lazy.hpp>
+#include <type_safe/mdarray_ref.hpp>
+#include <type_safe/narrow_cast.hpp>
+#include <type_safe/optional.hpp>
+#include <type_safe/optional_ref.hpp>
+#include <type_safe/optional_vector.hpp>
+#include <type_safe/output_parameter.hpp>
+#include <type_safe/parallel_reduce.hpp>
+#include <type_safe/parse.hpp>
+#include <type_safe/precondition_sampling.hpp>
+#include <type_safe/quantity.hpp>
+#include <type_safe/ranged_integer.hpp>
+#include <type_safe/reference.hpp>
+#include <type_safe/relocation.hpp>
+#include <type_safe/result.hpp>
+#include <type_safe/slot_map.hpp>
+#include <type_safe/strong_typedef.hpp>
+#include <type_safe/tagged_object_ref.hpp>
+#include <type_safe/tagged_union.hpp>
+#include <type_safe/types.hpp>
+#include <type_safe/variant.hpp>
+#include <type_safe/variant_ring.hpp>
+#include <type_safe/variant_vector.hpp>
+#include <type_safe/violation_stats.hpp>
+#include <type_safe/visitor.hpp>
+#include <type_safe/wire_format.hpp>
+
+export module type_safe;
+
+export namespace type_safe
+{
+    //=== types ===//
+    using type_safe::arithmetic_policy_default;
+    using type_safe::checked_arithmetic;
+    using type_safe::default_arithmetic;
+    using type_safe::saturating_arithmetic;
+    using type_safe::undefined_behavior_arithmetic;
+    using type_safe::wrapping_arithmetic;
+
+    using type_safe::boolean;
+    using type_safe::equal_to;
+    using type_safe::greater;
+    using type_safe::greater_equal;
+    using type_safe::less;
+    using type_safe::less_equal;
+    using type_safe::not_equal_to;
+
+    using type_safe::abs;
+    using type_safe::integer;
+    using type_safe::make_signed;
+    using type_safe::make_signed_t;
+    using type_safe::make_unsigned;
+    using type_safe::make_unsigned_t;
+    using type_safe::ranged_integer;
+
+    using type_safe::almost_equal_abs;
+    using type_safe::almost_equal_rel;
+    using type_safe::almost_equal_ulps;
+    using type_safe::floating_point;
+    using type_safe::fma;
+    using type_safe::mul_add;
+    using type_safe::ulp_distance;
+
+    using type_safe::batch_add;
+    using type_safe::batch_mul;
+    using type_safe::batch_sub;
+    using type_safe::batch_sum;
+    using type_safe::checked_reduce;
+    using type_safe::checked_transform_reduce;
+
+    using type_safe::binary_fixed_point;
+    using type_safe::decimal_fixed_point;
+    using type_safe::fixed_point;
+
+    using type_safe::dimension;
+    using type_safe::dimension_divide;
+    using type_safe::dimension_multiply;
+    using type_safe::quantity;
+    using type_safe::quantity_cast;
+
+    using type_safe::bool_t;
+    using type_safe::double_t;
+    using type_safe::float_t;
+    using type_safe::int16_t;
+    using type_safe::int32_t;
+    using type_safe::int64_t;
+    using type_safe::int8_t;
+    using type_safe::int_fast16_t;
+    using type_safe::int_fast32_t;
+    using type_safe::int_fast64_t;
+    using type_safe::int_fast8_t;
+    using type_safe::int_least16_t;
+    using type_safe::int_least32_t;
+    using type_safe::int_least64_t;
+    using type_safe::int_least8_t;
+    using type_safe::int_t;
+    using type_safe::intmax_t;
+    using type_safe::intptr_t;
+    using type_safe::ptrdiff_t;
+    using type_safe::size_t;
+    using type_safe::uint16_t;
+    using type_safe::uint32_t;
+    using type_safe::uint64_t;
+    using type_safe::uint8_t;
+    using type_safe::uint_fast16_t;
+    using type_safe::uint_fast32_t;
+    using type_safe::uint_fast64_t;
+    using type_safe::uint_fast8_t;
+    using type_safe::uint_least16_t;
+    using type_safe::uint_least32_t;
+    using type_safe::uint_least64_t;
+    using type_safe::uint_least8_t;
+    using type_safe::uintmax_t;
+    using type_safe::uintptr_t;
+    using type_safe::unsigned_t;
+
+    using type_safe::narrow_cast;
+    using type_safe::narrow_cast_all;
+
+    using type_safe::can_downcast;
+    using type_safe::checked_downcast;
+    using type_safe::class_id_range;
+    using type_safe::derived_type;
+    using type_safe::downcast;
+
+    using type_safe::advance;
+    using type_safe::at;
+    using type_safe::difference_t;
+    using type_safe::distance;
+    using type_safe::in_bounds_index;
+    using type_safe::index_range;
+    using type_safe::index_t;
+    using type_safe::next;
+    using type_safe::prev;
+
+    //=== flags ===//
+    using type_safe::atomic_flag;
+    using type_safe::atomic_flag_set;
+    using type_safe::combo;
+    using type_safe::flag;
+    using type_safe::flag_combo;
+    using type_safe::flag_mask;
+    using type_safe::flag_set;
+    using type_safe::flag_set_iterator;
+    using type_safe::flag_set_traits;
+    using type_safe::mask;
+    using type_safe::noflag;
+    using type_safe::noflag_t;
+
+    //=== strong typedef ===//
+    using type_safe::fast_hashable;
+    using type_safe::get;
+    using type_safe::hashable;
+    using type_safe::interned;
+    using type_safe::strong_typedef;
+    using type_safe::underlying_type;
+
+    //=== constrained types ===//
+    using type_safe::assertion_verifier;
+    using type_safe::constrain;
+    using type_safe::constrain_error;
+    using type_safe::constrained_modifier;
+    using type_safe::constrained_ref;
+    using type_safe::constrained_type;
+    using type_safe::null_verifier;
+    using type_safe::sanitize;
+    using type_safe::tag;
+    using type_safe::tagged_ref;
+    using type_safe::tagged_type;
+    using type_safe::throwing_verifier;
+
+    using type_safe::all_valid;
+    using type_safe::clamp_all;
+    using type_safe::constrain_all;
+    using type_safe::constrained_array_modifier;
+    using type_safe::modify_all;
+
+    using type_safe::bounded_type;
+    using type_safe::clamp;
+    using type_safe::clamped_type;
+    using type_safe::clamping_verifier;
+    using type_safe::make_bounded;
+    using type_safe::make_bounded_exclusive;
+    using type_safe::make_clamped;
+    using type_safe::sanitize_bounded;
+    using type_safe::sanitize_bounded_exclusive;
+
+    //=== vocabulary types ===//
+    using type_safe::basic_optional;
+    using type_safe::direct_optional_storage;
+    using type_safe::make_optional;
+    using type_safe::nullopt;
+    using type_safe::nullopt_t;
+    using type_safe::optional;
+    using type_safe::optional_for;
+    using type_safe::optional_storage_policy_for;
+
+    using type_safe::opt_cref;
+    using type_safe::opt_ref;
+    using type_safe::opt_xref;
+    using type_safe::optional_ref;
+    using type_safe::optional_xvalue_ref;
+    using type_safe::reference_optional_storage;
+
+    using type_safe::compact_bool_policy;
+    using type_safe::compact_container_policy;
+    using type_safe::compact_enum_policy;
+    using type_safe::compact_floating_point_policy;
+    using type_safe::compact_integer_policy;
+    using type_safe::compact_nan_payload_policy;
+    using type_safe::compact_optional;
+    using type_safe::compact_optional_storage;
+    using type_safe::compact_pointer_policy;
+    using type_safe::compact_tagged_object_ref_policy;
+    using type_safe::count_present;
+    using type_safe::fill_missing;
+    using type_safe::transform_present;
+
+    using type_safe::optional_array;
+    using type_safe::optional_vector;
+
+    using type_safe::copy;
+    using type_safe::destroy;
+    using type_safe::move;
+    using type_safe::tagged_union;
+    using type_safe::union_type;
+    using type_safe::union_types;
+    using type_safe::with;
+
+    using type_safe::basic_variant;
+    using type_safe::fallback_variant;
+    using type_safe::fallback_variant_policy;
+    using type_safe::never_empty_variant_policy;
+    using type_safe::match;
+    using type_safe::nullvar;
+    using type_safe::nullvar_t;
+    using type_safe::optional_variant_policy;
+    using type_safe::otherwise;
+    using type_safe::rarely_empty_variant_policy;
+    using type_safe::variant;
+    using type_safe::variant_type;
+    using type_safe::variant_types;
+    using type_safe::visit;
+    using type_safe::visit_all;
+
+    using type_safe::basic_compact_variant;
+    using type_safe::compact_variant;
+    using type_safe::compact_variant_pointer_traits;
+    using type_safe::pointer_compact_variant_policy;
+
+    using type_safe::mpmc_variant_ring;
+    using type_safe::variant_ring;
+
+    using type_safe::basic_variant_ref;
+    using type_safe::variant_cref;
+    using type_safe::variant_ref;
+    using type_safe::variant_vector;
+
+    using type_safe::error;
+    using type_safe::make_error;
+    using type_safe::result;
+
+    using type_safe::allocate_boxed;
+    using type_safe::arena;
+    using type_safe::arena_allocator;
+    using type_safe::boxed;
+
+    using type_safe::is_trivially_relocatable;
+    using type_safe::layout_info;
+    using type_safe::relocate_at;
+    using type_safe::uninitialized_relocate;
+
+    //=== references ===//
+    using type_safe::array_ref;
+    using type_safe::array_xvalue_ref;
+    using type_safe::cref;
+    using type_safe::function_ref;
+    using type_safe::object_ref;
+    using type_safe::ref;
+    using type_safe::tagged_object_ref;
+    using type_safe::typed_view;
+    using type_safe::underlying_view;
+    using type_safe::xref;
+    using type_safe::xvalue_ref;
+
+    using type_safe::mdarray_ref;
+    using type_safe::strided_array_ref;
+
+    using type_safe::out;
+    using type_safe::out_range;
+    using type_safe::output_parameter;
+    using type_safe::output_range;
+
+    //=== containers ===//
+    using type_safe::boolean_array;
+    using type_safe::boolean_reference;
+    using type_safe::boolean_vector;
+    using type_safe::deferred_array;
+    using type_safe::deferred_construction;
+    using type_safe::lazy;
+    using type_safe::deferred_vector;
+    using type_safe::function;
+    using type_safe::id_map;
+    using type_safe::slot_handle;
+    using type_safe::slot_map;
+
+    //=== parsing and serialization ===//
+    using type_safe::parse;
+    using type_safe::to_chars;
+
+    using type_safe::wire_array_view;
+    using type_safe::wire_size;
+    using type_safe::wire_traits;
+    using type_safe::wire_view;
+    using type_safe::write_wire;
+
+    //=== diagnostics ===//
+    using type_safe::precondition_sample_rate;
+    using type_safe::reset_violation_stats;
+    using type_safe::set_precondition_sample_rate;
+    using type_safe::set_violation_sampler;
+    using type_safe::violation_overflow_count;
+    using type_safe::violation_record;
+    using type_safe::violation_sampler;
+    using type_safe::violation_stats;
+
+    //=== operators ===//
+    using type_safe::operator==;
+    using type_safe::operator!=;
+    using type_safe::operator<;
+    using type_safe::operator<=;
+    using type_safe::operator>;
+    using type_safe::operator>=;
+    using type_safe::operator+;
+    using type_safe::operator-;
+    using type_safe::operator*;
+    using type_safe::operator/;
+    using type_safe::operator%;
+    using type_safe::operator&;
+    using type_safe::operator|;
+    using type_safe::operator^;
+    using type_safe::operator<<;
+    using type_safe::operator>>;
+#if TYPE_SAFE_USE_COROUTINES
+    using type_safe::operator co_await;
+#endif
+
+    inline namespace literals
+    {
+        using type_safe::literals::operator""_i8;
+        using type_safe::literals::operator""_i16;
+        using type_safe::literals::operator""_i32;
+        using type_safe::literals::operator""_i64;
+        using type_safe::literals::operator""_u8;
+        using type_safe::literals::operator""_u16;
+        using type_safe::literals::operator""_u32;
+        using type_safe::literals::operator""_u64;
+        using type_safe::literals::operator""_isize;
+        using type_safe::literals::operator""_usize;
+        using type_safe::literals::operator""_i;
+        using type_safe::literals::operator""_u;
+        using type_safe::literals::operator""_f;
+        using type_safe::literals::operator""_d;
+
+        using type_safe::literals::operator""_bound;
+        using type_safe::literals::operator""_boundu;
+        using type_safe::literals::operator""_ci8;
+        using type_safe::literals::operator""_ci16;
+        using type_safe::literals::operator""_ci32;
+        using type_safe::literals::operator""_ci64;
+        using type_safe::literals::operator""_cu8;
+        using type_safe::literals::operator""_cu16;
+        using type_safe::literals::operator""_cu32;
+        using type_safe::literals::operator""_cu64;
+    } // namespace literals
+
+    namespace constraints
+    {
+        using type_safe::constraints::bounded;
+        using type_safe::constraints::closed;
+        using type_safe::constraints::closed_interval;
+        using type_safe::constraints::dynamic_bound;
+        using type_safe::constraints::greater;
+        using type_safe::constraints::greater_equal;
+        using type_safe::constraints::less;
+        using type_safe::constraints::less_equal;
+        using type_safe::constraints::non_default;
+        using type_safe::constraints::non_empty;
+        using type_safe::constraints::non_invalid;
+        using type_safe::constraints::non_null;
+        using type_safe::constraints::open;
+        using type_safe::constraints::open_interval;
+        using type_safe::constraints::owner;
+    } // namespace constraints
+
+    namespace dimensions
+    {
+        using type_safe::dimensions::acceleration;
+        using type_safe::dimensions::amount;
+        using type_safe::dimensions::area;
+        using type_safe::dimensions::current;
+        using type_safe::dimensions::dimensionless;
+        using type_safe::dimensions::energy;
+        using type_safe::dimensions::force;
+        using type_safe::dimensions::frequency;
+        using type_safe::dimensions::length;
+        using type_safe::dimensions::luminosity;
+        using type_safe::dimensions::mass;
+        using type_safe::dimensions::power;
+        using type_safe::dimensions::temperature;
+        using type_safe::dimensions::time;
+        using type_safe::dimensions::velocity;
+        using type_safe::dimensions::volume;
+    } // namespace dimensions
+
+    namespace strong_typedef_op
+    {
+        using type_safe::strong_typedef_op::addition;
+        using type_safe::strong_typedef_op::array_subscript;
+        using type_safe::strong_typedef_op::bidirectional_iterator;
+        using type_safe::strong_typedef_op::bitmask;
+        using type_safe::strong_typedef_op::bitshift;
+        using type_safe::strong_typedef_op::bitwise_and;
+        using type_safe::strong_typedef_op::bitwise_or;
+        using type_safe::strong_typedef_op::bitwise_xor;
+        using type_safe::strong_typedef_op::complement;
+        using type_safe::strong_typedef_op::decrement;
+        using type_safe::strong_typedef_op::dereference;
+        using type_safe::strong_typedef_op::division;
+        using type_safe::strong_typedef_op::equality_comparison;
+        using type_safe::strong_typedef_op::floating_point_arithmetic;
+        using type_safe::strong_typedef_op::forward_iterator;
+        using type_safe::strong_typedef_op::increment;
+        using type_safe::strong_typedef_op::input_iterator;
+        using type_safe::strong_typedef_op::input_operator;
+        using type_safe::strong_typedef_op::integer_arithmetic;
+        using type_safe::strong_typedef_op::iterator;
+        using type_safe::strong_typedef_op::mixed_addition;
+        using type_safe::strong_typedef_op::mixed_bitwise_and;
+        using type_safe::strong_typedef_op::mixed_bitwise_or;
+        using type_safe::strong_typedef_op::mixed_bitwise_xor;
+        using type_safe::strong_typedef_op::mixed_division;
+        using type_safe::strong_typedef_op::mixed_equality_comparison;
+        using type_safe::strong_typedef_op::mixed_modulo;
+        using type_safe::strong_typedef_op::mixed_multiplication;
+        using type_safe::strong_typedef_op::mixed_relational_comparison;
+        using type_safe::strong_typedef_op::mixed_simd_comparison;
+        using type_safe::strong_typedef_op::mixed_subtraction;
+        using type_safe::strong_typedef_op::modulo;
+        using type_safe::strong_typedef_op::multiplication;
+        using type_safe::strong_typedef_op::output_iterator;
+        using type_safe::strong_typedef_op::output_operator;
+        using type_safe::strong_typedef_op::random_access_iterator;
+        using type_safe::strong_typedef_op::relational_comparison;
+        using type_safe::strong_typedef_op::simd_arithmetic;
+        using type_safe::strong_typedef_op::simd_comparison;
+        using type_safe::strong_typedef_op::subtraction;
+        using type_safe::strong_typedef_op::unary_minus;
+        using type_safe::strong_typedef_op::unary_plus;
+
+        using type_safe::strong_typedef_op::operator+;
+        using type_safe::strong_typedef_op::operator-;
+        using type_safe::strong_typedef_op::operator~;
+    } // namespace strong_typedef_op
+} // namespace type_safe
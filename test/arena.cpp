@@ -0,0 +1,79 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/arena.hpp>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace type_safe;
+
+TEST_CASE("arena")
+{
+    arena a(64u);
+    REQUIRE(a.block_size() == 64u);
+
+    SECTION("alignment")
+    {
+        auto c = static_cast<char*>(a.allocate(1u, 1u));
+        auto d = a.allocate(sizeof(double), alignof(double));
+        REQUIRE(reinterpret_cast<std::uintptr_t>(d) % alignof(double) == 0u);
+        REQUIRE(static_cast<void*>(c) != d);
+
+        auto e = a.allocate(16u, 16u);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(e) % 16u == 0u);
+    }
+    SECTION("bump")
+    {
+        auto first  = static_cast<char*>(a.allocate(4u, 4u));
+        auto second = static_cast<char*>(a.allocate(4u, 4u));
+        REQUIRE(second == first + 4);
+    }
+    SECTION("new block")
+    {
+        for (auto i = 0; i != 100; ++i)
+        {
+            auto ptr = static_cast<int*>(a.allocate(sizeof(int), alignof(int)));
+            *ptr     = i;
+        }
+    }
+    SECTION("big allocation")
+    {
+        auto first = static_cast<char*>(a.allocate(4u, 4u));
+        auto big   = static_cast<char*>(a.allocate(1024u, 8u));
+        big[1023]  = 'a';
+        // current block is still used
+        auto second = static_cast<char*>(a.allocate(4u, 4u));
+        REQUIRE(second == first + 4);
+    }
+    SECTION("release")
+    {
+        a.allocate(32u, 8u);
+        a.release();
+        a.release();
+        a.allocate(32u, 8u);
+    }
+}
+
+TEST_CASE("arena_allocator")
+{
+    arena a;
+
+    arena_allocator<int>  alloc(a);
+    arena_allocator<char> other(alloc);
+    REQUIRE(&other.get_arena() == &a);
+    REQUIRE(alloc == other);
+
+    arena                 b;
+    arena_allocator<char> different(b);
+    REQUIRE(alloc != different);
+
+    std::vector<int, arena_allocator<int>> vec(alloc);
+    for (auto i = 0; i != 1000; ++i)
+        vec.push_back(i);
+    REQUIRE(vec.size() == 1000u);
+    REQUIRE(vec[999] == 999);
+}
@@ -8,6 +8,17 @@
 
 using namespace type_safe;
 
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+// checks are usable in constant expressions
+static_assert(detail::will_addition_error(detail::signed_integer_tag{},
+                                          std::numeric_limits<int>::max(), 1),
+              "");
+static_assert(!detail::will_subtraction_error(detail::unsigned_integer_tag{}, 1u, 1u), "");
+static_assert(detail::will_multiplication_error(detail::signed_integer_tag{},
+                                                std::numeric_limits<int>::min(), -1),
+              "");
+#endif
+
 TEST_CASE("over/underflow")
 {
     SECTION("unsigned")
@@ -75,4 +86,94 @@ TEST_CASE("over/underflow")
         REQUIRE(detail::will_modulo_error(detail::signed_integer_tag{}, 1, 0));
         REQUIRE(!detail::will_modulo_error(detail::signed_integer_tag{}, 1, 1));
     }
+    SECTION("other sizes")
+    {
+        using small = signed char;
+        auto max    = std::numeric_limits<small>::max();
+        auto min    = std::numeric_limits<small>::min();
+
+        REQUIRE(detail::will_addition_error(detail::signed_integer_tag{}, max, small(1)));
+        REQUIRE(!detail::will_addition_error(detail::signed_integer_tag{}, max, small(-1)));
+        REQUIRE(detail::will_subtraction_error(detail::signed_integer_tag{}, min, small(1)));
+        REQUIRE(detail::will_multiplication_error(detail::signed_integer_tag{}, min, small(-1)));
+        REQUIRE(!detail::will_multiplication_error(detail::signed_integer_tag{}, small(-8),
+                                                   small(16)));
+
+        auto umax = std::numeric_limits<unsigned long long>::max();
+        REQUIRE(detail::will_addition_error(detail::unsigned_integer_tag{}, umax, 1ull));
+        REQUIRE(detail::will_multiplication_error(detail::unsigned_integer_tag{}, 1ull << 32,
+                                                  1ull << 32));
+        REQUIRE(!detail::will_multiplication_error(detail::unsigned_integer_tag{}, 1ull << 31,
+                                                   1ull << 32));
+    }
+}
+
+TEST_CASE("wrapping_arithmetic")
+{
+    using p   = wrapping_arithmetic;
+    auto max  = std::numeric_limits<int>::max();
+    auto min  = std::numeric_limits<int>::min();
+    auto umax = std::numeric_limits<unsigned>::max();
+
+    REQUIRE(p::do_addition(max, 1) == min);
+    REQUIRE(p::do_addition(min, -1) == max);
+    REQUIRE(p::do_addition(umax, 2u) == 1u);
+    REQUIRE(p::do_subtraction(min, 1) == max);
+    REQUIRE(p::do_subtraction(0u, 1u) == umax);
+    REQUIRE(p::do_multiplication(max, 2) == -2);
+    REQUIRE(p::do_multiplication(umax, umax) == 1u);
+    REQUIRE(p::do_division(min, -1) == min);
+    REQUIRE(p::do_division(7, -2) == -3);
+    REQUIRE(p::do_modulo(min, -1) == 0);
+    REQUIRE(p::do_modulo(7u, 4u) == 3u);
+
+    using small = unsigned short;
+    REQUIRE(p::do_multiplication(small(65535), small(65535)) == small(1));
+    REQUIRE(p::do_addition(static_cast<signed char>(127), static_cast<signed char>(1)) == -128);
+}
+
+TEST_CASE("saturating_arithmetic")
+{
+    using p   = saturating_arithmetic;
+    auto max  = std::numeric_limits<int>::max();
+    auto min  = std::numeric_limits<int>::min();
+    auto umax = std::numeric_limits<unsigned>::max();
+
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+    static_assert(p::do_addition(std::numeric_limits<int>::max(), 1)
+                      == std::numeric_limits<int>::max(),
+                  "");
+#endif
+
+    REQUIRE(p::do_addition(max, 1) == max);
+    REQUIRE(p::do_addition(max - 1, 1) == max);
+    REQUIRE(p::do_addition(min, -1) == min);
+    REQUIRE(p::do_addition(min, max) == -1);
+    REQUIRE(p::do_addition(umax, 1u) == umax);
+    REQUIRE(p::do_addition(1u, 2u) == 3u);
+
+    REQUIRE(p::do_subtraction(min, 1) == min);
+    REQUIRE(p::do_subtraction(max, -1) == max);
+    REQUIRE(p::do_subtraction(0, min) == max);
+    REQUIRE(p::do_subtraction(-1, min) == max);
+    REQUIRE(p::do_subtraction(5, 7) == -2);
+    REQUIRE(p::do_subtraction(5u, 7u) == 0u);
+
+    REQUIRE(p::do_multiplication(max, 2) == max);
+    REQUIRE(p::do_multiplication(max, -2) == min);
+    REQUIRE(p::do_multiplication(min, -1) == max);
+    REQUIRE(p::do_multiplication(-3, 4) == -12);
+    REQUIRE(p::do_multiplication(umax, 2u) == umax);
+
+    REQUIRE(p::do_division(min, -1) == max);
+    REQUIRE(p::do_division(-7, 2) == -3);
+    REQUIRE(p::do_modulo(min, -1) == 0);
+
+    using small = signed char;
+    REQUIRE(p::do_addition(small(100), small(100)) == small(127));
+    REQUIRE(p::do_subtraction(small(-100), small(100)) == small(-128));
+    REQUIRE(p::do_addition(static_cast<unsigned char>(200), static_cast<unsigned char>(100))
+            == 255);
+    REQUIRE(p::do_multiplication(small(-16), small(8)) == small(-128));
+    REQUIRE(p::do_multiplication(small(-16), small(9)) == small(-128));
 }
@@ -0,0 +1,101 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/atomic_flag.hpp>
+
+#include <catch.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace type_safe;
+
+TEST_CASE("atomic_flag")
+{
+    SECTION("constructor")
+    {
+        atomic_flag a(true);
+        REQUIRE(a.load());
+
+        atomic_flag b(boolean(false));
+        REQUIRE(!b.load());
+    }
+    SECTION("toggle")
+    {
+        atomic_flag a(true);
+        REQUIRE(a.toggle());
+        REQUIRE(!a.load());
+        REQUIRE(!a.toggle(std::memory_order_relaxed));
+        REQUIRE(a.load());
+    }
+    SECTION("change")
+    {
+        atomic_flag a(true);
+        a.change(false);
+        REQUIRE(!a.load());
+        a.change(boolean(true), std::memory_order_acq_rel);
+        REQUIRE(a.load());
+    }
+    SECTION("set/reset")
+    {
+        atomic_flag a(false);
+        a.set();
+        REQUIRE(a.load());
+        a.set(std::memory_order_release);
+        REQUIRE(a.load(std::memory_order_acquire));
+
+        a.reset();
+        REQUIRE(!a.load());
+        a.reset(std::memory_order_release);
+        REQUIRE(!a.load());
+    }
+    SECTION("try_set/try_reset")
+    {
+        atomic_flag a(false);
+        REQUIRE(a.try_set());
+        REQUIRE(a.load());
+        REQUIRE(!a.try_set(std::memory_order_acq_rel));
+        REQUIRE(a.load());
+
+        REQUIRE(a.try_reset());
+        REQUIRE(!a.load());
+        REQUIRE(!a.try_reset(std::memory_order_acq_rel));
+        REQUIRE(!a.load());
+    }
+    SECTION("concurrent try_set")
+    {
+        atomic_flag              a(false);
+        std::atomic<int>         winners(0);
+        std::vector<std::thread> threads;
+        for (auto i = 0; i != 4; ++i)
+            threads.emplace_back([&] {
+                if (a.try_set())
+                    ++winners;
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        REQUIRE(a.load());
+        REQUIRE(winners == 1);
+    }
+    SECTION("wait/notify")
+    {
+        atomic_flag a(true);
+        a.wait(false); // returns immediately
+
+        atomic_flag ready(false), done(false);
+        std::thread thread([&] {
+            ready.wait(false, std::memory_order_acquire);
+            done.set(std::memory_order_release);
+            done.notify_one();
+        });
+
+        ready.set(std::memory_order_release);
+        ready.notify_all();
+        done.wait(false, std::memory_order_acquire);
+        thread.join();
+
+        REQUIRE(done.load());
+    }
+}
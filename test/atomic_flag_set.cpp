@@ -0,0 +1,93 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/atomic_flag_set.hpp>
+
+#include <catch.hpp>
+
+using namespace type_safe;
+
+namespace
+{
+    enum class test_flags
+    {
+        a,
+        b,
+        c,
+        _flag_set_size,
+    };
+} // namespace
+
+TEST_CASE("atomic_flag_set")
+{
+    SECTION("constructor")
+    {
+        atomic_flag_set<test_flags> a;
+        REQUIRE(a.load() == noflag);
+
+        atomic_flag_set<test_flags> b(test_flags::a | test_flags::c);
+        REQUIRE(b.load() == (test_flags::a | test_flags::c));
+
+        atomic_flag_set<test_flags> c(flag_set<test_flags>(test_flags::b));
+        REQUIRE(c.load() == test_flags::b);
+    }
+    SECTION("flag operation")
+    {
+        atomic_flag_set<test_flags> set;
+
+        set.set(test_flags::a);
+        REQUIRE(set.is_set(test_flags::a));
+        REQUIRE(!set.is_set(test_flags::b));
+
+        set.toggle(test_flags::b, std::memory_order_relaxed);
+        REQUIRE(set.load() == (test_flags::a | test_flags::b));
+
+        set.reset(test_flags::a, std::memory_order_release);
+        REQUIRE(set.load(std::memory_order_acquire) == test_flags::b);
+
+        REQUIRE(!set.test_and_set(test_flags::c));
+        REQUIRE(set.test_and_set(test_flags::c));
+        REQUIRE(set.test_and_reset(test_flags::c));
+        REQUIRE(!set.test_and_reset(test_flags::c));
+        REQUIRE(set.load() == test_flags::b);
+    }
+    SECTION("combination operation")
+    {
+        atomic_flag_set<test_flags> set(test_flags::a);
+
+        REQUIRE(set.fetch_set(test_flags::b | test_flags::c) == test_flags::a);
+        REQUIRE(set.load().all());
+
+        REQUIRE(set.fetch_reset(test_flags::a | test_flags::b).all());
+        REQUIRE(set.load() == test_flags::c);
+
+        REQUIRE(set.fetch_toggle(test_flags::a | test_flags::c) == test_flags::c);
+        REQUIRE(set.load() == test_flags::a);
+
+        set.store(test_flags::a | test_flags::b);
+        REQUIRE(set.fetch_mask(~test_flags::a) == (test_flags::a | test_flags::b));
+        REQUIRE(set.load() == test_flags::b);
+
+        REQUIRE(set.exchange(test_flags::c) == test_flags::b);
+        REQUIRE(set.load() == test_flags::c);
+    }
+    SECTION("compare_exchange")
+    {
+        atomic_flag_set<test_flags> set(test_flags::a);
+
+        flag_set<test_flags> expected(test_flags::b);
+        REQUIRE(!set.compare_exchange_strong(expected, test_flags::c));
+        REQUIRE(expected == test_flags::a);
+
+        REQUIRE(set.compare_exchange_strong(expected, test_flags::c, std::memory_order_acq_rel,
+                                            std::memory_order_acquire));
+        REQUIRE(set.load() == test_flags::c);
+
+        expected = test_flags::c;
+        while (!set.compare_exchange_weak(expected, test_flags::a | test_flags::b))
+        {
+        }
+        REQUIRE(set.load() == (test_flags::a | test_flags::b));
+    }
+}
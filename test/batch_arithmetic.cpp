@@ -0,0 +1,122 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/batch_arithmetic.hpp>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace type_safe;
+
+namespace
+{
+    template <typename T, class Policy>
+    array_ref<integer<T, Policy>> make_ref(std::vector<integer<T, Policy>>& vec)
+    {
+        return array_ref<integer<T, Policy>>(vec.data(), vec.size());
+    }
+} // namespace
+
+TEST_CASE("batch_add")
+{
+    using int_t = integer<std::int32_t, checked_arithmetic>;
+    auto max    = std::numeric_limits<std::int32_t>::max();
+
+    std::vector<int_t> a, b, result;
+    for (auto i = 0; i != 1000; ++i)
+    {
+        a.push_back(i);
+        b.push_back(2 * i);
+        result.push_back(0);
+    }
+
+    SECTION("no overflow")
+    {
+        batch_add(make_ref(result), make_ref(a), make_ref(b));
+        for (auto i = 0u; i != result.size(); ++i)
+            REQUIRE(result[i].get() == 3 * std::int32_t(i));
+
+        batch_sub(make_ref(result), make_ref(result), make_ref(b));
+        REQUIRE(result == a);
+    }
+    SECTION("overflow")
+    {
+        a[600] = max;
+        REQUIRE_THROWS_AS(batch_add(make_ref(result), make_ref(a), make_ref(b)),
+                          checked_arithmetic::error);
+        for (auto i = 0u; i != 600u; ++i)
+            REQUIRE(result[i].get() == (a[i] + b[i]).get());
+    }
+    SECTION("unsigned")
+    {
+        using uint_t = integer<std::uint8_t, checked_arithmetic>;
+        std::vector<uint_t> c(300u, std::uint8_t(100)), d(300u, std::uint8_t(50));
+
+        batch_sub(make_ref(c), make_ref(c), make_ref(d));
+        REQUIRE(c == d);
+
+        d[299] = std::uint8_t(51);
+        REQUIRE_THROWS_AS(batch_sub(make_ref(c), make_ref(c), make_ref(d)),
+                          checked_arithmetic::error);
+    }
+}
+
+TEST_CASE("batch_add saturating")
+{
+    using int_t = integer<std::int16_t, saturating_arithmetic>;
+
+    std::vector<int_t> a(300u, std::int16_t(30000)), b(300u, std::int16_t(-1)), result = a;
+    b[100] = std::int16_t(10000);
+    batch_add(make_ref(result), make_ref(a), make_ref(b));
+    REQUIRE(result[0].get() == 29999);
+    REQUIRE(result[100].get() == std::numeric_limits<std::int16_t>::max());
+}
+
+TEST_CASE("batch_mul")
+{
+    using int_t = integer<std::int16_t, checked_arithmetic>;
+
+    std::vector<int_t> a(500u, std::int16_t(-100)), b(500u, std::int16_t(300)), result = a;
+    batch_mul(make_ref(result), make_ref(a), make_ref(b));
+    REQUIRE(result == std::vector<int_t>(500u, std::int16_t(-30000)));
+
+    b[499] = std::int16_t(400);
+    REQUIRE_THROWS_AS(batch_mul(make_ref(result), make_ref(a), make_ref(b)),
+                      checked_arithmetic::error);
+
+    using long_t = integer<std::int64_t, checked_arithmetic>;
+    std::vector<long_t> c(10u, std::int64_t(1) << 40), d = c;
+    REQUIRE_THROWS_AS(batch_mul(make_ref(d), make_ref(c), make_ref(c)), checked_arithmetic::error);
+}
+
+TEST_CASE("batch_sum")
+{
+    using int_t = integer<std::int32_t, checked_arithmetic>;
+    auto max    = std::numeric_limits<std::int32_t>::max();
+
+    std::vector<int_t> a;
+    for (auto i = 0; i != 1000; ++i)
+        a.push_back(i % 2 == 0 ? i : -i);
+    REQUIRE(batch_sum(make_ref(a)).get() == -500);
+    REQUIRE(batch_sum(make_ref(a), int_t(500)).get() == 0);
+
+    // the final sum fits, but a partial sum does not
+    a[0] = max;
+    a[1] = 1;
+    a[2] = -1;
+    REQUIRE_THROWS_AS(batch_sum(make_ref(a)), checked_arithmetic::error);
+
+    using uint_t = integer<std::uint64_t, checked_arithmetic>;
+    std::vector<uint_t> b(100u, std::uint64_t(1));
+    REQUIRE(batch_sum(make_ref(b)).get() == 100u);
+    b[50] = std::numeric_limits<std::uint64_t>::max();
+    REQUIRE_THROWS_AS(batch_sum(make_ref(b)), checked_arithmetic::error);
+
+    using default_t = integer<std::uint32_t, default_arithmetic>;
+    std::vector<default_t> c(10u, std::uint32_t(1));
+    REQUIRE(batch_sum(array_ref<const default_t>(c.data(), c.size())).get() == 10u);
+}
@@ -0,0 +1,161 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/batch_constrained.hpp>
+
+#include <catch.hpp>
+
+#include <vector>
+
+using namespace type_safe;
+
+namespace
+{
+    using zero         = std::integral_constant<int, 0>;
+    using hundred      = std::integral_constant<int, 100>;
+    using percentage   = constraints::closed_interval<int, zero, hundred>;
+    using percentage_t = bounded_type<int, true, true, zero, hundred>;
+} // namespace
+
+TEST_CASE("all_valid")
+{
+    std::vector<int> values;
+    for (auto i = 0; i != 1000; ++i)
+        values.push_back(i % 101);
+    array_ref<int> ref(values.data(), values.size());
+
+    REQUIRE(all_valid(ref, percentage{}));
+    REQUIRE(all_valid(ref, constraints::less<int, std::integral_constant<int, 101>>{}));
+    REQUIRE(!all_valid(ref, constraints::open_interval<int, zero, hundred>{}));
+    REQUIRE(all_valid(ref, [](int i) { return i <= 100; }));
+
+    values[500] = 101;
+    REQUIRE(!all_valid(ref, percentage{}));
+    values[500] = -1;
+    REQUIRE(!all_valid(ref, percentage{}));
+
+    REQUIRE(all_valid(array_ref<const int>(nullptr), percentage{}));
+
+    std::vector<double> doubles(10u, 0.5);
+    REQUIRE(all_valid(array_ref<double>(doubles.data(), doubles.size()),
+                      constraints::closed_interval<double>(0.0, 1.0)));
+}
+
+TEST_CASE("clamp_all")
+{
+    std::vector<int> values = {-5, 0, 50, 100, 150};
+    clamp_all(array_ref<int>(values.data(), values.size()), percentage{});
+    REQUIRE(values == (std::vector<int>{0, 0, 50, 100, 100}));
+
+    clamp_all(array_ref<int>(values.data(), values.size()),
+              constraints::closed_interval<int>(10, 20));
+    REQUIRE(values == (std::vector<int>{10, 10, 20, 20, 20}));
+}
+
+TEST_CASE("constrain_all")
+{
+    std::vector<int> values = {0, 42, 100};
+    array_ref<int>   ref(values.data(), values.size());
+
+    auto view = constrain_all<percentage>(ref);
+    static_assert(std::is_same<decltype(view), array_ref<percentage_t>>::value, "");
+    REQUIRE(view.size().get() == ref.size().get());
+    REQUIRE(view[1u].get_value() == 42);
+    REQUIRE(&view[2u].get_value() == &values[2]);
+
+    SECTION("throwing")
+    {
+        values[1] = 101;
+        REQUIRE_THROWS_AS(constrain_all<throwing_verifier>(ref, percentage{}), constrain_error);
+    }
+    SECTION("clamping")
+    {
+        values[1] = 101;
+        auto clamped = constrain_all<percentage, clamping_verifier>(ref);
+        REQUIRE(clamped[1u].get_value() == 100);
+        REQUIRE(values[1] == 100);
+    }
+    SECTION("empty")
+    {
+        auto empty = constrain_all<percentage>(array_ref<int>(nullptr));
+        REQUIRE(empty.size().get() == 0u);
+    }
+}
+
+TEST_CASE("modify_all")
+{
+    std::vector<int> values = {0, 42, 100};
+    array_ref<int>   ref(values.data(), values.size());
+    auto             view = constrain_all<percentage>(ref);
+
+    {
+        auto modifier = modify_all(view);
+        for (auto& value : modifier.get())
+            value /= 2;
+        REQUIRE((*modifier).size().get() == 3u);
+    }
+    REQUIRE(view[1u].get_value() == 21);
+    REQUIRE(view[2u].get_value() == 50);
+
+    SECTION("throwing")
+    {
+        // the values stay invalid after a violation, so every check gets new ones
+        using throwing_t = constrained_type<int, percentage, throwing_verifier>;
+        std::vector<throwing_t> throwing;
+        auto                    make_ref = [&]() {
+            throwing.clear();
+            throwing.emplace_back(10);
+            throwing.emplace_back(20);
+            return array_ref<throwing_t>(throwing.data(), throwing.size());
+        };
+
+        auto modify = [&] {
+            auto modifier      = modify_all(make_ref());
+            modifier.get()[1u] = 101;
+        };
+        REQUIRE_THROWS_AS(modify(), constrain_error);
+
+        auto commit = [&] {
+            auto modifier      = modify_all(make_ref());
+            modifier.get()[0u] = 101;
+            modifier.commit();
+        };
+        REQUIRE_THROWS_AS(commit(), constrain_error);
+
+        auto move_assign = [&] {
+            auto modifier      = modify_all(make_ref());
+            modifier.get()[0u] = 101;
+            modifier           = modify_all(array_ref<throwing_t>(throwing.data() + 1, 1u));
+        };
+        REQUIRE_THROWS_AS(move_assign(), constrain_error);
+
+        // an exception is already in flight, so the destructor doesn't verify
+        auto unwind = [&] {
+            auto modifier      = modify_all(make_ref());
+            modifier.get()[0u] = 101;
+            throw 42;
+        };
+        REQUIRE_THROWS_AS(unwind(), int);
+    }
+    SECTION("clamping")
+    {
+        std::vector<int> raw = {10, 20};
+        auto clamping = constrain_all<percentage, clamping_verifier>(array_ref<int>(raw.data(),
+                                                                                    raw.size()));
+        {
+            auto modifier = modify_all(clamping);
+            for (auto& value : modifier.get())
+                value *= 10;
+        }
+        REQUIRE(clamping[0u].get_value() == 100);
+        REQUIRE(clamping[1u].get_value() == 100);
+    }
+    SECTION("moved")
+    {
+        auto modifier   = modify_all(view);
+        auto other      = std::move(modifier);
+        other.get()[0u] = 1;
+    }
+    REQUIRE(view[0u].get_value() <= 100);
+}
@@ -0,0 +1,87 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/batch_visit.hpp>
+
+#include <catch.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace type_safe;
+
+namespace
+{
+    struct visitor
+    {
+        std::string& result;
+
+        void operator()(nullvar_t) const
+        {
+            result += '_';
+        }
+
+        void operator()(int i) const
+        {
+            result += static_cast<char>('0' + i);
+        }
+
+        void operator()(char c) const
+        {
+            result += c;
+        }
+    };
+
+    struct increment
+    {
+        using incomplete_visitor = void;
+
+        void operator()(int& i) const
+        {
+            ++i;
+        }
+    };
+} // namespace
+
+TEST_CASE("visit_all")
+{
+    using var = variant<nullvar_t, int, char>;
+
+    std::vector<var> vec;
+    vec.emplace_back(1);
+    vec.emplace_back('a');
+    vec.emplace_back(nullvar);
+    vec.emplace_back(2);
+    vec.emplace_back('b');
+    vec.emplace_back(3);
+
+    SECTION("grouped by type")
+    {
+        std::string result;
+        visit_all(array_ref<var>(vec.data(), vec.size()), visitor{result});
+        REQUIRE(result == "_123ab");
+
+        // const variants and a user provided buffer
+        result.clear();
+        std::size_t buffer[6];
+        visit_all(array_ref<const var>(vec.data(), vec.size()), array_ref<std::size_t>(buffer),
+                  visitor{result});
+        REQUIRE(result == "_123ab");
+        REQUIRE(buffer[0] == 2u);
+        REQUIRE(buffer[5] == 4u);
+    }
+    SECTION("modifying")
+    {
+        visit_all(array_ref<var>(vec.data(), vec.size()), increment{});
+        REQUIRE(vec[0].value(variant_type<int>{}) == 2);
+        REQUIRE(vec[1].value(variant_type<char>{}) == 'a');
+        REQUIRE(vec[5].value(variant_type<int>{}) == 4);
+    }
+    SECTION("empty")
+    {
+        std::string result;
+        visit_all(array_ref<var>(nullptr), visitor{result});
+        REQUIRE(result.empty());
+    }
+}
@@ -0,0 +1,188 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/boolean_array.hpp>
+
+#include <catch.hpp>
+
+using namespace type_safe;
+
+TEST_CASE("boolean_reference")
+{
+    boolean_array<8> arr;
+
+    boolean_reference ref = arr[3u];
+    REQUIRE(!ref);
+    REQUIRE(static_cast<boolean>(ref) == false);
+
+    ref = true;
+    REQUIRE(static_cast<bool>(arr[3u]));
+    REQUIRE(!arr[2u]);
+    REQUIRE(!arr[4u]);
+
+    ref = boolean(false);
+    REQUIRE(!arr[3u]);
+
+    ref.flip();
+    REQUIRE(static_cast<bool>(arr[3u]));
+
+    arr[5u] = arr[3u];
+    REQUIRE(static_cast<bool>(arr[5u]));
+
+    boolean b = arr[5u];
+    REQUIRE(b == true);
+}
+
+TEST_CASE("boolean_array")
+{
+    SECTION("basic")
+    {
+        boolean_array<100> arr;
+        REQUIRE(arr.size().get() == 100u);
+        REQUIRE(arr.count().get() == 0u);
+        REQUIRE(!arr.any());
+        REQUIRE(static_cast<bool>(arr.none()));
+        REQUIRE(!arr.all());
+
+        arr[0u]  = true;
+        arr[64u] = true;
+        arr[99u] = true;
+        REQUIRE(arr.count().get() == 3u);
+        REQUIRE(static_cast<bool>(arr.any()));
+        REQUIRE(!arr.none());
+
+        const boolean_array<100>& carr = arr;
+        REQUIRE(carr[64u] == true);
+        REQUIRE(carr[63u] == false);
+
+        arr.flip();
+        REQUIRE(arr.count().get() == 97u);
+        REQUIRE(!arr[0u]);
+        REQUIRE(static_cast<bool>(arr[1u]));
+
+        arr.fill(true);
+        REQUIRE(arr.count().get() == 100u);
+        REQUIRE(static_cast<bool>(arr.all()));
+
+        arr.fill(false);
+        REQUIRE(static_cast<bool>(arr.none()));
+    }
+    SECTION("full words")
+    {
+        boolean_array<128> arr(true);
+        REQUIRE(arr.count().get() == 128u);
+        REQUIRE(static_cast<bool>(arr.all()));
+
+        arr[127u] = false;
+        REQUIRE(!arr.all());
+
+        boolean_array<0> empty;
+        REQUIRE(static_cast<bool>(empty.all()));
+        REQUIRE(!empty.any());
+    }
+    SECTION("bitwise")
+    {
+        boolean_array<70> a, b;
+        a[1u]  = true;
+        a[69u] = true;
+        b[1u]  = true;
+        b[2u]  = true;
+
+        auto and_ = a & b;
+        REQUIRE(and_.count().get() == 1u);
+        REQUIRE(static_cast<bool>(and_[1u]));
+
+        auto or_ = a | b;
+        REQUIRE(or_.count().get() == 3u);
+
+        auto xor_ = a ^ b;
+        REQUIRE(xor_.count().get() == 2u);
+        REQUIRE(!xor_[1u]);
+
+        auto not_ = ~a;
+        REQUIRE(not_.count().get() == 68u);
+
+        REQUIRE(a == a);
+        REQUIRE(a != b);
+        REQUIRE((a | b) == (b | a));
+
+        a &= b;
+        REQUIRE(a == and_);
+    }
+}
+
+TEST_CASE("boolean_vector")
+{
+    SECTION("basic")
+    {
+        boolean_vector vec;
+        REQUIRE(vec.empty());
+        REQUIRE(vec.size().get() == 0u);
+        REQUIRE(static_cast<bool>(vec.all()));
+        REQUIRE(!vec.any());
+
+        for (auto i = 0u; i != 130u; ++i)
+            vec.push_back(i % 2u == 0u);
+        REQUIRE(vec.size().get() == 130u);
+        REQUIRE(vec.count().get() == 65u);
+        REQUIRE(static_cast<bool>(vec[128u]));
+        REQUIRE(!vec[129u]);
+
+        vec.flip();
+        REQUIRE(vec.count().get() == 65u);
+        REQUIRE(!vec[128u]);
+        REQUIRE(static_cast<bool>(vec[129u]));
+
+        vec.pop_back();
+        REQUIRE(vec.size().get() == 129u);
+        REQUIRE(vec.count().get() == 64u);
+
+        vec.fill(true);
+        REQUIRE(static_cast<bool>(vec.all()));
+        REQUIRE(vec.count().get() == 129u);
+
+        vec.clear();
+        REQUIRE(vec.empty());
+    }
+    SECTION("resize")
+    {
+        boolean_vector vec(10u, true);
+        REQUIRE(vec.count().get() == 10u);
+
+        vec.resize(100u);
+        REQUIRE(vec.count().get() == 10u);
+        REQUIRE(!vec[99u]);
+
+        vec.resize(200u, true);
+        REQUIRE(vec.count().get() == 110u);
+        REQUIRE(static_cast<bool>(vec[199u]));
+
+        vec.resize(5u);
+        REQUIRE(vec.count().get() == 5u);
+        REQUIRE(static_cast<bool>(vec.all()));
+
+        // removed bits don't come back
+        vec.resize(64u);
+        REQUIRE(vec.count().get() == 5u);
+    }
+    SECTION("bitwise")
+    {
+        boolean_vector a(70u), b(70u, true);
+        a[3u] = true;
+
+        REQUIRE((a & b).count().get() == 1u);
+        REQUIRE((a | b).count().get() == 70u);
+        REQUIRE((a ^ b).count().get() == 69u);
+        REQUIRE((~b).count().get() == 0u);
+
+        REQUIRE(a == a);
+        REQUIRE(a != b);
+        REQUIRE(boolean_vector(3u) != boolean_vector(4u));
+
+        b ^= a;
+        REQUIRE(!b[3u]);
+        b |= a;
+        REQUIRE(static_cast<bool>(b.all()));
+    }
+}
@@ -153,6 +153,61 @@ TEST_CASE("bounded literal")
     REQUIRE(bounded.get_constraint().get_upper_bound() == 100);
 }
 
+TEST_CASE("bounded constant")
+{
+    static_assert(std::is_same<decltype(42_ci8), lit_detail::integer_bound<std::int8_t, 42>>::value,
+                  "");
+    static_assert(std::is_same<decltype(42_cu32),
+                               lit_detail::integer_bound<std::uint32_t, 42>>::value,
+                  "");
+    static_assert(std::is_base_of<std::integral_constant<std::int64_t, -42>,
+                                  decltype(-42_ci64)>::value,
+                  "");
+    REQUIRE(decltype(255_cu8)::value == 255u);
+    REQUIRE(decltype(0xFFFF_cu16)::value == 0xFFFFu);
+
+    using closed = constraints::closed_interval<int, decltype(0_bound), decltype(100_bound)>;
+    static_assert(closed::is_valid_constant<decltype(0_ci32)>::value, "");
+    static_assert(closed::is_valid_constant<decltype(100_cu64)>::value, "");
+    static_assert(!closed::is_valid_constant<decltype(101_ci32)>::value, "");
+    static_assert(!closed::is_valid_constant<decltype(-1_ci64)>::value, "");
+
+    using open = constraints::open_interval<int, decltype(0_bound), decltype(100_bound)>;
+    static_assert(!open::is_valid_constant<decltype(0_ci32)>::value, "");
+    static_assert(open::is_valid_constant<decltype(1_cu8)>::value, "");
+    static_assert(!open::is_valid_constant<decltype(100_ci8)>::value, "");
+
+    // different signedness
+    using unsigned_closed =
+        constraints::closed_interval<unsigned, decltype(0_boundu), decltype(100_boundu)>;
+    static_assert(!unsigned_closed::is_valid_constant<decltype(-1_ci32)>::value, "");
+    static_assert(unsigned_closed::is_valid_constant<decltype(42_ci32)>::value, "");
+
+    static_assert(!detail::has_constant_check<constraints::closed_interval<int>,
+                                              decltype(0_ci32)>::value,
+                  "");
+
+    bounded_type<int, true, true, decltype(0_bound), decltype(100_bound)> a(42_ci32);
+    REQUIRE(a.get_value() == 42);
+
+    bounded_type<integer<std::int16_t>, false, true, decltype(-10_bound), decltype(10_bound)>
+        b(-9_ci16);
+    REQUIRE(static_cast<std::int16_t>(b.get_value()) == -9);
+
+    bounded_type<int, true, true, decltype(0_bound), decltype(100_bound), throwing_verifier> c(
+        std::integral_constant<int, 100>{});
+    REQUIRE(c.get_value() == 100);
+
+    // dynamic bounds are checked at run-time
+    bounded_type<int, true, true> d(42_ci32, constraints::closed_interval<int>(0, 100));
+    REQUIRE(d.get_value() == 42);
+
+    // clamping doesn't use the static check, as it modifies the value
+    static_assert(!detail::is_verifiable_constant<clamping_verifier, closed,
+                                                  decltype(200_ci32)>::value,
+                  "");
+}
+
 TEST_CASE("bounded_type")
 {
     constrained_type<int, constraints::closed_interval<int>> dynamic_closed =
@@ -0,0 +1,157 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/boxed.hpp>
+
+#include <catch.hpp>
+
+#include <type_safe/arena.hpp>
+#include <type_safe/variant.hpp>
+#include <type_safe/visitor.hpp>
+
+#include "debugger_type.hpp"
+
+using namespace type_safe;
+
+TEST_CASE("boxed")
+{
+    SECTION("constructor")
+    {
+        debugger_type        dbg(0);
+        boxed<debugger_type> a(dbg);
+        REQUIRE(a->id == 0);
+        REQUIRE(a->copy_ctor());
+
+        boxed<debugger_type> b(debugger_type(1));
+        REQUIRE(b.value().id == 1);
+        REQUIRE(b->move_ctor());
+
+        boxed<debugger_type> c(std::allocator_arg, std::allocator<debugger_type>{}, 2, 3.0);
+        REQUIRE((*c).id == 2);
+        REQUIRE(c->ctor());
+
+        auto d = allocate_boxed<debugger_type>(std::allocator<debugger_type>{}, 3);
+        REQUIRE(d->id == 3);
+    }
+    SECTION("copy/move")
+    {
+        boxed<int> a(4);
+
+        boxed<int> b(a);
+        REQUIRE(*b == 4);
+        REQUIRE(&*b != &*a);
+
+        auto       ptr = &*a;
+        boxed<int> c(std::move(a));
+        REQUIRE(&*c == ptr);
+
+        b = c;
+        REQUIRE(*b == 4);
+        REQUIRE(&*b != ptr);
+
+        // assign to moved-from
+        a = c;
+        REQUIRE(*a == 4);
+
+        *b = 5;
+        a  = std::move(b);
+        REQUIRE(*a == 5);
+    }
+    SECTION("propagating copy assignment")
+    {
+        arena arena_a, arena_b;
+        auto  a = allocate_boxed<int>(arena_allocator<int>(arena_a), 1);
+        auto  b = allocate_boxed<int>(arena_allocator<int>(arena_b), 2);
+
+        // the copy is allocated in the other arena
+        b = a;
+        REQUIRE(*b == 1);
+        REQUIRE(&*b != &*a);
+        REQUIRE(&b.get_allocator().get_arena() == &arena_a);
+    }
+    SECTION("swap")
+    {
+        boxed<int> a(1);
+        boxed<int> b(2);
+
+        auto ptr_a = &*a;
+        swap(a, b);
+        REQUIRE(*a == 2);
+        REQUIRE(*b == 1);
+        REQUIRE(&*b == ptr_a);
+    }
+    SECTION("comparison")
+    {
+        boxed<int> a(1);
+        boxed<int> b(2);
+        REQUIRE(a == a);
+        REQUIRE(a != b);
+        REQUIRE(a < b);
+        REQUIRE(a <= b);
+        REQUIRE(b > a);
+        REQUIRE(b >= a);
+    }
+}
+
+namespace
+{
+    struct binary_expr;
+
+    using expr_allocator = arena_allocator<binary_expr>;
+    using expr           = variant<int, boxed<binary_expr, expr_allocator>>;
+
+    struct binary_expr
+    {
+        char op;
+        expr lhs, rhs;
+
+        binary_expr(char op, expr lhs, expr rhs)
+        : op(op), lhs(std::move(lhs)), rhs(std::move(rhs))
+        {
+        }
+
+        friend bool operator==(const binary_expr& a, const binary_expr& b)
+        {
+            return a.op == b.op && a.lhs == b.lhs && a.rhs == b.rhs;
+        }
+    };
+
+    expr make_expr(expr_allocator alloc, char op, expr lhs, expr rhs)
+    {
+        return allocate_boxed<binary_expr>(alloc, op, std::move(lhs), std::move(rhs));
+    }
+
+    struct evaluator
+    {
+        int operator()(int i) const
+        {
+            return i;
+        }
+
+        int operator()(const binary_expr& e) const
+        {
+            auto lhs = visit(*this, e.lhs);
+            auto rhs = visit(*this, e.rhs);
+            return e.op == '+' ? lhs + rhs : lhs * rhs;
+        }
+    };
+} // namespace
+
+TEST_CASE("boxed recursive variant")
+{
+    arena          a;
+    expr_allocator alloc(a);
+
+    // (1 + 2) * (3 + 4)
+    auto e = make_expr(alloc, '*', make_expr(alloc, '+', 1, 2), make_expr(alloc, '+', 3, 4));
+    REQUIRE(visit(evaluator{}, e) == 21);
+
+    auto copy = e;
+    REQUIRE(visit(evaluator{}, copy) == 21);
+    REQUIRE(copy == e);
+
+    copy = 42;
+    REQUIRE(visit(evaluator{}, copy) == 42);
+    REQUIRE(copy != e);
+}
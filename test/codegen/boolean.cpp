@@ -0,0 +1,16 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/boolean.hpp>
+
+#if TYPE_SAFE_CODEGEN_WRAPPER
+using bool_t = type_safe::boolean;
+#else
+using bool_t = bool;
+#endif
+
+extern "C" bool type_safe_codegen(bool a, bool b, bool c)
+{
+    return (!bool_t(a) == bool_t(b)) != (bool_t(c) == true);
+}
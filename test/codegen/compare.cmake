@@ -0,0 +1,65 @@
+# Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+# This file is subject to the license terms in the LICENSE file
+# found in the top-level directory of this distribution.
+
+# compiles SOURCE once with and once without the wrapper types
+# and fails if the function type_safe_codegen() has more instructions using the wrappers
+#
+# expected variables:
+# COMPILER - the C++ compiler
+# SOURCE - the snippet
+# OUTPUT - prefix for the generated assembly files
+# INCLUDE_DIRS - include directories separated by '|'
+
+string(REPLACE "|" ";" include_dirs "${INCLUDE_DIRS}")
+set(flags -std=c++11 -O2 -S -fno-asynchronous-unwind-tables
+          -DTYPE_SAFE_ENABLE_ASSERTIONS=0 -DTYPE_SAFE_ENABLE_PRECONDITION_CHECKS=0
+          -DTYPE_SAFE_ARITHMETIC_UB=0)
+foreach(dir ${include_dirs})
+    list(APPEND flags -I${dir})
+endforeach()
+
+# returns the instructions of type_safe_codegen() in the assembly file
+function(_type_safe_extract_instructions file result)
+    file(STRINGS ${file} lines)
+    set(in_function OFF)
+    set(instructions)
+    foreach(line ${lines})
+        if(line MATCHES "^_?type_safe_codegen:")
+            set(in_function ON)
+        elseif(in_function)
+            if(line MATCHES "^[ \t]*\\.size" OR line MATCHES "^_?[A-Za-z_][A-Za-z_0-9]*:")
+                break()
+            elseif(line MATCHES "^[ \t]+[a-z]")
+                # instruction and not a directive or label
+                string(STRIP "${line}" line)
+                list(APPEND instructions "${line}")
+            endif()
+        endif()
+    endforeach()
+    set(${result} "${instructions}" PARENT_SCOPE)
+endfunction()
+
+foreach(wrapper 0 1)
+    execute_process(COMMAND ${COMPILER} ${flags} -DTYPE_SAFE_CODEGEN_WRAPPER=${wrapper}
+                            ${SOURCE} -o ${OUTPUT}_${wrapper}.s
+                    RESULT_VARIABLE result
+                    ERROR_VARIABLE error)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "unable to compile ${SOURCE}:\n${error}")
+    endif()
+
+    _type_safe_extract_instructions(${OUTPUT}_${wrapper}.s instructions_${wrapper})
+    list(LENGTH instructions_${wrapper} count_${wrapper})
+endforeach()
+
+if(count_0 EQUAL 0)
+    message(FATAL_ERROR "type_safe_codegen() not found in ${OUTPUT}_0.s")
+elseif(count_1 GREATER count_0)
+    string(REPLACE ";" "\n    " raw "${instructions_0}")
+    string(REPLACE ";" "\n    " wrapper "${instructions_1}")
+    message(FATAL_ERROR "wrapper generates ${count_1} instead of ${count_0} instructions\n"
+                        "raw:\n    ${raw}\nwrapper:\n    ${wrapper}")
+else()
+    message(STATUS "${count_1} instructions, raw version has ${count_0}")
+endif()
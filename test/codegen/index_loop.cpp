@@ -0,0 +1,23 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/index.hpp>
+
+#if TYPE_SAFE_CODEGEN_WRAPPER
+extern "C" int type_safe_codegen(const int* array, std::size_t size)
+{
+    auto sum = 0;
+    for (type_safe::index_t i; i != type_safe::index_t(size); ++i)
+        sum += type_safe::at(array, i);
+    return sum;
+}
+#else
+extern "C" int type_safe_codegen(const int* array, std::size_t size)
+{
+    auto sum = 0;
+    for (std::size_t i = 0u; i != size; ++i)
+        sum += array[i];
+    return sum;
+}
+#endif
@@ -0,0 +1,16 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/integer.hpp>
+
+#if TYPE_SAFE_CODEGEN_WRAPPER
+using int_t = type_safe::integer<int>;
+#else
+using int_t = int;
+#endif
+
+extern "C" int type_safe_codegen(int a, int b, int c)
+{
+    return static_cast<int>(int_t(a) * int_t(b) + int_t(c) - int_t(a) / int_t(c));
+}
@@ -0,0 +1,16 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/ranged_integer.hpp>
+
+#if TYPE_SAFE_CODEGEN_WRAPPER
+using byte_t = type_safe::ranged_integer<0, 255>;
+#else
+using byte_t = int;
+#endif
+
+extern "C" int type_safe_codegen(unsigned char a, unsigned char b, unsigned char c)
+{
+    return static_cast<int>(byte_t(a) * byte_t(b) + byte_t(c) - byte_t(a));
+}
@@ -0,0 +1,26 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/strong_typedef.hpp>
+
+#if TYPE_SAFE_CODEGEN_WRAPPER
+struct meter : type_safe::strong_typedef<meter, int>,
+               type_safe::strong_typedef_op::addition<meter>,
+               type_safe::strong_typedef_op::relational_comparison<meter>
+{
+    using strong_typedef::strong_typedef;
+};
+
+extern "C" int type_safe_codegen(int a, int b)
+{
+    auto sum = meter(a) + meter(b);
+    return static_cast<int>(sum < meter(a) ? meter(a) : sum);
+}
+#else
+extern "C" int type_safe_codegen(int a, int b)
+{
+    auto sum = a + b;
+    return sum < a ? a : sum;
+}
+#endif
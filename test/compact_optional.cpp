@@ -6,6 +6,9 @@
 
 #include <catch.hpp>
 
+#include <limits>
+#include <vector>
+
 using namespace type_safe;
 
 namespace type_safe
@@ -13,6 +16,8 @@ namespace type_safe
     template class basic_optional<compact_optional_storage<compact_bool_policy<bool>>>;
     template class basic_optional<compact_optional_storage<compact_integer_policy<int, -1>>>;
     template class basic_optional<compact_optional_storage<compact_floating_point_policy<float>>>;
+    template class basic_optional<compact_optional_storage<compact_nan_payload_policy<double>>>;
+    template class basic_optional<compact_optional_storage<compact_pointer_policy<int>>>;
 } // namespace type_safe
 
 TEST_CASE("compact_bool")
@@ -72,6 +77,49 @@ TEST_CASE("compact_floating_point")
     REQUIRE(s.get_value() == 1.0);
 }
 
+TEST_CASE("compact_nan_payload")
+{
+    using storage = compact_optional_storage<compact_nan_payload_policy<double>>;
+
+    storage s;
+    REQUIRE(!s.has_value());
+
+    s.create_value(std::numeric_limits<double>::quiet_NaN());
+    REQUIRE(s.has_value());
+    REQUIRE(s.get_value() != s.get_value());
+
+    s.destroy_value();
+    REQUIRE(!s.has_value());
+
+    s.create_value(1.0);
+    REQUIRE(s.has_value());
+    REQUIRE(s.get_value() == 1.0);
+
+    using float_storage = compact_optional_storage<compact_nan_payload_policy<float>>;
+    float_storage f;
+    REQUIRE(!f.has_value());
+    f.create_value(std::numeric_limits<float>::quiet_NaN());
+    REQUIRE(f.has_value());
+}
+
+TEST_CASE("compact_pointer")
+{
+    using storage = compact_optional_storage<compact_pointer_policy<int>>;
+
+    storage s;
+    REQUIRE(!s.has_value());
+
+    s.create_value(nullptr);
+    REQUIRE(s.has_value());
+    REQUIRE(s.get_value() == nullptr);
+
+    int i = 0;
+    s.destroy_value();
+    s.create_value(&i);
+    REQUIRE(s.has_value());
+    REQUIRE(s.get_value() == &i);
+}
+
 enum class test_compact_enum
 {
     a,
@@ -134,3 +182,78 @@ TEST_CASE("compact_container")
     s.destroy_value();
     REQUIRE(!s.has_value());
 }
+
+TEST_CASE("compact_optional range algorithms")
+{
+    SECTION("floating point")
+    {
+        using optional_t = compact_optional<compact_floating_point_policy<double>>;
+
+        std::vector<optional_t> vec(100u);
+        for (auto i = 0u; i != vec.size(); i += 2u)
+            vec[i] = double(i);
+
+        array_ref<optional_t> range(vec.data(), vec.size());
+        REQUIRE(count_present(range).get() == 50u);
+        REQUIRE(count_present(array_ref<const optional_t>(vec.data(), vec.size())).get() == 50u);
+
+        transform_present(range, [](double d) { return d / 2; });
+        REQUIRE(vec[4].value() == 2.);
+        REQUIRE(!vec[5].has_value());
+
+        // modifying the argument doesn't affect the empty optionals
+        transform_present(range, [](double& d) {
+            d = 1.;
+            return 2.;
+        });
+        REQUIRE(vec[4].value() == 2.);
+        REQUIRE(!vec[5].has_value());
+
+        fill_missing(range, 0);
+        REQUIRE(count_present(range).get() == 100u);
+        REQUIRE(vec[4].value() == 2.);
+        REQUIRE(vec[5].value() == 0.);
+    }
+    SECTION("nan payload")
+    {
+        using optional_t = compact_optional<compact_nan_payload_policy<double>>;
+
+        std::vector<optional_t> vec(10u);
+        vec[0] = std::numeric_limits<double>::quiet_NaN();
+
+        array_ref<optional_t> range(vec.data(), vec.size());
+        REQUIRE(count_present(range).get() == 1u);
+        fill_missing(range, 1.0);
+        REQUIRE(vec[0].value() != vec[0].value());
+        REQUIRE(vec[1].value() == 1.0);
+    }
+    SECTION("integer")
+    {
+        using optional_t = compact_optional<compact_integer_policy<int, -1>>;
+
+        std::vector<optional_t> vec(10u);
+        vec[3] = 3;
+        vec[7] = 7;
+
+        array_ref<optional_t> range(vec.data(), vec.size());
+        REQUIRE(count_present(range).get() == 2u);
+
+        // returning the invalid value makes it empty
+        transform_present(range, [](int i) { return i == 3 ? -1 : i + 1; });
+        REQUIRE(count_present(range).get() == 1u);
+        REQUIRE(vec[7].value() == 8);
+
+        fill_missing(range, 42);
+        REQUIRE(vec[0].value() == 42);
+        REQUIRE(vec[3].value() == 42);
+        REQUIRE(vec[7].value() == 8);
+    }
+    SECTION("empty range")
+    {
+        using optional_t = compact_optional<compact_integer_policy<int, -1>>;
+
+        array_ref<optional_t> range(nullptr);
+        REQUIRE(count_present(range).get() == 0u);
+        fill_missing(range, 0);
+    }
+}
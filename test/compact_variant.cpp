@@ -0,0 +1,97 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/compact_variant.hpp>
+
+#include <catch.hpp>
+
+using namespace type_safe;
+
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+static_assert(sizeof(compact_variant<object_ref<int>, object_ref<double>>) == sizeof(void*), "");
+static_assert(sizeof(compact_variant<nullvar_t, int*, const long*>) == sizeof(void*), "");
+static_assert(std::is_trivially_copyable<compact_variant<int*, double*>>::value, "");
+static_assert(!std::is_default_constructible<compact_variant<int*, double*>>::value, "");
+#endif
+
+TEST_CASE("compact_variant")
+{
+    int    i = 4;
+    double d = 3.14;
+
+    SECTION("non-empty")
+    {
+        using variant_t = compact_variant<object_ref<int>, object_ref<double>>;
+
+        variant_t a = object_ref<int>(i);
+        REQUIRE(a.has_value());
+        REQUIRE(a.type() == variant_t::type_id(variant_type<object_ref<int>>{}));
+        REQUIRE(a.has_value(variant_type<object_ref<int>>{}));
+        REQUIRE(!a.has_value(variant_type<object_ref<double>>{}));
+        REQUIRE(&a.value(variant_type<object_ref<int>>{}).get() == &i);
+        REQUIRE(!a.optional_value(variant_type<object_ref<double>>{}).has_value());
+
+        a = object_ref<double>(d);
+        REQUIRE(a.type() == variant_t::type_id(variant_type<object_ref<double>>{}));
+        REQUIRE(&a.value(variant_type<object_ref<double>>{}).get() == &d);
+        REQUIRE(&a.optional_value(variant_type<object_ref<double>>{}).value().get() == &d);
+
+        variant_t b(variant_type<object_ref<double>>{}, d);
+        REQUIRE(a == b);
+        b.emplace(variant_type<object_ref<int>>{}, i);
+        REQUIRE(a != b);
+    }
+    SECTION("empty")
+    {
+        using variant_t = compact_variant<nullvar_t, int*, double*>;
+
+        variant_t a;
+        REQUIRE(!a.has_value());
+        REQUIRE(a.has_value(variant_type<nullvar_t>{}));
+        REQUIRE(a.type() == variant_t::invalid_type);
+        REQUIRE(a == variant_t(nullvar));
+
+        a = &i;
+        REQUIRE(a.has_value(variant_type<int*>{}));
+        REQUIRE(a.value(variant_type<int*>{}) == &i);
+        REQUIRE(a.value_or(variant_type<double*>{}, nullptr) == nullptr);
+
+        a = static_cast<int*>(nullptr);
+        REQUIRE(a.has_value(variant_type<int*>{}));
+        REQUIRE(a.value(variant_type<int*>{}) == nullptr);
+        REQUIRE(a != variant_t(static_cast<double*>(nullptr)));
+
+        a.reset();
+        REQUIRE(!a.has_value());
+    }
+    SECTION("visit")
+    {
+        struct visitor
+        {
+            int operator()(int* ptr) const
+            {
+                return *ptr;
+            }
+
+            int operator()(double* ptr) const
+            {
+                return static_cast<int>(*ptr * 100);
+            }
+
+            int operator()(nullvar_t) const
+            {
+                return -1;
+            }
+        };
+
+        compact_variant<nullvar_t, int*, double*> a;
+        REQUIRE(visit(visitor{}, a) == -1);
+
+        a = &i;
+        REQUIRE(visit(visitor{}, a) == 4);
+
+        a = &d;
+        REQUIRE(visit(visitor{}, a) == 314);
+    }
+}
@@ -0,0 +1,154 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/deferred_array.hpp>
+
+#include <catch.hpp>
+
+#include <string>
+
+using namespace type_safe;
+
+namespace
+{
+    struct counted
+    {
+        static int alive;
+
+        int value;
+
+        explicit counted(int v) : value(v)
+        {
+            ++alive;
+        }
+
+        counted(const counted&) = delete;
+
+        ~counted()
+        {
+            --alive;
+        }
+    };
+
+    int counted::alive = 0;
+
+    struct throwing
+    {
+        throwing()
+        {
+            throw 0;
+        }
+    };
+}
+
+TEST_CASE("deferred_array")
+{
+    SECTION("trivial")
+    {
+        deferred_array<int, 100> arr;
+        REQUIRE(arr.size().get() == 100u);
+        REQUIRE(arr.count().get() == 0u);
+        REQUIRE(!arr.has_value(0u));
+
+        REQUIRE(arr.emplace(70u, 42) == 42);
+        REQUIRE(arr.has_value(70u));
+        REQUIRE(arr.value(70u) == 42);
+        REQUIRE(arr.count().get() == 1u);
+
+        arr.value(70u) = 0;
+        const deferred_array<int, 100>& carr = arr;
+        REQUIRE(carr.value(70u) == 0);
+
+        arr.destroy(70u);
+        REQUIRE(!arr.has_value(70u));
+
+        arr.emplace(0u, 1);
+        arr.emplace(99u, 2);
+        REQUIRE(arr.count().get() == 2u);
+        arr.reset();
+        REQUIRE(arr.count().get() == 0u);
+        REQUIRE(!arr.has_value(0u));
+        REQUIRE(!arr.has_value(99u));
+    }
+    SECTION("non-trivial")
+    {
+        {
+            deferred_array<counted, 130> arr;
+            for (auto i = 0u; i < 130u; i += 3u)
+                arr.emplace(i, int(i));
+            REQUIRE(counted::alive == 44);
+            REQUIRE(arr.count().get() == 44u);
+            REQUIRE(arr.value(129u).value == 129);
+
+            arr.destroy(63u);
+            REQUIRE(counted::alive == 43);
+
+            arr.reset();
+            REQUIRE(counted::alive == 0);
+            REQUIRE(arr.count().get() == 0u);
+
+            arr.emplace(63u, 1);
+            arr.emplace(64u, 2);
+            REQUIRE(counted::alive == 2);
+        }
+        REQUIRE(counted::alive == 0);
+    }
+    SECTION("exception")
+    {
+        deferred_array<throwing, 4> arr;
+        REQUIRE_THROWS(arr.emplace(1u));
+        REQUIRE(!arr.has_value(1u));
+    }
+}
+
+TEST_CASE("deferred_vector")
+{
+    SECTION("empty")
+    {
+        deferred_vector<std::string> vec;
+        REQUIRE(vec.size().get() == 0u);
+        REQUIRE(vec.count().get() == 0u);
+        vec.reset();
+    }
+    SECTION("trivial")
+    {
+        deferred_vector<int> vec(65u);
+        REQUIRE(vec.size().get() == 65u);
+        REQUIRE(vec.count().get() == 0u);
+
+        vec.emplace(64u, 4);
+        vec.emplace(0u, 3);
+        REQUIRE(vec.value(64u) == 4);
+        REQUIRE(vec.count().get() == 2u);
+
+        vec.reset();
+        REQUIRE(!vec.has_value(0u));
+        REQUIRE(!vec.has_value(64u));
+    }
+    SECTION("non-trivial")
+    {
+        {
+            deferred_vector<counted> vec(200u);
+            for (auto i = 0u; i < 200u; i += 2u)
+                vec.emplace(i, int(i));
+            REQUIRE(counted::alive == 100);
+
+            vec.destroy(100u);
+            REQUIRE(!vec.has_value(100u));
+            REQUIRE(counted::alive == 99);
+
+            deferred_vector<counted> other(std::move(vec));
+            REQUIRE(vec.size().get() == 0u);
+            REQUIRE(other.size().get() == 200u);
+            REQUIRE(other.value(198u).value == 198);
+            REQUIRE(counted::alive == 99);
+
+            other.reset();
+            REQUIRE(counted::alive == 0);
+
+            other.emplace(199u, 1);
+        }
+        REQUIRE(counted::alive == 0);
+    }
+}
@@ -64,3 +64,147 @@ TEST_CASE("downcast")
         REQUIRE(&res2 == &ref);
     }
 }
+
+namespace
+{
+    enum class node_kind
+    {
+        expr,
+        literal,
+        binary,
+        stmt,
+    };
+
+    struct node
+    {
+        explicit node(node_kind k) : kind(k)
+        {
+        }
+
+        node_kind class_id() const noexcept
+        {
+            return kind;
+        }
+
+        node_kind kind;
+    };
+
+    struct expr : node
+    {
+        using class_ids = class_id_range<node_kind, node_kind::expr, node_kind::binary>;
+
+        explicit expr(node_kind k) : node(k)
+        {
+        }
+    };
+
+    struct literal : expr
+    {
+        using class_ids = class_id_range<node_kind, node_kind::literal>;
+
+        literal() : expr(node_kind::literal)
+        {
+        }
+    };
+
+    struct binary : expr
+    {
+        using class_ids = class_id_range<node_kind, node_kind::binary>;
+
+        binary() : expr(node_kind::binary)
+        {
+        }
+    };
+
+    struct stmt : node
+    {
+        using class_ids = class_id_range<node_kind, node_kind::stmt>;
+
+        stmt() : node(node_kind::stmt)
+        {
+        }
+    };
+
+    // forgot to declare its own class_ids
+    struct call : expr
+    {
+    };
+} // namespace
+
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+static_assert(detail::has_own_class_ids<literal, expr>::value, "");
+static_assert(detail::has_own_class_ids<expr, node>::value, "");
+static_assert(!detail::has_own_class_ids<call, expr>::value, "");
+#endif
+
+TEST_CASE("checked_downcast")
+{
+    SECTION("class_id_range")
+    {
+        using range = class_id_range<int, 2, 4>;
+        REQUIRE(range::first == 2);
+        REQUIRE(range::last == 4);
+        REQUIRE(!range::contains(1));
+        REQUIRE(range::contains(2));
+        REQUIRE(range::contains(4));
+        REQUIRE(!range::contains(5));
+
+        REQUIRE(class_id_range<unsigned, 0u>::contains(0u));
+        REQUIRE(!class_id_range<unsigned, 0u>::contains(1u));
+    }
+    SECTION("class ids")
+    {
+        literal lit;
+        stmt    s;
+
+        node& lit_node = lit;
+        REQUIRE(can_downcast<node>(lit_node));
+        REQUIRE(can_downcast<expr>(lit_node));
+        REQUIRE(can_downcast<literal>(lit_node));
+        REQUIRE(!can_downcast<binary>(lit_node));
+        REQUIRE(!can_downcast<stmt>(lit_node));
+
+        const node& s_node = s;
+        REQUIRE(!can_downcast<expr>(s_node));
+        REQUIRE(can_downcast<stmt>(s_node));
+
+        optional_ref<expr> e = checked_downcast<expr>(lit_node);
+        REQUIRE(e.has_value());
+        REQUIRE(&e.value() == &lit);
+
+        optional_ref<literal> l = checked_downcast(derived_type<literal>{}, e.value());
+        REQUIRE(l.has_value());
+        REQUIRE(&l.value() == &lit);
+
+        REQUIRE(!checked_downcast<binary>(lit_node).has_value());
+
+        optional_ref<const stmt> cs = checked_downcast<stmt>(s_node);
+        REQUIRE(cs.has_value());
+        REQUIRE(&cs.value() == &s);
+        REQUIRE(!checked_downcast<expr>(s_node).has_value());
+
+        // also used by the debug check
+        REQUIRE(&downcast<literal&>(lit_node) == &lit);
+    }
+#if TYPE_SAFE_USE_RTTI
+    SECTION("dynamic_cast")
+    {
+        struct base
+        {
+            virtual ~base() = default;
+        };
+
+        struct derived : base
+        {
+        };
+
+        base    b;
+        derived d;
+
+        REQUIRE(can_downcast<derived>(static_cast<base&>(d)));
+        REQUIRE(!can_downcast<derived>(b));
+        REQUIRE(checked_downcast<derived>(static_cast<base&>(d)).has_value());
+        REQUIRE(!checked_downcast<derived>(b).has_value());
+    }
+#endif
+}
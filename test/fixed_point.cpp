@@ -0,0 +1,99 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/fixed_point.hpp>
+
+#include <catch.hpp>
+
+#include <cstdint>
+
+using namespace type_safe;
+
+TEST_CASE("fixed_point")
+{
+    using price = decimal_fixed_point<std::int64_t, 4, checked_arithmetic>;
+
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+    static_assert(sizeof(price) == sizeof(std::int64_t), "");
+    static_assert(price::scale() == 10000, "");
+    static_assert(std::is_same<binary_fixed_point<int, 8>, fixed_point<int, 256>>::value, "");
+
+    constexpr auto c = price(1.5) * price(2);
+    static_assert(c.raw().get() == 30000, "");
+#endif
+
+    SECTION("construction")
+    {
+        REQUIRE(price().raw().get() == 0);
+        REQUIRE(price(3).raw().get() == 30000);
+        REQUIRE(price(1.25).raw().get() == 12500);
+        REQUIRE(price(-1.00005).raw().get() == -10001);
+        REQUIRE(price(floating_point<double>(0.5)).raw().get() == 5000);
+        REQUIRE(price::from_raw(12345).whole().get() == 1);
+        REQUIRE(price::from_raw(-12345).whole().get() == -1);
+
+        REQUIRE(static_cast<double>(price(2.5)) == 2.5);
+        REQUIRE(static_cast<float>(price(0.25).to_floating_point<float>()) == 0.25f);
+    }
+    SECTION("rescale")
+    {
+        using cents = decimal_fixed_point<std::int64_t, 2, checked_arithmetic>;
+        REQUIRE(price(cents(1.23)).raw().get() == 12300);
+        REQUIRE(cents(price::from_raw(12399)).raw().get() == 123);
+    }
+    SECTION("arithmetic")
+    {
+        price a(1.5), b(0.25);
+        REQUIRE(a + b == price(1.75));
+        REQUIRE(a - b == price(1.25));
+        REQUIRE(-a == price(-1.5));
+        REQUIRE(a * b == price(0.375));
+        REQUIRE(a / b == price(6));
+        REQUIRE(price(1) / price(3) == price::from_raw(3333));
+        REQUIRE(a * 3 == price(4.5));
+        REQUIRE(3 * a == price(4.5));
+        REQUIRE(a / 2 == price(0.75));
+
+        REQUIRE(!(a < b));
+        REQUIRE(a > b);
+        REQUIRE(a != b);
+        REQUIRE(a >= a);
+
+        a += b;
+        REQUIRE(a == price(1.75));
+        a -= b;
+        REQUIRE(a == price(1.5));
+        a *= price(2);
+        REQUIRE(a == price(3));
+        a /= price(4);
+        REQUIRE(a == price(0.75));
+        a *= 4;
+        REQUIRE(a == price(3));
+        a /= 3;
+        REQUIRE(a == price(1));
+    }
+    SECTION("wide intermediate")
+    {
+        // the product of the raw values does not fit into 64bit
+        price big(100000000);
+        REQUIRE(big * price(2) == price(200000000));
+        REQUIRE(big / price(0.5) == price(200000000));
+
+        using small = decimal_fixed_point<std::int16_t, 2, checked_arithmetic>;
+        REQUIRE(small(100.) * small(0.5) == small(50.));
+        REQUIRE(small(3.) / small(4.) == small(0.75));
+    }
+    SECTION("overflow")
+    {
+        auto max = price::from_raw(std::numeric_limits<std::int64_t>::max());
+        REQUIRE_THROWS_AS(max + price(1), checked_arithmetic::error);
+        REQUIRE_THROWS_AS(max * price(2), checked_arithmetic::error);
+        REQUIRE_THROWS_AS(max / price(0.5), checked_arithmetic::error);
+        REQUIRE_THROWS_AS(price(1) / price(), checked_arithmetic::error);
+
+        using saturated = decimal_fixed_point<std::int32_t, 3, saturating_arithmetic>;
+        REQUIRE(saturated(2000000) * saturated(2000000)
+                == saturated::from_raw(std::numeric_limits<std::int32_t>::max()));
+    }
+}
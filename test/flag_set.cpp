@@ -6,6 +6,8 @@
 
 #include <catch.hpp>
 
+#include <vector>
+
 // no using namespace to test operator namespace
 
 enum class test_flags
@@ -221,3 +223,92 @@ TEST_CASE("flag_set")
         check_set(s, true, false, false);
     }
 }
+
+TEST_CASE("flag_set iteration")
+{
+    type_safe::flag_set<test_flags> s;
+    REQUIRE(s.count() == 0u);
+    REQUIRE(!s.find_first().has_value());
+    REQUIRE(s.begin() == s.end());
+
+    s |= test_flags::b | test_flags::c;
+    REQUIRE(s.count() == 2u);
+    REQUIRE(s.find_first().value() == test_flags::b);
+
+    std::vector<test_flags> flags(s.begin(), s.end());
+    REQUIRE(flags == (std::vector<test_flags>{test_flags::b, test_flags::c}));
+
+    auto count = 0;
+    for (test_flags flag : s.set_flags())
+    {
+        REQUIRE(s.is_set(flag));
+        ++count;
+    }
+    REQUIRE(count == 2);
+
+    REQUIRE(s.any_of(test_flags::a | test_flags::b));
+    REQUIRE(!s.any_of(test_flags::a));
+    REQUIRE(s.all_of(test_flags::b | test_flags::c));
+    REQUIRE(!s.all_of(test_flags::a | test_flags::b));
+    REQUIRE(s.none_of(test_flags::a));
+    REQUIRE(!s.none_of(test_flags::c));
+}
+
+enum class big_flags
+{
+    a,
+    b = 63,
+    c = 64,
+    d = 150,
+    e = 199,
+    _flag_set_size,
+};
+
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+static_assert(type_safe::flag_set<big_flags>(big_flags::d).is_set(big_flags::d), "");
+static_assert(!type_safe::flag_set<big_flags>(big_flags::d).is_set(big_flags::c), "");
+static_assert((~type_safe::flag_set<big_flags>(big_flags::c)).is_set(big_flags::e), "");
+static_assert(type_safe::flag_set<big_flags>(big_flags::a | big_flags::e).any(), "");
+#endif
+
+TEST_CASE("flag_set large")
+{
+    type_safe::flag_set<big_flags> s;
+    REQUIRE(s.none());
+    REQUIRE(s.count() == 0u);
+    REQUIRE(!s.find_first().has_value());
+
+    s.set(big_flags::c);
+    s.set(big_flags::e);
+    REQUIRE(s.any());
+    REQUIRE(s.is_set(big_flags::c));
+    REQUIRE(s.is_set(big_flags::e));
+    REQUIRE(!s.is_set(big_flags::b));
+    REQUIRE(s.count() == 2u);
+    REQUIRE(s.find_first().value() == big_flags::c);
+    REQUIRE(s.any_of(big_flags::a | big_flags::e));
+    REQUIRE(!s.all_of(big_flags::a | big_flags::e));
+    REQUIRE((s & big_flags::c));
+    REQUIRE((big_flags::e & s));
+    REQUIRE(!(s & big_flags::a));
+    REQUIRE(!(big_flags::a & s));
+
+    s |= big_flags::a | big_flags::b;
+    std::vector<big_flags> flags(s.begin(), s.end());
+    REQUIRE(flags
+            == (std::vector<big_flags>{big_flags::a, big_flags::b, big_flags::c, big_flags::e}));
+
+    s &= ~big_flags::c;
+    REQUIRE(!s.is_set(big_flags::c));
+    REQUIRE(s == (big_flags::a | big_flags::b | big_flags::e));
+
+    s.toggle(big_flags::d);
+    s ^= big_flags::a | big_flags::e;
+    REQUIRE(s == (big_flags::b | big_flags::d));
+
+    s.set_all();
+    REQUIRE(s.all());
+    REQUIRE(s.count() == 200u);
+    s.toggle_all();
+    REQUIRE(s.none());
+}
@@ -6,6 +6,9 @@
 
 #include <catch.hpp>
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <sstream>
 
 using namespace type_safe;
@@ -194,6 +197,54 @@ TEST_CASE("floating_point")
         REQUIRE(!(float_t(4.) >= 5.));
         REQUIRE(bool(float_t(5.) >= 5.));
     }
+    SECTION("approximate comparison")
+    {
+        auto next = float_t(std::nextafter(1., 2.));
+
+        REQUIRE(ulp_distance(float_t(1.), float_t(1.)) == 0u);
+        REQUIRE(ulp_distance(float_t(1.), next) == 1u);
+        REQUIRE(ulp_distance(next, float_t(1.)) == 1u);
+        REQUIRE(ulp_distance(float_t(0.), float_t(-0.)) == 0u);
+        REQUIRE(ulp_distance(float_t(std::numeric_limits<double>::denorm_min()),
+                             float_t(-std::numeric_limits<double>::denorm_min()))
+                == 2u);
+        REQUIRE(ulp_distance(float_t(std::numeric_limits<double>::max()),
+                             float_t(std::numeric_limits<double>::infinity()))
+                == 1u);
+        REQUIRE(ulp_distance(float_t(std::numeric_limits<double>::quiet_NaN()), float_t(1.))
+                == std::numeric_limits<std::uint64_t>::max());
+
+        REQUIRE(almost_equal_ulps(float_t(0.1 + 0.2), float_t(0.3)));
+        REQUIRE(almost_equal_ulps(float_t(1.), next, 1u));
+        REQUIRE(!almost_equal_ulps(float_t(1.), next, 0u));
+        REQUIRE(!almost_equal_ulps(float_t(1.), float_t(1.001)));
+        REQUIRE(!almost_equal_ulps(float_t(std::numeric_limits<double>::quiet_NaN()),
+                                   float_t(std::numeric_limits<double>::quiet_NaN()),
+                                   std::numeric_limits<std::uint64_t>::max()));
+        REQUIRE(almost_equal_ulps(floating_point<float>(0.1f + 0.2f), floating_point<float>(0.3f)));
+
+        REQUIRE(almost_equal_abs(float_t(1e-20), float_t(0.), float_t(1e-10)));
+        REQUIRE(!almost_equal_abs(float_t(1.), float_t(1.1), float_t(0.01)));
+        REQUIRE(!almost_equal_abs(float_t(std::numeric_limits<double>::quiet_NaN()), float_t(0.),
+                                  float_t(1.)));
+
+        REQUIRE(almost_equal_rel(float_t(1000.), float_t(1000.5), float_t(1e-3)));
+        REQUIRE(almost_equal_rel(float_t(-1000.5), float_t(-1000.), float_t(1e-3)));
+        REQUIRE(!almost_equal_rel(float_t(1.), float_t(1.5), float_t(1e-3)));
+        REQUIRE(!almost_equal_rel(float_t(std::numeric_limits<double>::quiet_NaN()), float_t(0.),
+                                  float_t(1.)));
+    }
+    SECTION("fused operations")
+    {
+        REQUIRE(static_cast<double>(fma(float_t(2.), float_t(3.), float_t(4.))) == 10.);
+        REQUIRE(static_cast<double>(mul_add(float_t(2.), float_t(3.), float_t(4.))) == 10.);
+
+        // fma only rounds once
+        auto eps = std::numeric_limits<double>::epsilon();
+        auto a   = float_t(1. + eps);
+        auto b   = float_t(1. - eps);
+        REQUIRE(static_cast<double>(fma(a, b, float_t(-1.))) == -eps * eps);
+    }
     SECTION("i/o")
     {
         std::ostringstream out;
@@ -0,0 +1,55 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/fmt.hpp>
+
+#include <catch.hpp>
+
+using namespace type_safe;
+
+namespace
+{
+    enum class permission
+    {
+        read,
+        write,
+        execute,
+        _flag_set_size
+    };
+
+    struct id : strong_typedef<id, unsigned>
+    {
+        using strong_typedef::strong_typedef;
+    };
+} // namespace
+
+TEST_CASE("fmt")
+{
+    SECTION("wrapper")
+    {
+        REQUIRE(fmt::format("{}", integer<int>(-7)) == "-7");
+        REQUIRE(fmt::format("{:#x}", integer<unsigned>(255u)) == "0xff");
+        REQUIRE(fmt::format("{:.2f}", floating_point<double>(0.5)) == "0.50");
+        REQUIRE(fmt::format("{}", boolean(true)) == "true");
+        REQUIRE(fmt::format("{:>4}", id(42u)) == "  42");
+    }
+    SECTION("optional")
+    {
+        REQUIRE(fmt::format("{:03}", optional<int>(7)) == "007");
+        REQUIRE(fmt::format("{}", optional<id>()) == "nullopt");
+    }
+    SECTION("variant")
+    {
+        using value = variant<nullvar_t, int, id, optional<int>>;
+        REQUIRE(fmt::format("{}", value()) == "nullvar");
+        REQUIRE(fmt::format("{}", value(-1)) == "-1");
+        REQUIRE(fmt::format("{}", value(id(11u))) == "11");
+        REQUIRE(fmt::format("{}", value(optional<int>())) == "nullopt");
+    }
+    SECTION("flag_set")
+    {
+        flag_set<permission> set(permission::write);
+        REQUIRE(fmt::format("{}", set) == "010");
+    }
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/format.hpp>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+using namespace type_safe;
+
+namespace
+{
+    enum class permission
+    {
+        read,
+        write,
+        execute,
+        _flag_set_size
+    };
+
+    enum class big_flags
+    {
+        first,
+        last = 99,
+        _flag_set_size
+    };
+
+    struct id : strong_typedef<id, unsigned>
+    {
+        using strong_typedef::strong_typedef;
+    };
+
+    template <typename T>
+    std::string format_str(const T& value)
+    {
+        char buffer[128];
+        auto end = to_chars(buffer, buffer + sizeof(buffer), value);
+        REQUIRE(end);
+        return std::string(buffer, end);
+    }
+} // namespace
+
+TEST_CASE("to_chars")
+{
+    SECTION("integer")
+    {
+        REQUIRE(format_str(0) == "0");
+        REQUIRE(format_str(42) == "42");
+        REQUIRE(format_str(-42) == "-42");
+        REQUIRE(format_str(42u) == "42");
+        REQUIRE(format_str(std::int8_t(-128)) == "-128");
+        REQUIRE(format_str(std::uint8_t(255)) == "255");
+        REQUIRE(format_str(std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808");
+        REQUIRE(format_str(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+
+        // the buffer must be big enough for all characters
+        char buffer[3];
+        REQUIRE(to_chars(buffer, buffer + 3, -42) == buffer + 3);
+        REQUIRE(!to_chars(buffer, buffer + 3, -420));
+        REQUIRE(!to_chars(buffer, buffer, 0));
+    }
+    SECTION("boolean")
+    {
+        REQUIRE(format_str(true) == "true");
+        REQUIRE(format_str(boolean(false)) == "false");
+
+        char buffer[4];
+        REQUIRE(!to_chars(buffer, buffer + 4, false));
+    }
+    SECTION("wrapper")
+    {
+        REQUIRE(format_str(integer<int>(-7)) == "-7");
+        REQUIRE(format_str(id(42u)) == "42");
+    }
+    SECTION("optional")
+    {
+        REQUIRE(format_str(optional<int>(3)) == "3");
+        REQUIRE(format_str(optional<id>()) == "nullopt");
+        REQUIRE(format_str(optional<optional<int>>(optional<int>())) == "nullopt");
+
+        char buffer[4];
+        REQUIRE(!to_chars(buffer, buffer + 4, optional<int>()));
+    }
+    SECTION("variant")
+    {
+        using value = variant<nullvar_t, int, id, optional<int>>;
+        REQUIRE(format_str(value()) == "nullvar");
+        REQUIRE(format_str(value(-1)) == "-1");
+        REQUIRE(format_str(value(id(11u))) == "11");
+        REQUIRE(format_str(value(optional<int>())) == "nullopt");
+
+        REQUIRE(format_str(variant<int, bool>(true)) == "true");
+    }
+    SECTION("flag_set")
+    {
+        flag_set<permission> set;
+        REQUIRE(format_str(set) == "000");
+        set.set(permission::read);
+        REQUIRE(format_str(set) == "001");
+        set.set(permission::execute);
+        REQUIRE(format_str(set) == "101");
+
+        char buffer[2];
+        REQUIRE(!to_chars(buffer, buffer + 2, set));
+
+        flag_set<big_flags> big(big_flags::last);
+        REQUIRE(format_str(big) == "1" + std::string(99u, '0'));
+        big.set(big_flags::first);
+        REQUIRE(format_str(big) == "1" + std::string(98u, '0') + "1");
+    }
+#if TYPE_SAFE_USE_FROM_CHARS && defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    SECTION("floating point")
+    {
+        REQUIRE(format_str(0.5) == "0.5");
+        REQUIRE(format_str(floating_point<double>(-150.0)) == "-150");
+        REQUIRE(format_str(optional<double>(0.25)) == "0.25");
+    }
+#endif
+}
@@ -0,0 +1,128 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/function.hpp>
+
+#include <catch.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace type_safe;
+
+namespace
+{
+    int add(int a, int b)
+    {
+        return a + b;
+    }
+
+    // relocatable, but needs to be destroyed
+    struct counting_functor
+    {
+        int* destroyed;
+
+        ~counting_functor()
+        {
+            ++*destroyed;
+        }
+
+        int operator()() const
+        {
+            return *destroyed;
+        }
+    };
+} // namespace
+
+namespace type_safe
+{
+    template <>
+    struct is_trivially_relocatable<counting_functor> : std::true_type
+    {
+    };
+} // namespace type_safe
+
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+static_assert(!std::is_copy_constructible<function<void()>>::value, "");
+static_assert(std::is_nothrow_move_constructible<function<void()>>::value, "");
+static_assert(std::is_constructible<function<int(int, int)>, decltype(&add)>::value, "");
+#endif
+
+TEST_CASE("function")
+{
+    SECTION("function pointer")
+    {
+        function<int(int, int)> f(&add);
+        REQUIRE(f(1, 2) == 3);
+
+        function<void(int, short)> g(&add);
+        g(1, 2);
+    }
+    SECTION("functor")
+    {
+        auto call_count = 0;
+
+        function<int(int)> f([&](int i) {
+            ++call_count;
+            return 2 * i;
+        });
+        REQUIRE(f(2) == 4);
+        REQUIRE(call_count == 1);
+
+        function<int(int)> g(std::move(f));
+        REQUIRE(g(3) == 6);
+        REQUIRE(call_count == 2);
+
+        f = [](int i) { return i; };
+        REQUIRE(f(5) == 5);
+        g = std::move(f);
+        REQUIRE(g(7) == 7);
+    }
+    SECTION("move-only functor")
+    {
+        struct functor
+        {
+            std::unique_ptr<int> ptr;
+
+            int operator()()
+            {
+                return ++*ptr;
+            }
+        };
+
+        function<int()> f(functor{std::unique_ptr<int>(new int(0))});
+        REQUIRE(f() == 1);
+
+        function<int()> g(std::move(f));
+        REQUIRE(g() == 2);
+
+        g = [] { return 0; };
+        REQUIRE(g() == 0);
+    }
+    SECTION("destruction")
+    {
+        auto ptr = std::make_shared<int>(0);
+        {
+            function<long(), 2 * sizeof(std::shared_ptr<int>)> f([ptr] { return ptr.use_count(); });
+            REQUIRE(f() == 2);
+
+            auto g = std::move(f);
+            REQUIRE(g() == 2);
+        }
+        REQUIRE(ptr.use_count() == 1);
+    }
+    SECTION("relocatable functor")
+    {
+        auto destroyed = 0;
+        {
+            function<int()> f(counting_functor{&destroyed});
+            destroyed = 0; // the temporary
+
+            // moved with memcpy(), so the old one isn't destroyed
+            auto g = std::move(f);
+            REQUIRE(g() == 0);
+        }
+        REQUIRE(destroyed == 1);
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/fwd.hpp>
+
+namespace ts = type_safe;
+
+namespace
+{
+    // only uses the forward declarations
+    struct api
+    {
+        ts::object_ref<const int>*        ref;
+        ts::function_ref<int(int)>*       callback;
+        const ts::boolean*                flag;
+        const ts::floating_point<double>* value;
+    };
+
+    ts::optional<int> find(ts::integer<int> key);
+    int               get_value(const ts::optional<int>& opt);
+    bool              is_set(const ts::basic_optional<ts::direct_optional_storage<int>>& opt);
+} // namespace
+
+#include <type_safe/boolean.hpp>
+#include <type_safe/floating_point.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/optional.hpp>
+#include <type_safe/reference.hpp>
+#include <type_safe/strong_typedef.hpp>
+#include <type_safe/variant.hpp>
+
+#include <catch.hpp>
+
+namespace
+{
+    int get_value(const ts::optional<int>& opt)
+    {
+        return opt.value();
+    }
+
+    bool is_set(const ts::basic_optional<ts::direct_optional_storage<int>>& opt)
+    {
+        return opt.has_value();
+    }
+
+    ts::optional<int> find(ts::integer<int> key)
+    {
+        return static_cast<int>(key) == 0 ? ts::nullopt : ts::optional<int>(static_cast<int>(key));
+    }
+} // namespace
+
+TEST_CASE("fwd")
+{
+    static_assert(std::is_same<ts::integer<int>,
+                               ts::integer<int, ts::arithmetic_policy_default>>::value,
+                  "");
+    static_assert(std::is_same<ts::object_ref<int>, ts::object_ref<int, false>>::value, "");
+    static_assert(std::is_same<ts::variant<int, ts::floating_point<double>>,
+                               ts::basic_variant<ts::rarely_empty_variant_policy, int,
+                                                 ts::floating_point<double>>>::value,
+                  "");
+
+    auto                      value = 42;
+    ts::object_ref<const int> ref(value);
+    api                       a{&ref, nullptr, nullptr, nullptr};
+    REQUIRE(a.ref->get() == 42);
+
+    REQUIRE(get_value(find(ts::integer<int>(4))) == 4);
+    REQUIRE(!is_set(find(ts::integer<int>(0))));
+}
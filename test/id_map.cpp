@@ -0,0 +1,95 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/id_map.hpp>
+
+#include <catch.hpp>
+
+#include <string>
+
+#include "debugger_type.hpp"
+
+using namespace type_safe;
+
+namespace
+{
+    struct user_id : strong_typedef<user_id, unsigned>,
+                     strong_typedef_op::equality_comparison<user_id>
+    {
+        using strong_typedef::strong_typedef;
+    };
+} // namespace
+
+TEST_CASE("id_map")
+{
+    id_map<user_id, std::string> map;
+    REQUIRE(map.empty());
+    REQUIRE(map.capacity() == 0u);
+    REQUIRE(!map.lookup(user_id(0u)).has_value());
+    REQUIRE(!map.erase(user_id(0u)));
+
+    SECTION("insert")
+    {
+        REQUIRE(map.emplace(user_id(1u), "a"));
+        REQUIRE(!map.emplace(user_id(1u), "b"));
+        REQUIRE(map.size() == 1u);
+        REQUIRE(map.lookup(user_id(1u)).value() == "a");
+        REQUIRE(!map.contains(user_id(2u)));
+
+        REQUIRE(!map.insert_or_assign(user_id(1u), "b"));
+        REQUIRE(map.lookup(user_id(1u)).value() == "b");
+        REQUIRE(map.insert_or_assign(user_id(2u), "c"));
+        REQUIRE(map.contains(user_id(2u)));
+        REQUIRE(map.size() == 2u);
+
+        map.lookup(user_id(2u)).value() = "d";
+        const auto& cmap = map;
+        REQUIRE(cmap.lookup(user_id(2u)).value() == "d");
+    }
+    SECTION("many")
+    {
+        for (auto i = 0u; i != 1000u; ++i)
+            REQUIRE(map.emplace(user_id(i), std::to_string(i)));
+        REQUIRE(map.size() == 1000u);
+        REQUIRE(map.capacity() >= 1000u);
+
+        for (auto i = 0u; i != 1000u; i += 2u)
+            REQUIRE(map.erase(user_id(i)));
+        REQUIRE(map.size() == 500u);
+
+        for (auto i = 0u; i != 1000u; ++i)
+        {
+            auto value = map.lookup(user_id(i));
+            if (i % 2u == 0u)
+                REQUIRE(!value.has_value());
+            else
+                REQUIRE(value.value() == std::to_string(i));
+        }
+
+        auto count = 0u;
+        map.for_each([&](const user_id& id, const std::string& value) {
+            REQUIRE(value == std::to_string(static_cast<unsigned>(id)));
+            ++count;
+        });
+        REQUIRE(count == 500u);
+
+        auto copy = map;
+        REQUIRE(copy.size() == 500u);
+        REQUIRE(copy.lookup(user_id(999u)).value() == "999");
+
+        auto moved = std::move(copy);
+        REQUIRE(moved.lookup(user_id(999u)).value() == "999");
+        REQUIRE(copy.empty());
+
+        map.clear();
+        REQUIRE(map.empty());
+        REQUIRE(!map.contains(user_id(1u)));
+    }
+    SECTION("custom policy")
+    {
+        id_map<user_id, int, compact_integer_policy<unsigned, 0u>> zero_map;
+        REQUIRE(zero_map.emplace(user_id(~0u), 1));
+        REQUIRE(zero_map.lookup(user_id(~0u)).value() == 1);
+    }
+}
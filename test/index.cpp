@@ -6,6 +6,8 @@
 
 #include <catch.hpp>
 
+#include <vector>
+
 using namespace type_safe;
 
 TEST_CASE("index_t")
@@ -102,4 +104,33 @@ TEST_CASE("index_t")
         for (index_t i; i != 5u; ++i)
             REQUIRE(at(array, i) == std::size_t(get(i)));
     }
+    SECTION("index_range")
+    {
+        std::size_t       array[] = {0, 1, 2, 3, 4, 5};
+        std::vector<int>  vec(3u, 42);
+        const std::size_t n = 6u;
+
+        index_range range(array);
+        REQUIRE(range.size().get() == 6u);
+
+        index_t expected;
+        for (auto i : range)
+        {
+            REQUIRE(i.get() == expected);
+            REQUIRE(at(array, i) == std::size_t(get(i.get())));
+            ++expected;
+        }
+        REQUIRE(expected == n);
+
+        auto count = 0;
+        for (auto i : index_range(vec))
+        {
+            at(vec, i) = count;
+            ++count;
+        }
+        REQUIRE(count == 3);
+        REQUIRE(vec == (std::vector<int>{0, 1, 2}));
+
+        REQUIRE(index_range(std::vector<int>()).begin() == index_range(std::vector<int>()).end());
+    }
 }
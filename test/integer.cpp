@@ -296,3 +296,9 @@ TEST_CASE("integer")
         REQUIRE(static_cast<unsigned>(ia) == 123u);
     }
 }
+
+TEST_CASE("integer hash")
+{
+    using int_t = integer<int>;
+    REQUIRE(std::hash<int_t>{}(int_t(42)) == std::hash<int>{}(42));
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/interned.hpp>
+
+#include <catch.hpp>
+
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace type_safe;
+
+namespace
+{
+    struct symbol_tag
+    {
+    };
+    using symbol = interned<symbol_tag>;
+
+    struct other_tag
+    {
+    };
+    using other_symbol = interned<other_tag>;
+} // namespace
+
+TEST_CASE("interned")
+{
+    SECTION("empty")
+    {
+        symbol a;
+        REQUIRE(a.empty());
+        REQUIRE(a.size() == 0u);
+        REQUIRE(a.str().empty());
+        REQUIRE(*a.c_str() == '\0');
+        REQUIRE(a == symbol(""));
+        REQUIRE(a == symbol(std::string()));
+        REQUIRE(a.hash() == std::hash<std::string>{}(std::string()));
+    }
+    SECTION("intern")
+    {
+        symbol a("foo");
+        REQUIRE(!a.empty());
+        REQUIRE(a.size() == 3u);
+        REQUIRE(a.str() == "foo");
+        REQUIRE(std::string(a.c_str()) == "foo");
+        REQUIRE(a.view().size().get() == 3u);
+        REQUIRE(a.view().data() == a.data());
+        REQUIRE(a.hash() == std::hash<std::string>{}("foo"));
+
+        // the same string is stored only once
+        symbol b(std::string("foo"));
+        REQUIRE(a == b);
+        REQUIRE(a.data() == b.data());
+
+        const char buffer[] = {'f', 'o', 'o', 'b', 'a', 'r'};
+        symbol     c(buffer, 3u);
+        REQUIRE(a == c);
+        auto d = symbol(array_ref<const char>(buffer));
+        REQUIRE(a != d);
+        REQUIRE(d.str() == "foobar");
+
+        // different tags have different tables
+        other_symbol e("foo");
+        REQUIRE(e.str() == "foo");
+        REQUIRE(e.data() != a.data());
+    }
+    SECTION("hash")
+    {
+        std::unordered_set<symbol> set;
+        set.insert(symbol("a"));
+        set.insert(symbol("b"));
+        set.insert(symbol(std::string("a")));
+        REQUIRE(set.size() == 2u);
+        REQUIRE(set.count(symbol("b")) == 1u);
+        REQUIRE(std::hash<symbol>{}(symbol("a")) == symbol("a").hash());
+    }
+    SECTION("multiple threads")
+    {
+        std::vector<symbol>      symbols(8u);
+        std::vector<std::thread> threads;
+        for (auto i = 0u; i != symbols.size(); ++i)
+            threads.emplace_back([&symbols, i] {
+                for (auto j = 0; j != 100; ++j)
+                    symbol(std::to_string(j));
+                symbols[i] = symbol("shared");
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        for (auto& s : symbols)
+            REQUIRE(s == symbols.front());
+        REQUIRE(symbols.front().str() == "shared");
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/layout_info.hpp>
+
+#include <catch.hpp>
+
+#include <string>
+#include <utility>
+
+#include <type_safe/compact_optional.hpp>
+#include <type_safe/deferred_construction.hpp>
+#include <type_safe/flag_set.hpp>
+#include <type_safe/optional_ref.hpp>
+#include <type_safe/reference.hpp>
+#include <type_safe/tagged_object_ref.hpp>
+#include <type_safe/tagged_union.hpp>
+#include <type_safe/variant.hpp>
+
+using namespace type_safe;
+
+// the layouts of the wrapper types, a failure here means a wrapper got bigger or lost triviality
+namespace
+{
+    enum class test_flags
+    {
+        a,
+        b,
+        c,
+        _flag_set_size,
+    };
+
+    struct alignas(8) aligned_node
+    {
+        int value;
+    };
+
+    template <typename T, typename Underlying>
+    void check_no_overhead()
+    {
+        using info = layout_info<T, Underlying>;
+        INFO("size " << info::size() << ", underlying size " << info::underlying_size());
+        REQUIRE(info::overhead() == 0u);
+        REQUIRE(info::alignment() == alignof(Underlying));
+        REQUIRE(info::preserves_triviality());
+    }
+
+    // at most one additional object of the alignment is needed to store the state
+    template <typename T, typename Underlying>
+    void check_tag_overhead()
+    {
+        using info = layout_info<T, Underlying>;
+        INFO("size " << info::size() << ", underlying size " << info::underlying_size());
+        REQUIRE(info::overhead() <= info::alignment());
+        REQUIRE(info::preserves_triviality());
+    }
+} // namespace
+
+static_assert(layout_info<int>::overhead() == 0u, "layout_info must be constexpr");
+
+TEST_CASE("layout_info")
+{
+    using info = layout_info<long long, char>;
+    REQUIRE(info::size() == sizeof(long long));
+    REQUIRE(info::alignment() == alignof(long long));
+    REQUIRE(info::underlying_size() == 1u);
+    REQUIRE(info::overhead() == sizeof(long long) - 1u);
+    REQUIRE(info::is_trivially_copyable());
+    REQUIRE(info::is_trivially_destructible());
+    REQUIRE(info::is_trivially_relocatable());
+    REQUIRE(info::preserves_triviality());
+
+    REQUIRE(layout_info<char, long long>::overhead() == 0u);
+    REQUIRE(!layout_info<std::string>::is_trivially_copyable());
+    REQUIRE(layout_info<std::string>::preserves_triviality());
+    REQUIRE(!layout_info<std::string, int>::preserves_triviality());
+}
+
+TEST_CASE("layout_info optional")
+{
+    check_tag_overhead<optional<char>, char>();
+    check_tag_overhead<optional<int>, int>();
+    check_tag_overhead<optional<double>, double>();
+    check_tag_overhead<optional<std::string>, std::string>();
+    check_no_overhead<optional_ref<int>, int*>();
+
+    check_no_overhead<compact_optional<compact_bool_policy<bool>>, bool>();
+    check_no_overhead<compact_optional<compact_integer_policy<int, -1>>, int>();
+    check_no_overhead<compact_optional<compact_floating_point_policy<double>>, double>();
+    check_no_overhead<compact_optional<compact_nan_payload_policy<double>>, double>();
+    check_no_overhead<compact_optional<compact_pointer_policy<int>>, int*>();
+    check_no_overhead<compact_optional<compact_enum_policy<test_flags, -1>>, test_flags>();
+    check_no_overhead<compact_optional<compact_tagged_object_ref_policy<aligned_node, test_flags>>,
+                      aligned_node*>();
+}
+
+TEST_CASE("layout_info variant")
+{
+    check_tag_overhead<tagged_union<char>, char>();
+    check_tag_overhead<tagged_union<int, double>, double>();
+    check_tag_overhead<tagged_union<char, short>, short>();
+
+    // the variant must not add anything to the tagged union
+    check_no_overhead<variant<char>, tagged_union<nullvar_t, char>>();
+    check_no_overhead<variant<int, double>, tagged_union<nullvar_t, int, double>>();
+    check_no_overhead<variant<char, short>, tagged_union<nullvar_t, char, short>>();
+    check_no_overhead<fallback_variant<int, double>, tagged_union<int, double>>();
+    check_tag_overhead<variant<int, std::string>, std::string>();
+}
+
+TEST_CASE("layout_info references")
+{
+    check_no_overhead<object_ref<int>, int*>();
+    check_no_overhead<object_ref<const int>, const int*>();
+    check_no_overhead<tagged_object_ref<aligned_node, test_flags>, aligned_node*>();
+    check_no_overhead<array_ref<int>, std::pair<int*, std::size_t>>();
+    check_no_overhead<function_ref<void(int)>, std::pair<void*, void (*)()>>();
+}
+
+TEST_CASE("layout_info other")
+{
+    check_no_overhead<flag_set<test_flags>, unsigned char>();
+
+    // it has a user-defined copy constructor and destructor, as it has to check the state
+    using deferred_info = layout_info<deferred_construction<int>, int>;
+    REQUIRE(deferred_info::overhead() <= deferred_info::alignment());
+    REQUIRE(!deferred_info::is_trivially_copyable());
+    REQUIRE(!deferred_info::is_trivially_destructible());
+}
@@ -0,0 +1,94 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/lazy.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace type_safe;
+
+namespace
+{
+    int forty_two()
+    {
+        return 42;
+    }
+} // namespace
+
+TEST_CASE("lazy")
+{
+    SECTION("function pointer")
+    {
+        lazy<int> a(&forty_two);
+        REQUIRE(!a.has_value());
+        REQUIRE(a.value() == 42);
+        REQUIRE(a.has_value());
+
+        *a = 43;
+        REQUIRE(*a == 43);
+
+        const lazy<int> b([] { return 1; });
+        REQUIRE(*b == 1);
+        REQUIRE(b.has_value());
+    }
+    SECTION("function object")
+    {
+        auto calls = 0;
+        auto init  = [&] {
+            ++calls;
+            return std::string("hello");
+        };
+
+        lazy<std::string, decltype(init)> str(init);
+        REQUIRE(calls == 0);
+        REQUIRE(str->size() == 5u);
+        REQUIRE(*str == "hello");
+        REQUIRE(calls == 1);
+    }
+#if TYPE_SAFE_USE_EXCEPTIONS
+    SECTION("throwing init")
+    {
+        auto calls = 0;
+        auto init  = [&] {
+            if (++calls == 1)
+                throw 0;
+            return 42;
+        };
+
+        lazy<int, decltype(init)> a(init);
+        REQUIRE_THROWS(a.value());
+        REQUIRE(!a.has_value());
+        REQUIRE(a.value() == 42);
+        REQUIRE(calls == 2);
+    }
+#endif
+    SECTION("multiple threads")
+    {
+        std::atomic<int> calls(0);
+        auto             init = [&] {
+            ++calls;
+            // make sure the other threads have to block
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            return std::vector<int>(100u, 42);
+        };
+
+        lazy<std::vector<int>, decltype(init)> table(init);
+
+        std::atomic<int>         sum(0);
+        std::vector<std::thread> threads;
+        for (auto i = 0; i != 8; ++i)
+            threads.emplace_back([&, i] { sum += table->at(std::size_t(i) * 10u); });
+        for (auto& thread : threads)
+            thread.join();
+
+        REQUIRE(calls == 1);
+        REQUIRE(sum == 8 * 42);
+    }
+}
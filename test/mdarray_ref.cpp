@@ -0,0 +1,103 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/mdarray_ref.hpp>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace type_safe;
+
+TEST_CASE("strided_array_ref")
+{
+    int array[] = {0, 1, 2, 3, 4, 5, 6};
+
+    strided_array_ref<int> even(array, 4u, 2u);
+    REQUIRE(even.size().get() == 4u);
+    REQUIRE(even.stride().get() == 2u);
+    REQUIRE(even.data() == array);
+    REQUIRE(even[0u] == 0);
+    REQUIRE(even[3u] == 6);
+    REQUIRE(at(even, 2u) == 4);
+
+    std::vector<int> values(even.begin(), even.end());
+    REQUIRE(values == (std::vector<int>{0, 2, 4, 6}));
+    REQUIRE(even.end() - even.begin() == 4);
+    REQUIRE(*std::find(even.begin(), even.end(), 4) == 4);
+
+    for (auto& i : even)
+        i = -i;
+    REQUIRE(array[2] == -2);
+    REQUIRE(array[3] == 3);
+
+    auto sub = even.subview(1u, 2u);
+    REQUIRE(sub.size().get() == 2u);
+    REQUIRE(sub[0u] == -2);
+    REQUIRE(sub[1u] == -4);
+
+    strided_array_ref<const int> all = array_ref<int>(array);
+    REQUIRE(all.size().get() == 7u);
+    REQUIRE(all.stride().get() == 1u);
+    REQUIRE(all[5u] == 5);
+
+    auto sum = 0;
+    for (auto i : index_range(even))
+        sum += at(even, i);
+    REQUIRE(sum == -12);
+
+    sum = 0;
+    array_ref<int> contiguous(array);
+    for (auto i : index_range(contiguous))
+        sum += contiguous[i];
+    REQUIRE(sum == -3);
+
+    strided_array_ref<int> empty(nullptr);
+    REQUIRE(empty.size().get() == 0u);
+    REQUIRE(empty.begin() == empty.end());
+}
+
+TEST_CASE("mdarray_ref")
+{
+    // 2 x 3 matrix
+    int array[] = {0, 1, 2, 3, 4, 5};
+
+    mdarray_ref<int, 2> matrix(array, 2u, 3u);
+    REQUIRE(matrix.rank() == 2u);
+    REQUIRE(matrix.extent(0u).get() == 2u);
+    REQUIRE(matrix.extent(1u).get() == 3u);
+    REQUIRE(matrix.stride(0u).get() == 3u);
+    REQUIRE(matrix.stride(1u).get() == 1u);
+    REQUIRE(matrix.size().get() == 6u);
+    REQUIRE(matrix(0u, 0u) == 0);
+    REQUIRE(matrix(1u, 2u) == 5);
+    REQUIRE(matrix(index_t(1u), index_t(0u)) == 3);
+
+    auto row = matrix.row(1u);
+    REQUIRE(row.size().get() == 3u);
+    REQUIRE(row.stride().get() == 1u);
+    REQUIRE(std::vector<int>(row.begin(), row.end()) == (std::vector<int>{3, 4, 5}));
+
+    auto column = matrix.column(1u);
+    REQUIRE(column.size().get() == 2u);
+    REQUIRE(column.stride().get() == 3u);
+    REQUIRE(std::vector<int>(column.begin(), column.end()) == (std::vector<int>{1, 4}));
+
+    column[1u] = 42;
+    REQUIRE(matrix(1u, 1u) == 42);
+
+    // 2 x 2 x 3 array
+    int cube[12] = {};
+    mdarray_ref<int, 3> md(cube, {{2u, 2u, 3u}});
+    md(1u, 0u, 2u) = 1;
+    REQUIRE(cube[8] == 1);
+
+    auto slice = md.slice(2u, 2u);
+    REQUIRE(slice.rank() == 2u);
+    REQUIRE(slice.extent(0u).get() == 2u);
+    REQUIRE(slice.extent(1u).get() == 2u);
+    REQUIRE(slice(1u, 0u) == 1);
+    REQUIRE(slice.column(0u)[1u] == 1);
+}
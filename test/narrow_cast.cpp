@@ -6,6 +6,8 @@
 
 #include <catch.hpp>
 
+#include <cstdint>
+
 using namespace type_safe;
 
 TEST_CASE("narrow_cast<integer>")
@@ -29,3 +31,38 @@ TEST_CASE("narrow_cast<floating_point>")
     floating_point<float> c = narrow_cast<floating_point<float>>(a);
     REQUIRE(static_cast<float>(c) == 1.);
 }
+
+TEST_CASE("narrow_cast_all")
+{
+    SECTION("integer")
+    {
+        std::int64_t source[] = {0, -1, 2147483647, -2147483647 - 1, 42};
+        std::int32_t destination[5];
+        REQUIRE(narrow_cast_all(array_ref<const std::int64_t>(source),
+                                array_ref<std::int32_t>(destination))
+                    .get()
+                == 5u);
+        for (auto i = 0; i != 5; ++i)
+            REQUIRE(destination[i] == source[i]);
+
+        std::uint64_t unsigned_source[] = {0u, 5u, 32767u};
+        std::int16_t  signed_destination[3];
+        narrow_cast_all(array_ref<const std::uint64_t>(unsigned_source),
+                        array_ref<std::int16_t>(signed_destination));
+        REQUIRE(signed_destination[1] == 5);
+        REQUIRE(narrow_cast<std::int32_t>(std::uint64_t(5u)) == 5);
+
+        REQUIRE(narrow_cast_all(array_ref<const std::int64_t>(nullptr),
+                                array_ref<std::int32_t>(nullptr))
+                    .get()
+                == 0u);
+    }
+    SECTION("floating point")
+    {
+        double source[] = {0., 1.5, -0.25, 1e10, 3.};
+        float  destination[5];
+        narrow_cast_all(array_ref<const double>(source), array_ref<float>(destination));
+        for (auto i = 0; i != 5; ++i)
+            REQUIRE(destination[i] == source[i]);
+    }
+}
@@ -7,10 +7,19 @@
 
 #include <catch.hpp>
 
+#include <string>
+
 #include "debugger_type.hpp"
 
 using namespace type_safe;
 
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+static_assert(std::is_trivially_copyable<optional<int>>::value, "");
+static_assert(std::is_trivially_destructible<optional<int>>::value, "");
+static_assert(!std::is_trivially_copyable<optional<debugger_type>>::value, "");
+static_assert(!std::is_trivially_destructible<optional<debugger_type>>::value, "");
+#endif
+
 TEST_CASE("optional")
 {
     SECTION("constructor - empty")
@@ -327,6 +336,69 @@ TEST_CASE("optional")
         REQUIRE(c_res2.has_value());
         REQUIRE(c_res2.value() == 42);
     }
+    SECTION("then")
+    {
+        auto to_char   = [](int i) { return "abc"[i]; };
+        auto to_int    = [](char c) { return int(c - 'a'); };
+        auto add_three = [](int i) { return i + 3; };
+
+        optional<int> a;
+        REQUIRE(!a.then(to_char).has_value());
+        REQUIRE(a.then(to_char).then(to_int).value_or(-1) == -1);
+        optional<char> a_res = a.then(to_char).result();
+        REQUIRE_FALSE(a_res.has_value());
+
+        optional<int> b(1);
+        REQUIRE(b.then(to_char).value() == 'b');
+        REQUIRE(b.then(to_char).then(to_int).then(add_three).value_or(-1) == 4);
+        optional<int> b_res = b.then(to_char).then(to_int).result();
+        REQUIRE(b_res.has_value());
+        REQUIRE(b_res.value() == 1);
+
+        // an lvalue chain can be continued multiple times
+        std::string str   = "abc";
+        auto        chain = b.then([str](int) { return str; });
+        auto        size  = [](const std::string& s) { return s.size(); };
+        REQUIRE(chain.then(size).value() == 3u);
+        REQUIRE(chain.then(size).value() == 3u);
+
+        // the value of an rvalue optional is moved into the first function
+        auto id = optional<debugger_type>(debugger_type(2))
+                      .then([](debugger_type&& dbg) {
+                          debugger_type result(std::move(dbg));
+                          REQUIRE(result.move_ctor());
+                          return result.id;
+                      })
+                      .value_or(0);
+        REQUIRE(id == 2);
+    }
+    SECTION("and_then")
+    {
+        auto func = [](int i) { return i > 0 ? optional<int>(i - 1) : nullopt; };
+
+        optional<int> a;
+        REQUIRE_FALSE(a.and_then(func).has_value());
+
+        optional<int> b(1);
+        REQUIRE(b.and_then(func).value() == 0);
+        REQUIRE_FALSE(b.and_then(func).and_then(func).has_value());
+
+        auto moved = optional<debugger_type>(debugger_type(3)).and_then([](debugger_type&& dbg) {
+            return optional<debugger_type>(std::move(dbg));
+        });
+        REQUIRE(moved.value().id == 3);
+    }
+    SECTION("or_else")
+    {
+        auto func = [] { return optional<int>(42); };
+
+        optional<int> a;
+        REQUIRE(a.or_else(func).value() == 42);
+
+        optional<int> b(1);
+        REQUIRE(b.or_else(func).value() == 1);
+        REQUIRE(optional<int>().or_else([] { return 0; }).value() == 0);
+    }
     SECTION("with")
     {
         optional<int> a;
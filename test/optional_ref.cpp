@@ -10,6 +10,10 @@
 
 using namespace type_safe;
 
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+static_assert(std::is_trivially_copyable<optional_ref<int>>::value, "");
+#endif
+
 template <typename A, typename B, typename Value>
 void test_optional_ref_conversion(Value)
 {
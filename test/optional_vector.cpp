@@ -0,0 +1,113 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/optional_vector.hpp>
+
+#include <catch.hpp>
+
+#include <string>
+
+using namespace type_safe;
+
+TEST_CASE("optional_vector")
+{
+    optional_vector<int> vec;
+    REQUIRE(vec.empty());
+    REQUIRE(vec.size().get() == 0u);
+
+    for (auto i = 0; i != 200; ++i)
+    {
+        if (i % 3 == 0)
+            vec.push_back(nullopt);
+        else
+            vec.emplace_back(i);
+    }
+    REQUIRE(vec.size().get() == 200u);
+    REQUIRE(vec.count().get() == 133u);
+
+    SECTION("access")
+    {
+        REQUIRE(!vec.has_value(0u));
+        REQUIRE(!vec[0u].has_value());
+        REQUIRE(vec.has_value(130u));
+        REQUIRE(vec[130u].value() == 130);
+
+        vec[130u].value() = 0;
+        REQUIRE(vec.data()[130] == 0);
+
+        const optional_vector<int>& cvec = vec;
+        REQUIRE(cvec[131u].value() == 131);
+        REQUIRE(!cvec[132u].has_value());
+    }
+    SECTION("modifiers")
+    {
+        REQUIRE(vec.emplace(0u, 42) == 42);
+        REQUIRE(vec[0u].value() == 42);
+        REQUIRE(vec.count().get() == 134u);
+
+        vec.reset(1u);
+        REQUIRE(!vec.has_value(1u));
+        REQUIRE(vec.count().get() == 133u);
+
+        vec.push_back(optional<int>(7));
+        vec.push_back(optional<int>());
+        REQUIRE(vec.size().get() == 202u);
+        REQUIRE(vec[200u].value() == 7);
+        REQUIRE(!vec.has_value(201u));
+
+        vec.pop_back();
+        vec.pop_back();
+        REQUIRE(vec.size().get() == 200u);
+
+        vec.resize(64u);
+        REQUIRE(vec.count().get() == 42u);
+        vec.resize(100u);
+        REQUIRE(vec.count().get() == 42u);
+        REQUIRE(!vec.has_value(99u));
+
+        vec.clear();
+        REQUIRE(vec.empty());
+        REQUIRE(vec.count().get() == 0u);
+    }
+    SECTION("bulk")
+    {
+        auto values = vec.value_or(-1);
+        REQUIRE(values.size() == 200u);
+        for (auto i = 0u; i != values.size(); ++i)
+            REQUIRE(values[i] == (i % 3 == 0 ? -1 : int(i)));
+
+        auto strings = vec.map([](int i) { return std::to_string(i); });
+        REQUIRE(strings.size().get() == 200u);
+        REQUIRE(strings.count().get() == 133u);
+        REQUIRE(!strings.has_value(0u));
+        REQUIRE(strings[199u].value() == "199");
+    }
+}
+
+TEST_CASE("optional_array")
+{
+    optional_array<int, 70> arr;
+    REQUIRE(arr.size().get() == 70u);
+    REQUIRE(arr.count().get() == 0u);
+    REQUIRE(!arr[0u].has_value());
+
+    arr.emplace(0u, 1);
+    arr.emplace(69u, 2);
+    REQUIRE(arr.count().get() == 2u);
+    REQUIRE(arr[69u].value() == 2);
+
+    auto values = arr.value_or(0);
+    REQUIRE(values[0] == 1);
+    REQUIRE(values[1] == 0);
+    REQUIRE(values[69] == 2);
+
+    auto doubled = arr.map([](int i) { return 2.5 * i; });
+    REQUIRE(doubled.count().get() == 2u);
+    REQUIRE(doubled[0u].value() == 2.5);
+    REQUIRE(!doubled.has_value(1u));
+
+    arr.reset(0u);
+    REQUIRE(!arr.has_value(0u));
+    REQUIRE(arr.count().get() == 1u);
+}
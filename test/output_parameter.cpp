@@ -6,6 +6,7 @@
 
 #include <catch.hpp>
 #include <string>
+#include <vector>
 
 using namespace type_safe;
 
@@ -79,3 +80,84 @@ TEST_CASE("output_parameter")
         }
     }
 }
+
+TEST_CASE("output_range")
+{
+    SECTION("array")
+    {
+        std::string slots[3];
+
+        array_ref<std::string>    ref(slots);
+        output_range<std::string> out(ref);
+        REQUIRE(out.size().get() == 3u);
+        REQUIRE(out.written().get() == 0u);
+
+        std::string& res = out.assign("abc");
+        REQUIRE(&res == &slots[0]);
+        REQUIRE(out.assign(3u, 'c') == "ccc");
+        REQUIRE(!out.full());
+        out.assign();
+        REQUIRE(out.full());
+        REQUIRE(out.written().get() == 3u);
+
+        REQUIRE(slots[0] == "abc");
+        REQUIRE(slots[1] == "ccc");
+        REQUIRE(slots[2] == "");
+    }
+    SECTION("container")
+    {
+        std::vector<std::string> vec;
+        vec.emplace_back("a");
+
+        auto out = out_range(vec, 2u);
+        REQUIRE(vec.capacity() >= 3u);
+        auto data = vec.data();
+
+        std::string& res = out.assign("b");
+        REQUIRE(&res == &vec.back());
+        out.assign(2u, 'c');
+        REQUIRE(out.full());
+        REQUIRE(vec.data() == data);
+        REQUIRE((vec == std::vector<std::string>{"a", "b", "cc"}));
+    }
+    SECTION("function")
+    {
+        auto iota = [](output_range<int> out) {
+            for (auto i = 0; !out.full(); ++i)
+                out.assign(i);
+        };
+
+        int array[4];
+        iota(out_range(array_ref<int>(array)));
+        REQUIRE(array[0] == 0);
+        REQUIRE(array[3] == 3);
+
+        std::vector<int> vec;
+        iota(out_range(vec, 3u));
+        REQUIRE((vec == std::vector<int>{0, 1, 2}));
+    }
+    SECTION("move")
+    {
+        int array[2];
+
+        array_ref<int>    ref(array);
+        output_range<int> a(ref);
+        a.assign(0);
+        output_range<int> b(std::move(a));
+        REQUIRE(b.written().get() == 1u);
+        b.assign(1);
+        REQUIRE(b.full());
+    }
+#if TYPE_SAFE_USE_EXCEPTIONS
+    SECTION("exception")
+    {
+        int  array[2];
+        auto fail = [&] {
+            output_range<int> out((array_ref<int>(array)));
+            out.assign(0);
+            throw 42;
+        };
+        REQUIRE_THROWS_AS(fail(), int);
+    }
+#endif
+}
@@ -0,0 +1,77 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/parallel_reduce.hpp>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace type_safe;
+
+namespace
+{
+    template <typename T, class Policy>
+    array_ref<const integer<T, Policy>> make_ref(const std::vector<integer<T, Policy>>& vec)
+    {
+        return array_ref<const integer<T, Policy>>(vec.data(), vec.size());
+    }
+} // namespace
+
+TEST_CASE("checked_reduce")
+{
+    using int_t = integer<std::int32_t, checked_arithmetic>;
+
+    // multiple chunks
+    std::vector<int_t> a;
+    for (auto i = 0; i != 100000; ++i)
+        a.push_back(i % 2 == 0 ? i : -i);
+
+    for (auto threads : {1u, 3u, 0u})
+    {
+        REQUIRE(checked_reduce(make_ref(a), int_t(0), threads).get() == -50000);
+        REQUIRE(checked_reduce(make_ref(a), int_t(50000), threads).get() == 0);
+    }
+    REQUIRE(checked_reduce(array_ref<int_t>(nullptr)).get() == 0);
+
+    // overflow of a partial sum in a later chunk
+    a[70000] = std::numeric_limits<std::int32_t>::max();
+    a[70001] = 1;
+    REQUIRE_THROWS_AS(checked_reduce(make_ref(a), int_t(0), 4u), checked_arithmetic::error);
+
+    // overflow when merging the chunks
+    std::vector<int_t> b(50000u, 50000);
+    REQUIRE_THROWS_AS(checked_reduce(make_ref(b), int_t(0), 2u), checked_arithmetic::error);
+
+    using uint_t = integer<std::uint64_t, checked_arithmetic>;
+    std::vector<uint_t> c(40000u, std::uint64_t(1));
+    REQUIRE(checked_reduce(make_ref(c), uint_t(std::uint64_t(0)), 2u).get() == 40000u);
+    c[39999] = std::numeric_limits<std::uint64_t>::max();
+    REQUIRE_THROWS_AS(checked_reduce(make_ref(c), uint_t(std::uint64_t(0)), 2u),
+                      checked_arithmetic::error);
+
+    using default_t = integer<std::uint32_t, default_arithmetic>;
+    std::vector<default_t> d(40000u, std::uint32_t(1));
+    REQUIRE(checked_reduce(make_ref(d), default_t(0u), 2u).get() == 40000u);
+}
+
+TEST_CASE("checked_transform_reduce")
+{
+    using int_t = integer<std::int64_t, checked_arithmetic>;
+
+    std::vector<std::int32_t> values(100000u, 3);
+    auto ref   = array_ref<const std::int32_t>(values.data(), values.size());
+    auto twice = [](std::int32_t i) { return int_t(i) * int_t(2); };
+    REQUIRE(checked_transform_reduce(ref, int_t(4), twice, 4u).get() == 600004);
+
+    // the exception of the transformation is rethrown
+    values[60000] = -1;
+    auto invalid  = [](std::int32_t i) {
+        return i < 0 ? int_t(std::numeric_limits<std::int64_t>::max()) * int_t(2) : int_t(i);
+    };
+    REQUIRE_THROWS_AS(checked_transform_reduce(ref, int_t(0), invalid, 4u),
+                      checked_arithmetic::error);
+}
@@ -0,0 +1,103 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/parse.hpp>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#include <type_safe/bounded_type.hpp>
+
+using namespace type_safe;
+
+namespace
+{
+    template <typename T>
+    optional<T> parse_str(const char* str)
+    {
+        return parse<T>(str, str + std::strlen(str));
+    }
+
+    struct id : strong_typedef<id, unsigned>, strong_typedef_op::equality_comparison<id>
+    {
+        using strong_typedef::strong_typedef;
+    };
+} // namespace
+
+TEST_CASE("parse")
+{
+    SECTION("integer")
+    {
+        REQUIRE(parse_str<int>("0").value() == 0);
+        REQUIRE(parse_str<int>("42").value() == 42);
+        REQUIRE(parse_str<int>("-42").value() == -42);
+        REQUIRE(parse_str<int>("-0").value() == 0);
+        REQUIRE(parse_str<unsigned>("007").value() == 7u);
+
+        REQUIRE(parse_str<std::int8_t>("127").value() == 127);
+        REQUIRE(parse_str<std::int8_t>("-128").value() == -128);
+        REQUIRE(!parse_str<std::int8_t>("128"));
+        REQUIRE(!parse_str<std::int8_t>("-129"));
+        REQUIRE(parse_str<std::uint8_t>("255").value() == 255u);
+        REQUIRE(!parse_str<std::uint8_t>("256"));
+        REQUIRE(parse_str<std::int64_t>("-9223372036854775808").value()
+                == std::numeric_limits<std::int64_t>::min());
+        REQUIRE(parse_str<std::uint64_t>("18446744073709551615").value()
+                == std::numeric_limits<std::uint64_t>::max());
+        REQUIRE(!parse_str<std::uint64_t>("18446744073709551616"));
+
+        REQUIRE(!parse_str<int>(""));
+        REQUIRE(!parse_str<int>("-"));
+        REQUIRE(!parse_str<int>("+1"));
+        REQUIRE(!parse_str<int>(" 1"));
+        REQUIRE(!parse_str<int>("1 "));
+        REQUIRE(!parse_str<int>("1a"));
+        REQUIRE(!parse_str<unsigned>("-1"));
+
+        // only the given range is parsed
+        const char str[] = "1234";
+        REQUIRE(parse<int>(str, str + 2).value() == 12);
+    }
+    SECTION("ts::integer")
+    {
+        auto result = parse_str<integer<int>>("-42");
+        REQUIRE(result);
+        REQUIRE(result.value().get() == -42);
+        REQUIRE(!parse_str<integer<unsigned>>("-42"));
+    }
+    SECTION("strong_typedef")
+    {
+        REQUIRE(parse_str<id>("42").value() == id(42u));
+        REQUIRE(!parse_str<id>("x"));
+    }
+    SECTION("constrained_type")
+    {
+        using percent = bounded_type<int, true, true, std::integral_constant<int, 0>,
+                                     std::integral_constant<int, 100>>;
+        REQUIRE(parse_str<percent>("0").value().get_value() == 0);
+        REQUIRE(parse_str<percent>("100").value().get_value() == 100);
+        REQUIRE(!parse_str<percent>("101"));
+        REQUIRE(!parse_str<percent>("-1"));
+        REQUIRE(!parse_str<percent>("abc"));
+
+        using dynamic_bounded = bounded_type<int, true, false>;
+        const char str[]      = "10";
+        REQUIRE(parse<dynamic_bounded>(str, str + 2, constraints::bounded<int, true, false>(0, 20))
+                    .value()
+                    .get_value()
+                == 10);
+        REQUIRE(
+            !parse<dynamic_bounded>(str, str + 2, constraints::bounded<int, true, false>(0, 10)));
+    }
+#if TYPE_SAFE_USE_FROM_CHARS && defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    SECTION("floating point")
+    {
+        REQUIRE(parse_str<double>("0.5").value() == 0.5);
+        REQUIRE(parse_str<floating_point<double>>("-1.5e2").value().get() == -150.0);
+        REQUIRE(!parse_str<double>("0.5x"));
+    }
+#endif
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/precondition_sampling.hpp>
+
+#include <catch.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace type_safe;
+
+namespace
+{
+    // a new thread, so it starts with a fresh countdown
+    std::vector<bool> sample(unsigned n)
+    {
+        std::vector<bool> result;
+        std::thread       thread([&] {
+            for (auto i = 0u; i != n; ++i)
+                result.push_back(detail::precondition_sampled());
+        });
+        thread.join();
+        return result;
+    }
+} // namespace
+
+TEST_CASE("precondition_sampling")
+{
+    REQUIRE(precondition_sample_rate() == TYPE_SAFE_PRECONDITION_SAMPLE_RATE);
+
+    set_precondition_sample_rate(3u);
+    REQUIRE(precondition_sample_rate() == 3u);
+    REQUIRE((sample(7u) == std::vector<bool>{true, false, false, true, false, false, true}));
+
+    set_precondition_sample_rate(1u);
+    REQUIRE((sample(3u) == std::vector<bool>{true, true, true}));
+
+    set_precondition_sample_rate(0u);
+    REQUIRE((sample(3u) == std::vector<bool>{false, false, false}));
+
+    set_precondition_sample_rate(TYPE_SAFE_PRECONDITION_SAMPLE_RATE);
+}
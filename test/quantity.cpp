@@ -0,0 +1,113 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/quantity.hpp>
+
+#include <catch.hpp>
+
+using namespace type_safe;
+
+namespace
+{
+    using meters      = quantity<dimensions::length>;
+    using kilometers  = quantity<dimensions::length, double, std::kilo>;
+    using millimeters = quantity<dimensions::length, int, std::milli>;
+    using seconds     = quantity<dimensions::time>;
+    using hertz       = quantity<dimensions::frequency>;
+    using velocity    = quantity<dimensions::velocity>;
+    using area        = quantity<dimensions::area>;
+}
+
+TEST_CASE("quantity")
+{
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+    static_assert(sizeof(meters) == sizeof(double), "");
+    static_assert(std::is_trivially_copyable<meters>::value, "");
+    static_assert(std::is_same<dimension_multiply<dimensions::mass, dimensions::acceleration>,
+                               dimension<1, 1, -2, 0, 0, 0, 0>>::value,
+                  "");
+    static_assert(std::is_convertible<kilometers, meters>::value, "");
+    static_assert(std::is_convertible<meters, millimeters>::value == false, "");
+    static_assert(std::is_convertible<meters, seconds>::value == false, "");
+    static_assert(std::is_constructible<meters, seconds>::value == false, "");
+    static_assert(std::is_convertible<double, meters>::value == false, "");
+    // narrowing the representation requires a cast
+    static_assert(std::is_convertible<quantity<dimensions::length, std::int8_t>,
+                                      quantity<dimensions::length, std::int64_t>>::value,
+                  "");
+    static_assert(std::is_convertible<quantity<dimensions::length, std::int64_t>,
+                                      quantity<dimensions::length, std::int8_t>>::value
+                      == false,
+                  "");
+    static_assert(std::is_convertible<quantity<dimensions::length, float>, meters>::value, "");
+    static_assert(std::is_convertible<meters, quantity<dimensions::length, float>>::value == false,
+                  "");
+    static_assert(std::is_convertible<millimeters, quantity<dimensions::length, float>>::value,
+                  "");
+
+    constexpr auto c = meters(2.) * meters(3.);
+    static_assert(get(c) == 6., "");
+#endif
+
+    SECTION("arithmetic")
+    {
+        meters a(1.5);
+        REQUIRE(get(a) == 1.5);
+        REQUIRE(get(meters()) == 0.);
+
+        REQUIRE(a + meters(1.) == meters(2.5));
+        REQUIRE(a - meters(1.) == meters(0.5));
+        REQUIRE(-a == meters(-1.5));
+        REQUIRE(a < meters(2.));
+
+        REQUIRE(a * 2. == meters(3.));
+        REQUIRE(2. * a == meters(3.));
+        REQUIRE(a / 3. == meters(0.5));
+
+        a *= 4.;
+        REQUIRE(a == meters(6.));
+        a /= 2.;
+        REQUIRE(a == meters(3.));
+        a += meters(1.);
+        REQUIRE(a == meters(4.));
+    }
+    SECTION("dimensions")
+    {
+        velocity v = meters(10.) / seconds(2.);
+        REQUIRE(get(v) == 5.);
+
+        meters d = v * seconds(3.);
+        REQUIRE(get(d) == 15.);
+
+        area a = d * d;
+        REQUIRE(get(a) == 225.);
+
+        hertz f = 1. / seconds(4.);
+        REQUIRE(get(f) == 0.25);
+
+        quantity<dimensions::dimensionless> ratio = d / meters(5.);
+        REQUIRE(get(ratio) == 3.);
+    }
+    SECTION("conversion")
+    {
+        meters m = kilometers(1.5);
+        REQUIRE(get(m) == 1500.);
+
+        millimeters mm = quantity<dimensions::length, int>(2);
+        REQUIRE(get(mm) == 2000);
+
+        REQUIRE(get(quantity_cast<kilometers>(m)) == 1.5);
+        REQUIRE(get(quantity_cast<millimeters>(meters(0.25))) == 250);
+        REQUIRE(get(quantity_cast<quantity<dimensions::length, int>>(millimeters(2500))) == 2);
+        REQUIRE(get(quantity_cast<quantity<dimensions::length, float>>(meters(0.5))) == 0.5f);
+        REQUIRE(get(quantity_cast<quantity<dimensions::length, std::int8_t>>(
+                    quantity<dimensions::length, std::int64_t>(42)))
+                == 42);
+
+        auto km2 = kilometers(2.) * kilometers(3.);
+        REQUIRE((std::is_same<decltype(km2)::scale, std::mega>::value));
+        area a   = km2;
+        REQUIRE(get(a) == 6e6);
+    }
+}
@@ -0,0 +1,143 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/ranged_integer.hpp>
+
+#include <catch.hpp>
+
+#include <climits>
+#include <cstdint>
+
+using namespace type_safe;
+
+using percent = ranged_integer<0, 100>;
+
+static_assert(std::is_same<percent::integer_type, std::uint_least8_t>::value, "");
+static_assert(std::is_same<ranged_integer<-1, 0>::integer_type, std::int_least8_t>::value, "");
+static_assert(std::is_same<ranged_integer<0, 65536>::integer_type, std::uint_least32_t>::value,
+              "");
+static_assert(std::is_same<ranged_integer<-200, 100>::integer_type, std::int_least16_t>::value,
+              "");
+static_assert(sizeof(percent) == sizeof(std::uint_least8_t), "");
+
+// the bounds of the whole long long range, only negation is impossible
+using full_range = ranged_integer<LLONG_MIN, LLONG_MAX>;
+static_assert(std::is_same<full_range::integer_type, std::int_least64_t>::value, "");
+static_assert(std::is_convertible<long long, full_range>::value, "");
+
+static_assert(std::is_convertible<std::uint8_t, ranged_integer<0, 255>>::value, "");
+static_assert(!std::is_convertible<int, percent>::value, "");
+static_assert(std::is_constructible<percent, int>::value, "");
+static_assert(std::is_convertible<percent, ranged_integer<-1, 100>>::value, "");
+static_assert(!std::is_convertible<ranged_integer<-1, 100>, percent>::value, "");
+
+TEST_CASE("ranged_integer")
+{
+    SECTION("constructor")
+    {
+        constexpr percent a(std::integral_constant<int, 42>{});
+        static_assert(a.get() == 42, "");
+
+        percent b(std::uint8_t(100));
+        REQUIRE(b.get() == 100);
+
+        ranged_integer<0, 255> c = std::uint8_t(255);
+        REQUIRE(c.get() == 255);
+
+        ranged_integer<-1, 100> d = b;
+        REQUIRE(d.get() == 100);
+
+        percent e(integer<int>(7));
+        REQUIRE(e.get() == 7);
+
+        full_range f(5ll);
+        REQUIRE(f.get() == 5);
+        REQUIRE(f == percent(5));
+    }
+    SECTION("arithmetic")
+    {
+        percent a(50);
+        percent b(70);
+
+        auto sum = a + b;
+        static_assert(std::is_same<decltype(sum), ranged_integer<0, 200>>::value, "");
+        REQUIRE(sum.get() == 120);
+
+        auto difference = a - b;
+        static_assert(std::is_same<decltype(difference), ranged_integer<-100, 100>>::value, "");
+        REQUIRE(difference.get() == -20);
+
+        auto product = difference * a;
+        static_assert(std::is_same<decltype(product), ranged_integer<-10000, 10000>>::value, "");
+        REQUIRE(product.get() == -1000);
+
+        auto negative = -a;
+        static_assert(std::is_same<decltype(negative), ranged_integer<-100, 0>>::value, "");
+        REQUIRE(negative.get() == -50);
+
+        constexpr auto big = ranged_integer<0, 4294967295>(std::uint32_t(4294967295u))
+                             * ranged_integer<-2, 0>(std::integral_constant<int, -2>{});
+        static_assert(std::is_same<decltype(big), const ranged_integer<-8589934590, 0>>::value,
+                      "");
+        static_assert(big.get() == -8589934590, "");
+    }
+    SECTION("comparison")
+    {
+        percent                   a(50);
+        ranged_integer<-100, 100> b(50);
+        ranged_integer<101, 200>  c(150);
+
+        REQUIRE(a == b);
+        REQUIRE(!(a != b));
+        REQUIRE(a <= b);
+        REQUIRE(a >= b);
+        REQUIRE(!(a < b));
+        REQUIRE(!(a > b));
+
+        REQUIRE(a != c);
+        REQUIRE(a < c);
+        REQUIRE(c > b);
+        REQUIRE(-a < a);
+    }
+    SECTION("narrow_cast")
+    {
+        percent a(50);
+        auto    sum = a + a;
+
+        std::int8_t b = narrow_cast<std::int8_t>(a);
+        REQUIRE(b == 50);
+
+        integer<unsigned> c = narrow_cast<integer<unsigned>>(sum);
+        REQUIRE(static_cast<unsigned>(c) == 100u);
+
+        percent d = narrow_cast<percent>(sum);
+        REQUIRE(d == a + a);
+
+        auto e = narrow_cast<ranged_integer<-100, 0>>(a - a - a);
+        REQUIRE(e.get() == -50);
+    }
+    SECTION("bounded_type")
+    {
+        bounded_type<int, true, true, std::integral_constant<int, 0>,
+                     std::integral_constant<int, 10>>
+                a(5);
+        percent b = a;
+        REQUIRE(b.get() == 5);
+
+        bounded_type<int, false, false, std::integral_constant<int, -1>,
+                     std::integral_constant<int, 101>>
+                c(100);
+        percent d = c;
+        REQUIRE(d.get() == 100);
+
+        static_assert(!std::is_convertible<bounded_type<int, true, true,
+                                                        std::integral_constant<int, -1>,
+                                                        std::integral_constant<int, 10>>,
+                                           percent>::value,
+                      "");
+
+        auto e = d.to_bounded<int>();
+        REQUIRE(e.get_value() == 100);
+    }
+}
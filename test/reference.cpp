@@ -172,6 +172,39 @@ TEST_CASE("array_ref")
     }
 }
 
+struct typed_id : strong_typedef<typed_id, unsigned>,
+                  strong_typedef_op::equality_comparison<typed_id>
+{
+    using strong_typedef::strong_typedef;
+};
+
+TEST_CASE("typed_view")
+{
+    unsigned array[3] = {1u, 2u, 3u};
+
+    auto typed = typed_view<typed_id>(array_ref<unsigned>(array));
+    static_assert(std::is_same<decltype(typed), array_ref<typed_id>>::value, "");
+    REQUIRE(typed.data() == static_cast<void*>(array));
+    REQUIRE(typed[1u] == typed_id(2u));
+
+    typed[2u] = typed_id(42u);
+    REQUIRE(array[2] == 42u);
+
+    auto const_typed = typed_view<typed_id>(array_ref<const unsigned>(array));
+    static_assert(std::is_same<decltype(const_typed), array_ref<const typed_id>>::value, "");
+    REQUIRE(const_typed[0u] == typed_id(1u));
+
+    auto underlying = underlying_view(typed);
+    static_assert(std::is_same<decltype(underlying), array_ref<unsigned>>::value, "");
+    REQUIRE(underlying.data() == array);
+
+    auto const_underlying = underlying_view(const_typed);
+    static_assert(std::is_same<decltype(const_underlying), array_ref<const unsigned>>::value, "");
+    REQUIRE(const_underlying[2u] == 42u);
+
+    REQUIRE(typed_view<typed_id>(array_ref<unsigned>(nullptr)).data() == nullptr);
+}
+
 // fake polymorphic lambda, due to C++11 requirement
 struct lambda
 {
@@ -191,6 +224,11 @@ struct lambda
     }
 };
 
+int add(int a, int b)
+{
+    return a + b;
+}
+
 TEST_CASE("function_ref")
 {
     SECTION("functor")
@@ -257,6 +295,17 @@ TEST_CASE("function_ref")
         function_ref<void(short)> b(lambda{});
         b(0);
     }
+    SECTION("make")
+    {
+        auto a = function_ref<int(int, int)>::make<&add>();
+        REQUIRE(a(1, 3) == 4);
+
+        auto b = function_ref<int(int, short)>::make<decltype(&add), &add>();
+        REQUIRE(b(1, 3) == 4);
+
+        auto c = function_ref<void(int, int)>::make<decltype(&add), &add>();
+        c(1, 3);
+    }
     SECTION("member function")
     {
         struct foo
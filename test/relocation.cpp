@@ -0,0 +1,163 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/relocation.hpp>
+
+#include <catch.hpp>
+
+#include <memory>
+#include <string>
+
+#include <type_safe/bounded_type.hpp>
+#include <type_safe/boxed.hpp>
+#include <type_safe/optional_ref.hpp>
+#include <type_safe/variant.hpp>
+
+using namespace type_safe;
+
+namespace
+{
+    // relocatable, but not trivially copyable
+    struct handle
+    {
+        std::unique_ptr<int> ptr;
+
+        explicit handle(int i) : ptr(new int(i))
+        {
+        }
+    };
+
+    struct self_referential
+    {
+        self_referential* self;
+
+        self_referential() : self(this)
+        {
+        }
+
+        self_referential(self_referential&&) noexcept : self(this)
+        {
+        }
+    };
+
+    struct strong_handle : strong_typedef<strong_handle, handle>
+    {
+        using strong_typedef::strong_typedef;
+    };
+
+    struct strong_int : strong_typedef<strong_int, int>
+    {
+        using strong_typedef::strong_typedef;
+    };
+} // namespace
+
+namespace type_safe
+{
+    template <>
+    struct is_trivially_relocatable<handle> : std::true_type
+    {
+    };
+} // namespace type_safe
+
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+static_assert(is_trivially_relocatable<int>::value, "");
+static_assert(is_trivially_relocatable<handle>::value, "");
+static_assert(!is_trivially_relocatable<self_referential>::value, "");
+
+static_assert(is_trivially_relocatable<strong_int>::value, "");
+static_assert(is_trivially_relocatable<strong_handle>::value, "");
+static_assert(!is_trivially_relocatable<strong_typedef<struct tag, self_referential>>::value, "");
+
+static_assert(is_trivially_relocatable<object_ref<self_referential>>::value, "");
+static_assert(is_trivially_relocatable<optional_ref<self_referential>>::value, "");
+static_assert(is_trivially_relocatable<optional<handle>>::value, "");
+static_assert(!is_trivially_relocatable<optional<self_referential>>::value, "");
+
+static_assert(is_trivially_relocatable<tagged_union<int, handle>>::value, "");
+static_assert(!is_trivially_relocatable<tagged_union<int, self_referential>>::value, "");
+static_assert(is_trivially_relocatable<variant<int, handle>>::value, "");
+static_assert(is_trivially_relocatable<variant<nullvar_t, int, handle>>::value, "");
+static_assert(!is_trivially_relocatable<variant<int, self_referential>>::value, "");
+
+static_assert(is_trivially_relocatable<bounded_type<int, true, true>>::value, "");
+static_assert(is_trivially_relocatable<constrained_type<handle, constraints::non_null>>::value, "");
+static_assert(is_trivially_relocatable<constrained_ref<self_referential, constraints::non_null>>::value, "");
+
+static_assert(is_trivially_relocatable<boxed<self_referential>>::value, "");
+#endif
+
+TEST_CASE("relocate_at")
+{
+    SECTION("trivial")
+    {
+        alignas(handle) unsigned char storage[sizeof(handle)];
+
+        auto src  = new handle(42);
+        auto dest = relocate_at(src, reinterpret_cast<handle*>(&storage));
+        REQUIRE(*dest->ptr == 42);
+        ::operator delete(src); // no destructor
+        dest->~handle();
+    }
+    SECTION("non-trivial")
+    {
+        alignas(self_referential) unsigned char storage[sizeof(self_referential)];
+
+        self_referential src;
+        auto dest = relocate_at(&src, reinterpret_cast<self_referential*>(&storage));
+        REQUIRE(dest->self == dest);
+        ::new (static_cast<void*>(&src)) self_referential(); // src was destroyed
+        dest->~self_referential();
+    }
+}
+
+TEST_CASE("uninitialized_relocate")
+{
+    SECTION("trivial")
+    {
+        using variant_t = variant<int, handle>;
+
+        std::allocator<variant_t> alloc;
+        auto src  = alloc.allocate(2u);
+        auto dest = alloc.allocate(2u);
+
+        ::new (static_cast<void*>(src + 0)) variant_t(1);
+        ::new (static_cast<void*>(src + 1)) variant_t(handle(2));
+
+        auto end = uninitialized_relocate(src, src + 2, dest);
+        REQUIRE(end == dest + 2);
+        REQUIRE(dest[0] == 1);
+        REQUIRE(*dest[1].value(variant_type<handle>{}).ptr == 2);
+
+        for (auto cur = dest; cur != end; ++cur)
+            cur->~variant_t();
+        alloc.deallocate(src, 2u);
+        alloc.deallocate(dest, 2u);
+    }
+    SECTION("non-trivial")
+    {
+        using variant_t = variant<int, std::string>;
+
+        std::allocator<variant_t> alloc;
+        auto src  = alloc.allocate(3u);
+        auto dest = alloc.allocate(3u);
+
+        ::new (static_cast<void*>(src + 0)) variant_t(1);
+        ::new (static_cast<void*>(src + 1)) variant_t(std::string("hello"));
+        ::new (static_cast<void*>(src + 2)) variant_t(3);
+
+        auto end = uninitialized_relocate(src, src + 3, dest);
+        REQUIRE(end == dest + 3);
+        REQUIRE(dest[0] == 1);
+        REQUIRE(dest[1] == std::string("hello"));
+        REQUIRE(dest[2] == 3);
+
+        // empty ranges are fine
+        REQUIRE(uninitialized_relocate(src, src, dest) == dest);
+
+        for (auto cur = dest; cur != end; ++cur)
+            cur->~variant_t();
+        alloc.deallocate(src, 3u);
+        alloc.deallocate(dest, 3u);
+    }
+}
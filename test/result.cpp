@@ -0,0 +1,134 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/result.hpp>
+
+#include <catch.hpp>
+
+#include <string>
+
+using namespace type_safe;
+
+namespace
+{
+    enum class parse_error
+    {
+        empty,
+        invalid,
+    };
+
+    result<int, parse_error> parse_digit(const std::string& str)
+    {
+        if (str.empty())
+            return make_error(parse_error::empty);
+        else if (str.size() != 1u || str[0] < '0' || str[0] > '9')
+            return make_error(parse_error::invalid);
+        return str[0] - '0';
+    }
+
+    result<int, parse_error> sum_digits(const std::string& a, const std::string& b)
+    {
+        TYPE_SAFE_TRY_RESULT(auto first, parse_digit(a));
+        TYPE_SAFE_TRY_RESULT(auto second, parse_digit(b));
+        return first + second;
+    }
+
+#if TYPE_SAFE_USE_COROUTINES
+    result<int, parse_error> co_sum_digits(const std::string& a, const std::string& b)
+    {
+        auto first  = co_await parse_digit(a);
+        auto second = co_await parse_digit(b);
+        co_return first + second;
+    }
+#endif
+} // namespace
+
+static_assert(sizeof(result<int, int>) == sizeof(tagged_union<int, error<int>>),
+              "result must not add anything to the tagged union");
+
+TEST_CASE("result")
+{
+    SECTION("value")
+    {
+        result<int, std::string> a(42);
+        REQUIRE(a.has_value());
+        REQUIRE(a);
+        REQUIRE(!a.has_error());
+        REQUIRE(a.value() == 42);
+        REQUIRE(a.value_or(0) == 42);
+
+        a = 43;
+        REQUIRE(a.value() == 43);
+    }
+    SECTION("error")
+    {
+        result<int, std::string> a(make_error("error"));
+        REQUIRE(!a.has_value());
+        REQUIRE(!a);
+        REQUIRE(a.has_error());
+        REQUIRE(a.error() == "error");
+        REQUIRE(a.value_or(0) == 0);
+
+        a = 42;
+        REQUIRE(a.value() == 42);
+        a = error<std::string>(3u, 'a');
+        REQUIRE(a.error() == "aaa");
+    }
+    SECTION("same type")
+    {
+        result<int, int> a(0);
+        REQUIRE(a.has_value());
+        result<int, int> b(make_error(0));
+        REQUIRE(b.has_error());
+        REQUIRE(a != b);
+        REQUIRE(a == result<int, int>(0));
+        REQUIRE(b == result<int, int>(make_error(0)));
+    }
+    SECTION("map")
+    {
+        result<int, std::string> a(21);
+        auto                     b = a.map([](int i) { return std::to_string(i * 2); });
+        REQUIRE(b.value() == "42");
+
+        result<int, std::string> c(make_error("error"));
+        auto                     d = c.map([](int i) { return i * 2.0; });
+        REQUIRE(d.error() == "error");
+    }
+    SECTION("map_error")
+    {
+        result<int, parse_error> a(make_error(parse_error::empty));
+        auto b = a.map_error([](parse_error e) { return e == parse_error::empty ? "empty" : ""; });
+        REQUIRE(std::string(b.error()) == "empty");
+
+        result<int, parse_error> c(42);
+        auto d = std::move(c).map_error([](parse_error) { return std::string(); });
+        REQUIRE(d.value() == 42);
+    }
+    SECTION("and_then")
+    {
+        auto a = result<std::string, parse_error>("4").and_then(&parse_digit);
+        REQUIRE(a.value() == 4);
+
+        auto b = result<std::string, parse_error>("a").and_then(&parse_digit);
+        REQUIRE(b.error() == parse_error::invalid);
+
+        auto c = result<std::string, parse_error>(make_error(parse_error::empty))
+                     .and_then(&parse_digit);
+        REQUIRE(c.error() == parse_error::empty);
+    }
+    SECTION("TYPE_SAFE_TRY_RESULT")
+    {
+        REQUIRE(sum_digits("1", "2").value() == 3);
+        REQUIRE(sum_digits("", "2").error() == parse_error::empty);
+        REQUIRE(sum_digits("1", "12").error() == parse_error::invalid);
+    }
+#if TYPE_SAFE_USE_COROUTINES
+    SECTION("co_await")
+    {
+        REQUIRE(co_sum_digits("1", "2").value() == 3);
+        REQUIRE(co_sum_digits("", "2").error() == parse_error::empty);
+        REQUIRE(co_sum_digits("1", "12").error() == parse_error::invalid);
+    }
+#endif
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/slot_map.hpp>
+
+#include <catch.hpp>
+
+#include <string>
+
+using namespace type_safe;
+
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+static_assert(sizeof(slot_handle<int>) == sizeof(std::uint64_t), "");
+static_assert(!std::is_convertible<slot_handle<int>, slot_handle<char>>::value, "");
+#endif
+
+TEST_CASE("slot_map")
+{
+    slot_map<std::string> map;
+    REQUIRE(map.empty());
+    REQUIRE(!map.contains(slot_map<std::string>::handle()));
+
+    auto a = map.insert("a");
+    auto b = map.emplace(3u, 'b');
+    auto c = map.insert("c");
+    REQUIRE(map.size() == 3u);
+    REQUIRE(map.lookup(a).value() == "a");
+    REQUIRE(map.lookup(b).value() == "bbb");
+    REQUIRE(map.lookup(c).value() == "c");
+    REQUIRE(a != b);
+
+    SECTION("erase")
+    {
+        REQUIRE(map.erase(a));
+        REQUIRE(!map.erase(a));
+        REQUIRE(map.size() == 2u);
+        REQUIRE(!map.contains(a));
+        REQUIRE(!map.lookup(a).has_value());
+        REQUIRE(map.lookup(b).value() == "bbb");
+        REQUIRE(map.lookup(c).value() == "c");
+
+        // slot is reused, but old handle stays stale
+        auto d = map.insert("d");
+        REQUIRE(d.index() == a.index());
+        REQUIRE(d != a);
+        REQUIRE(!map.contains(a));
+        REQUIRE(map.lookup(d).value() == "d");
+    }
+    SECTION("iteration")
+    {
+        REQUIRE(map.erase(b));
+
+        std::string result;
+        for (auto& str : map)
+            result += str;
+        REQUIRE((result == "ac" || result == "ca"));
+
+        for (auto i = 0u; i != map.size(); ++i)
+        {
+            auto h = map.handle_at(i);
+            REQUIRE(&map.lookup(h).value() == map.begin() + i);
+        }
+    }
+    SECTION("clear")
+    {
+        map.clear();
+        REQUIRE(map.empty());
+        REQUIRE(!map.contains(a));
+        REQUIRE(!map.contains(b));
+        REQUIRE(!map.contains(c));
+
+        auto d = map.insert("d");
+        REQUIRE(map.lookup(d).value() == "d");
+        REQUIRE(map.size() == 1u);
+    }
+    SECTION("modify")
+    {
+        map.lookup(a).value() += "1";
+        const auto& cmap = map;
+        REQUIRE(cmap.lookup(a).value() == "a1");
+    }
+}
@@ -6,10 +6,51 @@
 
 #include <catch.hpp>
 
+#include <type_safe/integer.hpp>
+
 #include <sstream>
+#include <unordered_set>
 
 using namespace type_safe;
 
+namespace
+{
+    struct hashed_id : strong_typedef<hashed_id, int>,
+                       strong_typedef_op::equality_comparison<hashed_id>
+    {
+        using strong_typedef::strong_typedef;
+    };
+
+    struct fast_hashed_id : strong_typedef<fast_hashed_id, unsigned>,
+                            strong_typedef_op::equality_comparison<fast_hashed_id>
+    {
+        using strong_typedef::strong_typedef;
+    };
+
+    struct fast_hashed_index : strong_typedef<fast_hashed_index, integer<unsigned>>
+    {
+        using strong_typedef::strong_typedef;
+    };
+} // namespace
+
+namespace std
+{
+    template <>
+    struct hash<hashed_id> : type_safe::hashable<hashed_id>
+    {
+    };
+
+    template <>
+    struct hash<fast_hashed_id> : type_safe::fast_hashable<fast_hashed_id>
+    {
+    };
+
+    template <>
+    struct hash<fast_hashed_index> : type_safe::fast_hashable<fast_hashed_index>
+    {
+    };
+} // namespace std
+
 TEST_CASE("strong_typedef")
 {
     // only check compilation here
@@ -481,3 +522,72 @@ TEST_CASE("strong_typedef")
         REQUIRE(static_cast<int>(a) == 1);
     }
 }
+
+TEST_CASE("strong_typedef hash")
+{
+    REQUIRE(std::hash<hashed_id>{}(hashed_id(42)) == std::hash<int>{}(42));
+
+    std::hash<fast_hashed_id> hasher;
+    REQUIRE(hasher(fast_hashed_id(0u)) == 0u);
+    REQUIRE(hasher(fast_hashed_id(1u)) == hasher(fast_hashed_id(1u)));
+    REQUIRE(hasher(fast_hashed_id(1u)) != hasher(fast_hashed_id(2u)));
+    // sequential ids differ in the low bits
+    REQUIRE((hasher(fast_hashed_id(1u)) & 0xFFu) != (hasher(fast_hashed_id(2u)) & 0xFFu));
+
+    std::unordered_set<fast_hashed_id> set;
+    for (auto i = 0u; i != 100u; ++i)
+        set.insert(fast_hashed_id(i));
+    REQUIRE(set.size() == 100u);
+    REQUIRE(set.count(fast_hashed_id(50u)) == 1u);
+
+    // a ts::integer is hashed like the integer it wraps
+    std::hash<fast_hashed_index> index_hasher;
+    REQUIRE(index_hasher(fast_hashed_index(integer<unsigned>(42u)))
+            == hasher(fast_hashed_id(42u)));
+}
+
+#if defined(__GNUC__)
+TEST_CASE("strong_typedef simd")
+{
+    typedef float float4 __attribute__((vector_size(4 * sizeof(float))));
+
+    struct velocity : strong_typedef<velocity, float4>,
+                      strong_typedef_op::simd_arithmetic<velocity>,
+                      strong_typedef_op::mixed_multiplication<velocity, float>,
+                      strong_typedef_op::simd_comparison<velocity>,
+                      strong_typedef_op::mixed_simd_comparison<velocity, float>
+    {
+        using strong_typedef::strong_typedef;
+    };
+
+    auto element = [](const velocity& v, int i) { return static_cast<const float4&>(v)[i]; };
+
+    velocity a(float4{1.f, 2.f, 3.f, 4.f});
+    velocity b(float4{4.f, 3.f, 2.f, 1.f});
+
+    auto sum = a + b;
+    for (auto i = 0; i != 4; ++i)
+        REQUIRE(element(sum, i) == 5.f);
+
+    auto scaled = -(a * 2.f);
+    REQUIRE(element(scaled, 0) == -2.f);
+    REQUIRE(element(scaled, 3) == -8.f);
+
+    a += b;
+    a -= b;
+    a /= velocity(float4{1.f, 1.f, 1.f, 2.f});
+    REQUIRE(element(a, 3) == 2.f);
+
+    // the comparison returns the element-wise mask of the vector type
+    auto less = a < b;
+    REQUIRE(less[0] != 0);
+    REQUIRE(less[1] != 0);
+    REQUIRE(less[2] == 0);
+    REQUIRE(less[3] == 0);
+
+    auto equal = a == 2.f;
+    REQUIRE(equal[0] == 0);
+    REQUIRE(equal[1] != 0);
+    REQUIRE(equal[3] != 0);
+}
+#endif
@@ -0,0 +1,130 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/tagged_object_ref.hpp>
+
+#include <catch.hpp>
+
+using namespace type_safe;
+
+namespace
+{
+    enum class node_flags
+    {
+        red,
+        leaf,
+        dirty,
+        _flag_set_size,
+    };
+
+    struct alignas(8) node
+    {
+        int value;
+    };
+
+    struct derived_node : node
+    {
+    };
+} // namespace
+
+TEST_CASE("tagged_object_ref")
+{
+    using ref_t = tagged_object_ref<node, node_flags>;
+    static_assert(sizeof(ref_t) == sizeof(node*), "");
+    static_assert(is_trivially_relocatable<ref_t>::value, "");
+
+    node a{1};
+    node b{2};
+
+    SECTION("ctor")
+    {
+        ref_t ref(a);
+        REQUIRE(&ref.get() == &a);
+        REQUIRE(&*ref == &a);
+        REQUIRE(ref->value == 1);
+        REQUIRE(ref.ref() == a);
+        REQUIRE(ref.none());
+
+        ref_t with_flags(a, node_flags::red | node_flags::dirty);
+        REQUIRE(&with_flags.get() == &a);
+        REQUIRE(with_flags.is_set(node_flags::red));
+        REQUIRE(!with_flags.is_set(node_flags::leaf));
+        REQUIRE(with_flags.is_set(node_flags::dirty));
+        REQUIRE(with_flags.flags() == (node_flags::red | node_flags::dirty));
+
+        derived_node d;
+        d.value = 3;
+        ref_t from_ref(object_ref<derived_node>(d), node_flags::leaf);
+        REQUIRE(from_ref->value == 3);
+        REQUIRE(from_ref.as_flag(node_flags::leaf) == true);
+    }
+    SECTION("rebind")
+    {
+        ref_t ref(a, node_flags::leaf);
+        ref = type_safe::ref(b);
+        REQUIRE(&ref.get() == &b);
+        REQUIRE(ref.flags() == node_flags::leaf);
+    }
+    SECTION("flags")
+    {
+        ref_t ref(a);
+        ref.set(node_flags::red);
+        REQUIRE(ref.is_set(node_flags::red));
+        REQUIRE(ref.any());
+
+        ref.set(node_flags::leaf, true);
+        ref.set(node_flags::red, false);
+        REQUIRE(!ref.is_set(node_flags::red));
+        REQUIRE(ref.is_set(node_flags::leaf));
+
+        ref.toggle(node_flags::dirty);
+        REQUIRE(ref.is_set(node_flags::dirty));
+        ref.reset(node_flags::dirty);
+        REQUIRE(!ref.is_set(node_flags::dirty));
+
+        ref.set_all();
+        REQUIRE(ref.all());
+        REQUIRE(&ref.get() == &a);
+        ref.reset_all();
+        REQUIRE(ref.none());
+        REQUIRE(&ref.get() == &a);
+
+        ref.set_flags(node_flags::dirty);
+        REQUIRE(ref.flags() == node_flags::dirty);
+        REQUIRE(&ref.get() == &a);
+    }
+    SECTION("compare")
+    {
+        ref_t ref(a, node_flags::red);
+        REQUIRE(ref == ref_t(a, node_flags::red));
+        REQUIRE(ref != ref_t(a));
+        REQUIRE(ref != ref_t(b, node_flags::red));
+    }
+}
+
+TEST_CASE("compact_tagged_object_ref_policy")
+{
+    using ref_t      = tagged_object_ref<node, node_flags>;
+    using optional_t = compact_optional<compact_tagged_object_ref_policy<node, node_flags>>;
+    static_assert(sizeof(optional_t) == sizeof(node*), "");
+    static_assert(std::is_same<optional_for<ref_t>, optional_t>::value, "");
+
+    node a{1};
+
+    optional_t opt;
+    REQUIRE(!opt.has_value());
+
+    // the reference without flags is still a valid value
+    opt = ref_t(a);
+    REQUIRE(opt.has_value());
+    REQUIRE(&opt.value().get() == &a);
+    REQUIRE(opt.value().none());
+
+    opt = ref_t(a, node_flags::leaf);
+    REQUIRE(opt.has_value());
+    REQUIRE(opt.value().flags() == node_flags::leaf);
+
+    opt = nullopt;
+    REQUIRE(!opt.has_value());
+}
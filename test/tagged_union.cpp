@@ -6,10 +6,25 @@
 
 #include <catch.hpp>
 
+#include <string>
+
 #include "debugger_type.hpp"
 
 using namespace type_safe;
 
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+// the tag is as small as possible and shares the padding after the biggest type
+static_assert(sizeof(tagged_union<char, short>::type_id) == 1u, "");
+static_assert(sizeof(tagged_union<char, short>) == 2u * sizeof(short), "");
+static_assert(sizeof(tagged_union<char[5], std::int32_t>) == 2u * sizeof(std::int32_t), "");
+
+// trivial types without that padding can be used in constant expressions
+constexpr tagged_union<int, double> constant_union(union_type<double>{}, 0.5);
+static_assert(constant_union.has_value(), "");
+static_assert(static_cast<std::size_t>(constant_union.type()) == 2u, "");
+static_assert(constant_union.value(union_type<double>{}) == 0.5, "");
+#endif
+
 TEST_CASE("tagged_union")
 {
     using union_t = tagged_union<int, double, debugger_type>;
@@ -19,6 +34,7 @@ TEST_CASE("tagged_union")
     REQUIRE(!tunion.has_value());
     REQUIRE(tunion.type() == union_t::invalid_type);
     REQUIRE(static_cast<std::size_t>(tunion.type()) == 0u);
+    REQUIRE(union_t::type_id::hash{}(union_t::type_id(union_type<double>{})) == 2u);
 
     SECTION("emplace int")
     {
@@ -122,3 +138,34 @@ TEST_CASE("tagged_union")
         }
     }
 }
+
+TEST_CASE("tagged_union compare and hash")
+{
+    using union_t = tagged_union<int, std::string>;
+
+    union_t empty;
+    union_t a(union_type<int>{}, 1);
+    union_t b(union_type<int>{}, 2);
+    union_t c(union_type<std::string>{}, "a");
+
+    REQUIRE(empty == union_t());
+    REQUIRE(a == union_t(union_type<int>{}, 1));
+    REQUIRE(a != b);
+    REQUIRE(a != c);
+    REQUIRE(a != empty);
+
+    // ordered by type id first, then by value
+    REQUIRE(empty < a);
+    REQUIRE(a < b);
+    REQUIRE(b < c);
+    REQUIRE_FALSE(c < b);
+    REQUIRE(a <= a);
+    REQUIRE(c > a);
+    REQUIRE(c >= c);
+    REQUIRE_FALSE(empty < union_t());
+
+    std::hash<union_t> hash;
+    REQUIRE(hash(a) == hash(union_t(union_type<int>{}, 1)));
+    REQUIRE(hash(c) == hash(union_t(union_type<std::string>{}, "a")));
+    REQUIRE(hash(empty) == hash(union_t()));
+}
@@ -6,6 +6,10 @@
 
 #include <catch.hpp>
 
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+
 #include "debugger_type.hpp"
 
 using namespace type_safe;
@@ -15,6 +19,28 @@ using namespace type_safe;
 using variant_t = variant<nullvar_t, int, double, debugger_type>;
 using union_t   = tagged_union<int, double, debugger_type>;
 
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+// trivial types give a trivial variant
+static_assert(std::is_trivially_copyable<variant<nullvar_t, int, double>>::value, "");
+static_assert(std::is_trivially_destructible<variant<int, double>>::value, "");
+static_assert(std::is_trivially_copyable<tagged_union<int, double>>::value, "");
+static_assert(!std::is_copy_constructible<union_t>::value, "");
+static_assert(!std::is_trivially_destructible<variant_t>::value, "");
+// the union and the variant both use the copy/move controls, that must not add padding
+static_assert(sizeof(variant<int, double>) == sizeof(tagged_union<int, double>), "");
+
+// trivial variants can be created and queried in constant expressions
+constexpr variant<nullvar_t, int, double> constant_empty;
+static_assert(!constant_empty.has_value(), "");
+static_assert(constant_empty.has_value(variant_type<nullvar_t>{}), "");
+
+constexpr variant<int, char> constant_table[] = {1, 'a', variant<int, char>(variant_type<int>{}, 3)};
+static_assert(constant_table[0].value(variant_type<int>{}) == 1, "");
+static_assert(constant_table[1].has_value(variant_type<char>{}), "");
+static_assert(constant_table[1].value(variant_type<char>{}) == 'a', "");
+static_assert(constant_table[2].value(variant_type<int>{}) == 3, "");
+#endif
+
 template <class Variant>
 void check_variant_empty(const Variant& var)
 {
@@ -711,3 +737,26 @@ TEST_CASE("rarely_empty_variant")
         check_variant_empty(var);
     }
 }
+
+TEST_CASE("basic_variant hash")
+{
+    using key_t = variant<std::int64_t, std::string>;
+
+    std::hash<key_t> hash;
+    REQUIRE(hash(key_t(std::int64_t(42))) == hash(key_t(std::int64_t(42))));
+    REQUIRE(hash(key_t(std::string("foo"))) == hash(key_t(std::string("foo"))));
+    REQUIRE(hash(key_t(std::string("foo"))) != hash(key_t(std::string("bar"))));
+
+    std::unordered_set<key_t> set;
+    set.insert(key_t(std::int64_t(1)));
+    set.insert(key_t(std::string("1")));
+    set.insert(key_t(std::int64_t(1)));
+    REQUIRE(set.size() == 2u);
+    REQUIRE(set.count(key_t(std::string("1"))) == 1u);
+    REQUIRE(set.count(key_t(std::string("2"))) == 0u);
+
+    // the empty state has a hash as well
+    using optional_key_t = variant<nullvar_t, std::int64_t, std::string>;
+    REQUIRE(std::hash<optional_key_t>{}(optional_key_t())
+            == std::hash<optional_key_t>{}(optional_key_t(nullvar)));
+}
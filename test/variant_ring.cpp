@@ -0,0 +1,191 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/variant_ring.hpp>
+
+#include <catch.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace type_safe;
+
+namespace
+{
+    struct counted
+    {
+        static int count;
+
+        int value;
+
+        explicit counted(int value) : value(value)
+        {
+            ++count;
+        }
+
+        counted(const counted&) = delete;
+
+        ~counted()
+        {
+            --count;
+        }
+    };
+
+    int counted::count = 0;
+
+    struct recorder
+    {
+        int*         ints;
+        std::string* str;
+
+        void operator()(int i) const
+        {
+            *ints += i;
+        }
+
+        void operator()(std::string& s) const
+        {
+            *str += s;
+        }
+
+        void operator()(counted& c) const
+        {
+            *ints += c.value;
+        }
+    };
+
+    template <class Ring>
+    void check_single_thread()
+    {
+        Ring ring;
+        REQUIRE(ring.empty());
+        REQUIRE(Ring::capacity() == 4u);
+
+        int         ints = 0;
+        std::string str;
+        REQUIRE(!ring.try_visit(recorder{&ints, &str}));
+
+        REQUIRE(ring.try_emplace(variant_type<int>{}, 1));
+        REQUIRE(ring.try_emplace(variant_type<std::string>{}, 3u, 'a'));
+        REQUIRE(ring.try_emplace(variant_type<counted>{}, 10));
+        REQUIRE(ring.try_emplace(variant_type<int>{}, 100));
+        REQUIRE(!ring.try_emplace(variant_type<int>{}, 1000));
+        REQUIRE(!ring.empty());
+        REQUIRE(counted::count == 1);
+
+        REQUIRE(ring.try_visit(recorder{&ints, &str}));
+        REQUIRE(ints == 1);
+        REQUIRE(ring.try_visit(recorder{&ints, &str}));
+        REQUIRE(str == "aaa");
+        REQUIRE(ring.try_visit(recorder{&ints, &str}));
+        REQUIRE(ints == 11);
+        REQUIRE(counted::count == 0);
+
+        // wrap around
+        ring.emplace(variant_type<counted>{}, 20);
+        ring.emplace(variant_type<std::string>{}, "bc");
+        REQUIRE(ring.try_visit(recorder{&ints, &str}));
+        REQUIRE(ints == 111);
+        REQUIRE(ring.try_visit(recorder{&ints, &str}));
+        REQUIRE(ints == 131);
+
+        // remaining message is destroyed by the destructor
+        REQUIRE(counted::count == 0);
+        ring.emplace(variant_type<counted>{}, 30);
+        REQUIRE(counted::count == 1);
+    }
+
+    template <class Ring>
+    long long transfer(std::size_t producers, std::size_t consumers, int count)
+    {
+        Ring ring;
+
+        std::atomic<long long> sum(0);
+        std::atomic<int>       received(0);
+        auto const             total = static_cast<int>(producers) * count;
+
+        struct visitor
+        {
+            std::atomic<long long>& sum;
+
+            void operator()(int i) const
+            {
+                sum += i;
+            }
+
+            void operator()(std::string& s) const
+            {
+                sum += static_cast<long long>(s.size());
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (auto i = 0u; i != producers; ++i)
+            threads.emplace_back([&] {
+                for (auto j = 0; j != count; ++j)
+                {
+                    if (j % 2 == 0)
+                        ring.emplace(variant_type<int>{}, j);
+                    else
+                        ring.emplace(variant_type<std::string>{}, static_cast<std::size_t>(j),
+                                     'a');
+                }
+            });
+        for (auto i = 0u; i != consumers; ++i)
+            threads.emplace_back([&] {
+                while (received.load() != total)
+                {
+                    if (ring.try_visit(visitor{sum}))
+                        ++received;
+                    else
+                        std::this_thread::yield();
+                }
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        REQUIRE(ring.empty());
+        return sum.load();
+    }
+} // namespace
+
+TEST_CASE("variant_ring")
+{
+    check_single_thread<variant_ring<4u, int, std::string, counted>>();
+    REQUIRE(counted::count == 0);
+
+    REQUIRE(transfer<variant_ring<8u, int, std::string>>(1u, 1u, 10000) == 49995000);
+}
+
+TEST_CASE("mpmc_variant_ring")
+{
+    check_single_thread<mpmc_variant_ring<4u, int, std::string, counted>>();
+    REQUIRE(counted::count == 0);
+
+    REQUIRE(transfer<mpmc_variant_ring<8u, int, std::string>>(1u, 1u, 10000) == 49995000);
+    REQUIRE(transfer<mpmc_variant_ring<8u, int, std::string>>(4u, 4u, 10000) == 4 * 49995000ll);
+
+#if TYPE_SAFE_USE_EXCEPTIONS
+    SECTION("throwing constructor")
+    {
+        struct thrower
+        {
+            thrower()
+            {
+                throw 0;
+            }
+        };
+
+        mpmc_variant_ring<4u, int, thrower> ring;
+        REQUIRE_THROWS(ring.try_emplace(variant_type<thrower>{}));
+        REQUIRE(ring.try_emplace(variant_type<int>{}, 42));
+
+        auto value = 0;
+        REQUIRE(ring.try_visit([&](int i) { value = i; }));
+        REQUIRE(value == 42);
+        REQUIRE(!ring.try_visit([&](int i) { value = i; }));
+    }
+#endif
+}
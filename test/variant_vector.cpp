@@ -0,0 +1,93 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/variant_vector.hpp>
+
+#include <catch.hpp>
+
+#include <string>
+
+using namespace type_safe;
+
+TEST_CASE("variant_vector")
+{
+    using vector = variant_vector<int, double, std::string>;
+
+    vector vec;
+    REQUIRE(vec.empty());
+    REQUIRE(vec.size().get() == 0u);
+    REQUIRE(vec.values(variant_type<int>{}).size().get() == 0u);
+
+    vec.push_back(1);
+    vec.push_back(std::string("hello"));
+    vec.emplace_back(variant_type<double>{}, 3.5);
+    vec.push_back(2);
+    REQUIRE(vec.emplace_back(variant_type<std::string>{}, 3u, 'a') == "aaa");
+
+    REQUIRE(vec.size().get() == 5u);
+    REQUIRE(vec.count(variant_type<int>{}).get() == 2u);
+    REQUIRE(vec.count(variant_type<double>{}).get() == 1u);
+    REQUIRE(vec.count(variant_type<std::string>{}).get() == 2u);
+
+    SECTION("element access")
+    {
+        REQUIRE(vec.type(0u) == vector::type_id(variant_type<int>{}));
+        REQUIRE(vec.type(2u) == vector::type_id(variant_type<double>{}));
+
+        vector::reference ref = vec[1u];
+        REQUIRE(ref.has_value());
+        REQUIRE(ref.has_value(variant_type<std::string>{}));
+        REQUIRE(!ref.has_value(variant_type<int>{}));
+        REQUIRE(ref.value(variant_type<std::string>{}) == "hello");
+        REQUIRE(!ref.optional_value(variant_type<int>{}));
+
+        ref.value(variant_type<std::string>{}) = "world";
+        REQUIRE(vec[1u].value(variant_type<std::string>{}) == "world");
+
+        const vector&           cvec = vec;
+        vector::const_reference cref = cvec[3u];
+        REQUIRE(cref.value(variant_type<int>{}) == 2);
+        REQUIRE(cref.optional_value(variant_type<int>{}).value() == 2);
+
+        vector::const_reference converted = vec[2u];
+        REQUIRE(converted.value(variant_type<double>{}) == 3.5);
+    }
+    SECTION("values")
+    {
+        auto ints = vec.values(variant_type<int>{});
+        REQUIRE(ints.size().get() == 2u);
+        REQUIRE(ints.data()[0] == 1);
+        REQUIRE(ints.data()[1] == 2);
+
+        for (auto& i : ints)
+            i *= 10;
+        REQUIRE(vec[0u].value(variant_type<int>{}) == 10);
+        REQUIRE(vec[3u].value(variant_type<int>{}) == 20);
+
+        const vector& cvec    = vec;
+        auto          strings = cvec.values(variant_type<std::string>{});
+        REQUIRE(strings.size().get() == 2u);
+        REQUIRE(strings.data()[1] == "aaa");
+    }
+    SECTION("pop_back")
+    {
+        vec.pop_back();
+        REQUIRE(vec.size().get() == 4u);
+        REQUIRE(vec.count(variant_type<std::string>{}).get() == 1u);
+
+        vec.pop_back();
+        REQUIRE(vec.count(variant_type<int>{}).get() == 1u);
+
+        vec.push_back(42);
+        REQUIRE(vec[3u].value(variant_type<int>{}) == 42);
+        REQUIRE(vec.values(variant_type<int>{}).data()[1] == 42);
+    }
+    SECTION("clear")
+    {
+        vec.clear();
+        REQUIRE(vec.empty());
+        REQUIRE(vec.count(variant_type<int>{}).get() == 0u);
+        REQUIRE(vec.count(variant_type<std::string>{}).get() == 0u);
+    }
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/violation_stats.hpp>
+
+#include <catch.hpp>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace type_safe;
+
+namespace
+{
+    const violation_record* find(const std::vector<violation_record>& stats, unsigned line)
+    {
+        for (auto& record : stats)
+            if (record.location.line_number == line)
+                return &record;
+        return nullptr;
+    }
+
+    std::vector<std::uint_least64_t> sampled;
+
+    void sampler(const violation_record& record)
+    {
+        sampled.push_back(record.count);
+    }
+} // namespace
+
+TEST_CASE("violation_stats")
+{
+    reset_violation_stats();
+    REQUIRE(violation_stats().empty());
+
+    auto violate = [](unsigned line, const char* msg) {
+        detail::on_precondition_violation(debug_assert::source_location{__FILE__, line}, "expr",
+                                          msg);
+    };
+
+    SECTION("counting")
+    {
+        violate(1u, "a");
+        violate(2u, "b");
+        violate(1u, "a");
+
+        auto stats = violation_stats();
+        REQUIRE(stats.size() == 2u);
+
+        auto a = find(stats, 1u);
+        REQUIRE(a);
+        REQUIRE(std::strcmp(a->location.file_name, __FILE__) == 0);
+        REQUIRE(std::strcmp(a->expression, "expr") == 0);
+        REQUIRE(std::strcmp(a->message, "a") == 0);
+        REQUIRE(a->count == 2u);
+
+        auto b = find(stats, 2u);
+        REQUIRE(b);
+        REQUIRE(b->count == 1u);
+
+        reset_violation_stats();
+        REQUIRE(violation_stats().empty());
+
+        violate(2u, "b");
+        stats = violation_stats();
+        REQUIRE(stats.size() == 1u);
+        REQUIRE(stats[0].count == 1u);
+    }
+    SECTION("same location from different file name strings")
+    {
+        char file[] = __FILE__;
+        detail::on_precondition_violation(debug_assert::source_location{file, 3u}, "expr", "");
+        violate(3u, "");
+
+        auto stats = violation_stats();
+        REQUIRE(stats.size() == 1u);
+        REQUIRE(stats[0].count == 2u);
+    }
+    SECTION("concurrent")
+    {
+        std::vector<std::thread> threads;
+        for (auto i = 0; i != 4; ++i)
+            threads.emplace_back([&] {
+                for (auto j = 0u; j != 1000u; ++j)
+                    violate(4u + j % 2u, "");
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        auto stats = violation_stats();
+        REQUIRE(stats.size() == 2u);
+        REQUIRE(find(stats, 4u)->count == 2000u);
+        REQUIRE(find(stats, 5u)->count == 2000u);
+    }
+    SECTION("sampler")
+    {
+        sampled.clear();
+        set_violation_sampler(sampler, 3u);
+        for (auto i = 0; i != 7; ++i)
+            violate(6u, "");
+        set_violation_sampler(nullptr);
+        violate(6u, "");
+
+        REQUIRE((sampled == std::vector<std::uint_least64_t>{1u, 3u, 6u}));
+    }
+    SECTION("overflow")
+    {
+        for (auto i = 0u; i != TYPE_SAFE_VIOLATION_STATS_CAPACITY + 2u; ++i)
+            violate(100u + i, "");
+
+        // call sites of the other sections are still registered
+        auto stats = violation_stats();
+        REQUIRE(violation_overflow_count() >= 2u);
+        REQUIRE(stats.size() + violation_overflow_count()
+                == TYPE_SAFE_VIOLATION_STATS_CAPACITY + 2u);
+
+        reset_violation_stats();
+        REQUIRE(violation_overflow_count() == 0u);
+    }
+}
@@ -6,8 +6,70 @@
 
 #include <catch.hpp>
 
+#include <string>
+
 using namespace type_safe;
 
+#if !defined(TYPE_SAFE_TEST_NO_STATIC_ASSERT) && TYPE_SAFE_USE_CONSTEXPR14
+// trivial variants can be visited in constant expressions
+namespace
+{
+    struct constant_visitor
+    {
+        constexpr int operator()(nullvar_t) const
+        {
+            return -1;
+        }
+
+        template <typename T>
+        constexpr int operator()(T value) const
+        {
+            return static_cast<int>(value);
+        }
+    };
+
+    // these use a switch
+    constexpr variant<nullvar_t, int, char> constant_small[] = {nullvar, 1, 'a'};
+    // and these a table
+    constexpr variant<int, char, short, long, unsigned, bool> constant_big[] = {short(2), true};
+} // namespace
+
+static_assert(visit(constant_visitor{}, constant_small[0]) == -1, "");
+static_assert(visit(constant_visitor{}, constant_small[1]) == 1, "");
+static_assert(visit(constant_visitor{}, constant_small[2]) == 'a', "");
+static_assert(visit(constant_visitor{}, constant_big[0]) == 2, "");
+static_assert(visit(constant_visitor{}, constant_big[1]) == 1, "");
+#endif
+
+namespace
+{
+    struct multi_visitor
+    {
+        using incomplete_visitor = void;
+
+        int& result;
+
+        void operator()(int a, double b, char c) const
+        {
+            result = a + int(b) + c;
+        }
+
+        void operator()(nullvar_t, double, char) const
+        {
+            result = -1;
+        }
+
+        void operator()(int, nullvar_t, char) const
+        {
+            result = -2;
+        }
+
+        // only exact types, other combinations must not convert
+        template <typename A, typename B, typename C>
+        void operator()(A, B, C) const = delete;
+    };
+} // namespace
+
 TEST_CASE("visit optional")
 {
     struct visitor
@@ -174,4 +236,183 @@ TEST_CASE("visit variant")
         REQUIRE(visit([](int) { return 0; }, a) == 0);
         REQUIRE(visit([](int, int) { return 0; }, a, b) == 0);
     }
+    SECTION("many types")
+    {
+        struct visitor
+        {
+            int operator()(nullvar_t) const
+            {
+                return -1;
+            }
+
+            int operator()(char) const
+            {
+                return 0;
+            }
+
+            int operator()(short) const
+            {
+                return 1;
+            }
+
+            int operator()(int) const
+            {
+                return 2;
+            }
+
+            int operator()(long) const
+            {
+                return 3;
+            }
+
+            int operator()(float) const
+            {
+                return 4;
+            }
+
+            int operator()(double d) const
+            {
+                REQUIRE(d == 3.5);
+                return 5;
+            }
+        };
+
+        variant<nullvar_t, char, short, int, long, float, double> a;
+        REQUIRE(visit(visitor{}, a) == -1);
+
+        a = 'a';
+        REQUIRE(visit(visitor{}, a) == 0);
+
+        a = short(1);
+        REQUIRE(visit(visitor{}, a) == 1);
+
+        a = 42;
+        REQUIRE(visit(visitor{}, a) == 2);
+
+        a = 42l;
+        REQUIRE(visit(visitor{}, a) == 3);
+
+        a = 3.14f;
+        REQUIRE(visit(visitor{}, a) == 4);
+
+        a = 3.5;
+        REQUIRE(visit(visitor{}, a) == 5);
+        REQUIRE(visit(visitor{}, std::move(a)) == 5);
+    }
+    SECTION("multiple variants")
+    {
+        variant<nullvar_t, int, double> a(1);
+        variant<nullvar_t, int, double> b(2.0);
+        variant<nullvar_t, char, int>   c(char(3));
+
+        auto result = 0;
+        visit(multi_visitor{result}, a, b, c);
+        REQUIRE(result == 6);
+
+        a.reset();
+        visit(multi_visitor{result}, a, b, c);
+        REQUIRE(result == -1);
+
+        a = 1;
+        b.reset();
+        visit(multi_visitor{result}, a, b, c);
+        REQUIRE(result == -2);
+
+        // not covered
+        result = 0;
+        c.reset();
+        visit(multi_visitor{result}, a, b, c);
+        REQUIRE(result == 0);
+
+        // no conversion from int to char
+        c = 3;
+        visit(multi_visitor{result}, a, b, c);
+        REQUIRE(result == 0);
+    }
+}
+
+TEST_CASE("match")
+{
+    SECTION("exhaustive")
+    {
+        variant<int, std::string> a(3);
+        auto to_int = [&] {
+            return match(
+                a, [](int i) { return i; },
+                [](const std::string& str) { return static_cast<int>(str.size()); });
+        };
+        REQUIRE(to_int() == 3);
+
+        a = std::string("hello");
+        REQUIRE(to_int() == 5);
+
+        // the value is perfectly forwarded
+        auto str = match(
+            std::move(a), [](int) { return std::string(); },
+            [](std::string&& s) { return std::move(s); });
+        REQUIRE(str == "hello");
+    }
+    SECTION("empty state")
+    {
+        variant<nullvar_t, int, char> a;
+        auto get = [&] {
+            return match(
+                a, [](nullvar_t) { return 0; }, [](int) { return 1; }, [](char) { return 2; });
+        };
+        REQUIRE(get() == 0);
+
+        a = 42;
+        REQUIRE(get() == 1);
+
+        a = 'c';
+        REQUIRE(get() == 2);
+    }
+    SECTION("otherwise")
+    {
+        variant<nullvar_t, int, char, double> a;
+
+        auto result = 0;
+        auto set    = [&] {
+            match(
+                a, [&](int i) { result = i; }, otherwise([&] { result = -1; }));
+        };
+        set();
+        REQUIRE(result == -1);
+
+        a = 42;
+        set();
+        REQUIRE(result == 42);
+
+        // a promotion is fine, but narrowing conversions go to the wildcard
+        a = 'c';
+        set();
+        REQUIRE(result == 'c');
+
+        a = 3.5;
+        set();
+        REQUIRE(result == -1);
+
+        // handlers taking a reference still get the value
+        a = 1;
+        match(
+            a, [](int& i) { i = 2; }, otherwise([] {}));
+        REQUIRE(a.value(variant_type<int>{}) == 2);
+
+        // overload resolution picks the handler, even if others would accept it as well
+        variant<int, long, short, std::string> b(1);
+        auto                                   overlapping = [&] {
+            return match(
+                b, [](int) { return 1; }, [](long) { return 2; }, otherwise([] { return -1; }));
+        };
+        REQUIRE(overlapping() == 1);
+        b = 1l;
+        REQUIRE(overlapping() == 2);
+        b = short(1);
+        REQUIRE(overlapping() == 1);
+        b = std::string("a");
+        REQUIRE(overlapping() == -1);
+
+        // only the wildcard
+        REQUIRE(match(a, otherwise([] { return 7; })) == 7);
+    }
 }
@@ -0,0 +1,174 @@
+// Copyright (C) 2016-2017 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/wire_format.hpp>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace type_safe;
+
+namespace
+{
+    enum class permission
+    {
+        read,
+        write,
+        execute,
+        _flag_set_size
+    };
+
+    enum class big_flags
+    {
+        first,
+        last = 99,
+        _flag_set_size
+    };
+
+    struct id : strong_typedef<id, std::uint32_t>, strong_typedef_op::equality_comparison<id>
+    {
+        using strong_typedef::strong_typedef;
+    };
+
+    using value   = variant<nullvar_t, std::int16_t, double, id>;
+    using message = optional<value>;
+
+    template <typename T>
+    std::vector<unsigned char> encode(const T& obj)
+    {
+        std::vector<unsigned char> buffer(wire_size<T>());
+        REQUIRE(write_wire(array_ref<unsigned char>(buffer.data(), buffer.size()), obj)
+                == buffer.size());
+        return buffer;
+    }
+
+    array_ref<const unsigned char> bytes_of(const std::vector<unsigned char>& buffer)
+    {
+        return array_ref<const unsigned char>(buffer.data(), buffer.size());
+    }
+} // namespace
+
+TEST_CASE("wire_format")
+{
+    SECTION("scalars")
+    {
+        REQUIRE(wire_size<std::int32_t>() == 4u);
+        REQUIRE((encode(std::int32_t(-2)) == std::vector<unsigned char>{0xFE, 0xFF, 0xFF, 0xFF}));
+        REQUIRE((encode(std::uint16_t(0x1234)) == std::vector<unsigned char>{0x34, 0x12}));
+        REQUIRE((encode(true) == std::vector<unsigned char>{1u}));
+        REQUIRE((encode(permission::execute) == encode(int(permission::execute))));
+        REQUIRE((encode(1.0f) == std::vector<unsigned char>{0x00, 0x00, 0x80, 0x3F}));
+
+        REQUIRE(wire_view<std::int32_t>(bytes_of(encode(std::int32_t(-2)))).get() == -2);
+        REQUIRE(wire_view<double>(bytes_of(encode(0.5))).get() == 0.5);
+        REQUIRE(wire_view<permission>(bytes_of(encode(permission::write))).get()
+                == permission::write);
+
+        REQUIRE(encode(integer<std::int32_t>(-2)) == encode(std::int32_t(-2)));
+        REQUIRE(wire_view<integer<std::int32_t>>(bytes_of(encode(std::int32_t(-2)))).get().get()
+                == -2);
+        REQUIRE(wire_view<floating_point<double>>(bytes_of(encode(0.5))).get().get() == 0.5);
+        REQUIRE(static_cast<bool>(wire_view<boolean>(bytes_of(encode(true))).get()));
+    }
+    SECTION("strong_typedef")
+    {
+        REQUIRE(wire_size<id>() == 4u);
+        REQUIRE(encode(id(42u)) == encode(std::uint32_t(42u)));
+        REQUIRE(wire_view<id>(bytes_of(encode(id(42u)))).get() == id(42u));
+    }
+    SECTION("optional")
+    {
+        REQUIRE(wire_size<optional<std::uint16_t>>() == 3u);
+        REQUIRE((encode(optional<std::uint16_t>(std::uint16_t(0x1234u)))
+                 == std::vector<unsigned char>{1u, 0x34, 0x12}));
+        REQUIRE((encode(optional<std::uint16_t>()) == std::vector<unsigned char>{0u, 0u, 0u}));
+
+        auto buffer = encode(optional<std::uint16_t>(std::uint16_t(7u)));
+        wire_view<optional<std::uint16_t>> view(bytes_of(buffer));
+        REQUIRE(view.has_value());
+        REQUIRE(view.value().get() == 7u);
+        REQUIRE(view.get() == optional<std::uint16_t>(std::uint16_t(7u)));
+
+        buffer = encode(optional<std::uint16_t>());
+        wire_view<optional<std::uint16_t>> empty(bytes_of(buffer));
+        REQUIRE(!empty.has_value());
+        REQUIRE(!empty.get().has_value());
+    }
+    SECTION("variant")
+    {
+        // tag (1 byte) + double (8 byte)
+        REQUIRE(wire_size<value>() == 9u);
+        REQUIRE((encode(value(std::int16_t(-1)))
+                 == std::vector<unsigned char>{1u, 0xFF, 0xFF, 0u, 0u, 0u, 0u, 0u, 0u}));
+        REQUIRE((encode(value()) == std::vector<unsigned char>(9u, 0u)));
+
+        auto             buffer = encode(value(id(3u)));
+        wire_view<value> view(bytes_of(buffer));
+        REQUIRE(view.index() == 3u);
+        REQUIRE(view.has_value());
+        REQUIRE(view.has_value(variant_type<id>{}));
+        REQUIRE(!view.has_value(variant_type<double>{}));
+        REQUIRE(view.value(variant_type<id>{}).get() == id(3u));
+        REQUIRE(view.get() == value(id(3u)));
+
+        buffer = encode(value(2.5));
+        REQUIRE(wire_view<value>(bytes_of(buffer)).get() == value(2.5));
+
+        buffer = encode(value());
+        REQUIRE(!wire_view<value>(bytes_of(buffer)).get().has_value());
+
+        using never_empty = variant<int, double>;
+        buffer            = encode(never_empty(2.5));
+        REQUIRE(wire_view<never_empty>(bytes_of(buffer)).get() == never_empty(2.5));
+    }
+    SECTION("flag_set")
+    {
+        flag_set<permission> set(permission::read | permission::execute);
+        REQUIRE(wire_size<flag_set<permission>>() == 1u);
+        REQUIRE((encode(set) == std::vector<unsigned char>{0x05}));
+
+        auto                            buffer = encode(set);
+        wire_view<flag_set<permission>> view(bytes_of(buffer));
+        REQUIRE(view.is_set(permission::read));
+        REQUIRE(!view.is_set(permission::write));
+        REQUIRE(view.is_set(permission::execute));
+        REQUIRE(view.get() == set);
+
+        // bits without a flag are ignored
+        buffer[0] = 0xFF;
+        REQUIRE(view.get() == flag_set<permission>(combo(~flag_set<permission>())));
+
+        flag_set<big_flags> big(big_flags::first | big_flags::last);
+        REQUIRE(wire_size<flag_set<big_flags>>() == 16u);
+        buffer = encode(big);
+        REQUIRE(buffer[0] == 0x01);
+        REQUIRE(buffer[12] == 0x08);
+
+        wire_view<flag_set<big_flags>> big_view(bytes_of(buffer));
+        REQUIRE(big_view.is_set(big_flags::last));
+        REQUIRE(big_view.get() == big);
+
+        buffer[15] = 0xFF;
+        REQUIRE(big_view.get() == big);
+    }
+    SECTION("wire_array_view")
+    {
+        std::vector<unsigned char> buffer;
+        for (auto m : {message(), message(value(std::int16_t(1))), message(value(2.5))})
+        {
+            auto encoded = encode(m);
+            buffer.insert(buffer.end(), encoded.begin(), encoded.end());
+        }
+        buffer.push_back(0u); // incomplete trailing record
+
+        wire_array_view<message> records(bytes_of(buffer));
+        REQUIRE(records.size() == 3u);
+        REQUIRE(!records[0u].has_value());
+        REQUIRE(records[1u].value().value(variant_type<std::int16_t>{}).get() == 1);
+        REQUIRE(records[2u].value().has_value(variant_type<double>{}));
+        REQUIRE(records[2u].get().value() == value(2.5));
+    }
+}